@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import re
+import shlex
+import statistics
+import subprocess
+from pathlib import Path
+
+
+def uleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def sleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        done = (value == 0 and not (byte & 0x40)) or (value == -1 and (byte & 0x40))
+        out.append(byte if done else byte | 0x80)
+        if done:
+            return bytes(out)
+
+
+def section(section_id: int, payload: bytes) -> bytes:
+    return bytes([section_id]) + uleb128(len(payload)) + payload
+
+
+def vec(items: list[bytes]) -> bytes:
+    return uleb128(len(items)) + b"".join(items)
+
+
+def build_module(func_count: int) -> bytes:
+    # type 0: () -> ()        used by _start
+    # type 1: (i32) -> (i32)  used by every generated worker function
+    types = vec([b"\x60\x00\x00", b"\x60\x01\x7f\x01\x7f"])
+    functions = vec([uleb128(1) for _ in range(func_count)] + [uleb128(0)])
+    exports = vec([uleb128(len(b"_start")) + b"_start" + b"\x00" + uleb128(func_count)])
+
+    bodies: list[bytes] = []
+    for i in range(func_count):
+        # local.get 0; i32.const i; i32.mul; i32.const i+1; i32.add
+        code = b"\x20\x00\x41" + sleb128(i) + b"\x6c\x41" + sleb128(i + 1) + b"\x6a\x0b"
+        body = b"\x00" + code
+        bodies.append(uleb128(len(body)) + body)
+
+    # _start calls every worker once so each one is lazily materialized exactly once.
+    start_code = bytearray(b"\x00")
+    for i in range(func_count):
+        start_code += b"\x41" + sleb128(i) + b"\x10" + uleb128(i) + b"\x1a"
+    start_code += b"\x0b"
+    bodies.append(uleb128(len(start_code)) + bytes(start_code))
+
+    return (b"\x00asm\x01\x00\x00\x00" + section(1, types) + section(3, functions) + section(7, exports) +
+            section(10, vec(bodies)))
+
+
+def run_case(label: str, uwvm: str, wasm_path: Path, log_path: Path, extra_args: list[str]) -> dict[str, float] | None:
+    argv = [uwvm, "-Rcm", "lazy", "-Rcc", "jit", "-Rllvm-cache-path", "disable", "-Rclog", "file", str(log_path), *extra_args, "--run",
+            str(wasm_path)]
+    print(">> " + " ".join(shlex.quote(x) for x in argv))
+    log_path.unlink(missing_ok=True)
+
+    proc = subprocess.Popen(argv, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    _, status, rusage = os.wait4(proc.pid, 0)
+    if os.waitstatus_to_exitcode(status) != 0:
+        print(f"  {label}: uwvm exited with status {os.waitstatus_to_exitcode(status)}")
+        return None
+
+    times: list[float] = []
+    session_modules = 0
+    for line in log_path.read_text(errors="replace").splitlines():
+        if "[llvm-jit-lazy] compile-end" not in line:
+            continue
+        t = re.search(r"time=([0-9.]+)", line)
+        if t:
+            times.append(float(t.group(1)))
+        m = re.search(r"session_modules=([0-9]+)", line)
+        if m:
+            session_modules = max(session_modules, int(m.group(1)))
+
+    if not times:
+        print(f"  {label}: no compile-end records found in {log_path}")
+        return None
+
+    # ru_maxrss is KiB on Linux and bytes on macOS.
+    max_rss_kib = rusage.ru_maxrss / 1024.0 if os.uname().sysname == "Darwin" else float(rusage.ru_maxrss)
+    return {
+        "groups": float(len(times)),
+        "median_us": statistics.median(times) * 1e6,
+        "p90_us": (statistics.quantiles(times, n=10)[-1] if len(times) >= 2 else times[0]) * 1e6,
+        "total_ms": sum(times) * 1e3,
+        "max_rss_mib": max_rss_kib / 1024.0,
+        "session_modules": float(session_modules),
+    }
+
+
+def main() -> int:
+    script_path = Path(__file__).resolve()
+    script_dir = script_path.parent
+
+    output_dir = script_dir / "outputs"
+    output_dir.mkdir(parents=True, exist_ok=True)
+
+    func_count = int(os.environ.get("FUNCS", "20000"))
+    uwvm = os.environ.get("UWVM", "uwvm")
+    uwvm_baseline = os.environ.get("UWVM_BASELINE")
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    wasm_path = output_dir / f"lazy_session_{func_count}.wasm"
+    wasm_path.write_bytes(build_module(func_count))
+
+    print("uwvm2 lazy LLVM JIT session benchmark (Python driver)")
+    print(f"  functions  = {func_count}")
+    print(f"  uwvm       = {uwvm}")
+    print(f"  baseline   = {uwvm_baseline or '<none>'}")
+    print(f"  output_dir = {output_dir}")
+
+    cases: list[tuple[str, str]] = []
+    if uwvm_baseline:
+        cases.append(("baseline", uwvm_baseline))
+    cases.append(("current", uwvm))
+
+    results: dict[str, dict[str, float]] = {}
+    for label, binary in cases:
+        result = run_case(label, binary, wasm_path, output_dir / f"{label}.log", extra_args)
+        if result is not None:
+            results[label] = result
+
+    print()
+    print("=" * 80)
+    print("Lazy materialization latency (per compile group) and peak resident memory")
+    print("=" * 80)
+    for label, result in results.items():
+        print(f"  {label:9s}: groups={int(result['groups'])} median={result['median_us']:.1f}us p90={result['p90_us']:.1f}us "
+              f"total={result['total_ms']:.1f}ms max_rss={result['max_rss_mib']:.1f}MiB session_modules={int(result['session_modules'])}")
+
+    base = results.get("baseline")
+    curr = results.get("current")
+    if base is not None and curr is not None:
+        print()
+        print(f"  median latency ratio (current / baseline): {curr['median_us'] / base['median_us']:.3f}  ( <1 means faster )")
+        print(f"  max RSS ratio        (current / baseline): {curr['max_rss_mib'] / base['max_rss_mib']:.3f}  ( <1 means smaller )")
+
+    print()
+    print("Done.")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
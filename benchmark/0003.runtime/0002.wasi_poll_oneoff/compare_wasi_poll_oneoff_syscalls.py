@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import shutil
+import subprocess
+from pathlib import Path
+
+# Syscalls that the Linux poll_oneoff backend issues; everything else the process does is reported as "other".
+POLL_SYSCALLS = ("epoll_create1", "epoll_create", "epoll_ctl", "epoll_wait", "epoll_pwait", "timerfd_create", "timerfd_settime", "close")
+
+
+def uleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def sleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        done = (value == 0 and not (byte & 0x40)) or (value == -1 and (byte & 0x40))
+        out.append(byte if done else byte | 0x80)
+        if done:
+            return bytes(out)
+
+
+def section(section_id: int, payload: bytes) -> bytes:
+    return bytes([section_id]) + uleb128(len(payload)) + payload
+
+
+def vec(items: list[bytes]) -> bytes:
+    return uleb128(len(items)) + b"".join(items)
+
+
+def name(text: str) -> bytes:
+    return uleb128(len(text)) + text.encode()
+
+
+def subscription(userdata: int, tag: int, union: bytes) -> bytes:
+    # wasm32 subscription_t: userdata u64, tag u8 (+7 padding), 32-byte union
+    return userdata.to_bytes(8, "little") + bytes([tag]) + bytes(7) + union.ljust(32, b"\x00")
+
+
+def build_module(calls: int) -> bytes:
+    # fd_write readiness on stdout (always ready on a pipe) plus a 1s monotonic clock that never fires:
+    # every call goes through the epoll path and returns with one event.
+    subs = (subscription(1, 2, (1).to_bytes(4, "little")) +
+            subscription(2, 0, (1).to_bytes(4, "little") + bytes(4) + (1_000_000_000).to_bytes(8, "little") + bytes(8) + bytes(2)))
+
+    # type 0: (i32 i32 i32 i32) -> i32  poll_oneoff
+    # type 1: () -> ()                  _start
+    types = vec([b"\x60\x04\x7f\x7f\x7f\x7f\x01\x7f", b"\x60\x00\x00"])
+    imports = vec([name("wasi_snapshot_preview1") + name("poll_oneoff") + b"\x00" + uleb128(0)])
+    functions = vec([uleb128(1)])
+    memory = vec([b"\x00\x01"])
+    exports = vec([name("_start") + b"\x00" + uleb128(1), name("memory") + b"\x02" + uleb128(0)])
+
+    # (local i32) loop: poll_oneoff(0, 256, 2, 512); drop; local0 += 1; br_if local0 != calls
+    code = bytearray(b"\x01\x01\x7f")
+    code += b"\x03\x40"
+    code += b"\x41\x00\x41" + sleb128(256) + b"\x41\x02\x41" + sleb128(512) + b"\x10\x00\x1a"
+    code += b"\x20\x00\x41\x01\x6a\x22\x00"
+    code += b"\x41" + sleb128(calls) + b"\x47\x0d\x00"
+    code += b"\x0b\x0b"
+    bodies = vec([uleb128(len(code)) + bytes(code)])
+
+    datas = vec([b"\x00\x41\x00\x0b" + uleb128(len(subs)) + subs])
+
+    return (b"\x00asm\x01\x00\x00\x00" + section(1, types) + section(2, imports) + section(3, functions) + section(5, memory) +
+            section(7, exports) + section(10, bodies) + section(11, datas))
+
+
+def count_syscalls(label: str, uwvm: str, wasm_path: Path, summary_path: Path, extra_args: list[str]) -> dict[str, int] | None:
+    argv = ["strace", "-f", "-c", "-o", str(summary_path), uwvm, *extra_args, "--run", str(wasm_path)]
+    print(">> " + " ".join(shlex.quote(x) for x in argv))
+
+    # stdout has to be something epoll accepts; /dev/null and regular files are rejected with EPERM.
+    proc = subprocess.run(argv, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    if proc.returncode != 0:
+        print(f"  {label}: exited with status {proc.returncode}")
+        return None
+
+    counts: dict[str, int] = {}
+    for line in summary_path.read_text(errors="replace").splitlines():
+        parts = line.split()
+        # % time, seconds, usecs/call, calls, [errors,] syscall
+        if len(parts) < 5 or not parts[3].isdigit() or parts[-1] == "total":
+            continue
+        counts[parts[-1]] = counts.get(parts[-1], 0) + int(parts[3])
+    return counts
+
+
+def per_call(label: str, uwvm: str, output_dir: Path, calls: int, extra_args: list[str]) -> dict[str, float] | None:
+    # Startup and teardown cancel out in the difference between a run with `calls` polls and one with twice as many.
+    runs: list[dict[str, int]] = []
+    for n in (calls, calls * 2):
+        wasm_path = output_dir / f"poll_oneoff_{n}.wasm"
+        wasm_path.write_bytes(build_module(n))
+        counts = count_syscalls(label, uwvm, wasm_path, output_dir / f"{label}_{n}.strace", extra_args)
+        if counts is None:
+            return None
+        runs.append(counts)
+
+    result: dict[str, float] = {}
+    names = set(runs[0]) | set(runs[1])
+    for syscall in names:
+        delta = (runs[1].get(syscall, 0) - runs[0].get(syscall, 0)) / calls
+        key = syscall if syscall in POLL_SYSCALLS else "other"
+        result[key] = result.get(key, 0.0) + delta
+    result["total"] = sum(v for k, v in result.items())
+    return result
+
+
+def main() -> int:
+    script_path = Path(__file__).resolve()
+    script_dir = script_path.parent
+
+    output_dir = script_dir / "outputs"
+    output_dir.mkdir(parents=True, exist_ok=True)
+
+    if shutil.which("strace") is None:
+        print("strace is required")
+        return 1
+
+    calls = int(os.environ.get("CALLS", "20000"))
+    uwvm = os.environ.get("UWVM", "uwvm")
+    uwvm_baseline = os.environ.get("UWVM_BASELINE")
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    print("uwvm2 WASI poll_oneoff syscall benchmark (Python driver)")
+    print(f"  calls      = {calls}")
+    print(f"  uwvm       = {uwvm}")
+    print(f"  baseline   = {uwvm_baseline or '<none>'}")
+    print(f"  output_dir = {output_dir}")
+
+    cases: list[tuple[str, str]] = []
+    if uwvm_baseline:
+        cases.append(("baseline", uwvm_baseline))
+    cases.append(("current", uwvm))
+
+    results: dict[str, dict[str, float]] = {}
+    for label, binary in cases:
+        result = per_call(label, binary, output_dir, calls, extra_args)
+        if result is not None:
+            results[label] = result
+
+    print()
+    print("=" * 80)
+    print("Syscalls per poll_oneoff call (fd_write on stdout + 1s monotonic clock)")
+    print("=" * 80)
+    for label, result in results.items():
+        detail = " ".join(f"{k}={v:.2f}" for k, v in sorted(result.items()) if k != "total" and abs(v) >= 0.005)
+        print(f"  {label:9s}: total={result['total']:.2f}  {detail}")
+
+    base = results.get("baseline")
+    curr = results.get("current")
+    if base is not None and curr is not None and base["total"] > 0:
+        print()
+        print(f"  syscall ratio (current / baseline): {curr['total'] / base['total']:.3f}  ( <1 means fewer )")
+
+    print()
+    print("Done.")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import os
+import shlex
+import subprocess
+import time
+from pathlib import Path
+
+MODES = ("off", "on", "sqpoll")
+
+
+def uleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def sleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        done = (value == 0 and not (byte & 0x40)) or (value == -1 and (byte & 0x40))
+        out.append(byte if done else byte | 0x80)
+        if done:
+            return bytes(out)
+
+
+def section(section_id: int, payload: bytes) -> bytes:
+    return bytes([section_id]) + uleb128(len(payload)) + payload
+
+
+def vec(items: list[bytes]) -> bytes:
+    return uleb128(len(items)) + b"".join(items)
+
+
+def name(text: str) -> bytes:
+    return uleb128(len(text)) + text.encode()
+
+
+def build_module(code: bytes, data: bytes, pages: int) -> bytes:
+    # type 0: (i32 i32 i32 i32) -> i32  fd_write / fd_read
+    # type 1: () -> ()                  _start
+    types = vec([b"\x60\x04\x7f\x7f\x7f\x7f\x01\x7f", b"\x60\x00\x00"])
+    imports = vec([name("wasi_snapshot_preview1") + name("fd_write") + b"\x00" + uleb128(0),
+                   name("wasi_snapshot_preview1") + name("fd_read") + b"\x00" + uleb128(0)])
+    functions = vec([uleb128(1)])
+    memory = vec([b"\x00" + uleb128(pages)])
+    exports = vec([name("_start") + b"\x00" + uleb128(2), name("memory") + b"\x02" + uleb128(0)])
+    bodies = vec([uleb128(len(code)) + code])
+    datas = vec([b"\x00\x41\x00\x0b" + uleb128(len(data)) + data])
+
+    return (b"\x00asm\x01\x00\x00\x00" + section(1, types) + section(2, imports) + section(3, functions) + section(5, memory) +
+            section(7, exports) + section(10, bodies) + section(11, datas))
+
+
+def build_log_module(lines: int) -> bytes:
+    # Writes one short line to stdout per fd_write, `lines` times: the shape of a guest that logs a lot.
+    line = b"[info] request handled in 42us, status=200, bytes=1024\n"
+    data = (64).to_bytes(4, "little") + len(line).to_bytes(4, "little")
+    data = data.ljust(64, b"\x00") + line
+
+    # (local i32) loop: fd_write(1, 0, 1, 16); drop; local0 += 1; br_if local0 != lines
+    code = bytearray(b"\x01\x01\x7f")
+    code += b"\x03\x40"
+    code += b"\x41\x01\x41\x00\x41\x01\x41\x10\x10\x00\x1a"
+    code += b"\x20\x00\x41\x01\x6a\x22\x00"
+    code += b"\x41" + sleb128(lines) + b"\x47\x0d\x00"
+    code += b"\x0b\x0b"
+    return build_module(bytes(code), data, 1)
+
+
+def build_copy_module() -> bytes:
+    # Copies stdin to stdout in 64 KiB fd_read/fd_write pairs until end of file: the shape of a file-copy guest.
+    chunk = 65536
+    data = chunk.to_bytes(4, "little") + chunk.to_bytes(4, "little")
+
+    # (local i32) block loop
+    #   br_if 1 fd_read(0, 0, 1, 16)
+    #   local0 = load(16); br_if 1 local0 == 0
+    #   store(4, local0); drop fd_write(1, 0, 1, 20); store(4, chunk); br 0
+    code = bytearray(b"\x01\x01\x7f")
+    code += b"\x02\x40\x03\x40"
+    code += b"\x41\x00\x41\x00\x41\x01\x41\x10\x10\x01\x0d\x01"
+    code += b"\x41\x10\x28\x02\x00\x22\x00\x45\x0d\x01"
+    code += b"\x41\x04\x20\x00\x36\x02\x00"
+    code += b"\x41\x01\x41\x00\x41\x01\x41\x14\x10\x00\x1a"
+    code += b"\x41\x04\x41" + sleb128(chunk) + b"\x36\x02\x00"
+    code += b"\x0c\x00"
+    code += b"\x0b\x0b\x0b"
+    return build_module(bytes(code), data, 2)
+
+
+def run_once(uwvm: str, mode: str, wasm_path: Path, stdin_path: Path | None, stdout_path: Path, extra_args: list[str]) -> float | None:
+    argv = [uwvm, "--wasip1-global-io-uring", mode, *extra_args, "--run", str(wasm_path)]
+    stdin = stdin_path.open("rb") if stdin_path is not None else subprocess.DEVNULL
+    try:
+        with stdout_path.open("wb") as stdout:
+            start = time.perf_counter()
+            proc = subprocess.run(argv, stdin=stdin, stdout=stdout, stderr=subprocess.DEVNULL)
+            elapsed = time.perf_counter() - start
+    finally:
+        if stdin_path is not None:
+            stdin.close()
+
+    if proc.returncode != 0:
+        print(f"  {mode}: exited with status {proc.returncode} (" + " ".join(shlex.quote(x) for x in argv) + ")")
+        return None
+    return elapsed
+
+
+def best_of(uwvm: str, mode: str, wasm_path: Path, stdin_path: Path | None, stdout_path: Path, extra_args: list[str], repeat: int,
+            expected_size: int) -> float | None:
+    best: float | None = None
+    for _ in range(repeat):
+        elapsed = run_once(uwvm, mode, wasm_path, stdin_path, stdout_path, extra_args)
+        if elapsed is None:
+            return None
+        if stdout_path.stat().st_size != expected_size:
+            print(f"  {mode}: wrote {stdout_path.stat().st_size} bytes, expected {expected_size}")
+            return None
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def main() -> int:
+    script_path = Path(__file__).resolve()
+    script_dir = script_path.parent
+
+    output_dir = script_dir / "outputs"
+    output_dir.mkdir(parents=True, exist_ok=True)
+
+    uwvm = os.environ.get("UWVM", "uwvm")
+    lines = int(os.environ.get("LINES", "200000"))
+    copy_mib = int(os.environ.get("COPY_MIB", "256"))
+    repeat = int(os.environ.get("REPEAT", "5"))
+    extra_args = shlex.split(os.environ.get("UWVM_ARGS", ""))
+
+    print("uwvm2 WASI io_uring benchmark (Python driver)")
+    print(f"  uwvm       = {uwvm}")
+    print(f"  lines      = {lines}")
+    print(f"  copy_mib   = {copy_mib}")
+    print(f"  repeat     = {repeat}")
+    print(f"  output_dir = {output_dir}")
+
+    log_wasm = output_dir / "log.wasm"
+    log_wasm.write_bytes(build_log_module(lines))
+    log_size = lines * len(b"[info] request handled in 42us, status=200, bytes=1024\n")
+
+    copy_wasm = output_dir / "copy.wasm"
+    copy_wasm.write_bytes(build_copy_module())
+    copy_input = output_dir / "copy_input.bin"
+    copy_size = copy_mib * 1024 * 1024
+    if not copy_input.exists() or copy_input.stat().st_size != copy_size:
+        block = bytes(range(256)) * 4096
+        with copy_input.open("wb") as f:
+            for _ in range(copy_mib):
+                f.write(block)
+
+    results: dict[str, dict[str, float]] = {"log": {}, "copy": {}}
+    for mode in MODES:
+        t = best_of(uwvm, mode, log_wasm, None, output_dir / f"log_{mode}.out", extra_args, repeat, log_size)
+        if t is not None:
+            results["log"][mode] = t
+        t = best_of(uwvm, mode, copy_wasm, copy_input, output_dir / f"copy_{mode}.out", extra_args, repeat, copy_size)
+        if t is not None:
+            results["copy"][mode] = t
+
+    print()
+    print("=" * 80)
+    print("Best wall time per guest and --wasip1-global-io-uring mode")
+    print("=" * 80)
+    for guest, per_mode in results.items():
+        base = per_mode.get("off")
+        for mode, t in per_mode.items():
+            ratio = f"  ({t / base:.3f}x of off)" if base and mode != "off" else ""
+            print(f"  {guest:4s} {mode:6s}: {t * 1000.0:9.1f} ms{ratio}")
+
+    print()
+    print("Done.")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
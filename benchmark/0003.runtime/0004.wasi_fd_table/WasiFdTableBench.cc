@@ -0,0 +1,229 @@
+﻿// WasiFdTableBench.cc
+//
+// Multi-threaded fd-table benchmark for the WASI Preview 1 host functions.
+// - Part 1 times the table lock alone: `rwlock_t` with `rw_fair_*` guards (the previous fd-table lock) against `sharded_rwlock_t`,
+//   with one write per `WRITE_PERIOD` acquisitions, the way path_open / fd_close interleave with I/O calls.
+// - Part 2 runs `fd_write` of one byte to /dev/null from several threads on one shared environment, each thread on its own fd, while
+//   one extra thread opens and closes a file in a loop. Only the fd table is shared, so the time per call shows what the table costs.
+
+#include <uwvm2/utils/mutex/impl.h>
+#include <uwvm2/utils/debug/timer.h>
+#include <uwvm2/imported/wasi/wasip1/func/fd_write.h>
+#include <uwvm2/imported/wasi/wasip1/func/path_open.h>
+#include <uwvm2/imported/wasi/wasip1/func/fd_close.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    inline constexpr std::size_t thread_counts[]{1uz, 2uz, 4uz, 8uz, 16uz};
+    inline constexpr std::size_t lock_iters_per_thread{2000000uz};
+    inline constexpr std::size_t write_iters_per_thread{200000uz};
+    inline constexpr std::size_t write_period{1024uz};
+
+    template <typename Lock, typename SharedGuard, typename UniqueGuard>
+    void bench_table_lock(std::size_t thread_count)
+    {
+        Lock lock{};
+        std::size_t table_size{};  // stands in for the fd vector
+        std::atomic_size_t sink{};
+
+        auto worker = [&](std::size_t tid)
+        {
+            std::size_t local{};
+            for(std::size_t i{}; i < lock_iters_per_thread; ++i)
+            {
+                if((i + tid) % write_period == 0uz)
+                {
+                    UniqueGuard g{lock};
+                    ++table_size;
+                }
+                else
+                {
+                    SharedGuard g{lock};
+                    local += table_size;
+                }
+            }
+            sink.fetch_add(local, std::memory_order_relaxed);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        for(std::size_t i{}; i < thread_count; ++i) { threads.emplace_back(worker, i); }
+        for(auto& t: threads) { t.join(); }
+    }
+
+    using ::uwvm2::imported::wasi::wasip1::abi::errno_t;
+    using ::uwvm2::imported::wasi::wasip1::abi::fdflags_t;
+    using ::uwvm2::imported::wasi::wasip1::abi::lookupflags_t;
+    using ::uwvm2::imported::wasi::wasip1::abi::oflags_t;
+    using ::uwvm2::imported::wasi::wasip1::abi::rights_t;
+    using ::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t;
+    using ::uwvm2::imported::wasi::wasip1::abi::wasi_size_t;
+    using ::uwvm2::imported::wasi::wasip1::abi::wasi_void_ptr_t;
+    using ::uwvm2::imported::wasi::wasip1::environment::wasip1_environment;
+    using ::uwvm2::object::memory::linear::native_memory_t;
+
+    // Guest memory layout: one payload byte, then one iovec and one nwritten slot per thread.
+    inline constexpr wasi_void_ptr_t payload_ptr{64u};
+    inline constexpr wasi_void_ptr_t path_ptr{128u};
+    inline constexpr wasi_void_ptr_t open_fd_ptr{192u};
+    inline constexpr wasi_void_ptr_t per_thread_base{256u};
+    inline constexpr wasi_void_ptr_t per_thread_stride{16u};
+    inline constexpr std::size_t first_io_fd{4uz};
+
+    void bench_fd_write(std::size_t thread_count)
+    {
+        native_memory_t memory{};
+        memory.init_by_page_count(1uz);
+
+        wasip1_environment<native_memory_t> env{.wasip1_memory = ::std::addressof(memory),
+                                                .argv = {},
+                                                .envs = {},
+                                                .fd_storage = {.fd_limit = 1024uz},
+                                                .mount_dir_roots = {},
+                                                .trace_wasip1_call = false};
+
+        env.fd_storage.opens.resize(first_io_fd + thread_count);
+
+        // fd 3: the current directory, for the open/close thread.
+        {
+            auto& fd = *env.fd_storage.opens.index_unchecked(3uz).fd_p;
+            fd.rights_base = static_cast<rights_t>(-1);
+            fd.rights_inherit = static_cast<rights_t>(-1);
+            fd.wasi_fd.ptr->wasi_fd_storage.reset_type(::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::dir);
+            ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t entry{};
+            entry.ptr->dir_stack.storage.file = ::fast_io::dir_file{u8"."};
+            fd.wasi_fd.ptr->wasi_fd_storage.storage.dir_stack.dir_stack.push_back(::std::move(entry));
+        }
+
+        // fds 4..: /dev/null, one per writer thread.
+        for(std::size_t i{}; i < thread_count; ++i)
+        {
+            auto& fd = *env.fd_storage.opens.index_unchecked(first_io_fd + i).fd_p;
+            fd.rights_base = static_cast<rights_t>(-1);
+            fd.rights_inherit = static_cast<rights_t>(-1);
+            fd.wasi_fd.ptr->wasi_fd_storage.reset_type(::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::file);
+            fd.wasi_fd.ptr->wasi_fd_storage.storage.file_fd = ::fast_io::native_file{u8"/dev/null", ::fast_io::open_mode::out};
+
+            auto const iov_ptr{static_cast<wasi_void_ptr_t>(per_thread_base + per_thread_stride * i)};
+            ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory, iov_ptr, payload_ptr);
+            ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory,
+                                                                                            static_cast<wasi_void_ptr_t>(iov_ptr + 4u),
+                                                                                            static_cast<wasi_size_t>(1u));
+        }
+
+        constexpr char8_t churn_name[]{u8"wasi_fd_table_bench.tmp"};
+        ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32(memory,
+                                                                            path_ptr,
+                                                                            reinterpret_cast<::std::byte const*>(churn_name),
+                                                                            reinterpret_cast<::std::byte const*>(churn_name) + sizeof(churn_name) - 1u);
+
+        std::atomic_bool stop_churn{};
+        std::atomic_bool failed{};
+
+        // Opens and closes one fd in a loop: every iteration takes the table lock exclusively twice.
+        std::thread churn{[&]
+                          {
+                              while(!stop_churn.load(std::memory_order_relaxed))
+                              {
+                                  auto const ret{::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                                                  static_cast<wasi_posix_fd_t>(3),
+                                                                                                  static_cast<lookupflags_t>(0),
+                                                                                                  path_ptr,
+                                                                                                  static_cast<wasi_size_t>(sizeof(churn_name) - 1u),
+                                                                                                  oflags_t::o_creat,
+                                                                                                  rights_t::right_fd_write,
+                                                                                                  static_cast<rights_t>(0),
+                                                                                                  static_cast<fdflags_t>(0),
+                                                                                                  open_fd_ptr)};
+                                  if(ret != errno_t::esuccess)
+                                  {
+                                      failed.store(true, std::memory_order_relaxed);
+                                      return;
+                                  }
+
+                                  wasi_posix_fd_t opened{};
+                                  ::uwvm2::imported::wasi::wasip1::memory::read_all_from_memory_wasm32(
+                                      memory,
+                                      open_fd_ptr,
+                                      reinterpret_cast<::std::byte*>(&opened),
+                                      reinterpret_cast<::std::byte*>(&opened) + sizeof(opened));
+                                  (void)::uwvm2::imported::wasi::wasip1::func::fd_close(env, opened);
+                              }
+                          }};
+
+        auto worker = [&](std::size_t tid)
+        {
+            auto const fd{static_cast<wasi_posix_fd_t>(first_io_fd + tid)};
+            auto const iov_ptr{static_cast<wasi_void_ptr_t>(per_thread_base + per_thread_stride * tid)};
+            auto const nwritten_ptr{static_cast<wasi_void_ptr_t>(iov_ptr + 8u)};
+
+            for(std::size_t i{}; i < write_iters_per_thread; ++i)
+            {
+                if(::uwvm2::imported::wasi::wasip1::func::fd_write(env, fd, iov_ptr, static_cast<wasi_size_t>(1u), nwritten_ptr) != errno_t::esuccess)
+                {
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        };
+
+        {
+            ::uwvm2::utils::debug::timer t{u8"fd_write x threads (with open/close thread)"};
+
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count);
+            for(std::size_t i{}; i < thread_count; ++i) { threads.emplace_back(worker, i); }
+            for(auto& th: threads) { th.join(); }
+        }
+
+        stop_churn.store(true, std::memory_order_relaxed);
+        churn.join();
+
+        try
+        {
+            ::fast_io::native_unlinkat(::fast_io::at_fdcwd(), ::fast_io::mnp::os_c_str(churn_name), {});
+        }
+        catch(::fast_io::error)
+        {
+        }
+
+        if(failed.load(std::memory_order_relaxed)) { std::fputs("fd_write benchmark: a WASI call failed\n", stderr); }
+    }
+}  // namespace
+
+int main()
+{
+    for(auto const thread_count: thread_counts)
+    {
+        std::printf("\n== threads: %zu ==\n", thread_count);
+        std::fflush(stdout);
+
+        {
+            ::uwvm2::utils::debug::timer t{u8"table lock: rwlock_t + rw_fair_*"};
+            bench_table_lock<::uwvm2::utils::mutex::rwlock_t, ::uwvm2::utils::mutex::rw_fair_shared_guard_t, ::uwvm2::utils::mutex::rw_fair_unique_guard_t>(
+                thread_count);
+        }
+
+        {
+            ::uwvm2::utils::debug::timer t{u8"table lock: sharded_rwlock_t"};
+            bench_table_lock<::uwvm2::utils::mutex::sharded_rwlock_t,
+                             ::uwvm2::utils::mutex::rw_sharded_shared_guard_t,
+                             ::uwvm2::utils::mutex::rw_sharded_unique_guard_t>(thread_count);
+        }
+
+        bench_fd_write(thread_count);
+    }
+
+    return 0;
+}
+
+// From project root (Linux):
+// g++ benchmark/0003.runtime/0004.wasi_fd_table/WasiFdTableBench.cc -o benchmark/0003.runtime/0004.wasi_fd_table/WasiFdTableBench -std=c++26 -O3
+// -march=native -fno-rtti -I src -I third-parties/fast_io/include -I third-parties/bizwen/include -I third-parties/boost_unordered/include
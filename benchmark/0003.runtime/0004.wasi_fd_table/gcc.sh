@@ -0,0 +1,5 @@
+#!/usr/bin/env bash
+
+set -e
+
+g++ -o WasiFdTableBench WasiFdTableBench.cc -std=c++26 -O3 -march=native -fno-rtti -pthread -I ../../../src -I ../../../third-parties/fast_io/include -I ../../../third-parties/bizwen/include -I ../../../third-parties/boost_unordered/include
@@ -137,6 +137,9 @@ typedef size_t (*uwvm_preload_memory_descriptor_count_t)(void);
 typedef bool (*uwvm_preload_memory_descriptor_at_t)(size_t, uwvm_preload_memory_descriptor_t*);
 typedef bool (*uwvm_preload_memory_read_t)(size_t, uint_least64_t, void*, size_t);
 typedef bool (*uwvm_preload_memory_write_t)(size_t, uint_least64_t, void const*, size_t);
+typedef bool (*uwvm_preload_memory_discard_t)(size_t, uint_least64_t, size_t);
+typedef void (*uwvm_preload_epoch_increment_t)(void);
+typedef void (*uwvm_preload_epoch_set_deadline_t)(uint_least64_t);
 
 typedef struct uwvm_preload_host_api_v1_def
 {
@@ -146,6 +149,9 @@ typedef struct uwvm_preload_host_api_v1_def
     uwvm_preload_memory_descriptor_at_t memory_descriptor_at;
     uwvm_preload_memory_read_t memory_read;
     uwvm_preload_memory_write_t memory_write;
+    uwvm_preload_memory_discard_t memory_discard;
+    uwvm_preload_epoch_increment_t epoch_increment;
+    uwvm_preload_epoch_set_deadline_t epoch_set_deadline;
 } uwvm_preload_host_api_v1;
 
 typedef void (*uwvm_set_preload_host_api_v1_t)(uwvm_preload_host_api_v1 const*);
@@ -44,6 +44,9 @@ import uwvm2.object.memory;
 import uwvm2.imported.wasi.wasip1.abi;
 import uwvm2.imported.wasi.wasip1.fd_manager;
 import uwvm2.imported.wasi.wasip1.memory;
+import :poll_reactor;
+import :io_uring;
+import :path_cache;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -45,6 +45,9 @@
 # include <uwvm2/imported/wasi/wasip1/abi/impl.h>
 # include <uwvm2/imported/wasi/wasip1/fd_manager/impl.h>
 # include <uwvm2/imported/wasi/wasip1/memory/impl.h>
+# include "poll_reactor.h"
+# include "io_uring.h"
+# include "path_cache.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -175,6 +178,21 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::environment
 
         ::uwvm2::imported::wasi::wasip1::fd_manager::wasm_fd_storage_t fd_storage{};  // [singleton]
 
+        /// @brief Epoll instance, registrations and scratch that poll_oneoff keeps across calls (empty where it has no reactor).
+        ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_t poll_reactor{};  // [singleton]
+
+        /// @brief io_uring used for this environment's I/O when `io_uring.mode` selects it; set up on first use.
+        ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_t io_uring{};  // [singleton]
+
+        /// @brief Host-side buffering of the guest's stdout/stderr; fds 1 and 2 point at these buffers through `wasi_fd_t::output_buffer` when the
+        ///        policy is not `off` and the stream is a pipe or regular file.
+        ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_config_t stdio_buffer_config{};
+        ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_t stdout_buffer{};  // [singleton]
+        ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_t stderr_buffer{};  // [singleton]
+
+        /// @brief Negative lookups and directory chains remembered by path_open/path_filestat_get when `path_cache.enabled` is set.
+        ::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_t path_cache{};  // [singleton]
+
         /// @brief Provide predefined wasi content, which is already opened during command-line processing (to prevent TOCTOU). Subsequent operations utilize
         ///        this content via dup.
         /// @note  For platforms that support dup, use dup; for platforms that do not support dup, use observer.
@@ -202,6 +220,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::environment
         bool disable_utf8_check{};
     };
 
+    /// @brief Flush the environment's stdout/stderr buffers in order (no-op when buffering is off).
+    /// @param may_block See `flush_wasi_fd_output_buffer_noexcept`; only trap paths pass false.
+    template <wasip1_memory memory_type>
+    inline constexpr void flush_wasip1_stdio_buffers(wasip1_environment<memory_type> & env, bool may_block) noexcept
+    {
+        ::uwvm2::imported::wasi::wasip1::fd_manager::flush_wasi_fd_output_buffer_noexcept(env.stdout_buffer, may_block);
+        ::uwvm2::imported::wasi::wasip1::fd_manager::flush_wasi_fd_output_buffer_noexcept(env.stderr_buffer, may_block);
+    }
+
 }  // namespace uwvm2::imported::wasi::wasip1::environment
 
 #ifndef UWVM_MODULE
@@ -22,6 +22,9 @@
 module;
 
 export module uwvm2.imported.wasi.wasip1.environment;
+export import :poll_reactor;
+export import :io_uring;
+export import :path_cache;
 export import :environment;
 
 #ifndef UWVM_MODULE
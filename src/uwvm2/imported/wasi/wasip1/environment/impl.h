@@ -22,5 +22,8 @@
 #pragma once
 
 #ifndef UWVM_MODULE
+# include "poll_reactor.h"
+# include "io_uring.h"
+# include "path_cache.h"
 # include "environment.h"
 #endif
@@ -0,0 +1,570 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @file        io_uring.h
+ * @brief       Optional io_uring execution path for wasip1 I/O on Linux.
+ * @details     One ring lives in each WASI environment and is set up on first use when `--wasip1-global-io-uring` selects it. fd_read, fd_write,
+ *              fd_pread, fd_pwrite, sock_recv and sock_send submit the `io_scatter_t` array they already built as one READV/WRITEV/RECVMSG/SENDMSG
+ *              entry; fd_sync and fd_datasync submit FSYNC; poll_oneoff waits that only involve the realtime or monotonic clock become one TIMEOUT.
+ *
+ *              Every guest call still completes before it returns, since nwritten/nread and the errno are part of the WASI result and the guest
+ *              may reuse its buffers right afterwards. With `on`, submit and wait share one io_uring_enter. With `sqpoll`, a kernel thread
+ *              drains the submission queue, so a run of independent requests (a series of fd_pwrite followed by fd_datasync, a log writer's
+ *              fd_write calls) is picked up without any io_uring_enter; the caller spins briefly on the completion queue before it falls back
+ *              to a GETEVENTS wait.
+ *
+ *              Whenever the ring cannot serve a request (mode off, setup refused by the kernel, seccomp or `kernel.io_uring_disabled`,
+ *              another thread using the ring), the helpers report `wasip1_io_uring_declined` or forward to the `fast_io` call the function
+ *              used before, so callers keep a single error mapping.
+ *
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <atomic>
+# include <limits>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(__linux__)
+#  include <errno.h>
+#  if __has_include(<sys/syscall.h>)
+#   include <sys/syscall.h>
+#  endif
+#  if __has_include(<sys/mman.h>)
+#   include <sys/mman.h>
+#  endif
+#  if __has_include(<sys/socket.h>)
+#   include <sys/socket.h>
+#  endif
+#  if __has_include(<linux/io_uring.h>)
+#   include <linux/io_uring.h>
+#  endif
+# endif
+// import
+# include <fast_io.h>
+# include <fast_io_device.h>
+# include <uwvm2/utils/mutex/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::environment
+{
+    enum class wasip1_io_uring_mode_t : unsigned
+    {
+        off = 0u,
+        on,
+        sqpoll
+    };
+
+    /// @brief Returned by the ring helpers when the request was not submitted and the caller must take its usual path.
+    inline constexpr ::std::ptrdiff_t wasip1_io_uring_declined{::std::numeric_limits<::std::ptrdiff_t>::min()};
+
+#if defined(__linux__) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_mmap) && defined(__NR_munmap) &&                       \
+    !defined(__NR_mmap2) && defined(IORING_OFF_SQ_RING) && defined(IORING_FEAT_RW_CUR_POS)
+
+    /// @brief Only one request is in flight at a time, so a small ring is enough.
+    inline constexpr unsigned wasip1_io_uring_entries{8u};
+
+    /// @brief Completion-queue polls in `sqpoll` mode before the caller sleeps in io_uring_enter.
+    inline constexpr unsigned wasip1_io_uring_sqpoll_spin{4096u};
+
+    enum class wasip1_io_uring_state_t : unsigned
+    {
+        untried = 0u,
+        ready,
+        unavailable
+    };
+
+    struct wasip1_io_uring_t
+    {
+        /// @brief Set from the command line before the guest starts; never changed afterwards.
+        wasip1_io_uring_mode_t mode{};
+
+        /// @brief Held for one request: submission, wait and reaping. Threads that find it held take the fast_io path instead.
+        ::uwvm2::utils::mutex::mutex_t ring_mutex{};
+
+        // Everything below is only touched with `ring_mutex` held.
+        wasip1_io_uring_state_t state{};
+        bool sqpoll{};
+
+        ::fast_io::posix_file ring_file{};
+
+        ::std::byte* sq_ring{};
+        ::std::size_t sq_ring_length{};
+        ::std::byte* cq_ring{};
+        ::std::size_t cq_ring_length{};
+        struct ::io_uring_sqe* sqes{};
+        ::std::size_t sqes_length{};
+
+        unsigned* sq_head{};
+        unsigned* sq_tail{};
+        unsigned* sq_flags{};
+        unsigned* sq_array{};
+        unsigned sq_mask{};
+
+        unsigned* cq_head{};
+        unsigned* cq_tail{};
+        struct ::io_uring_cqe* cqes{};
+        unsigned cq_mask{};
+
+        inline wasip1_io_uring_t() noexcept = default;
+
+        inline wasip1_io_uring_t(wasip1_io_uring_t const&) = delete;
+        inline wasip1_io_uring_t& operator= (wasip1_io_uring_t const&) = delete;
+
+        inline void unmap() noexcept
+        {
+            if(this->sqes != nullptr) { static_cast<void>(::fast_io::system_call<__NR_munmap, int>(this->sqes, this->sqes_length)); }
+            if(this->cq_ring != nullptr && this->cq_ring != this->sq_ring)
+            {
+                static_cast<void>(::fast_io::system_call<__NR_munmap, int>(this->cq_ring, this->cq_ring_length));
+            }
+            if(this->sq_ring != nullptr) { static_cast<void>(::fast_io::system_call<__NR_munmap, int>(this->sq_ring, this->sq_ring_length)); }
+
+            this->sqes = nullptr;
+            this->cq_ring = nullptr;
+            this->sq_ring = nullptr;
+        }
+
+        inline ~wasip1_io_uring_t() { this->unmap(); }
+    };
+
+    namespace details
+    {
+        [[nodiscard]] inline ::std::byte* wasip1_io_uring_map(int ring_fd, ::std::size_t length, ::std::uint_least64_t offset) noexcept
+        {
+            ::std::ptrdiff_t const view{::fast_io::system_call<__NR_mmap, ::std::ptrdiff_t>(nullptr,
+                                                                                          length,
+                                                                                          PROT_READ | PROT_WRITE,
+                                                                                          MAP_SHARED | MAP_POPULATE,
+                                                                                          ring_fd,
+                                                                                          static_cast<::std::ptrdiff_t>(offset))};
+            if(::fast_io::linux_system_call_fails(view)) [[unlikely]] { return nullptr; }
+            return reinterpret_cast<::std::byte*>(view);
+        }
+
+        [[nodiscard]] inline bool wasip1_io_uring_try_setup(wasip1_io_uring_t& ring, bool sqpoll) noexcept
+        {
+            struct ::io_uring_params params{};
+            if(sqpoll)
+            {
+                params.flags = IORING_SETUP_SQPOLL;
+                // The kernel thread parks after this many idle milliseconds; the next submission then needs one wakeup call.
+                params.sq_thread_idle = 50u;
+            }
+
+            int const ring_fd{::fast_io::system_call<__NR_io_uring_setup, int>(wasip1_io_uring_entries, ::std::addressof(params))};
+            if(::fast_io::linux_system_call_fails(ring_fd)) [[unlikely]] { return false; }
+
+            ::fast_io::posix_file ring_file{ring_fd};
+
+            // fd_read and fd_write rely on offset -1 meaning "the file position" (Linux 5.6).
+            if((params.features & IORING_FEAT_RW_CUR_POS) == 0u) [[unlikely]] { return false; }
+
+            ring.sq_ring_length = static_cast<::std::size_t>(params.sq_off.array) + params.sq_entries * sizeof(unsigned);
+            ring.cq_ring_length = static_cast<::std::size_t>(params.cq_off.cqes) + params.cq_entries * sizeof(struct ::io_uring_cqe);
+            ring.sqes_length = params.sq_entries * sizeof(struct ::io_uring_sqe);
+
+            bool const single_mmap{(params.features & IORING_FEAT_SINGLE_MMAP) != 0u};
+            if(single_mmap)
+            {
+                if(ring.cq_ring_length > ring.sq_ring_length) { ring.sq_ring_length = ring.cq_ring_length; }
+                ring.cq_ring_length = ring.sq_ring_length;
+            }
+
+            ring.sq_ring = wasip1_io_uring_map(ring_fd, ring.sq_ring_length, IORING_OFF_SQ_RING);
+            if(ring.sq_ring == nullptr) [[unlikely]] { return false; }
+
+            ring.cq_ring = single_mmap ? ring.sq_ring : wasip1_io_uring_map(ring_fd, ring.cq_ring_length, IORING_OFF_CQ_RING);
+            if(ring.cq_ring == nullptr) [[unlikely]]
+            {
+                ring.unmap();
+                return false;
+            }
+
+            ring.sqes = reinterpret_cast<struct ::io_uring_sqe*>(wasip1_io_uring_map(ring_fd, ring.sqes_length, IORING_OFF_SQES));
+            if(ring.sqes == nullptr) [[unlikely]]
+            {
+                ring.unmap();
+                return false;
+            }
+
+            ring.sq_head = reinterpret_cast<unsigned*>(ring.sq_ring + params.sq_off.head);
+            ring.sq_tail = reinterpret_cast<unsigned*>(ring.sq_ring + params.sq_off.tail);
+            ring.sq_flags = reinterpret_cast<unsigned*>(ring.sq_ring + params.sq_off.flags);
+            ring.sq_array = reinterpret_cast<unsigned*>(ring.sq_ring + params.sq_off.array);
+            ring.sq_mask = *reinterpret_cast<unsigned*>(ring.sq_ring + params.sq_off.ring_mask);
+
+            ring.cq_head = reinterpret_cast<unsigned*>(ring.cq_ring + params.cq_off.head);
+            ring.cq_tail = reinterpret_cast<unsigned*>(ring.cq_ring + params.cq_off.tail);
+            ring.cqes = reinterpret_cast<struct ::io_uring_cqe*>(ring.cq_ring + params.cq_off.cqes);
+            ring.cq_mask = *reinterpret_cast<unsigned*>(ring.cq_ring + params.cq_off.ring_mask);
+
+            ring.ring_file = ::std::move(ring_file);
+            ring.sqpoll = sqpoll;
+            return true;
+        }
+
+        /// @brief Set the ring up on first use. `sqpoll` falls back to a plain ring when the kernel refuses the SQ thread (pre-5.11 without
+        ///        CAP_SYS_ADMIN); a refused plain ring disables the backend for this environment.
+        [[nodiscard]] inline bool wasip1_io_uring_ensure(wasip1_io_uring_t& ring) noexcept
+        {
+            if(ring.state == wasip1_io_uring_state_t::ready) [[likely]] { return true; }
+            if(ring.state == wasip1_io_uring_state_t::unavailable) { return false; }
+
+            bool const ok{(ring.mode == wasip1_io_uring_mode_t::sqpoll && wasip1_io_uring_try_setup(ring, true)) || wasip1_io_uring_try_setup(ring, false)};
+            ring.state = ok ? wasip1_io_uring_state_t::ready : wasip1_io_uring_state_t::unavailable;
+            return ok;
+        }
+
+        [[nodiscard]] inline bool wasip1_io_uring_reap(wasip1_io_uring_t& ring, int& res) noexcept
+        {
+            // Single consumer: the head is only written here, with `ring_mutex` held.
+            unsigned const head{*ring.cq_head};
+            if(head == ::std::atomic_ref<unsigned>{*ring.cq_tail}.load(::std::memory_order_acquire)) { return false; }
+
+            res = ring.cqes[head & ring.cq_mask].res;
+            ::std::atomic_ref<unsigned>{*ring.cq_head}.store(head + 1u, ::std::memory_order_release);
+            return true;
+        }
+
+        /// @brief  Submit `sqe` and wait for its completion.
+        /// @return The CQE result (a byte count or a negated errno), or `wasip1_io_uring_declined` if the kernel never took the entry.
+        [[nodiscard]] inline ::std::ptrdiff_t wasip1_io_uring_run(wasip1_io_uring_t& ring, struct ::io_uring_sqe const& sqe) noexcept
+        {
+            unsigned const tail{*ring.sq_tail};
+            unsigned const index{tail & ring.sq_mask};
+            ring.sqes[index] = sqe;
+            ring.sq_array[index] = index;
+            ::std::atomic_ref<unsigned>{*ring.sq_tail}.store(tail + 1u, ::std::memory_order_release);
+
+            int res{};
+
+            if(ring.sqpoll)
+            {
+                // The SQ thread only needs a wakeup once it has gone idle.
+                ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+                if((::std::atomic_ref<unsigned>{*ring.sq_flags}.load(::std::memory_order_relaxed) & IORING_SQ_NEED_WAKEUP) != 0u)
+                {
+                    static_cast<void>(
+                        ::fast_io::system_call<__NR_io_uring_enter, int>(ring.ring_file.native_handle(), 0u, 0u, IORING_ENTER_SQ_WAKEUP, nullptr, 0uz));
+                }
+
+                for(unsigned spin{}; spin != wasip1_io_uring_sqpoll_spin; ++spin)
+                {
+                    if(wasip1_io_uring_reap(ring, res)) { return res; }
+                }
+            }
+
+            for(;;)
+            {
+                if(wasip1_io_uring_reap(ring, res)) { return res; }
+
+                // Submit the entry if the kernel has not consumed it yet, then sleep until a completion is posted.
+                unsigned const to_submit{ring.sqpoll ? 0u : (tail + 1u) - ::std::atomic_ref<unsigned>{*ring.sq_head}.load(::std::memory_order_acquire)};
+                unsigned enter_flags{IORING_ENTER_GETEVENTS};
+                if(ring.sqpoll && (::std::atomic_ref<unsigned>{*ring.sq_flags}.load(::std::memory_order_relaxed) & IORING_SQ_NEED_WAKEUP) != 0u)
+                {
+                    enter_flags |= IORING_ENTER_SQ_WAKEUP;
+                }
+
+                int const ret{
+                    ::fast_io::system_call<__NR_io_uring_enter, int>(ring.ring_file.native_handle(), to_submit, 1u, enter_flags, nullptr, 0uz)};
+                if(!::fast_io::linux_system_call_fails(ret) || ret == -EINTR || ret == -EAGAIN || ret == -EBUSY) [[likely]] { continue; }
+
+                if(!ring.sqpoll && to_submit != 0u)
+                {
+                    // The kernel rejected the submission itself: withdraw the entry and stop using the ring.
+                    ::std::atomic_ref<unsigned>{*ring.sq_tail}.store(tail, ::std::memory_order_release);
+                    ring.state = wasip1_io_uring_state_t::unavailable;
+                    return wasip1_io_uring_declined;
+                }
+
+                // The entry is queued but waiting failed for good; its completion can no longer be collected.
+                ring.state = wasip1_io_uring_state_t::unavailable;
+                return ret;
+            }
+        }
+
+        /// @brief Lease of the environment's ring for one request, or nothing when it is off, unavailable or busy.
+        struct wasip1_io_uring_lease_t
+        {
+            wasip1_io_uring_t* ring_p{};
+
+            inline explicit wasip1_io_uring_lease_t(wasip1_io_uring_t& ring) noexcept
+            {
+                if(ring.mode == wasip1_io_uring_mode_t::off) [[likely]] { return; }
+                if(!ring.ring_mutex.try_lock()) { return; }
+
+                if(!wasip1_io_uring_ensure(ring)) [[unlikely]]
+                {
+                    ring.ring_mutex.unlock();
+                    return;
+                }
+
+                this->ring_p = ::std::addressof(ring);
+            }
+
+            inline wasip1_io_uring_lease_t(wasip1_io_uring_lease_t const&) = delete;
+            inline wasip1_io_uring_lease_t& operator= (wasip1_io_uring_lease_t const&) = delete;
+
+            inline ~wasip1_io_uring_lease_t()
+            {
+                if(this->ring_p != nullptr) { this->ring_p->ring_mutex.unlock(); }
+            }
+        };
+
+        [[nodiscard]] inline ::std::ptrdiff_t wasip1_io_uring_rw(wasip1_io_uring_t& ring,
+                                                                 ::std::uint_least8_t opcode,
+                                                                 int fd,
+                                                                 ::fast_io::io_scatter_t const* base,
+                                                                 ::std::size_t n,
+                                                                 ::std::int_least64_t off) noexcept
+        {
+            if(n > static_cast<::std::size_t>(::std::numeric_limits<unsigned>::max())) [[unlikely]] { return wasip1_io_uring_declined; }
+
+            wasip1_io_uring_lease_t const lease{ring};
+            if(lease.ring_p == nullptr) { return wasip1_io_uring_declined; }
+
+            // fast_io::io_scatter_t has the layout of struct iovec (checked where the scatter arrays are handed to sendmsg/recvmsg).
+            struct ::io_uring_sqe sqe{};
+            sqe.opcode = opcode;
+            sqe.fd = fd;
+            sqe.off = static_cast<::std::uint_least64_t>(off);
+            sqe.addr = reinterpret_cast<::std::uintptr_t>(base);
+            sqe.len = static_cast<unsigned>(n);
+
+            return wasip1_io_uring_run(*lease.ring_p, sqe);
+        }
+
+        [[noreturn]] inline void wasip1_io_uring_throw(::std::ptrdiff_t res)
+        {
+            // Same error object fast_io raises for a failed readv/writev, so the caller's existing catch maps it.
+# ifdef UWVM_CPP_EXCEPTIONS
+            throw ::fast_io::error{::fast_io::posix_domain_value, static_cast<::fast_io::error::value_type>(static_cast<unsigned>(-res))};
+# else
+            static_cast<void>(res);
+            ::fast_io::fast_terminate();
+# endif
+        }
+
+        [[nodiscard]] inline ::fast_io::io_scatter_status_t wasip1_io_uring_status(::std::ptrdiff_t res, ::fast_io::io_scatter_t const* base, ::std::size_t n)
+        {
+            if(res < 0) [[unlikely]] { wasip1_io_uring_throw(res); }
+
+            auto total{static_cast<::std::size_t>(res)};
+            for(::std::size_t i{}; i != n; ++i)
+            {
+                if(total < base[i].len) { return {i, total}; }
+                total -= base[i].len;
+            }
+            return {n, 0uz};
+        }
+    }  // namespace details
+
+    /// @brief  Drop-in for `fast_io::operations::scatter_read_some_bytes` on a native fd (readv at the file position).
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t
+        wasip1_io_uring_scatter_read_some_bytes(wasip1_io_uring_t& ring, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n)
+    {
+        auto const res{details::wasip1_io_uring_rw(ring, IORING_OP_READV, observer.native_handle(), base, n, -1)};
+        if(res == wasip1_io_uring_declined) { return ::fast_io::operations::scatter_read_some_bytes(observer, base, n); }
+        return details::wasip1_io_uring_status(res, base, n);
+    }
+
+    /// @brief  Drop-in for `fast_io::operations::scatter_write_some_bytes` on a native fd (writev at the file position).
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t
+        wasip1_io_uring_scatter_write_some_bytes(wasip1_io_uring_t& ring, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n)
+    {
+        auto const res{details::wasip1_io_uring_rw(ring, IORING_OP_WRITEV, observer.native_handle(), base, n, -1)};
+        if(res == wasip1_io_uring_declined) { return ::fast_io::operations::scatter_write_some_bytes(observer, base, n); }
+        return details::wasip1_io_uring_status(res, base, n);
+    }
+
+    /// @brief  Drop-in for `fast_io::operations::scatter_pread_some_bytes` (preadv).
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t wasip1_io_uring_scatter_pread_some_bytes(
+        wasip1_io_uring_t& ring, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n, ::fast_io::intfpos_t off)
+    {
+        // A negative offset would turn into "use the file position"; leave its EINVAL to preadv.
+        auto const res{off < 0 ? wasip1_io_uring_declined
+                               : details::wasip1_io_uring_rw(ring,
+                                                             IORING_OP_READV,
+                                                             observer.native_handle(),
+                                                             base,
+                                                             n,
+                                                             static_cast<::std::int_least64_t>(off))};
+        if(res == wasip1_io_uring_declined) { return ::fast_io::operations::scatter_pread_some_bytes(observer, base, n, off); }
+        return details::wasip1_io_uring_status(res, base, n);
+    }
+
+    /// @brief  Drop-in for `fast_io::operations::scatter_pwrite_some_bytes` (pwritev).
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t wasip1_io_uring_scatter_pwrite_some_bytes(
+        wasip1_io_uring_t& ring, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n, ::fast_io::intfpos_t off)
+    {
+        auto const res{off < 0 ? wasip1_io_uring_declined
+                               : details::wasip1_io_uring_rw(ring,
+                                                             IORING_OP_WRITEV,
+                                                             observer.native_handle(),
+                                                             base,
+                                                             n,
+                                                             static_cast<::std::int_least64_t>(off))};
+        if(res == wasip1_io_uring_declined) { return ::fast_io::operations::scatter_pwrite_some_bytes(observer, base, n, off); }
+        return details::wasip1_io_uring_status(res, base, n);
+    }
+
+    /// @brief  fsync, or fdatasync when `datasync` is set.
+    /// @return 0, a negated errno, or `wasip1_io_uring_declined`.
+    [[nodiscard]] inline ::std::ptrdiff_t wasip1_io_uring_fsync(wasip1_io_uring_t& ring, int fd, bool datasync) noexcept
+    {
+        details::wasip1_io_uring_lease_t const lease{ring};
+        if(lease.ring_p == nullptr) { return wasip1_io_uring_declined; }
+
+        struct ::io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_FSYNC;
+        sqe.fd = fd;
+        sqe.fsync_flags = datasync ? IORING_FSYNC_DATASYNC : 0u;
+
+        return details::wasip1_io_uring_run(*lease.ring_p, sqe);
+    }
+
+    /// @brief  Like recvmsg(2): the received byte count, or -1 with errno set. `wasip1_io_uring_declined` means nothing was done.
+    [[nodiscard]] inline ::std::ptrdiff_t wasip1_io_uring_recvmsg(wasip1_io_uring_t& ring, int fd, struct ::msghdr* msg, int flags) noexcept
+    {
+        details::wasip1_io_uring_lease_t const lease{ring};
+        if(lease.ring_p == nullptr) { return wasip1_io_uring_declined; }
+
+        struct ::io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_RECVMSG;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<::std::uintptr_t>(msg);
+        sqe.len = 1u;
+        sqe.msg_flags = static_cast<unsigned>(flags);
+
+        auto const res{details::wasip1_io_uring_run(*lease.ring_p, sqe)};
+        if(res == wasip1_io_uring_declined || res >= 0) { return res; }
+
+        errno = static_cast<int>(-res);
+        return -1;
+    }
+
+    /// @brief  Like sendmsg(2): the sent byte count, or -1 with errno set. `wasip1_io_uring_declined` means nothing was done.
+    [[nodiscard]] inline ::std::ptrdiff_t wasip1_io_uring_sendmsg(wasip1_io_uring_t& ring, int fd, struct ::msghdr const* msg, int flags) noexcept
+    {
+        details::wasip1_io_uring_lease_t const lease{ring};
+        if(lease.ring_p == nullptr) { return wasip1_io_uring_declined; }
+
+        struct ::io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_SENDMSG;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<::std::uintptr_t>(msg);
+        sqe.len = 1u;
+        sqe.msg_flags = static_cast<unsigned>(flags);
+
+        auto const res{details::wasip1_io_uring_run(*lease.ring_p, sqe)};
+        if(res == wasip1_io_uring_declined || res >= 0) { return res; }
+
+        errno = static_cast<int>(-res);
+        return -1;
+    }
+
+    /// @brief  Sleep for `timeout` ns (relative, CLOCK_MONOTONIC) on the ring.
+    /// @return 0 once the timeout expired, a negated errno, or `wasip1_io_uring_declined`.
+    [[nodiscard]] inline ::std::ptrdiff_t wasip1_io_uring_sleep(wasip1_io_uring_t& ring, ::std::uint_least64_t timeout) noexcept
+    {
+        details::wasip1_io_uring_lease_t const lease{ring};
+        if(lease.ring_p == nullptr) { return wasip1_io_uring_declined; }
+
+        struct ::__kernel_timespec ts{};
+        ts.tv_sec = static_cast<decltype(ts.tv_sec)>(timeout / 1'000'000'000u);
+        ts.tv_nsec = static_cast<decltype(ts.tv_nsec)>(timeout % 1'000'000'000u);
+
+        // A pure timeout (no completion count): it always ends with -ETIME unless it could not be armed.
+        struct ::io_uring_sqe sqe{};
+        sqe.opcode = IORING_OP_TIMEOUT;
+        sqe.fd = -1;
+        sqe.addr = reinterpret_cast<::std::uintptr_t>(::std::addressof(ts));
+        sqe.len = 1u;
+
+        auto const res{details::wasip1_io_uring_run(*lease.ring_p, sqe)};
+        return res == -ETIME ? 0 : res;
+    }
+
+#else
+
+    /// @brief Platforms without io_uring only record the mode; every request takes the regular path.
+    struct wasip1_io_uring_t
+    {
+        wasip1_io_uring_mode_t mode{};
+    };
+
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t
+        wasip1_io_uring_scatter_read_some_bytes(wasip1_io_uring_t&, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n)
+    { return ::fast_io::operations::scatter_read_some_bytes(observer, base, n); }
+
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t
+        wasip1_io_uring_scatter_write_some_bytes(wasip1_io_uring_t&, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n)
+    { return ::fast_io::operations::scatter_write_some_bytes(observer, base, n); }
+
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t wasip1_io_uring_scatter_pread_some_bytes(
+        wasip1_io_uring_t&, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n, ::fast_io::intfpos_t off)
+    { return ::fast_io::operations::scatter_pread_some_bytes(observer, base, n, off); }
+
+    template <typename native_observer>
+    inline ::fast_io::io_scatter_status_t wasip1_io_uring_scatter_pwrite_some_bytes(
+        wasip1_io_uring_t&, native_observer observer, ::fast_io::io_scatter_t const* base, ::std::size_t n, ::fast_io::intfpos_t off)
+    { return ::fast_io::operations::scatter_pwrite_some_bytes(observer, base, n, off); }
+
+    [[nodiscard]] inline constexpr ::std::ptrdiff_t wasip1_io_uring_fsync(wasip1_io_uring_t&, int, bool) noexcept { return wasip1_io_uring_declined; }
+
+    template <typename msghdr_type>
+    [[nodiscard]] inline constexpr ::std::ptrdiff_t wasip1_io_uring_recvmsg(wasip1_io_uring_t&, int, msghdr_type*, int) noexcept
+    { return wasip1_io_uring_declined; }
+
+    template <typename msghdr_type>
+    [[nodiscard]] inline constexpr ::std::ptrdiff_t wasip1_io_uring_sendmsg(wasip1_io_uring_t&, int, msghdr_type const*, int) noexcept
+    { return wasip1_io_uring_declined; }
+
+    [[nodiscard]] inline constexpr ::std::ptrdiff_t wasip1_io_uring_sleep(wasip1_io_uring_t&, ::std::uint_least64_t) noexcept
+    { return wasip1_io_uring_declined; }
+
+#endif
+}  // namespace uwvm2::imported::wasi::wasip1::environment
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,374 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @file        path_cache.h
+ * @brief       Resolution cache and single-syscall lookup for wasip1 path_* calls.
+ * @details     path_open and path_filestat_get resolve a guest path by walking it one component at a time from the fd's directory, with one
+ *              openat (plus a readlinkat probe) per component. Interpreters compiled to WASI repeat that walk for thousands of module probes on
+ *              the same few trees at startup.
+ *
+ *              Two things shorten it for plain relative paths (no `..`, ending in a name):
+ *              - On Linux, `wasip1_openat2_beneath` resolves the whole path with one openat2(RESOLVE_BENEATH | RESOLVE_NO_MAGICLINKS). The kernel
+ *                refuses the same escapes the walk refuses (`..` above the base, absolute symlinks); the caller falls back to the walk for every
+ *                result other than success and ENOENT, so errno values stay those of the walk.
+ *              - With `--wasip1-global-path-cache`, `wasip1_path_cache_t` remembers, per base directory, paths that did not exist and the
+ *                directory chains that path_open built for directory fds. A hit skips the lookup altogether.
+ *
+ *              The cache only sees this environment's own calls. path_open with O_CREAT, path_create_directory, path_link and path_symlink drop
+ *              the negative entries; path_remove_directory, path_unlink_file and path_rename drop everything. Changes made by other processes are
+ *              not observed, which is why the cache is opt-in.
+ *
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <atomic>
+# include <limits>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(__linux__)
+#  include <errno.h>
+#  include <fcntl.h>
+#  if __has_include(<sys/syscall.h>)
+#   include <sys/syscall.h>
+#  endif
+#  if __has_include(<linux/openat2.h>)
+#   include <linux/openat2.h>
+#  endif
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/mutex/impl.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/imported/wasi/wasip1/fd_manager/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::environment
+{
+    /// @brief Returned by `wasip1_openat2_beneath` when the call was not made and the caller must walk the path itself.
+    inline constexpr int wasip1_openat2_declined{::std::numeric_limits<int>::min()};
+
+#if defined(__linux__) && defined(__NR_openat2) && defined(RESOLVE_BENEATH) && defined(RESOLVE_NO_MAGICLINKS)
+
+    /// @brief Set once openat2 turned out to be missing (kernel before 5.6, seccomp), so later lookups go straight to the walk.
+    inline ::std::atomic_bool wasip1_openat2_unavailable{};
+
+    /// @brief Open `path` below `dirfd` with a single openat2 that refuses to leave `dirfd`.
+    /// @return The new fd, a negated errno, or `wasip1_openat2_declined`.
+    [[nodiscard]] inline int wasip1_openat2_beneath(int dirfd, char const* path, int flags, unsigned mode) noexcept
+    {
+        if(wasip1_openat2_unavailable.load(::std::memory_order_relaxed)) [[unlikely]] { return wasip1_openat2_declined; }
+
+        struct ::open_how how{};
+        how.flags = static_cast<::std::uint_least64_t>(static_cast<unsigned>(flags));
+        how.mode = (flags & O_CREAT) != 0 ? mode : 0u;
+        how.resolve = RESOLVE_BENEATH | RESOLVE_NO_MAGICLINKS;
+
+        int const ret{::fast_io::system_call<__NR_openat2, int>(dirfd, path, ::std::addressof(how), sizeof(how))};
+        if(ret == -ENOSYS || ret == -EPERM) [[unlikely]]
+        {
+            wasip1_openat2_unavailable.store(true, ::std::memory_order_relaxed);
+            return wasip1_openat2_declined;
+        }
+
+        return ret;
+    }
+
+    /// @brief The open(2) flags fast_io's posix backend derives from `mode`, restricted to the bits path_open sets, so that a file opened here is
+    ///        opened exactly like the `native_file` the walk would construct (including fast_io's O_CREAT for `out` and `app`).
+    [[nodiscard]] inline constexpr int wasip1_posix_open_flags(::fast_io::open_mode mode) noexcept
+    {
+        auto const has{[mode](::fast_io::open_mode bit) constexpr noexcept { return (mode & bit) != ::fast_io::open_mode::none; }};
+
+        int flags{O_CLOEXEC};
+        if(!has(::fast_io::open_mode::follow)) { flags |= O_NOFOLLOW; }
+        if(has(::fast_io::open_mode::creat)) { flags |= O_CREAT; }
+        if(has(::fast_io::open_mode::excl)) { flags |= O_EXCL; }
+        if(has(::fast_io::open_mode::trunc)) { flags |= O_TRUNC; }
+        if(has(::fast_io::open_mode::sync)) { flags |= O_SYNC; }
+        if(has(::fast_io::open_mode::dsync)) { flags |= O_DSYNC; }
+# ifdef O_RSYNC
+        if(has(::fast_io::open_mode::rsync)) { flags |= O_RSYNC; }
+# endif
+        if(has(::fast_io::open_mode::no_block)) { flags |= O_NONBLOCK; }
+        if(has(::fast_io::open_mode::directory)) { flags |= O_DIRECTORY; }
+# ifdef O_LARGEFILE
+        flags |= O_LARGEFILE;
+# endif
+
+        bool const in{has(::fast_io::open_mode::in)};
+        bool const out{has(::fast_io::open_mode::out)};
+        bool const app{has(::fast_io::open_mode::app)};
+
+        if(app) { return flags | (in ? O_RDWR : O_WRONLY) | O_CREAT | O_APPEND; }
+        if(in && out) { return flags | O_RDWR; }
+        if(out) { return flags | O_WRONLY | O_CREAT | O_TRUNC; }
+        return flags | O_RDONLY;
+    }
+
+    /// @brief Whether the last component of `path` below `dirfd` does not exist at all, as opposed to being a dangling symlink.
+    /// @details A lookup that follows symlinks reports ENOENT for both; only the first may become a negative cache entry, because a later
+    ///          lookup without `lookup_symlink_follow` would find the link.
+    [[nodiscard]] inline bool wasip1_openat2_name_absent(int dirfd, char const* path) noexcept
+    {
+        int const ret{wasip1_openat2_beneath(dirfd, path, O_PATH | O_NOFOLLOW | O_CLOEXEC, 0u)};
+        if(ret >= 0) { ::fast_io::posix_file const probe_file{ret}; }
+        return ret == -ENOENT;
+    }
+
+#else
+
+    [[nodiscard]] inline constexpr int wasip1_openat2_beneath(int, char const*, int, unsigned) noexcept { return wasip1_openat2_declined; }
+
+    [[nodiscard]] inline constexpr bool wasip1_openat2_name_absent(int, char const*) noexcept { return false; }
+
+#endif
+
+    /// @brief Whether opening with `mode` may add the final name. fast_io creates for `out` without `in` and for `app`, not only for `creat`,
+    ///        so the decision is taken from the flags the open actually uses rather than from the guest's `o_creat`.
+    [[nodiscard]] inline constexpr bool wasip1_open_may_create(::fast_io::open_mode mode) noexcept
+    {
+#if defined(__linux__) && defined(__NR_openat2) && defined(RESOLVE_BENEATH) && defined(RESOLVE_NO_MAGICLINKS)
+        return (wasip1_posix_open_flags(mode) & O_CREAT) != 0;
+#else
+        auto const has{[mode](::fast_io::open_mode bit) constexpr noexcept { return (mode & bit) != ::fast_io::open_mode::none; }};
+        return has(::fast_io::open_mode::creat) || has(::fast_io::open_mode::app) || (has(::fast_io::open_mode::out) && !has(::fast_io::open_mode::in));
+#endif
+    }
+
+    /// @brief Upper bound on remembered paths per environment; reaching it starts over with an empty cache.
+    inline constexpr ::std::size_t wasip1_path_cache_max_entries{4096uz};
+
+    /// @brief Upper bound on directory handles kept open by the cache, so that it never competes with the guest for host fds.
+    inline constexpr ::std::size_t wasip1_path_cache_max_dir_handles{256uz};
+
+    struct wasip1_path_cache_entry_t
+    {
+        /// @brief The path did not exist when it was last looked up.
+        bool negative{};
+
+        /// @brief For a directory opened by path_open: one opened directory per component, in the order the new fd's dir_stack holds them.
+        ::uwvm2::utils::container::vector<::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t> dirs{};
+    };
+
+    struct wasip1_path_cache_base_t
+    {
+        /// @brief Keeps the base directory alive, so its address cannot be reused by another directory while entries are keyed by it.
+        ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t base;
+
+        ::uwvm2::utils::container::unordered_flat_map<::uwvm2::utils::container::u8string, wasip1_path_cache_entry_t> paths{};
+    };
+
+    enum class wasip1_path_cache_change_t : unsigned
+    {
+        /// @brief A name was added (O_CREAT, mkdir, link, symlink): only negative entries can be wrong now.
+        created = 0u,
+        /// @brief A name was removed or moved (rmdir, unlink, rename): any entry can be wrong now.
+        removed
+    };
+
+    struct wasip1_path_cache_t
+    {
+        /// @brief Set from the command line before the guest starts; never changed afterwards.
+        bool enabled{};
+
+        ::uwvm2::utils::mutex::mutex_t mutex{};  // [singleton]
+
+        /// @brief Bumped by every namespace-changing call, whether or not the cache is enabled. Directory streams behind fd_readdir remember the
+        ///        value they were filled under and start over once it moved.
+        ::std::atomic_size_t generation{};
+
+        // Everything below is only touched with `mutex` held.
+        ::uwvm2::utils::container::unordered_flat_map<::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_rc_t const*, wasip1_path_cache_base_t>
+            bases{};
+        ::std::size_t entry_count{};
+        ::std::size_t dir_handle_count{};
+    };
+
+    namespace details
+    {
+        /// @brief Find or create the entry for `path` below `base`. Must be called with `cache.mutex` held.
+        inline wasip1_path_cache_entry_t& wasip1_path_cache_slot(wasip1_path_cache_t & cache,
+                                                                 ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t const& base,
+                                                                 ::uwvm2::utils::container::u8string const& path) noexcept
+        {
+            if(cache.entry_count >= wasip1_path_cache_max_entries) [[unlikely]]
+            {
+                cache.bases.clear();
+                cache.entry_count = 0uz;
+                cache.dir_handle_count = 0uz;
+            }
+
+            auto base_iter{cache.bases.find(base.ptr)};
+            if(base_iter == cache.bases.end())
+            {
+                base_iter = cache.bases.emplace(base.ptr, wasip1_path_cache_base_t{.base = base, .paths = {}}).first;
+            }
+
+            auto const [path_iter, inserted]{base_iter->second.paths.try_emplace(path)};
+            if(inserted) { ++cache.entry_count; }
+            return path_iter->second;
+        }
+    }  // namespace details
+
+    /// @brief Whether `path` below `base` is known not to exist.
+    [[nodiscard]] inline bool wasip1_path_cache_is_negative(wasip1_path_cache_t & cache,
+                                                            ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t const& base,
+                                                            ::uwvm2::utils::container::u8string const& path) noexcept
+    {
+        if(!cache.enabled) { return false; }
+
+        ::uwvm2::utils::mutex::mutex_guard_t cache_lock{cache.mutex};
+
+        auto const base_iter{cache.bases.find(base.ptr)};
+        if(base_iter == cache.bases.end()) { return false; }
+
+        auto const path_iter{base_iter->second.paths.find(path)};
+        return path_iter != base_iter->second.paths.end() && path_iter->second.negative;
+    }
+
+    inline void wasip1_path_cache_store_negative(wasip1_path_cache_t & cache,
+                                                 ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t const& base,
+                                                 ::uwvm2::utils::container::u8string const& path) noexcept
+    {
+        if(!cache.enabled) { return; }
+
+        ::uwvm2::utils::mutex::mutex_guard_t cache_lock{cache.mutex};
+
+        auto& entry{details::wasip1_path_cache_slot(cache, base, path)};
+        entry.negative = true;
+        cache.dir_handle_count -= entry.dirs.size();
+        entry.dirs.clear();
+    }
+
+    /// @brief Append the cached directory chain of `path` below `base` to `out`.
+    /// @return false (and `out` unchanged) if no chain is cached.
+    [[nodiscard]] inline bool wasip1_path_cache_append_dirs(wasip1_path_cache_t & cache,
+                                                            ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t const& base,
+                                                            ::uwvm2::utils::container::u8string const& path,
+                                                            ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_t & out) noexcept
+    {
+        if(!cache.enabled) { return false; }
+
+        ::uwvm2::utils::mutex::mutex_guard_t cache_lock{cache.mutex};
+
+        auto const base_iter{cache.bases.find(base.ptr)};
+        if(base_iter == cache.bases.end()) { return false; }
+
+        auto const path_iter{base_iter->second.paths.find(path)};
+        if(path_iter == base_iter->second.paths.end() || path_iter->second.dirs.empty()) { return false; }
+
+        for(auto const& dir: path_iter->second.dirs) { out.dir_stack.push_back(dir); }
+        return true;
+    }
+
+    /// @brief Remember the directory chain `[first, last)` that path_open built for `path` below `base`.
+    inline void wasip1_path_cache_store_dirs(wasip1_path_cache_t & cache,
+                                             ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t const& base,
+                                             ::uwvm2::utils::container::u8string const& path,
+                                             ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t const* first,
+                                             ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t const* last) noexcept
+    {
+        if(!cache.enabled || first == last) { return; }
+
+        auto const count{static_cast<::std::size_t>(last - first)};
+
+        ::uwvm2::utils::mutex::mutex_guard_t cache_lock{cache.mutex};
+
+        if(cache.dir_handle_count + count > wasip1_path_cache_max_dir_handles) { return; }
+
+        auto& entry{details::wasip1_path_cache_slot(cache, base, path)};
+        if(!entry.dirs.empty()) { return; }
+
+        entry.negative = false;
+        entry.dirs.reserve(count);
+        for(; first != last; ++first) { entry.dirs.push_back(*first); }
+        cache.dir_handle_count += count;
+    }
+
+    inline void wasip1_path_cache_invalidate(wasip1_path_cache_t & cache, wasip1_path_cache_change_t change) noexcept
+    {
+        if(!cache.enabled) { return; }
+
+        ::uwvm2::utils::mutex::mutex_guard_t cache_lock{cache.mutex};
+
+        if(change == wasip1_path_cache_change_t::removed)
+        {
+            cache.bases.clear();
+            cache.entry_count = 0uz;
+            cache.dir_handle_count = 0uz;
+            return;
+        }
+
+        for(auto& base_entry: cache.bases)
+        {
+            auto& paths{base_entry.second.paths};
+            for(auto path_iter{paths.begin()}; path_iter != paths.end();)
+            {
+                if(path_iter->second.negative)
+                {
+                    path_iter = paths.erase(path_iter);
+                    --cache.entry_count;
+                }
+                else
+                {
+                    ++path_iter;
+                }
+            }
+        }
+    }
+
+    /// @brief Invalidates the cache and the fd_readdir streams when the namespace-changing call that owns it returns, whatever the outcome.
+    struct wasip1_path_cache_invalidate_guard_t
+    {
+        wasip1_path_cache_t* cache{};
+        wasip1_path_cache_change_t change{};
+
+        inline constexpr wasip1_path_cache_invalidate_guard_t(wasip1_path_cache_t* c, wasip1_path_cache_change_t ch) noexcept : cache{c}, change{ch} {}
+
+        inline constexpr wasip1_path_cache_invalidate_guard_t(wasip1_path_cache_invalidate_guard_t const&) = delete;
+        inline constexpr wasip1_path_cache_invalidate_guard_t& operator= (wasip1_path_cache_invalidate_guard_t const&) = delete;
+
+        inline ~wasip1_path_cache_invalidate_guard_t()
+        {
+            if(this->cache != nullptr)
+            {
+                this->cache->generation.fetch_add(1uz, ::std::memory_order_release);
+                wasip1_path_cache_invalidate(*this->cache, this->change);
+            }
+        }
+    };
+}  // namespace uwvm2::imported::wasi::wasip1::environment
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
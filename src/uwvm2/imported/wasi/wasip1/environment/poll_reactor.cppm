@@ -0,0 +1,59 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+module;
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+// platform
+#if defined(__linux__)
+# include <errno.h>
+# if __has_include(<sys/syscall.h>)
+#  include <sys/syscall.h>
+# endif
+# if __has_include(<sys/epoll.h>)
+#  include <sys/epoll.h>
+# endif
+# if __has_include(<sys/timerfd.h>)
+#  include <sys/timerfd.h>
+# endif
+#endif
+
+export module uwvm2.imported.wasi.wasip1.environment:poll_reactor;
+
+import fast_io;
+import uwvm2.utils.container;
+import uwvm2.utils.mutex;
+import uwvm2.imported.wasi.wasip1.fd_manager;
+
+#ifndef UWVM_MODULE
+# define UWVM_MODULE
+#endif
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT export
+#endif
+
+#include "poll_reactor.h"
@@ -0,0 +1,350 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @file        poll_reactor.h
+ * @brief       Long-lived epoll reactor behind poll_oneoff on Linux.
+ * @details     One reactor lives in each WASI environment. It keeps its epoll instance and one timerfd per WASI clock open across
+ *              poll_oneoff calls. Fd registrations are cached by native fd together with their interest mask, so each call only diffs its
+ *              subscriptions against the cache. A guest polling the same fd set again pays for epoll_wait plus one timerfd_settime per clock
+ *              it waits on. The scratch vectors poll_oneoff needs are kept here as well.
+ *
+ *              fd_close and fd_renumber drop the native fd they are about to close. If a dup of that fd lived elsewhere, the registration
+ *              would outlive the number, and a file reopened under the same number would then be missed.
+ *
+ *              Other platforms get an empty reactor, and forgetting an fd there does nothing.
+ *
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(__linux__)
+#  include <errno.h>
+#  if __has_include(<sys/syscall.h>)
+#   include <sys/syscall.h>
+#  endif
+#  if __has_include(<sys/epoll.h>)
+#   include <sys/epoll.h>
+#  endif
+#  if __has_include(<sys/timerfd.h>)
+#   include <sys/timerfd.h>
+#  endif
+# endif
+// import
+# include <fast_io.h>
+# include <fast_io_device.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/mutex/impl.h>
+# include <uwvm2/imported/wasi/wasip1/fd_manager/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::environment
+{
+#if defined(__linux__) && (defined(__NR_epoll_create1) || defined(__NR_epoll_create)) && defined(__NR_epoll_ctl) && defined(__NR_timerfd_create) &&          \
+    defined(__NR_timerfd_settime) && defined(__NR_epoll_wait)
+
+    /// @brief One timerfd per WASI clock id (realtime, monotonic, process and thread cputime).
+    inline constexpr ::std::size_t wasip1_poll_reactor_clock_count{4uz};
+
+    /// @brief `epoll_event::data.u64` of a timerfd is this tag plus its clock id; fd registrations carry the (non-negative) native fd.
+    inline constexpr ::std::uint_least64_t wasip1_poll_reactor_timer_tag{static_cast<::std::uint_least64_t>(1u) << 32u};
+
+    /// @brief What poll_oneoff recorded for one subscription, used to map ready events back to it.
+    struct wasip1_poll_slot_t
+    {
+        // Native fd watched for an fd subscription; -1 for clocks and for subscriptions answered immediately.
+        int native_fd{-1};
+        // Clock id and relative timeout (ns, abstime already converted) of a clock subscription.
+        unsigned clock_slot{};
+        ::std::uint_least64_t timeout{};
+    };
+
+    struct wasip1_poll_reactor_t
+    {
+        /// @brief Held by the poll_oneoff call using this reactor, across epoll_wait as well.
+        ::uwvm2::utils::mutex::mutex_t poll_mutex{};
+        /// @brief Guards `epoll_file` creation and `registrations`. Never held across epoll_wait, so fd_close can always take it.
+        ::uwvm2::utils::mutex::mutex_t registration_mutex{};
+
+        ::fast_io::posix_file epoll_file{};
+        ::fast_io::posix_file timer_files[wasip1_poll_reactor_clock_count]{};
+        // Timeout (ns) each timerfd was last armed with; 0 once disarmed.
+        ::std::uint_least64_t timer_timeouts[wasip1_poll_reactor_clock_count]{};
+
+        // Native fd -> epoll interest mask currently registered.
+        ::uwvm2::utils::container::unordered_flat_map<int, ::std::uint_least32_t> registrations{};
+
+        // Scratch of the current call, reused across calls. Only valid while `poll_mutex` is held; the lease resets it.
+        ::uwvm2::utils::container::vector<::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_t*> fd_p_vector{};
+        ::uwvm2::utils::container::vector<::uwvm2::utils::mutex::mutex_merely_release_guard_t> fd_release_guards_vector{};
+        ::uwvm2::utils::container::unordered_flat_set<::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_t*> fd_unique_set{};
+        ::uwvm2::utils::container::unordered_flat_map<int, ::std::uint_least32_t> wanted{};
+        ::std::uint_least64_t timer_wanted[wasip1_poll_reactor_clock_count]{};
+        ::uwvm2::utils::container::vector<wasip1_poll_slot_t> slots{};
+        ::uwvm2::utils::container::vector<struct ::epoll_event> ep_events{};
+    };
+
+    namespace details
+    {
+        [[nodiscard]] inline int wasip1_poll_reactor_ctl(int epfd, int op, int fd, ::std::uint_least64_t data, ::std::uint_least32_t events) noexcept
+        {
+            struct ::epoll_event ev{};
+            ev.events = events;
+            ev.data.u64 = data;
+            return ::fast_io::system_call<__NR_epoll_ctl, int>(epfd, op, fd, ::std::addressof(ev));
+        }
+
+        [[nodiscard]] inline int wasip1_poll_reactor_settime(int tfd, ::std::uint_least64_t timeout) noexcept
+        {
+            // A zero timeout disarms the timer. Either way the expirations left over from an earlier call are cleared.
+            struct ::itimerspec ts{};
+            ts.it_value.tv_sec = static_cast<decltype(ts.it_value.tv_sec)>(timeout / 1'000'000'000u);
+            ts.it_value.tv_nsec = static_cast<decltype(ts.it_value.tv_nsec)>(timeout % 1'000'000'000u);
+            return ::fast_io::system_call<__NR_timerfd_settime, int>(tfd, 0, ::std::addressof(ts), nullptr);
+        }
+    }  // namespace details
+
+    /// @brief  Create the epoll instance on first use.
+    /// @return 0, or a negated errno.
+    [[nodiscard]] inline int wasip1_poll_reactor_open(wasip1_poll_reactor_t& reactor) noexcept
+    {
+        ::uwvm2::utils::mutex::mutex_guard_t registration_lock{reactor.registration_mutex};
+
+        if(reactor.epoll_file.native_handle() != -1) [[likely]] { return 0; }
+
+        int const epfd{
+# if defined(__NR_epoll_create1)
+            ::fast_io::system_call<__NR_epoll_create1, int>(EPOLL_CLOEXEC)
+# else
+            ::fast_io::system_call<__NR_epoll_create, int>(1)
+# endif
+        };
+
+        if(::fast_io::linux_system_call_fails(epfd)) [[unlikely]] { return epfd; }
+
+        reactor.epoll_file = ::fast_io::posix_file{epfd};
+        return 0;
+    }
+
+    /// @brief Record that the current call waits for `events` on `native_fd`. Several subscriptions on one fd merge their masks.
+    inline void wasip1_poll_reactor_want(wasip1_poll_reactor_t& reactor, int native_fd, ::std::uint_least32_t events) noexcept
+    { reactor.wanted[native_fd] |= events; }
+
+    /// @brief  Bring the epoll registrations in line with the wanted set: drop fds no longer polled, add new ones, re-mask changed ones.
+    /// @return 0, or the negated errno of the epoll_ctl that failed.
+    [[nodiscard]] inline int wasip1_poll_reactor_commit(wasip1_poll_reactor_t& reactor) noexcept
+    {
+        ::uwvm2::utils::mutex::mutex_guard_t registration_lock{reactor.registration_mutex};
+
+        int const epfd{reactor.epoll_file.native_handle()};
+
+        // Level-triggered registrations that are no longer polled would keep waking epoll_wait.
+        for(auto reg{reactor.registrations.begin()}; reg != reactor.registrations.end();)
+        {
+            if(reactor.wanted.contains(reg->first))
+            {
+                ++reg;
+                continue;
+            }
+
+            // ENOENT or EBADF only mean the registration is already gone.
+            static_cast<void>(details::wasip1_poll_reactor_ctl(epfd, EPOLL_CTL_DEL, reg->first, 0u, 0u));
+            reg = reactor.registrations.erase(reg);
+        }
+
+        for(auto const& [native_fd, events]: reactor.wanted)
+        {
+            auto const [reg, inserted]{reactor.registrations.try_emplace(native_fd, events)};
+            if(!inserted && reg->second == events) [[likely]] { continue; }
+
+            int op{inserted ? EPOLL_CTL_ADD : EPOLL_CTL_MOD};
+            int ret{details::wasip1_poll_reactor_ctl(epfd, op, native_fd, static_cast<::std::uint_least64_t>(native_fd), events)};
+            if(ret == -EEXIST || ret == -ENOENT)
+            {
+                // The kernel disagrees with the cache, e.g. after a host fd was closed behind the reactor's back; take the other operation.
+                op = (op == EPOLL_CTL_ADD) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+                ret = details::wasip1_poll_reactor_ctl(epfd, op, native_fd, static_cast<::std::uint_least64_t>(native_fd), events);
+            }
+
+            if(::fast_io::linux_system_call_fails(ret)) [[unlikely]]
+            {
+                reactor.registrations.erase(reg);
+                return ret;
+            }
+
+            reg->second = events;
+        }
+
+        return 0;
+    }
+
+    /// @brief  Arm the timerfd of every clock the current call waits on with its shortest timeout, creating and registering it on first use,
+    ///         and disarm timerfds an earlier call left armed so a stale expiry cannot wake this one.
+    /// @return 0, or a negated errno (timerfd_create rejects the cputime clocks).
+    [[nodiscard]] inline int wasip1_poll_reactor_sync_timers(wasip1_poll_reactor_t& reactor) noexcept
+    {
+        constexpr int linux_clock_ids[wasip1_poll_reactor_clock_count]{CLOCK_REALTIME, CLOCK_MONOTONIC, CLOCK_PROCESS_CPUTIME_ID, CLOCK_THREAD_CPUTIME_ID};
+
+        for(::std::size_t clock_slot{}; clock_slot != wasip1_poll_reactor_clock_count; ++clock_slot)
+        {
+            auto const wanted_timeout{reactor.timer_wanted[clock_slot]};
+            auto& timer_file{reactor.timer_files[clock_slot]};
+
+            if(wanted_timeout == 0u)
+            {
+                if(reactor.timer_timeouts[clock_slot] == 0u) [[likely]] { continue; }
+
+                static_cast<void>(details::wasip1_poll_reactor_settime(timer_file.native_handle(), 0u));
+                reactor.timer_timeouts[clock_slot] = 0u;
+                continue;
+            }
+
+            if(timer_file.native_handle() == -1)
+            {
+                int const tfd{::fast_io::system_call<__NR_timerfd_create, int>(linux_clock_ids[clock_slot], TFD_NONBLOCK | TFD_CLOEXEC)};
+                if(::fast_io::linux_system_call_fails(tfd)) [[unlikely]] { return tfd; }
+
+                ::fast_io::posix_file new_timer_file{tfd};
+
+                // The timerfd stays registered for the reactor's lifetime; disarming it is enough to keep it quiet.
+                int const ret{details::wasip1_poll_reactor_ctl(reactor.epoll_file.native_handle(),
+                                                               EPOLL_CTL_ADD,
+                                                               tfd,
+                                                               wasip1_poll_reactor_timer_tag + clock_slot,
+                                                               EPOLLIN)};
+                if(::fast_io::linux_system_call_fails(ret)) [[unlikely]] { return ret; }
+
+                timer_file = ::std::move(new_timer_file);
+            }
+
+            int const ret{details::wasip1_poll_reactor_settime(timer_file.native_handle(), wanted_timeout)};
+            if(::fast_io::linux_system_call_fails(ret)) [[unlikely]] { return ret; }
+
+            reactor.timer_timeouts[clock_slot] = wanted_timeout;
+        }
+
+        return 0;
+    }
+
+    /// @brief Drop the registration of the native fd behind `wasi_fd`. Call before the last reference to it is released.
+    inline void wasip1_poll_reactor_forget(wasip1_poll_reactor_t& reactor, ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_ref_t const& wasi_fd) noexcept
+    {
+        if(wasi_fd.ptr == nullptr) [[unlikely]] { return; }
+
+        auto& wasi_fd_storage{wasi_fd.ptr->wasi_fd_storage};
+
+        int native_fd;  // no initialize
+        switch(wasi_fd_storage.type)
+        {
+            case ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::file:
+            {
+                native_fd = wasi_fd_storage.storage.file_fd.native_handle();
+                break;
+            }
+            case ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::file_observer:
+            {
+                native_fd = wasi_fd_storage.storage.file_observer.native_handle();
+                break;
+            }
+            default:
+            {
+                // Directories and null fds are never registered.
+                return;
+            }
+        }
+
+        ::uwvm2::utils::mutex::mutex_guard_t registration_lock{reactor.registration_mutex};
+
+        auto const reg{reactor.registrations.find(native_fd)};
+        if(reg == reactor.registrations.end()) [[likely]] { return; }
+
+        static_cast<void>(details::wasip1_poll_reactor_ctl(reactor.epoll_file.native_handle(), EPOLL_CTL_DEL, native_fd, 0u, 0u));
+        reactor.registrations.erase(reg);
+    }
+
+    /// @brief  Hands a poll_oneoff call the environment's reactor, or `one_shot` while another thread is polling with it, so no caller waits
+    ///         behind someone else's epoll_wait.
+    /// @note   The destructor releases the fd locks gathered in the scratch and resets it for the next call.
+    struct wasip1_poll_reactor_lease_t
+    {
+        wasip1_poll_reactor_t* reactor_p{};
+        bool owns_poll_mutex{};
+
+        inline explicit wasip1_poll_reactor_lease_t(wasip1_poll_reactor_t& shared, wasip1_poll_reactor_t& one_shot) noexcept
+        {
+            if(shared.poll_mutex.try_lock())
+            {
+                this->reactor_p = ::std::addressof(shared);
+                this->owns_poll_mutex = true;
+            }
+            else
+            {
+                this->reactor_p = ::std::addressof(one_shot);
+            }
+        }
+
+        inline wasip1_poll_reactor_lease_t(wasip1_poll_reactor_lease_t const&) = delete;
+        inline wasip1_poll_reactor_lease_t& operator= (wasip1_poll_reactor_lease_t const&) = delete;
+
+        inline ~wasip1_poll_reactor_lease_t()
+        {
+            auto& reactor{*this->reactor_p};
+
+            reactor.fd_release_guards_vector.clear();
+            reactor.fd_p_vector.clear();
+            reactor.fd_unique_set.clear();
+            reactor.wanted.clear();
+            reactor.slots.clear();
+            for(auto& timer_wanted: reactor.timer_wanted) { timer_wanted = 0u; }
+
+            if(this->owns_poll_mutex) { reactor.poll_mutex.unlock(); }
+        }
+
+        [[nodiscard]] inline wasip1_poll_reactor_t& get() const noexcept { return *this->reactor_p; }
+    };
+
+#else
+
+    /// @brief Platforms without the epoll/timerfd syscalls keep no poll state between calls.
+    struct wasip1_poll_reactor_t
+    {
+    };
+
+    inline constexpr void wasip1_poll_reactor_forget(wasip1_poll_reactor_t&, ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_ref_t const&) noexcept {}
+
+#endif
+}  // namespace uwvm2::imported::wasi::wasip1::environment
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
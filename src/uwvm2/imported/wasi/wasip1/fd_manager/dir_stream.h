@@ -0,0 +1,380 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @file        dir_stream.h
+ * @brief       Per-fd directory stream behind fd_readdir.
+ * @details     fd_readdir is stateless: every call names the cookie to resume from, and the plain implementation walks the directory from its first
+ *              entry up to that cookie, which makes listing a large directory with a small buffer quadratic. On Linux a directory fd keeps its own
+ *              open file description of the directory and reads it in getdents64 batches. The current batch serves every cookie that falls into
+ *              it, and the kernel offset each batch started from is remembered, so a cookie outside the batch costs one lseek and one getdents64.
+ *              The stream starts over on cookie 0 (rewinddir) and whenever a path_* call changed the namespace since it was filled.
+ *
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <limits>
+# include <memory>
+# include <new>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(__linux__)
+#  include <fcntl.h>
+#  include <dirent.h>
+#  if __has_include(<sys/syscall.h>)
+#   include <sys/syscall.h>
+#  endif
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/utf/impl.h>
+# include <uwvm2/imported/wasi/wasip1/abi/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::fd_manager
+{
+    /// @brief Size of one getdents64 batch, the same as glibc's readdir buffer.
+    inline constexpr ::std::size_t dir_stream_batch_bytes{32uz * 1024uz};
+
+    /// @brief One listed name of the current batch. The name stays in the batch buffer, NUL-terminated.
+    struct dir_stream_entry_t
+    {
+        ::std::uint_least64_t ino{};
+        ::std::uint_least32_t name_pos{};
+        ::std::uint_least32_t name_len{};
+        ::uwvm2::imported::wasi::wasip1::abi::filetype_t type{};
+    };
+
+    /// @brief Where a batch was read from: the entry with index `first_index` is the first one listed at kernel offset `offset`.
+    struct dir_stream_checkpoint_t
+    {
+        ::std::size_t first_index{};
+        ::std::int_least64_t offset{};
+    };
+
+    /// @brief Listing state of one directory fd. Only touched with the fd's `fd_mutex` held.
+    /// @note  Entry indices count the names fd_readdir lists, so "." and ".." and names rejected by the UTF-8 check are not counted.
+    struct dir_stream_t
+    {
+        using allocator_t = ::fast_io::native_typed_global_allocator<::std::byte>;
+
+        // A separate open file description: the directory fd itself may be shared with other fds through the directory stack.
+        ::fast_io::posix_file dir_file{};
+        // Host fd `dir_file` was opened from. A WASI fd keeps its directory for life; this only catches code that edits the directory stack.
+        int source_fd{-1};
+        // Namespace generation the stream was filled under; see `wasip1_path_cache_t::generation`.
+        ::std::size_t generation{};
+
+        ::std::byte* batch{};
+        ::uwvm2::utils::container::vector<dir_stream_entry_t> entries{};
+        ::std::size_t first_index{};
+        // Kernel offset after the last record of the current batch.
+        ::std::int_least64_t next_offset{};
+        bool eof{};
+
+        // Ascending by `first_index`; the first one is always {0, 0}.
+        ::uwvm2::utils::container::vector<dir_stream_checkpoint_t> checkpoints{};
+
+        inline constexpr dir_stream_t() noexcept = default;
+
+        inline constexpr dir_stream_t(dir_stream_t const& other) noexcept = delete;
+
+        inline constexpr dir_stream_t& operator= (dir_stream_t const& other) noexcept = delete;
+
+        inline constexpr ~dir_stream_t()
+        {
+            if(this->batch != nullptr) { allocator_t::deallocate_n(this->batch, dir_stream_batch_bytes); }
+        }
+    };
+
+    /// @brief Owning pointer to the stream of a directory fd, created on the first fd_readdir.
+    /// @details Copying yields an empty pointer: a directory stack copied into another fd (path_open) starts its own listing.
+    struct dir_stream_ptr_t
+    {
+        using allocator_t = ::fast_io::native_typed_global_allocator<dir_stream_t>;
+
+        dir_stream_t* ptr{};
+
+        inline constexpr dir_stream_ptr_t() noexcept = default;
+
+        inline constexpr dir_stream_ptr_t(dir_stream_ptr_t const&) noexcept {}
+
+        inline constexpr dir_stream_ptr_t(dir_stream_ptr_t&& other) noexcept : ptr{other.ptr} { other.ptr = nullptr; }
+
+        inline constexpr dir_stream_ptr_t& operator= (dir_stream_ptr_t const& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+            this->reset();
+            return *this;
+        }
+
+        inline constexpr dir_stream_ptr_t& operator= (dir_stream_ptr_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+            this->reset();
+            this->ptr = other.ptr;
+            other.ptr = nullptr;
+            return *this;
+        }
+
+        inline constexpr ~dir_stream_ptr_t() { this->reset(); }
+
+        inline constexpr void reset() noexcept
+        {
+            if(this->ptr != nullptr)
+            {
+                ::std::destroy_at(this->ptr);
+                allocator_t::deallocate_n(this->ptr, 1uz);
+                this->ptr = nullptr;
+            }
+        }
+
+        inline constexpr dir_stream_t& get_or_create() noexcept
+        {
+            if(this->ptr == nullptr)
+            {
+                this->ptr = allocator_t::allocate(1uz);
+                // ptr will never be null because the fast_io allocator terminates upon allocation failure.
+                ::new(this->ptr) dir_stream_t{};
+            }
+            return *this->ptr;
+        }
+    };
+
+#if defined(__linux__) && defined(__NR_getdents64) && defined(__NR_openat)
+
+    namespace details
+    {
+        // Layout of `struct linux_dirent64`, which is kernel ABI: d_ino, d_off, d_reclen, d_type, d_name.
+        inline constexpr ::std::size_t dirent64_off_pos{8uz};
+        inline constexpr ::std::size_t dirent64_reclen_pos{16uz};
+        inline constexpr ::std::size_t dirent64_type_pos{18uz};
+        inline constexpr ::std::size_t dirent64_name_pos{19uz};
+
+        [[nodiscard]] inline constexpr ::uwvm2::imported::wasi::wasip1::abi::filetype_t dir_stream_filetype(unsigned char d_type) noexcept
+        {
+            // Same mapping as fd_readdir applies to fast_io's file_type.
+            switch(d_type)
+            {
+                case DT_BLK:
+                {
+                    return ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_block_device;
+                }
+                case DT_CHR:
+                {
+                    return ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_character_device;
+                }
+                case DT_DIR:
+                {
+                    return ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_directory;
+                }
+                case DT_LNK:
+                {
+                    return ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_symbolic_link;
+                }
+                case DT_REG:
+                {
+                    return ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_regular_file;
+                }
+                default:
+                {
+                    return ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                }
+            }
+        }
+
+        /// @brief Move the stream to kernel offset `offset`, where the entry with index `first_index` is listed next.
+        [[nodiscard]] inline bool dir_stream_seek(dir_stream_t & stream, ::std::size_t first_index, ::std::int_least64_t offset) noexcept
+        {
+#ifdef UWVM_CPP_EXCEPTIONS
+            try
+#endif
+            {
+                ::fast_io::operations::io_stream_seek_bytes(stream.dir_file, static_cast<::fast_io::intfpos_t>(offset), ::fast_io::seekdir::beg);
+            }
+#ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                return false;
+            }
+#endif
+
+            stream.entries.clear();
+            stream.first_index = first_index;
+            stream.next_offset = offset;
+            stream.eof = false;
+            return true;
+        }
+
+        /// @brief Replace the current batch with the next one. A host error ends the listing, like an error of the plain walk does.
+        inline void dir_stream_read_batch(dir_stream_t & stream, bool disable_utf8_check) noexcept
+        {
+            stream.first_index += stream.entries.size();
+            stream.entries.clear();
+
+            if(stream.checkpoints.back_unchecked().first_index < stream.first_index)
+            {
+                stream.checkpoints.push_back({.first_index = stream.first_index, .offset = stream.next_offset});
+            }
+
+            auto const read_bytes{::fast_io::system_call<__NR_getdents64, ::std::ptrdiff_t>(stream.dir_file.fd, stream.batch, dir_stream_batch_bytes)};
+            if(read_bytes <= 0)
+            {
+                stream.eof = true;
+                return;
+            }
+
+            auto const batch_size{static_cast<::std::size_t>(read_bytes)};
+
+            for(::std::size_t pos{}; pos < batch_size;)
+            {
+                auto const record{stream.batch + pos};
+
+                ::std::uint_least64_t d_ino;     // no initialize
+                ::std::int_least64_t d_off;      // no initialize
+                ::std::uint_least16_t d_reclen;  // no initialize
+                ::std::memcpy(::std::addressof(d_ino), record, sizeof(d_ino));
+                ::std::memcpy(::std::addressof(d_off), record + dirent64_off_pos, sizeof(d_off));
+                ::std::memcpy(::std::addressof(d_reclen), record + dirent64_reclen_pos, sizeof(d_reclen));
+
+                if(d_reclen <= dirent64_name_pos || d_reclen > batch_size - pos) [[unlikely]]
+                {
+                    stream.eof = true;
+                    return;
+                }
+
+                pos += d_reclen;
+                stream.next_offset = d_off;
+
+                auto const name{reinterpret_cast<char8_t const*>(record + dirent64_name_pos)};
+                auto const name_len{::std::strlen(reinterpret_cast<char const*>(name))};
+
+                // "." and ".." are listed by fd_readdir from the directory stack.
+                if(name[0] == u8'.' && (name_len == 1uz || (name_len == 2uz && name[1] == u8'.'))) { continue; }
+
+                if(!disable_utf8_check) [[likely]]
+                {
+                    auto const u8res{
+                        ::uwvm2::utils::utf::check_legal_utf8<::uwvm2::utils::utf::utf8_specification::utf8_rfc3629>(name, name + name_len)};
+                    if(u8res.err != ::uwvm2::utils::utf::utf_error_code::success) [[unlikely]] { continue; }
+                }
+
+                auto const d_type{static_cast<unsigned char>(record[dirent64_type_pos])};
+
+                stream.entries.push_back({.ino = d_ino,
+                                          .name_pos = static_cast<::std::uint_least32_t>(pos - d_reclen + dirent64_name_pos),
+                                          .name_len = static_cast<::std::uint_least32_t>(name_len),
+                                          .type = dir_stream_filetype(d_type)});
+            }
+        }
+    }  // namespace details
+
+    /// @brief  Make `ptr` ready to serve the directory `dir`.
+    /// @param  restart Start over from the first entry even if the stream is current (cookie 0).
+    /// @return false if the stream cannot be used (always, off Linux); fd_readdir then walks the directory itself.
+    [[nodiscard]] inline bool dir_stream_prepare(dir_stream_ptr_t & ptr, ::fast_io::dir_io_observer dir, ::std::size_t generation, bool restart) noexcept
+    {
+        auto& stream{ptr.get_or_create()};
+
+        if(stream.dir_file.fd == -1 || stream.source_fd != dir.native_handle()) [[unlikely]]
+        {
+            int const fd{::fast_io::system_call<__NR_openat, int>(dir.native_handle(), ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC, 0)};
+            if(fd < 0) [[unlikely]]
+            {
+                ptr.reset();
+                return false;
+            }
+
+            stream.dir_file = ::fast_io::posix_file{fd};
+            stream.source_fd = dir.native_handle();
+            if(stream.batch == nullptr) { stream.batch = dir_stream_t::allocator_t::allocate(dir_stream_batch_bytes); }
+        }
+        else if(!restart && stream.generation == generation) [[likely]]
+        {
+            return true;
+        }
+
+        stream.generation = generation;
+        stream.checkpoints.clear();
+        stream.checkpoints.push_back({.first_index = 0uz, .offset = 0});
+
+        if(!details::dir_stream_seek(stream, 0uz, 0)) [[unlikely]]
+        {
+            // Drop the stream rather than keep one whose position is unknown; the next call opens a fresh one.
+            ptr.reset();
+            return false;
+        }
+
+        return true;
+    }
+
+    /// @brief  Entry `index` of a prepared stream, reading or seeking to the batch that holds it.
+    /// @return nullptr past the last entry.
+    [[nodiscard]] inline dir_stream_entry_t const* dir_stream_find(dir_stream_t & stream, ::std::size_t index, bool disable_utf8_check) noexcept
+    {
+        if(index < stream.first_index)
+        {
+            // Resume from the last batch that started at or before `index`.
+            auto checkpoint_iter{stream.checkpoints.cend() - 1};
+            while(checkpoint_iter->first_index > index) { --checkpoint_iter; }
+
+            if(!details::dir_stream_seek(stream, checkpoint_iter->first_index, checkpoint_iter->offset)) [[unlikely]] { return nullptr; }
+        }
+
+        for(;;)
+        {
+            if(auto const pos{index - stream.first_index}; pos < stream.entries.size()) { return ::std::addressof(stream.entries.index_unchecked(pos)); }
+            if(stream.eof) { return nullptr; }
+            details::dir_stream_read_batch(stream, disable_utf8_check);
+        }
+    }
+
+    [[nodiscard]] inline constexpr char8_t const* dir_stream_name(dir_stream_t const& stream, dir_stream_entry_t const& entry) noexcept
+    {
+        return reinterpret_cast<char8_t const*>(stream.batch + entry.name_pos);
+    }
+
+#else
+
+    [[nodiscard]] inline constexpr bool dir_stream_prepare(dir_stream_ptr_t&, ::fast_io::dir_io_observer, ::std::size_t, bool) noexcept { return false; }
+
+    [[nodiscard]] inline constexpr dir_stream_entry_t const* dir_stream_find(dir_stream_t&, ::std::size_t, bool) noexcept { return nullptr; }
+
+    [[nodiscard]] inline constexpr char8_t const* dir_stream_name(dir_stream_t const&, dir_stream_entry_t const&) noexcept { return nullptr; }
+
+#endif
+}  // namespace uwvm2::imported::wasi::wasip1::fd_manager
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -24,6 +24,7 @@ module;
 // std
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <climits>
 #include <limits>
 #include <type_traits>
@@ -43,6 +44,7 @@ import uwvm2.utils.mutex;
 import uwvm2.utils.debug;
 import uwvm2.parser.wasm.standard.wasm1.type;
 import uwvm2.imported.wasi.wasip1.abi;
+import :dir_stream;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
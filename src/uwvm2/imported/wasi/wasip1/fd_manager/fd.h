@@ -25,6 +25,7 @@
 // std
 # include <cstddef>
 # include <cstdint>
+# include <cstring>
 # include <climits>
 # include <limits>
 # include <type_traits>
@@ -43,6 +44,7 @@
 # include <uwvm2/utils/debug/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
 # include <uwvm2/imported/wasi/wasip1/abi/impl.h>
+# include "dir_stream.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -267,6 +269,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::fd_manager
     {
         ::uwvm2::utils::container::vector<dir_stack_entry_ref_t> dir_stack{};
 
+        // fd_readdir's listing state for this fd. Not shared by copies of the stack.
+        dir_stream_ptr_t stream{};
+
         inline constexpr ::std::size_t stack_size() const noexcept { return this->dir_stack.size(); }
 
         inline constexpr bool empty() const noexcept { return this->stack_size() == 0uz; }
@@ -910,6 +915,243 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::fd_manager
         }
     };
 
+    /// @brief When a buffered stdio fd hands its bytes to the host.
+    enum class wasi_fd_output_flush_t : unsigned
+    {
+        // No buffer is attached; every fd_write reaches the host immediately.
+        off = 0u,
+        // Flush only when the buffer is full.
+        size,
+        // Flush after any fd_write whose bytes contain '\n' (or when full).
+        line,
+        // Flush once the oldest buffered byte is older than the interval (or when full). Checked on each write and at the flush points below; there is
+        // no timer thread.
+        time
+    };
+
+    /// @brief Per-environment stdio buffering configuration, copied from the command line.
+    struct wasi_fd_output_buffer_config_t
+    {
+        inline static constexpr ::std::size_t default_capacity{64uz * 1024uz};
+        inline static constexpr ::std::uint_least64_t default_interval_ms{50u};
+
+        wasi_fd_output_flush_t policy{wasi_fd_output_flush_t::off};
+        ::std::size_t capacity{default_capacity};
+        ::std::uint_least64_t interval_ms{default_interval_ms};
+    };
+
+    /// @brief    Host-side buffer behind a guest stdout/stderr fd.
+    /// @details  The environment owns the buffer and `wasi_fd_t::output_buffer` points at it, so renumbering moves the pointer together with the fd. The
+    ///           sink is the native handle the fd wrote to when the buffer was attached. Besides the policy above, the buffer is flushed on proc_exit,
+    ///           traps, fd_read from a stdio fd, fd_sync/fd_datasync, fd_seek/fd_tell, poll_oneoff, fd_close/fd_renumber of the fd and at process exit.
+    /// @note     `mutex` is a leaf lock: it may be taken while holding `wasi_fd_t::fd_mutex`, never the other way round.
+    struct wasi_fd_output_buffer_t
+    {
+        using mutex_t = ::uwvm2::utils::mutex::mutex_t;
+        using allocator_t = ::fast_io::native_typed_global_allocator<::std::byte>;
+
+        mutex_t mutex{};  // [singleton]
+        ::fast_io::native_io_observer sink{};
+        wasi_fd_output_flush_t policy{wasi_fd_output_flush_t::off};
+        ::std::uint_least64_t interval_ms{};
+
+        ::std::byte* begin{};
+        ::std::byte* curr{};
+        ::std::byte* end{};
+
+        // Monotonic time at which the buffer last went from empty to non-empty (time policy only).
+        ::fast_io::unix_timestamp oldest{};
+
+        inline constexpr wasi_fd_output_buffer_t() noexcept = default;
+
+        inline constexpr wasi_fd_output_buffer_t(wasi_fd_output_buffer_t const& other) noexcept = delete;
+
+        inline constexpr wasi_fd_output_buffer_t& operator= (wasi_fd_output_buffer_t const& other) noexcept = delete;
+
+        inline constexpr ~wasi_fd_output_buffer_t()
+        {
+            if(this->begin != nullptr) { allocator_t::deallocate_n(this->begin, static_cast<::std::size_t>(this->end - this->begin)); }
+        }
+
+        [[nodiscard]] inline constexpr bool enabled() const noexcept { return this->begin != nullptr; }
+    };
+
+    /// @brief Allocate the buffer and bind it to `sink`. Called once while the environment is initialized, before any guest code runs.
+    inline constexpr void attach_wasi_fd_output_buffer(wasi_fd_output_buffer_t & buf,
+                                                       ::fast_io::native_io_observer sink,
+                                                       wasi_fd_output_buffer_config_t const& config) noexcept
+    {
+        if(config.policy == wasi_fd_output_flush_t::off || config.capacity == 0uz || buf.begin != nullptr) [[unlikely]] { return; }
+
+        buf.begin = wasi_fd_output_buffer_t::allocator_t::allocate(config.capacity);
+        buf.curr = buf.begin;
+        buf.end = buf.begin + config.capacity;
+        buf.sink = sink;
+        buf.policy = config.policy;
+        buf.interval_ms = config.interval_ms;
+    }
+
+    namespace details
+    {
+        /// @brief Write out everything buffered. Must be called with `buf.mutex` held.
+        /// @throws ::fast_io::error from the host write. The buffered bytes are dropped either way, so one failing sink does not make every later
+        ///         flush fail again on the same data.
+        inline constexpr void flush_wasi_fd_output_buffer_locked(wasi_fd_output_buffer_t & buf)
+        {
+            if(buf.curr == buf.begin) { return; }
+
+            auto const first{buf.begin};
+            auto const last{buf.curr};
+            buf.curr = buf.begin;
+            ::fast_io::operations::write_all_bytes(buf.sink, first, last);
+        }
+
+        [[nodiscard]] inline constexpr ::fast_io::unix_timestamp wasi_fd_output_buffer_now() noexcept
+        {
+#ifdef UWVM_CPP_EXCEPTIONS
+            try
+#endif
+            {
+                return ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic);
+            }
+#ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                // Without a clock the time policy degrades to flushing on every write.
+                return {};
+            }
+#endif
+        }
+
+        [[nodiscard]] inline constexpr bool wasi_fd_output_buffer_interval_elapsed(wasi_fd_output_buffer_t const& buf) noexcept
+        {
+            auto const now{wasi_fd_output_buffer_now()};
+            if(now.seconds == 0 && now.subseconds == 0u) [[unlikely]] { return true; }
+
+            auto const elapsed{now - buf.oldest};
+            if(elapsed.seconds < 0) [[unlikely]] { return false; }
+
+            constexpr ::std::uint_least64_t subseconds_per_ms{::fast_io::uint_least64_subseconds_per_second / 1000u};
+            auto const elapsed_ms{static_cast<::std::uint_least64_t>(elapsed.seconds) * 1000u + elapsed.subseconds / subseconds_per_ms};
+            return elapsed_ms >= buf.interval_ms;
+        }
+    }  // namespace details
+
+    /// @brief  fd_write through the buffer.
+    /// @return The same status a completed `scatter_write_some_bytes` would give: every byte is accepted (buffered or written through).
+    /// @throws ::fast_io::error when a flush or write-through fails; fd_write maps it like a direct write error.
+    inline constexpr ::fast_io::io_scatter_status_t wasi_fd_output_buffer_scatter_write(wasi_fd_output_buffer_t & buf,
+                                                                                       ::fast_io::io_scatter_t const* scatters,
+                                                                                       ::std::size_t scatter_length)
+    {
+        ::uwvm2::utils::mutex::mutex_guard_t buf_lock{buf.mutex};
+
+        ::std::size_t total{};
+        for(::std::size_t i{}; i != scatter_length; ++i) { total += scatters[i].len; }
+
+        auto const capacity{static_cast<::std::size_t>(buf.end - buf.begin)};
+
+        if(total > static_cast<::std::size_t>(buf.end - buf.curr))
+        {
+            details::flush_wasi_fd_output_buffer_locked(buf);
+
+            if(total >= capacity)
+            {
+                // Large writes skip the copy: the buffer is already empty, so ordering is preserved.
+                ::fast_io::operations::scatter_write_all_bytes(buf.sink, scatters, scatter_length);
+                return {scatter_length, 0uz};
+            }
+        }
+
+        bool const was_empty{buf.curr == buf.begin};
+        bool has_newline{};
+
+        for(::std::size_t i{}; i != scatter_length; ++i)
+        {
+            auto const& curr_scatter{scatters[i]};
+            if(curr_scatter.len == 0uz) { continue; }
+
+            auto const src{reinterpret_cast<::std::byte const*>(curr_scatter.base)};
+            ::std::memcpy(buf.curr, src, curr_scatter.len);
+
+            if(buf.policy == wasi_fd_output_flush_t::line && !has_newline)
+            {
+                has_newline = ::std::memchr(src, '\n', curr_scatter.len) != nullptr;
+            }
+
+            buf.curr += curr_scatter.len;
+        }
+
+        switch(buf.policy)
+        {
+            case wasi_fd_output_flush_t::line:
+            {
+                if(has_newline) { details::flush_wasi_fd_output_buffer_locked(buf); }
+                break;
+            }
+            case wasi_fd_output_flush_t::time:
+            {
+                if(was_empty) { buf.oldest = details::wasi_fd_output_buffer_now(); }
+                else if(details::wasi_fd_output_buffer_interval_elapsed(buf)) { details::flush_wasi_fd_output_buffer_locked(buf); }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        return {scatter_length, 0uz};
+    }
+
+    /// @brief  Flush the buffer behind an fd from a WASI call on that fd (fd_sync, fd_seek, fd_close, ...). A null buffer is a no-op.
+    /// @return false if the host write failed; the caller reports eio.
+    [[nodiscard]] inline constexpr bool try_flush_wasi_fd_output_buffer(wasi_fd_output_buffer_t * buf) noexcept
+    {
+        if(buf == nullptr) [[likely]] { return true; }
+
+        ::uwvm2::utils::mutex::mutex_guard_t buf_lock{buf->mutex};
+
+#ifdef UWVM_CPP_EXCEPTIONS
+        try
+#endif
+        {
+            details::flush_wasi_fd_output_buffer_locked(*buf);
+        }
+#ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error)
+        {
+            return false;
+        }
+#endif
+
+        return true;
+    }
+
+    /// @brief Flush a buffer on a shutdown path (proc_exit, process exit, trap). Errors are dropped: there is no guest left to report them to.
+    /// @param may_block When false (traps), a buffer whose lock is held by another thread is skipped rather than risking a deadlock in a dying process.
+    inline constexpr void flush_wasi_fd_output_buffer_noexcept(wasi_fd_output_buffer_t & buf, bool may_block) noexcept
+    {
+        if(!buf.enabled()) { return; }
+
+        if(may_block) { buf.mutex.lock(); }
+        else if(!buf.mutex.try_lock()) { return; }
+
+#ifdef UWVM_CPP_EXCEPTIONS
+        try
+#endif
+        {
+            details::flush_wasi_fd_output_buffer_locked(buf);
+        }
+#ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error)
+        {
+        }
+#endif
+
+        buf.mutex.unlock();
+    }
+
     /// @brief    WASI file descriptor
     /// @details  Using a singleton ensures that when encountering multithreaded scaling during usage, the file descriptors currently in use remain unaffected.
     struct wasi_fd_t
@@ -932,6 +1174,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::fd_manager
         // note: Since SIZE_MAX is used to mark closed files, the maximum number of available files is only SIZE_MAX - 1uz.
         ::std::size_t close_pos{SIZE_MAX};
 
+        // Non-null only for the guest's stdout/stderr when stdio buffering is enabled; the buffer itself belongs to the environment.
+        wasi_fd_output_buffer_t* output_buffer{};
+        // Set on the guest's stdin: fd_read on it first flushes the environment's stdout/stderr buffers so prompts are visible before blocking.
+        bool flush_output_before_read{};
+
         inline constexpr wasi_fd_t() noexcept = default;
 
         inline constexpr wasi_fd_t(wasi_fd_t const& other) noexcept = delete;
@@ -55,7 +55,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::fd_manager
             renumber_map{};
         // Used to record the coordinates of closure for subsequent builds
         ::uwvm2::utils::container::vector<::std::size_t> closes{};
-        ::uwvm2::utils::mutex::rwlock_t fds_rwlock{};  // [singleton]
+        // Every WASI call takes this shared to look up its fd in `opens` or `renumber_map`; only creating, closing and renumbering take it unique.
+        // The reader-sharded lock keeps those lookups from bouncing one cache line between the cores that run guest threads, but they still
+        // acquire it and wait out any writer.
+        ::uwvm2::utils::mutex::sharded_rwlock_t fds_rwlock{};  // [singleton]
         ::std::size_t fd_limit{};
     };
 }
@@ -22,6 +22,7 @@
 module;
 
 export module uwvm2.imported.wasi.wasip1.fd_manager;
+export import :dir_stream;
 export import :fd;
 export import :fd_map;
 
@@ -22,6 +22,7 @@
 #pragma once
 
 #ifndef UWVM_MODULE
+# include "dir_stream.h"
 # include "fd.h"
 # include "fd_map.h"
 #endif
@@ -255,6 +255,40 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
         return result;
     }
 
+    /// @brief Join a split relative path back into `a/b/c`, dropping `.` components.
+    /// @return false if the path contains `..` or does not end in a name. Only paths accepted here are looked up in the path cache or handed to
+    ///         openat2; the others always take the component walk.
+    inline constexpr bool join_plain_relative_path(split_path_res_t const& split_path_res, ::uwvm2::utils::container::u8string& out) noexcept
+    {
+        out.clear();
+
+        if(split_path_res.is_absolute || split_path_res.res.empty()) { return false; }
+        if(split_path_res.res.back_unchecked().dir_type != dir_type_e::next) { return false; }
+
+        for(auto const& split_curr: split_path_res.res)
+        {
+            switch(split_curr.dir_type)
+            {
+                case dir_type_e::curr:
+                {
+                    break;
+                }
+                case dir_type_e::next:
+                {
+                    if(!out.empty()) { out.push_back(u8'/'); }
+                    out.append(::uwvm2::utils::container::u8string_view{split_curr.next_name.data(), split_curr.next_name.size()});
+                    break;
+                }
+                [[unlikely]] default:
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
     template <::uwvm2::imported::wasi::wasip1::environment::wasip1_memory memory_type, typename... Args>
     inline constexpr void print_wasip1_trace_message(::uwvm2::imported::wasi::wasip1::environment::wasip1_environment<memory_type> & env,
                                                      Args && ... args) noexcept
@@ -91,6 +91,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
         auto& wasm_fd_storage{env.fd_storage};
 
         ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_ref_t old_wasi_fd{::uwvm2::imported::wasi::wasip1::fd_manager::wasi_no_construct};
+        // A buffered stdout/stderr is flushed through its host handle before that handle goes away.
+        ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_t* old_output_buffer{};
 
         // Prevent operations to obtain the size or perform resizing at this time.
         // Only a lock is required when acquiring the unique pointer for the file descriptor. The lock can be released once the acquisition is complete.
@@ -111,7 +113,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
         // Manipulating fd_manager requires a unique_lock.
         {
-            ::uwvm2::utils::mutex::rw_fair_unique_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_unique_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // The minimum value in rename_map is greater than opensize.
             if(wasm_fd_storage.opens.size() <= fd_opens_pos)
@@ -135,6 +137,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     auto& curr_fd{*renumber_map_iter->second.fd_p};
                     old_wasi_fd.ptr = curr_fd.wasi_fd.ptr;
                     curr_fd.wasi_fd.ptr = nullptr;
+                    old_output_buffer = curr_fd.output_buffer;
 
                     wasm_fd_storage.renumber_map.erase(renumber_map_iter);
                 }
@@ -215,12 +218,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                 // To prevent the system close operation from taking too much time, the close operation is performed outside the fdmanager lock here.
                 old_wasi_fd.ptr = curr_fd.wasi_fd.ptr;
                 curr_fd.wasi_fd.ptr = nullptr;
+
+                // The slot is reused by the next open; it must not inherit the stdio buffer.
+                old_output_buffer = curr_fd.output_buffer;
+                curr_fd.output_buffer = nullptr;
+                curr_fd.flush_output_before_read = false;
             }
 
             // After unlocking fds_lock, members within `wasm_fd_storage_t` can no longer be accessed or modified.
         }
 
-        if(old_wasi_fd.ptr != nullptr) { old_wasi_fd.reset(); }
+        if(old_output_buffer != nullptr) { ::uwvm2::imported::wasi::wasip1::fd_manager::flush_wasi_fd_output_buffer_noexcept(*old_output_buffer, true); }
+
+        if(old_wasi_fd.ptr != nullptr)
+        {
+            // The host fd number may be reused by the next open, so poll_oneoff's cached registration has to go first.
+            ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_forget(env.poll_reactor, old_wasi_fd);
+            old_wasi_fd.reset();
+        }
 
         return ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess;
     }
@@ -108,7 +108,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t>;
@@ -175,6 +175,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             return ::uwvm2::imported::wasi::wasip1::abi::errno_t::enotcapable;
         }
 
+        // Bytes still in the stdio buffer must reach the host before they can be synced.
+        if(!::uwvm2::imported::wasi::wasip1::fd_manager::try_flush_wasi_fd_output_buffer(curr_fd.output_buffer)) [[unlikely]]
+        {
+            return ::uwvm2::imported::wasi::wasip1::abi::errno_t::eio;
+        }
+
         // If ptr is null, it indicates an attempt to open a closed file. However, the preceding check for close pos already prevents such closed files from
         // being processed, making this a virtual machine implementation error.
         if(curr_fd.wasi_fd.ptr == nullptr) [[unlikely]]
@@ -357,7 +363,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
         auto const curr_fd_native_handle{curr_fd_native_file.native_handle()};
 
 #  if defined(__linux__) && (defined(__NR_fdatasync) && defined(__NR_fsync))
-        auto const result_fdatasync{::fast_io::system_call<__NR_fdatasync, int>(curr_fd_native_handle)};
+        // Goes through the environment's io_uring when one is enabled, otherwise (or if the ring declines) a plain fdatasync.
+        auto const ring_fdatasync{::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_fsync(env.io_uring, curr_fd_native_handle, true)};
+        auto const result_fdatasync{ring_fdatasync == ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_declined
+                                        ? ::fast_io::system_call<__NR_fdatasync, int>(curr_fd_native_handle)
+                                        : static_cast<int>(ring_fdatasync)};
         if(::fast_io::linux_system_call_fails(result_fdatasync)) [[unlikely]]
         {
             auto const err{static_cast<int>(-result_fdatasync)};
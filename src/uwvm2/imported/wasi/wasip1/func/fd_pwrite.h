@@ -145,7 +145,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t>;
@@ -639,7 +639,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             try
 #  endif
             {
-                scatter_status = ::fast_io::operations::scatter_pwrite_some_bytes(curr_fd_native_observer, scatter_base, scatter_length, scatter_p_off);
+                scatter_status = ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_scatter_pwrite_some_bytes(env.io_uring,
+                                                                                                                         curr_fd_native_observer,
+                                                                                                                         scatter_base,
+                                                                                                                         scatter_length,
+                                                                                                                         scatter_p_off);
             }
 #  ifdef UWVM_CPP_EXCEPTIONS
             catch(::fast_io::error e)
@@ -139,7 +139,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
         {
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_wasm64_t>;
             auto const unsigned_fd{static_cast<unsigned_fd_t>(fd)};
@@ -583,7 +583,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             try
 #  endif
             {
-                scatter_status = ::fast_io::operations::scatter_pwrite_some_bytes(curr_fd_native_observer, scatter_base, scatter_length, scatter_p_off);
+                scatter_status = ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_scatter_pwrite_some_bytes(env.io_uring,
+                                                                                                                         curr_fd_native_observer,
+                                                                                                                         scatter_base,
+                                                                                                                         scatter_length,
+                                                                                                                         scatter_p_off);
             }
 #  ifdef UWVM_CPP_EXCEPTIONS
             catch(::fast_io::error e)
@@ -140,7 +140,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t>;
@@ -208,6 +208,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             return ::uwvm2::imported::wasi::wasip1::abi::errno_t::enotcapable;
         }
 
+        // A guest that prints a prompt and then reads stdin expects the prompt to reach the terminal or pipe peer first.
+        if(curr_fd.flush_output_before_read) { ::uwvm2::imported::wasi::wasip1::environment::flush_wasip1_stdio_buffers(env, true); }
+
         // check overflow (wasi_iovec_t)
         constexpr ::std::size_t max_iovs_len{::std::numeric_limits<::std::size_t>::max() / ::uwvm2::imported::wasi::wasip1::abi::size_of_wasi_iovec_t};
         if constexpr(::std::numeric_limits<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>::max() > max_iovs_len)
@@ -599,7 +602,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     try
 #  endif
                     {
-                        scatter_status = ::fast_io::operations::scatter_read_some_bytes(curr_fd_native_observer, scatter_base, scatter_length);
+                        scatter_status = ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_scatter_read_some_bytes(env.io_uring,
+                                                                                                                               curr_fd_native_observer,
+                                                                                                                               scatter_base,
+                                                                                                                               scatter_length);
                     }
 #  ifdef UWVM_CPP_EXCEPTIONS
                     catch(::fast_io::error e)
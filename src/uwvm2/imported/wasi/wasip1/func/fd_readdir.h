@@ -158,7 +158,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t>;
@@ -325,7 +325,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
         {
             return ::uwvm2::imported::wasi::wasip1::abi::errno_t::enotdir;
         }
-#  endif
+# endif
         // Win9x uses pathname emulation, so you can tell directly.
 # else
         struct ::stat stbuf;  // no initialize
@@ -566,225 +566,280 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
     files:
 
-# ifdef UWVM_CPP_EXCEPTIONS
-        try
-# endif
+        // Writes one entry behind the ones already in the buffer and returns false once it is full. A name that does not fit is cut short, so the
+        // guest sees buf_used == buf_len and asks again from the cookie of that entry.
+        auto const write_dirent = [&](::uwvm2::imported::wasi::wasip1::abi::inode_t d_ino,
+                                      char8_t const* d_filename_begin,
+                                      ::std::size_t d_filename_size,
+                                      ::uwvm2::imported::wasi::wasip1::abi::filetype_t d_type) -> bool
         {
-            for(auto const& ent: current(at(curr_fd_native_file)))
-            {
-                // Exclude dot, primarily exclude .., because during the process of opening an FD, other processes can move the FD to any position (Windows
-                // requires setting the FILE_SHARED_WRITE flag to enable this). At this point, .. cannot be trusted. Naturally, we maintain a directory stack.
-                // We obtain the FD from the already-opened directories (reference counts) in the directory stack, and this FD is trustworthy.
-                if(::fast_io::is_dot(ent)) { continue; }
+            auto const d_next{static_cast<::uwvm2::imported::wasi::wasip1::abi::dircookie_t>(dircookie_counter + 1u)};
+            auto const d_namlen{static_cast<::uwvm2::imported::wasi::wasip1::abi::dirnamlen_t>(d_filename_size)};
 
-                ::uwvm2::utils::container::u8cstring_view tmp_filename{u8filename(ent)};
+            // d_namlen is the size_t conversion.
+            auto const curr_write_size{static_cast<::std::size_t>(
+                size_of_wasi_dirent_t +
+                static_cast<::std::size_t>(static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::dirnamlen_t>>(d_namlen)))};
 
-                if(!env.disable_utf8_check) [[likely]]
-                {
-                    auto const u8res{::uwvm2::utils::utf::check_legal_utf8<::uwvm2::utils::utf::utf8_specification::utf8_rfc3629>(tmp_filename.cbegin(),
-                                                                                                                                  tmp_filename.cend())};
-                    if(u8res.err != ::uwvm2::utils::utf::utf_error_code::success) [[unlikely]]
-                    {
-                        // File names are expected to be valid UTF-8. However, the host filesystem might contain entries that are not valid UTF-8.
-                        // Implementations MAY replace invalid sequences with the Unicode replacement character (U+FFFD), or MAY omit such entries.
-                        continue;
-                    }
-                }
-                else
-                {
-                    auto const u8res{::uwvm2::utils::utf::check_has_zero_illegal_unchecked(tmp_filename.cbegin(), tmp_filename.cend())};
-                    if(u8res.err != ::uwvm2::utils::utf::utf_error_code::success) [[unlikely]] { continue; }
-                }
+            if(curr_write_size < size_of_wasi_dirent_t) [[unlikely]]
+            {
+                // Overflow-induced wrap-around, though it returns correctly here.
+                return false;
+            }
 
-                if(dircookie_counter < underlying_dircookie) [[likely]]
+            if constexpr(::std::numeric_limits<::std::size_t>::max() > ::std::numeric_limits<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>::max())
+            {
+                if(curr_write_size > ::std::numeric_limits<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>::max()) [[unlikely]]
                 {
-                    ++dircookie_counter;
-                    continue;
+                    // The size of buf_used exceeds the maximum size of wasi size_t.
+                    return false;
                 }
+            }
 
-                auto const d_next{static_cast<::uwvm2::imported::wasi::wasip1::abi::dircookie_t>(dircookie_counter + 1u)};
-                auto const d_ino{static_cast<::uwvm2::imported::wasi::wasip1::abi::inode_t>(inode_ul64(ent))};
-                auto const d_filename{tmp_filename};
-                auto const d_namlen{static_cast<::uwvm2::imported::wasi::wasip1::abi::dirnamlen_t>(d_filename.size())};
-                ::uwvm2::imported::wasi::wasip1::abi::filetype_t d_type;  // no initialize
+            auto const curr_write_size_wasi{static_cast<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>(curr_write_size)};
+            auto const header_write_size_wasi{static_cast<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>(size_of_wasi_dirent_t)};
+            auto write_size_wasi{curr_write_size_wasi};
 
-                switch(type(ent))
-                {
-                    case ::fast_io::file_type::none:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
-                        break;
-                    }
-                    case ::fast_io::file_type::not_found:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
-                        break;
-                    }
-                    case ::fast_io::file_type::regular:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_regular_file;
-                        break;
-                    }
-                    case ::fast_io::file_type::directory:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_directory;
-                        break;
-                    }
-                    case ::fast_io::file_type::symlink:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_symbolic_link;
-                        break;
-                    }
-                    case ::fast_io::file_type::block:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_block_device;
-                        break;
-                    }
-                    case ::fast_io::file_type::character:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_character_device;
-                        break;
-                    }
-                    case ::fast_io::file_type::fifo:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
-                        break;
-                    }
-                    case ::fast_io::file_type::socket:
-                    {
-                        // You won't encounter sockets in the directory.
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
-                        break;
-                    }
-                    case ::fast_io::file_type::unknown:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
-                        break;
-                    }
-                    case ::fast_io::file_type::remote:
-                    {
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
-                        break;
-                    }
-                    [[unlikely]] default:
-                    {
-# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-                        ::uwvm2::utils::debug::trap_and_inform_bug_pos();
-# endif
+            if(buf_remaining_size < curr_write_size_wasi)
+            {
+                // The remaining size of the buffer is less than the writable size.
+                if(buf_remaining_size < header_write_size_wasi) [[unlikely]] { return false; }
 
-                        d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
-                        break;
-                    }
-                }
+                write_size_wasi = buf_remaining_size;
+            }
 
-                // d_namlen is the size_t conversion.
-                auto const curr_write_size{static_cast<::std::size_t>(
-                    size_of_wasi_dirent_t +
-                    static_cast<::std::size_t>(static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::dirnamlen_t>>(d_namlen)))};
+            auto const new_byte_write_all_size{static_cast<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>(byte_write_all_size + write_size_wasi)};
+            if(new_byte_write_all_size < byte_write_all_size) [[unlikely]]
+            {
+                // Overflow-induced wrap-around, though it returns correctly here.
+                return false;
+            }
 
-                if(curr_write_size < size_of_wasi_dirent_t) [[unlikely]]
-                {
-                    // Overflow-induced wrap-around, though it returns correctly here.
-                    break;
-                }
+            // write to memory (Check all boundaries)
+            ::uwvm2::imported::wasi::wasip1::memory::check_memory_bounds_wasm32(memory, buf_ptrsz, new_byte_write_all_size);
 
-                if constexpr(::std::numeric_limits<::std::size_t>::max() > ::std::numeric_limits<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>::max())
-                {
-                    if(curr_write_size > ::std::numeric_limits<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>::max()) [[unlikely]]
-                    {
-                        // The size of buf_used exceeds the maximum size of wasi size_t.
-                        break;
-                    }
-                }
+            // After verification, `buf_ptrsz + byte_write_all_size + curr_write_size_wasi` will not overflow.
 
-                auto const curr_write_size_wasi{static_cast<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>(curr_write_size)};
-                auto const header_write_size_wasi{static_cast<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>(size_of_wasi_dirent_t)};
-                auto write_size_wasi{curr_write_size_wasi};
+            if constexpr(is_default_wasi_dirent_data_layout())
+            {
+                // If the memory is identical, it is copied directly, which is the most efficient approach.
+                wasi_dirent_t tmp_wasi_dirent;  // no initialize
+                tmp_wasi_dirent.d_next = d_next;
+                tmp_wasi_dirent.d_ino = d_ino;
+                tmp_wasi_dirent.d_namlen = d_namlen;
+                tmp_wasi_dirent.d_type = d_type;
 
-                if(buf_remaining_size < curr_write_size_wasi)
-                {
-                    // The remaining size of the buffer is less than the writable size.
-                    if(buf_remaining_size < header_write_size_wasi) [[unlikely]] { break; }
+                ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32_unchecked(
+                    memory,
+                    buf_ptrsz + byte_write_all_size,
+                    reinterpret_cast<::std::byte const*>(::std::addressof(tmp_wasi_dirent)),
+                    reinterpret_cast<::std::byte const*>(::std::addressof(tmp_wasi_dirent)) + sizeof(tmp_wasi_dirent));
+            }
+            else
+            {
+                // Ensure the structure meets the requirements for wasi memory.
+                ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
+                    memory,
+                    buf_ptrsz + byte_write_all_size,
+                    static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::dircookie_t>>(d_next));
 
-                    write_size_wasi = buf_remaining_size;
-                }
+                ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
+                    memory,
+                    buf_ptrsz + byte_write_all_size + 8u,
+                    static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::inode_t>>(d_ino));
 
-                auto const new_byte_write_all_size{static_cast<::uwvm2::imported::wasi::wasip1::abi::wasi_size_t>(byte_write_all_size + write_size_wasi)};
-                if(new_byte_write_all_size < byte_write_all_size) [[unlikely]]
-                {
-                    // Overflow-induced wrap-around, though it returns correctly here.
-                    break;
-                }
+                ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
+                    memory,
+                    buf_ptrsz + byte_write_all_size + 16u,
+                    static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::dirnamlen_t>>(d_namlen));
+
+                ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
+                    memory,
+                    buf_ptrsz + byte_write_all_size + 20u,
+                    static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::filetype_t>>(d_type));
+            }
+
+            if(write_size_wasi > header_write_size_wasi)
+            {
+                auto const filename_write_size{static_cast<::std::size_t>(write_size_wasi - header_write_size_wasi)};
 
-                // write to memory (Check all boundaries)
-                ::uwvm2::imported::wasi::wasip1::memory::check_memory_bounds_wasm32(memory, buf_ptrsz, new_byte_write_all_size);
+                ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32_unchecked(
+                    memory,
+                    buf_ptrsz + byte_write_all_size + size_of_wasi_dirent_t,
+                    reinterpret_cast<::std::byte const*>(d_filename_begin),
+                    reinterpret_cast<::std::byte const*>(d_filename_begin + filename_write_size));
+            }
 
-                // After verification, `buf_ptrsz + byte_write_all_size + curr_write_size_wasi` will not overflow.
+            // Settlement upon completion of writing
+            buf_remaining_size -= write_size_wasi;
+            byte_write_all_size = new_byte_write_all_size;
 
-                if constexpr(is_default_wasi_dirent_data_layout())
+            ++dircookie_counter;
+            return true;
+        };
+
+        auto& curr_dir_stream{curr_fd.wasi_fd.ptr->wasi_fd_storage.storage.dir_stack.stream};
+
+        // On Linux the fd keeps a directory stream (see dir_stream.h), so resuming at a cookie does not walk the directory again. Cookie 0
+        // rewinds it, and any path_* call that changed the namespace since it was filled makes it start over.
+        if(::uwvm2::imported::wasi::wasip1::fd_manager::dir_stream_prepare(curr_dir_stream,
+                                                                            curr_fd_native_file,
+                                                                            env.path_cache.generation.load(::std::memory_order_acquire),
+                                                                            underlying_dircookie == 0u))
+        {
+            // Stream entries are numbered from the first name after "..".
+            ::std::size_t stream_index{};
+            bool stream_index_valid{true};
+
+            if(dircookie_counter < underlying_dircookie)
+            {
+                auto const skip_count{underlying_dircookie - dircookie_counter};
+                if constexpr(::std::numeric_limits<underlying_dircookie_t>::max() > ::std::numeric_limits<::std::size_t>::max())
                 {
-                    // If the memory is identical, it is copied directly, which is the most efficient approach.
-                    wasi_dirent_t tmp_wasi_dirent;  // no initialize
-                    tmp_wasi_dirent.d_next = d_next;
-                    tmp_wasi_dirent.d_ino = d_ino;
-                    tmp_wasi_dirent.d_namlen = d_namlen;
-                    tmp_wasi_dirent.d_type = d_type;
-
-                    ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32_unchecked(
-                        memory,
-                        buf_ptrsz + byte_write_all_size,
-                        reinterpret_cast<::std::byte const*>(::std::addressof(tmp_wasi_dirent)),
-                        reinterpret_cast<::std::byte const*>(::std::addressof(tmp_wasi_dirent)) + sizeof(tmp_wasi_dirent));
+                    // Such a cookie lies past the end of any directory.
+                    if(skip_count > ::std::numeric_limits<::std::size_t>::max()) { stream_index_valid = false; }
                 }
-                else
+                stream_index = static_cast<::std::size_t>(skip_count);
+                dircookie_counter = underlying_dircookie;
+            }
+
+            for(; stream_index_valid; ++stream_index)
+            {
+                auto const ent{::uwvm2::imported::wasi::wasip1::fd_manager::dir_stream_find(*curr_dir_stream.ptr, stream_index, env.disable_utf8_check)};
+                if(ent == nullptr) { break; }
+
+                if(!write_dirent(static_cast<::uwvm2::imported::wasi::wasip1::abi::inode_t>(ent->ino),
+                                 ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stream_name(*curr_dir_stream.ptr, *ent),
+                                 static_cast<::std::size_t>(ent->name_len),
+                                 ent->type))
                 {
-                    // Ensure the structure meets the requirements for wasi memory.
-                    ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
-                        memory,
-                        buf_ptrsz + byte_write_all_size,
-                        static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::dircookie_t>>(d_next));
-
-                    ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
-                        memory,
-                        buf_ptrsz + byte_write_all_size + 8u,
-                        static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::inode_t>>(d_ino));
-
-                    ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
-                        memory,
-                        buf_ptrsz + byte_write_all_size + 16u,
-                        static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::dirnamlen_t>>(d_namlen));
-
-                    ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32_unchecked(
-                        memory,
-                        buf_ptrsz + byte_write_all_size + 20u,
-                        static_cast<::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::filetype_t>>(d_type));
+                    break;
                 }
-
-                if(write_size_wasi > header_write_size_wasi)
+            }
+        }
+        else
+        {
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                for(auto const& ent: current(at(curr_fd_native_file)))
                 {
-                    auto const filename_write_size{static_cast<::std::size_t>(write_size_wasi - header_write_size_wasi)};
+                    // Exclude dot, primarily exclude .., because during the process of opening an FD, other processes can move the FD to any position
+                    // (Windows requires setting the FILE_SHARED_WRITE flag to enable this). At this point, .. cannot be trusted. Naturally, we maintain a
+                    // directory stack. We obtain the FD from the already-opened directories (reference counts) in the directory stack, and this FD is
+                    // trustworthy.
+                    if(::fast_io::is_dot(ent)) { continue; }
 
-                    ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32_unchecked(
-                        memory,
-                        buf_ptrsz + byte_write_all_size + size_of_wasi_dirent_t,
-                        reinterpret_cast<::std::byte const*>(d_filename.cbegin()),
-                        reinterpret_cast<::std::byte const*>(d_filename.cbegin() + filename_write_size));
-                }
+                    ::uwvm2::utils::container::u8cstring_view tmp_filename{u8filename(ent)};
 
-                // Settlement upon completion of writing
-                buf_remaining_size -= write_size_wasi;
-                byte_write_all_size = new_byte_write_all_size;
+                    if(!env.disable_utf8_check) [[likely]]
+                    {
+                        auto const u8res{::uwvm2::utils::utf::check_legal_utf8<::uwvm2::utils::utf::utf8_specification::utf8_rfc3629>(tmp_filename.cbegin(),
+                                                                                                                                      tmp_filename.cend())};
+                        if(u8res.err != ::uwvm2::utils::utf::utf_error_code::success) [[unlikely]]
+                        {
+                            // File names are expected to be valid UTF-8. However, the host filesystem might contain entries that are not valid UTF-8.
+                            // Implementations MAY replace invalid sequences with the Unicode replacement character (U+FFFD), or MAY omit such entries.
+                            continue;
+                        }
+                    }
+                    else
+                    {
+                        auto const u8res{::uwvm2::utils::utf::check_has_zero_illegal_unchecked(tmp_filename.cbegin(), tmp_filename.cend())};
+                        if(u8res.err != ::uwvm2::utils::utf::utf_error_code::success) [[unlikely]] { continue; }
+                    }
 
-                ++dircookie_counter;
+                    if(dircookie_counter < underlying_dircookie) [[likely]]
+                    {
+                        ++dircookie_counter;
+                        continue;
+                    }
+
+                    auto const d_ino{static_cast<::uwvm2::imported::wasi::wasip1::abi::inode_t>(inode_ul64(ent))};
+                    auto const d_filename{tmp_filename};
+                    ::uwvm2::imported::wasi::wasip1::abi::filetype_t d_type;  // no initialize
+
+                    switch(type(ent))
+                    {
+                        case ::fast_io::file_type::none:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                            break;
+                        }
+                        case ::fast_io::file_type::not_found:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                            break;
+                        }
+                        case ::fast_io::file_type::regular:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_regular_file;
+                            break;
+                        }
+                        case ::fast_io::file_type::directory:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_directory;
+                            break;
+                        }
+                        case ::fast_io::file_type::symlink:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_symbolic_link;
+                            break;
+                        }
+                        case ::fast_io::file_type::block:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_block_device;
+                            break;
+                        }
+                        case ::fast_io::file_type::character:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_character_device;
+                            break;
+                        }
+                        case ::fast_io::file_type::fifo:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                            break;
+                        }
+                        case ::fast_io::file_type::socket:
+                        {
+                            // You won't encounter sockets in the directory.
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                            break;
+                        }
+                        case ::fast_io::file_type::unknown:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                            break;
+                        }
+                        case ::fast_io::file_type::remote:
+                        {
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                            break;
+                        }
+                        [[unlikely]] default:
+                        {
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                            ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+# endif
+
+                            d_type = ::uwvm2::imported::wasi::wasip1::abi::filetype_t::filetype_unknown;
+                            break;
+                        }
+                    }
+
+                    if(!write_dirent(d_ino, d_filename.cbegin(), d_filename.size(), d_type)) { break; }
+                }
             }
-        }
 # ifdef UWVM_CPP_EXCEPTIONS
-        catch(::fast_io::error)
-        {
-            // Exceptions may only be thrown when acquiring the iterator. In such cases, write directly to `all_byte` and then return.
-            // WASI Semantic Specification: For a valid directory file descriptor, `fd_readdir` should not return an error.
-        }
+            catch(::fast_io::error)
+            {
+                // Exceptions may only be thrown when acquiring the iterator. In such cases, write directly to `all_byte` and then return.
+                // WASI Semantic Specification: For a valid directory file descriptor, `fd_readdir` should not return an error.
+            }
 # endif
+        }
 
         // need check
         ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(
@@ -114,7 +114,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
         // If same fd, only succeed when fd_from is valid (exists and not closed)
         if(fd_opens_pos_from == fd_opens_pos_to) [[unlikely]]
         {
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
             bool valid;  // no initialize
             if(wasm_fd_storage.opens.size() > fd_opens_pos_from)
             {
@@ -140,7 +140,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             ::uwvm2::utils::mutex::mutex_merely_release_guard_t curr_fd_release_guard_from{};
 
             // Manipulating fd_manager requires a unique_lock.
-            ::uwvm2::utils::mutex::rw_fair_unique_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_unique_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // from
 
@@ -284,7 +284,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
         }
 
         // Delayed destruction of displaced fd to avoid UB during lock-held destruction
-        if(displaced_fd_p) { ::uwvm2::imported::wasi::wasip1::fd_manager::destroy_wasi_fd(displaced_fd_p); }
+        if(displaced_fd_p)
+        {
+            // Closing the displaced fd frees its host fd number; drop poll_oneoff's cached registration before that happens.
+            ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_forget(env.poll_reactor, displaced_fd_p->wasi_fd);
+            // Likewise, a displaced stdout/stderr writes out its buffered bytes while its host handle is still open.
+            if(displaced_fd_p->output_buffer != nullptr)
+            {
+                ::uwvm2::imported::wasi::wasip1::fd_manager::flush_wasi_fd_output_buffer_noexcept(*displaced_fd_p->output_buffer, true);
+            }
+            ::uwvm2::imported::wasi::wasip1::fd_manager::destroy_wasi_fd(displaced_fd_p);
+        }
 
         return ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess;
     }
@@ -134,7 +134,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
         {
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_wasm64_t>;
@@ -423,7 +423,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     try
 #  endif
                     {
-                        scatter_status = ::fast_io::operations::scatter_write_some_bytes(curr_fd_native_observer, scatter_base, scatter_length);
+                        if(curr_fd.output_buffer != nullptr)
+                        {
+                            scatter_status = ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_scatter_write(*curr_fd.output_buffer,
+                                                                                                                              scatter_base,
+                                                                                                                              scatter_length);
+                        }
+                        else
+                        {
+                            scatter_status = ::fast_io::operations::scatter_write_some_bytes(curr_fd_native_observer, scatter_base, scatter_length);
+                        }
                     }
 #  ifdef UWVM_CPP_EXCEPTIONS
                     catch(::fast_io::error e)
@@ -568,8 +577,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     // posix
 
                     // Reading or writing a directory file is undefined behavior on POSIX systems. Here, it uniformly returns `isdir`.
+                    // A buffered stdio fd was checked to be a pipe or regular file when the buffer was attached.
                     struct ::stat stbuf;  // no initialize
-                    if(::uwvm2::imported::wasi::wasip1::func::posix::fstat(curr_fd_native_observer.native_handle(), ::std::addressof(stbuf)) == 0 &&
+                    if(curr_fd.output_buffer == nullptr &&
+                       ::uwvm2::imported::wasi::wasip1::func::posix::fstat(curr_fd_native_observer.native_handle(), ::std::addressof(stbuf)) == 0 &&
                        S_ISDIR(stbuf.st_mode))
                     {
                         return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::eisdir;
@@ -581,7 +592,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     try
 #  endif
                     {
-                        scatter_status = ::fast_io::operations::scatter_write_some_bytes(curr_fd_native_observer, scatter_base, scatter_length);
+                        if(curr_fd.output_buffer != nullptr)
+                        {
+                            scatter_status = ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_scatter_write(*curr_fd.output_buffer,
+                                                                                                                              scatter_base,
+                                                                                                                              scatter_length);
+                        }
+                        else
+                        {
+                            scatter_status = ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_scatter_write_some_bytes(
+                                env.io_uring, curr_fd_native_observer, scatter_base, scatter_length);
+                        }
                     }
 #  ifdef UWVM_CPP_EXCEPTIONS
                     catch(::fast_io::error e)
@@ -144,7 +144,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_wasm64_t>;
@@ -375,6 +375,57 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
         // cend cannot be nullptr
         auto const split_last{split_path_res.res.cend() - 1u};
 
+        // Plain relative paths (no `..`, ending in a name) first try the path cache and, on Linux, a single openat2 below the directory. Any
+        // outcome the fast path cannot reproduce exactly (symlink escapes, ELOOP, EXDEV, ...) is left to the component walk below.
+        ::uwvm2::utils::container::u8string plain_path{};
+        if(::uwvm2::imported::wasi::wasip1::func::join_plain_relative_path(split_path_res, plain_path))
+        {
+            if(::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_is_negative(env.path_cache, curr_dir_stack_entry, plain_path))
+            {
+                return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::enoent;
+            }
+
+# if defined(__linux__) && defined(O_PATH)
+            int fast_open_flags{O_PATH | O_CLOEXEC};
+            if(!symlink_follow) { fast_open_flags |= O_NOFOLLOW; }
+
+            int const fast_fd{::uwvm2::imported::wasi::wasip1::environment::wasip1_openat2_beneath(curr_fd_native_file.native_handle(),
+                                                                                                  reinterpret_cast<char const*>(plain_path.c_str()),
+                                                                                                  fast_open_flags,
+                                                                                                  0u)};
+            if(fast_fd >= 0)
+            {
+                ::fast_io::posix_file const fast_file{fast_fd};
+
+#  ifdef UWVM_CPP_EXCEPTIONS
+                try
+#  endif
+                {
+                    open_file_status = ::fast_io::status(fast_file);
+                }
+#  ifdef UWVM_CPP_EXCEPTIONS
+                catch(::fast_io::error e)
+                {
+                    return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(e);
+                }
+#  endif
+
+                goto path_resolved;
+            }
+            else if(fast_fd == -ENOENT)
+            {
+                if(env.path_cache.enabled &&
+                   (!symlink_follow ||
+                    ::uwvm2::imported::wasi::wasip1::environment::wasip1_openat2_name_absent(curr_fd_native_file.native_handle(),
+                                                                                            reinterpret_cast<char const*>(plain_path.c_str()))))
+                {
+                    ::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_store_negative(env.path_cache, curr_dir_stack_entry, plain_path);
+                }
+                return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::enoent;
+            }
+# endif
+        }
+
         for(auto split_curr{split_path_res.res.cbegin()}; split_curr != split_path_res.res.cend(); ++split_curr)
         {
             if(split_curr == split_last)
@@ -1140,6 +1191,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             }
         }
 
+# if defined(__linux__) && defined(O_PATH)
+    path_resolved:
+# endif
+
         // set
 
         st_dev = static_cast<::uwvm2::imported::wasi::wasip1::abi::device_wasm64_t>(open_file_status.dev);
@@ -158,7 +158,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                 // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
                 // Simply acquiring data using a shared_lock
-                ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+                ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
                 // Negative states have been excluded, so the conversion result will only be positive numbers.
                 using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_wasm64_t>;
@@ -488,6 +488,74 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // cend cannot be nullptr
             auto const split_last{split_path_res.res.cend() - 1u};
 
+            // Plain relative paths (no `..`, ending in a name) first try the path cache and, for regular files on Linux, a single openat2 below
+            // the directory. Any outcome the fast path cannot reproduce exactly (symlink escapes, ELOOP, EXDEV, ...) is left to the walk below.
+            ::uwvm2::utils::container::u8string plain_path{};
+            bool const is_plain_path{::uwvm2::imported::wasi::wasip1::func::join_plain_relative_path(split_path_res, plain_path)};
+
+            // An open that may create can add a name, so later lookups must not trust negative entries recorded before it. `out` without
+            // `in` and `app` create as well, so this follows the final open flags, not just the guest's o_creat.
+            bool const may_create{::uwvm2::imported::wasi::wasip1::environment::wasip1_open_may_create(fast_io_oflags)};
+            ::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_invalidate_guard_t path_cache_guard{
+                may_create ? ::std::addressof(env.path_cache) : nullptr,
+                ::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_change_t::created};
+
+            // Directory chains are recorded with symlinks followed, which is the only mode they may be replayed in.
+            bool const is_cacheable_dir{is_plain_path && is_dir && symlink_follow && env.path_cache.enabled};
+
+            if(is_plain_path)
+            {
+                if(!may_create &&
+                   ::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_is_negative(env.path_cache, curr_dir_stack_entry, plain_path))
+                {
+                    return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::enoent;
+                }
+
+                if(is_cacheable_dir)
+                {
+                    auto& storage_dir_stack{new_wasi_fd.fd_p->wasi_fd.ptr->wasi_fd_storage.storage.dir_stack};
+                    storage_dir_stack = curr_dir_stack;
+
+                    if(::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_append_dirs(env.path_cache,
+                                                                                                   curr_dir_stack_entry,
+                                                                                                   plain_path,
+                                                                                                   storage_dir_stack))
+                    {
+                        goto path_opened;
+                    }
+                }
+
+# if defined(__linux__)
+                if(!is_dir)
+                {
+                    int fast_open_flags{::uwvm2::imported::wasi::wasip1::environment::wasip1_posix_open_flags(fast_io_oflags)};
+                    if(symlink_follow) { fast_open_flags &= ~O_NOFOLLOW; }
+
+                    int const fast_fd{::uwvm2::imported::wasi::wasip1::environment::wasip1_openat2_beneath(curr_fd_native_file.native_handle(),
+                                                                                                          reinterpret_cast<char const*>(plain_path.c_str()),
+                                                                                                          fast_open_flags,
+                                                                                                          436u)};
+                    if(fast_fd >= 0)
+                    {
+                        new_wasi_fd.fd_p->wasi_fd.ptr->wasi_fd_storage.storage.file_fd = ::fast_io::native_file{fast_fd};
+                        goto path_opened;
+                    }
+                    else if(fast_fd == -ENOENT)
+                    {
+                        // With O_CREAT, ENOENT means a missing parent directory, which says nothing about `plain_path` itself.
+                        if(!may_create && env.path_cache.enabled &&
+                           (!symlink_follow ||
+                            ::uwvm2::imported::wasi::wasip1::environment::wasip1_openat2_name_absent(curr_fd_native_file.native_handle(),
+                                                                                                    reinterpret_cast<char const*>(plain_path.c_str()))))
+                        {
+                            ::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_store_negative(env.path_cache, curr_dir_stack_entry, plain_path);
+                        }
+                        return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::enoent;
+                    }
+                }
+# endif
+            }
+
             for(auto split_curr{split_path_res.res.begin()}; split_curr != split_path_res.res.end(); ++split_curr)
             {
                 if(split_curr == split_last)
@@ -1437,6 +1505,18 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                 }
             }
 
+            if(is_cacheable_dir)
+            {
+                auto const& storage_dir_stack{new_wasi_fd.fd_p->wasi_fd.ptr->wasi_fd_storage.storage.dir_stack.dir_stack};
+                ::uwvm2::imported::wasi::wasip1::environment::wasip1_path_cache_store_dirs(env.path_cache,
+                                                                                           curr_dir_stack_entry,
+                                                                                           plain_path,
+                                                                                           storage_dir_stack.cbegin() + curr_dir_stack.dir_stack.size(),
+                                                                                           storage_dir_stack.cend());
+            }
+
+        path_opened:
+
             // curr_fd_release_guard destructor release the lock.
         }
 
@@ -1448,7 +1528,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
         {
             // Manipulating fd_manager requires a unique_lock.
-            ::uwvm2::utils::mutex::rw_fair_unique_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_unique_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // check limit
             using fd_t = ::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_wasm64_t;
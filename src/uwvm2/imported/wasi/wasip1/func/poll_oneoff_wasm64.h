@@ -392,6 +392,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
 
         // subscriptions.size() == nsubscriptions
 
+        // The guest is about to wait; do not leave its stdout/stderr in the host-side buffers meanwhile.
+        ::uwvm2::imported::wasi::wasip1::environment::flush_wasip1_stdio_buffers(env, true);
+
         if(nsubscriptions == 1u && subscriptions.front_unchecked().u.tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_clock)
         {
             // Optional blocking behaviour: if there is exactly one clock subscription,
@@ -581,9 +584,22 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // winnt 5.0+ WaitForMultipleObjectsEx
 
             // For those who use their own FD
+# if defined(__linux__) && (defined(__NR_epoll_create1) || defined(__NR_epoll_create)) && defined(__NR_epoll_ctl) && defined(__NR_timerfd_create) &&           \
+      defined(__NR_timerfd_settime) && defined(__NR_epoll_wait)
+            // The environment's reactor keeps the epoll instance, its registrations and this scratch across calls. A thread that finds it busy
+            // (another thread is inside poll_oneoff) gets a one-shot reactor instead of waiting behind that thread's epoll_wait.
+            ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_t one_shot_reactor{};
+            ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_lease_t const reactor_lease{env.poll_reactor, one_shot_reactor};
+            auto& reactor{reactor_lease.get()};
+
+            auto& fd_p_vector{reactor.fd_p_vector};
+            auto& fd_release_guards_vector{reactor.fd_release_guards_vector};
+            auto& fd_unique_set{reactor.fd_unique_set};
+# else
             ::uwvm2::utils::container::vector<::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_t*> fd_p_vector{};
             ::uwvm2::utils::container::vector<::uwvm2::utils::mutex::mutex_merely_release_guard_t> fd_release_guards_vector{};
             ::uwvm2::utils::container::unordered_flat_set<::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_t*> fd_unique_set{};
+# endif
 
             [[maybe_unused]] auto get_fd_from_wasm_fd{
                 [&env, &fd_p_vector, &fd_release_guards_vector, &fd_unique_set](
@@ -599,7 +615,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     auto& wasm_fd_storage{env.fd_storage};
 
                     // Simply acquiring data using a shared_lock
-                    ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+                    ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
                     // Negative states have been excluded, so the conversion result will only be positive numbers.
                     using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_wasm64_t>;
@@ -753,32 +769,25 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
       defined(__NR_timerfd_settime) && defined(__NR_epoll_wait)
             // syscall __NR_epoll_create1 or __NR_epoll_create, __NR_epoll_ctl, __NR_timerfd_create, __NR_timerfd_settime, __NR_epoll_wait
 
-            ::uwvm2::utils::container::vector<::fast_io::posix_file> fds{};  // RAII Close
             bool has_epoll_interest{};
 
-            int const epfd{
-#   if defined(__NR_epoll_create1)
-                ::fast_io::system_call<__NR_epoll_create1, int>(EPOLL_CLOEXEC)
-#   else
-                ::fast_io::system_call<__NR_epoll_create, int>(1)
-#   endif
-            };
-
-            if(::fast_io::linux_system_call_fails(epfd)) [[unlikely]]
+            int const open_ret{::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_open(reactor)};
+            if(::fast_io::linux_system_call_fails(open_ret)) [[unlikely]]
             {
                 ::fast_io::error fe{};
                 fe.domain = ::fast_io::posix_domain_value;
-                fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-epfd));
+                fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-open_ret));
 
                 return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
             }
 
-            // add to raii close
-            fds.push_back(::fast_io::posix_file{epfd});
+            // Same order as `subscriptions`: what each one waits on, so ready events can be mapped back to it.
+            auto& slots{reactor.slots};
+            slots.resize(subscriptions.size());
 
-            ::uwvm2::utils::container::vector<struct ::epoll_event> ep_events{};
-            for(auto const& sub: subscriptions)
+            for(::std::size_t sub_index{}; auto const& sub: subscriptions)
             {
+                auto& slot{slots.index_unchecked(sub_index++)};
                 switch(sub.u.tag)
                 {
                     case ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_read: [[fallthrough]];
@@ -865,46 +874,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                         }
                         auto const& curr_fd_native_file{curr_io_observer};
 
-                        struct ::epoll_event ev{};
-
                         bool const is_write{sub.u.tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_write};
-                        ev.events = is_write ? EPOLLOUT : EPOLLIN;
 
-                        ev.data.ptr = const_cast<void*>(static_cast<void const*>(::std::addressof(sub)));
-
-                        int ret{::fast_io::system_call<__NR_epoll_ctl, int>(epfd, EPOLL_CTL_ADD, curr_fd_native_file.native_handle(), ::std::addressof(ev))};
-                        if(::fast_io::linux_system_call_fails(ret)) [[unlikely]]
-                        {
-                            auto err{-ret};
-
-                            if(err == EEXIST)
-                            {
-                                // The same underlying fd already exists in the epoll instance.
-                                // Upgrade the interest set to monitor both read and write events,
-                                // so that multiple subscriptions (read and write) on the same fd
-                                // will not lose notifications.
-                                ev.events = EPOLLIN | EPOLLOUT;
-
-                                ret =
-                                    ::fast_io::system_call<__NR_epoll_ctl, int>(epfd, EPOLL_CTL_MOD, curr_fd_native_file.native_handle(), ::std::addressof(ev));
-                                if(::fast_io::linux_system_call_fails(ret)) [[unlikely]]
-                                {
-                                    ::fast_io::error fe{};
-                                    fe.domain = ::fast_io::posix_domain_value;
-                                    fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-ret));
-
-                                    return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
-                                }
-                            }
-                            else
-                            {
-                                ::fast_io::error fe{};
-                                fe.domain = ::fast_io::posix_domain_value;
-                                fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(err));
-
-                                return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
-                            }
-                        }
+                        // Read and write subscriptions on one fd merge into a single registration.
+                        slot.native_fd = curr_fd_native_file.native_handle();
+                        ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_want(reactor, slot.native_fd, is_write ? EPOLLOUT : EPOLLIN);
 
                         has_epoll_interest = true;
 
@@ -981,84 +955,22 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                             }
                         }
 
-                        constexpr timestamp_integral_t one_billion{1'000'000'000u};
-
                         // timerfd cannot set 0ns
                         if(effective_timeout == 0u) { effective_timeout = static_cast<timestamp_integral_t>(1u); }
 
-                        auto const seconds_part{effective_timeout / one_billion};
-                        auto const ns_rem{effective_timeout % one_billion};
-
-                        int linux_clock_id;  // no initialize
-
-                        switch(clock_id)
+                        using clockid_underlying_t = ::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::clockid_wasm64_t>;
+                        auto const clock_slot{static_cast<clockid_underlying_t>(clock_id)};
+                        if(clock_slot >= ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_clock_count) [[unlikely]]
                         {
-                            case ::uwvm2::imported::wasi::wasip1::abi::clockid_wasm64_t::clock_realtime:
-                            {
-                                linux_clock_id = CLOCK_REALTIME;
-                                break;
-                            }
-                            case ::uwvm2::imported::wasi::wasip1::abi::clockid_wasm64_t::clock_monotonic:
-                            {
-                                linux_clock_id = CLOCK_MONOTONIC;
-                                break;
-                            }
-                            case ::uwvm2::imported::wasi::wasip1::abi::clockid_wasm64_t::clock_process_cputime_id:
-                            {
-                                linux_clock_id = CLOCK_PROCESS_CPUTIME_ID;
-                                break;
-                            }
-                            case ::uwvm2::imported::wasi::wasip1::abi::clockid_wasm64_t::clock_thread_cputime_id:
-                            {
-                                linux_clock_id = CLOCK_THREAD_CPUTIME_ID;
-                                break;
-                            }
-                            [[unlikely]] default:
-                            {
-                                return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::einval;
-                            }
-                        }
-
-                        int const tfd{::fast_io::system_call<__NR_timerfd_create, int>(linux_clock_id, TFD_NONBLOCK | TFD_CLOEXEC)};
-                        if(::fast_io::linux_system_call_fails(tfd)) [[unlikely]]
-                        {
-                            ::fast_io::error fe{};
-                            fe.domain = ::fast_io::posix_domain_value;
-                            fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-tfd));
-
-                            return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
-                        }
-
-                        // add to raii close
-                        fds.push_back(::fast_io::posix_file{tfd});
-
-                        struct ::itimerspec ts{};
-                        ts.it_value.tv_sec = static_cast<decltype(ts.it_value.tv_sec)>(seconds_part);
-                        ts.it_value.tv_nsec = static_cast<decltype(ts.it_value.tv_nsec)>(ns_rem);
-
-                        int ret{::fast_io::system_call<__NR_timerfd_settime, int>(tfd, 0, ::std::addressof(ts), nullptr)};
-                        if(::fast_io::linux_system_call_fails(ret)) [[unlikely]]
-                        {
-                            ::fast_io::error fe{};
-                            fe.domain = ::fast_io::posix_domain_value;
-                            fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-ret));
-
-                            return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
+                            return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::einval;
                         }
 
-                        struct ::epoll_event ev{};
-                        ev.events = EPOLLIN;
-                        ev.data.ptr = const_cast<void*>(static_cast<void const*>(::std::addressof(sub)));
+                        slot.clock_slot = static_cast<unsigned>(clock_slot);
+                        slot.timeout = static_cast<::std::uint_least64_t>(effective_timeout);
 
-                        ret = ::fast_io::system_call<__NR_epoll_ctl, int>(epfd, EPOLL_CTL_ADD, tfd, ::std::addressof(ev));
-                        if(::fast_io::linux_system_call_fails(ret)) [[unlikely]]
-                        {
-                            ::fast_io::error fe{};
-                            fe.domain = ::fast_io::posix_domain_value;
-                            fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-ret));
-
-                            return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
-                        }
+                        // One timerfd per clock, armed with the shortest timeout among this call's subscriptions on it.
+                        auto& timer_wanted{reactor.timer_wanted[clock_slot]};
+                        if(timer_wanted == 0u || slot.timeout < timer_wanted) { timer_wanted = slot.timeout; }
 
                         has_epoll_interest = true;
 
@@ -1088,18 +1000,101 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                 return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::esuccess;
             }
 
+            // A wait on the realtime/monotonic clocks alone becomes one ring timeout when the environment's io_uring is enabled, instead of
+            // arming a timerfd and entering epoll_wait. The reactor's timers are not touched; the next call that needs them re-syncs them.
+            if(immediate_events.empty() && reactor.wanted.empty() && reactor.timer_wanted[2u] == 0u && reactor.timer_wanted[3u] == 0u)
+            {
+                auto sleep_timeout{reactor.timer_wanted[0u]};
+                if(sleep_timeout == 0u || (reactor.timer_wanted[1u] != 0u && reactor.timer_wanted[1u] < sleep_timeout))
+                {
+                    sleep_timeout = reactor.timer_wanted[1u];
+                }
+
+                auto const sleep_ret{::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_sleep(env.io_uring, sleep_timeout)};
+                if(sleep_ret != ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_declined)
+                {
+                    if(sleep_ret < 0) [[unlikely]]
+                    {
+                        ::fast_io::error fe{};
+                        fe.domain = ::fast_io::posix_domain_value;
+                        fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-sleep_ret));
+
+                        return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
+                    }
+
+                    ::uwvm2::imported::wasi::wasip1::abi::wasi_size_wasm64_t produced{};
+
+                    {
+                        [[maybe_unused]] auto const memory_locker_guard{::uwvm2::imported::wasi::wasip1::memory::lock_memory(memory)};
+
+                        ::uwvm2::imported::wasi::wasip1::func::wasi_event_wasm64_t evt{};
+
+                        auto out_curr{out};
+
+                        for(::std::size_t i{}; i != subscriptions.size(); ++i)
+                        {
+                            auto const& sub{subscriptions.index_unchecked(i)};
+                            auto const& slot{slots.index_unchecked(i)};
+
+                            if(sub.u.tag != ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_clock || slot.timeout > sleep_timeout)
+                            {
+                                continue;
+                            }
+
+                            evt.userdata = sub.userdata;
+                            evt.error = ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::esuccess;
+                            evt.type = ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_clock;
+
+                            evt.u.fd_readwrite.nbytes = static_cast<::uwvm2::imported::wasi::wasip1::abi::FILEwasi_size_wasm64_t>(0u);
+                            evt.u.fd_readwrite.flags = static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(0u);
+
+                            write_one_event_to_memory(evt, out_curr, produced);
+                        }
+
+                        ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm64_unlocked(memory, nevents, produced);
+                    }
+
+                    return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::esuccess;
+                }
+            }
+
             if(subscriptions.size() > static_cast<::std::size_t>(::std::numeric_limits<int>::max()))
             {
                 return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::eoverflow;
             }
 
-            ep_events.resize(subscriptions.size());
+            int const commit_ret{::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_commit(reactor)};
+            if(::fast_io::linux_system_call_fails(commit_ret)) [[unlikely]]
+            {
+                ::fast_io::error fe{};
+                fe.domain = ::fast_io::posix_domain_value;
+                fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-commit_ret));
+
+                return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
+            }
+
+            int const timers_ret{::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_sync_timers(reactor)};
+            if(::fast_io::linux_system_call_fails(timers_ret)) [[unlikely]]
+            {
+                ::fast_io::error fe{};
+                fe.domain = ::fast_io::posix_domain_value;
+                fe.code = static_cast<::fast_io::error::value_type>(static_cast<unsigned int>(-timers_ret));
+
+                return ::uwvm2::imported::wasi::wasip1::func::path_errno_from_fast_io_error(fe);
+            }
+
+            // Every ready fd is one of this call's registrations, plus at most one expiry per clock.
+            auto& ep_events{reactor.ep_events};
+            ep_events.resize(slots.size() + ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_clock_count);
 
             int ready{};
 
             for(;;)
             {
-                ready = ::fast_io::system_call<__NR_epoll_wait, int>(epfd, ep_events.data(), static_cast<int>(ep_events.size()), -1);
+                ready = ::fast_io::system_call<__NR_epoll_wait, int>(reactor.epoll_file.native_handle(),
+                                                                     ep_events.data(),
+                                                                     static_cast<int>(ep_events.size()),
+                                                                     -1);
                 if(!::fast_io::linux_system_call_fails(ready)) { break; }
 
                 auto err{-ready};
@@ -1132,95 +1127,104 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                 {
                     auto const& e{*ep_events_curr};
 
-                    auto const sub_p{static_cast<::uwvm2::imported::wasi::wasip1::func::wasi_subscription_wasm64_t const*>(e.data.ptr)};
-
-#   if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-                    if(sub_p == nullptr) [[unlikely]] { ::uwvm2::utils::debug::trap_and_inform_bug_pos(); }
-#   endif
-
-                    auto const sub_tag{sub_p->u.tag};
-
                     bool const has_error{(e.events & EPOLLERR) != 0u};
                     auto const event_error{has_error ? ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::eio
                                                      : ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::esuccess};
 
-                    if(sub_tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_read ||
-                       sub_tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_write)
+                    if(e.data.u64 >= ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_timer_tag)
                     {
-                        auto const fd{sub_p->u.u.fd_readwrite.file_descriptor};
+                        // A clock expired: report its subscriptions whose timeout is not later than the one the timerfd was armed with.
+                        auto const clock_slot{
+                            static_cast<::std::size_t>(e.data.u64 - ::uwvm2::imported::wasi::wasip1::environment::wasip1_poll_reactor_timer_tag)};
+                        auto const fired_timeout{reactor.timer_timeouts[clock_slot]};
 
-                        if((e.events & (EPOLLIN | EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0u)
+                        for(::std::size_t i{}; i != subscriptions.size(); ++i)
                         {
-                            for(auto const& sub: subscriptions)
+                            auto const& sub{subscriptions.index_unchecked(i)};
+                            auto const& slot{slots.index_unchecked(i)};
+
+                            if(sub.u.tag != ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_clock || slot.clock_slot != clock_slot ||
+                               slot.timeout > fired_timeout)
                             {
-                                if(sub.u.tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_read &&
-                                   sub.u.u.fd_readwrite.file_descriptor == fd)
-                                {
-                                    evt.userdata = sub.userdata;
-                                    evt.error = event_error;
-                                    evt.type = ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_read;
+                                continue;
+                            }
 
-                                    evt.u.fd_readwrite.nbytes = static_cast<::uwvm2::imported::wasi::wasip1::abi::filesize_wasm64_t>(0u);
-                                    evt.u.fd_readwrite.flags = static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(0u);
+                            evt.userdata = sub.userdata;
+                            evt.error = event_error;
+                            evt.type = ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_clock;
 
-                                    if((e.events & (EPOLLHUP | EPOLLRDHUP)) != 0u)
-                                    {
-                                        using eventrwflags_underlying_t2 =
-                                            ::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>;
-                                        evt.u.fd_readwrite.flags =
-                                            static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(static_cast<eventrwflags_underlying_t2>(
-                                                ::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t::event_fd_readwrite_hangup));
-                                    }
+                            evt.u.fd_readwrite.nbytes = static_cast<::uwvm2::imported::wasi::wasip1::abi::filesize_wasm64_t>(0u);
+                            evt.u.fd_readwrite.flags = static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(0u);
 
-                                    write_one_event_to_memory(evt, out_curr, produced);
-                                }
-                            }
+                            write_one_event_to_memory(evt, out_curr, produced);
                         }
 
-                        if((e.events & (EPOLLOUT | EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0u)
+                        continue;
+                    }
+
+                    auto const native_fd{static_cast<int>(e.data.u64)};
+
+                    if((e.events & (EPOLLIN | EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0u)
+                    {
+                        for(::std::size_t i{}; i != subscriptions.size(); ++i)
                         {
-                            for(auto const& sub: subscriptions)
+                            auto const& sub{subscriptions.index_unchecked(i)};
+                            if(sub.u.tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_read &&
+                               slots.index_unchecked(i).native_fd == native_fd)
                             {
-                                if(sub.u.tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_write &&
-                                   sub.u.u.fd_readwrite.file_descriptor == fd)
-                                {
-                                    evt.userdata = sub.userdata;
-                                    evt.error = event_error;
-                                    evt.type = ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_write;
+                                evt.userdata = sub.userdata;
+                                evt.error = event_error;
+                                evt.type = ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_read;
 
-                                    evt.u.fd_readwrite.nbytes = static_cast<::uwvm2::imported::wasi::wasip1::abi::filesize_wasm64_t>(0u);
-                                    evt.u.fd_readwrite.flags = static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(0u);
-
-                                    if((e.events & (EPOLLHUP | EPOLLRDHUP)) != 0u)
-                                    {
-                                        using eventrwflags_underlying_t2 =
-                                            ::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>;
-                                        evt.u.fd_readwrite.flags =
-                                            static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(static_cast<eventrwflags_underlying_t2>(
-                                                ::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t::event_fd_readwrite_hangup));
-                                    }
+                                evt.u.fd_readwrite.nbytes = static_cast<::uwvm2::imported::wasi::wasip1::abi::filesize_wasm64_t>(0u);
+                                evt.u.fd_readwrite.flags = static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(0u);
 
-                                    write_one_event_to_memory(evt, out_curr, produced);
+                                if((e.events & (EPOLLHUP | EPOLLRDHUP)) != 0u)
+                                {
+                                    using eventrwflags_underlying_t2 = ::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>;
+                                    evt.u.fd_readwrite.flags =
+                                        static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(static_cast<eventrwflags_underlying_t2>(
+                                            ::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t::event_fd_readwrite_hangup));
                                 }
+
+                                write_one_event_to_memory(evt, out_curr, produced);
                             }
                         }
                     }
-                    else
+
+                    if((e.events & (EPOLLOUT | EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0u)
                     {
-                        evt.userdata = sub_p->userdata;
-                        evt.error = event_error;
-                        evt.type = sub_tag;
+                        for(::std::size_t i{}; i != subscriptions.size(); ++i)
+                        {
+                            auto const& sub{subscriptions.index_unchecked(i)};
+                            if(sub.u.tag == ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_write &&
+                               slots.index_unchecked(i).native_fd == native_fd)
+                            {
+                                evt.userdata = sub.userdata;
+                                evt.error = event_error;
+                                evt.type = ::uwvm2::imported::wasi::wasip1::abi::eventtype_wasm64_t::eventtype_fd_write;
 
-                        evt.u.fd_readwrite.nbytes = static_cast<::uwvm2::imported::wasi::wasip1::abi::filesize_wasm64_t>(0u);
-                        evt.u.fd_readwrite.flags = static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(0u);
+                                evt.u.fd_readwrite.nbytes = static_cast<::uwvm2::imported::wasi::wasip1::abi::filesize_wasm64_t>(0u);
+                                evt.u.fd_readwrite.flags = static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(0u);
 
-                        write_one_event_to_memory(evt, out_curr, produced);
+                                if((e.events & (EPOLLHUP | EPOLLRDHUP)) != 0u)
+                                {
+                                    using eventrwflags_underlying_t2 = ::std::underlying_type_t<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>;
+                                    evt.u.fd_readwrite.flags =
+                                        static_cast<::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t>(static_cast<eventrwflags_underlying_t2>(
+                                            ::uwvm2::imported::wasi::wasip1::abi::eventrwflags_wasm64_t::event_fd_readwrite_hangup));
+                                }
+
+                                write_one_event_to_memory(evt, out_curr, produced);
+                            }
+                        }
                     }
                 }
 
                 ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm64_unlocked(memory, nevents, produced);
             }
 
+
             return ::uwvm2::imported::wasi::wasip1::abi::errno_wasm64_t::esuccess;
 
 #  elif defined(__NR_poll)
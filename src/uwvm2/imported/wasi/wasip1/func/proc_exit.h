@@ -87,6 +87,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                                              env,
                                          ::uwvm2::imported::wasi::wasip1::abi::exitcode_t code) noexcept
     {
+        // Neither exit path below returns, so buffered stdout/stderr must be written out now.
+        ::uwvm2::imported::wasi::wasip1::environment::flush_wasip1_stdio_buffers(env, true);
+
         if(env.wasip1_proc_exit_func_ptr != nullptr)
         {
             env.wasip1_proc_exit_func_ptr(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>(code));
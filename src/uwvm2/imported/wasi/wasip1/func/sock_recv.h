@@ -152,7 +152,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t>;
@@ -554,7 +554,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                     if((ri_flags_curr_value & ri_flags_waitall_value) != 0) [[unlikely]] { return ::uwvm2::imported::wasi::wasip1::abi::errno_t::enotsup; }
 #  endif
 
-                    auto const recv_res{::uwvm2::imported::wasi::wasip1::func::posix::recvmsg(native_fd, ::std::addressof(msg), recv_flags)};
+                    auto recv_res{::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_recvmsg(env.io_uring,
+                                                                                                        native_fd,
+                                                                                                        ::std::addressof(msg),
+                                                                                                        recv_flags)};
+                    if(recv_res == ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_declined)
+                    {
+                        recv_res = ::uwvm2::imported::wasi::wasip1::func::posix::recvmsg(native_fd, ::std::addressof(msg), recv_flags);
+                    }
 
                     if(recv_res < 0) [[unlikely]]
                     {
@@ -619,7 +626,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                         if((ri_flags_curr_value & ri_flags_waitall_value) != 0) [[unlikely]] { return ::uwvm2::imported::wasi::wasip1::abi::errno_t::enotsup; }
 #  endif
 
-                        auto const recv_res{::uwvm2::imported::wasi::wasip1::func::posix::recvmsg(native_fd, ::std::addressof(msg), recv_flags)};
+                        auto recv_res{::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_recvmsg(env.io_uring,
+                                                                                                            native_fd,
+                                                                                                            ::std::addressof(msg),
+                                                                                                            recv_flags)};
+                        if(recv_res == ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_declined)
+                        {
+                            recv_res = ::uwvm2::imported::wasi::wasip1::func::posix::recvmsg(native_fd, ::std::addressof(msg), recv_flags);
+                        }
 
                         if(recv_res < 0) [[unlikely]]
                         {
@@ -647,7 +661,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                         try
 #  endif
                         {
-                            scatter_status = ::fast_io::operations::scatter_read_some_bytes(curr_fd_native_file, scatter_base, scatter_length);
+                            scatter_status = ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_scatter_read_some_bytes(env.io_uring,
+                                                                                                                                   curr_fd_native_file,
+                                                                                                                                   scatter_base,
+                                                                                                                                   scatter_length);
                         }
 #  ifdef UWVM_CPP_EXCEPTIONS
                         catch(::fast_io::error e)
@@ -147,7 +147,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
             // Since the file descriptor's location is fixed and accessed via the unique pointer,
 
             // Simply acquiring data using a shared_lock
-            ::uwvm2::utils::mutex::rw_fair_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
+            ::uwvm2::utils::mutex::rw_sharded_shared_guard_t fds_lock{wasm_fd_storage.fds_rwlock};
 
             // Negative states have been excluded, so the conversion result will only be positive numbers.
             using unsigned_fd_t = ::std::make_unsigned_t<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t>;
@@ -518,7 +518,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
                 send_flags |= MSG_NOSIGNAL;
 #  endif
 
-                auto const send_res{::uwvm2::imported::wasi::wasip1::func::posix::sendmsg(native_fd, ::std::addressof(msg), send_flags)};
+                auto send_res{::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_sendmsg(env.io_uring,
+                                                                                                    native_fd,
+                                                                                                    ::std::addressof(msg),
+                                                                                                    send_flags)};
+                if(send_res == ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_declined)
+                {
+                    send_res = ::uwvm2::imported::wasi::wasip1::func::posix::sendmsg(native_fd, ::std::addressof(msg), send_flags);
+                }
 
                 if(send_res < 0) [[unlikely]]
                 {
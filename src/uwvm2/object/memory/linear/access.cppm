@@ -24,6 +24,7 @@ module;
 // std
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <version>
 #include <limits>
 #include <memory>
@@ -25,6 +25,7 @@
 // std
 # include <cstddef>
 # include <cstdint>
+# include <cstring>
 # include <version>
 # include <limits>
 # include <memory>
@@ -98,6 +99,30 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         }
     }
 
+    /// @brief Implement `memory.discard`: `[offset, offset + size)` reads back as zero afterwards, and whole platform pages inside it are returned to
+    ///        the OS where the backend can do so.
+    /// @return false when the range is outside the current length; nothing is modified then.
+    template <typename MemoryT>
+    [[nodiscard]] inline constexpr bool discard_memory_range(MemoryT const& memory, ::std::uint_least64_t offset, ::std::size_t size) noexcept
+    {
+        return with_memory_access_snapshot(memory,
+                                           [&](::std::byte* memory_begin, ::std::size_t byte_length) constexpr noexcept
+                                           {
+                                               if(offset > static_cast<::std::uint_least64_t>(byte_length)) [[unlikely]] { return false; }
+                                               auto const host_offset{static_cast<::std::size_t>(offset)};
+                                               if(size > byte_length - host_offset) [[unlikely]] { return false; }
+                                               if(size == 0uz) { return true; }
+
+                                               if constexpr(MemoryT::can_mmap) { memory.discard_committed_range(memory_begin + host_offset, size); }
+                                               else
+                                               {
+                                                   // Heap-backed memories cannot return part of their block; zeroing keeps the observable semantics.
+                                                   ::std::memset(memory_begin + host_offset, 0, size);
+                                               }
+                                               return true;
+                                           });
+    }
+
 }  // namespace uwvm2::object::memory::linear
 
 #ifndef UWVM_MODULE
@@ -24,6 +24,7 @@ module;
 // std
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <climits>
 #include <limits>
 #include <memory>
@@ -37,6 +38,9 @@ module;
 #if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__))  // posix mmap
 # include <sys/mman.h>
 #endif
+#if defined(UWVM_SUPPORT_MMAP) && defined(__linux__) && __has_include(<asm/unistd.h>)  // syscall numbers for memfd images
+# include <asm/unistd.h>
+#endif
 
 export module uwvm2.object.memory.linear:mmap;
 
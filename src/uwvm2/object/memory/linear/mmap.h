@@ -25,6 +25,7 @@
 // std
 # include <cstddef>
 # include <cstdint>
+# include <cstring>
 # include <climits>
 # include <limits>
 # include <memory>
@@ -38,6 +39,9 @@
 # if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__))  // posix mmap
 #  include <sys/mman.h>
 # endif
+# if defined(UWVM_SUPPORT_MMAP) && defined(__linux__) && __has_include(<asm/unistd.h>)  // syscall numbers for memfd images
+#  include <asm/unistd.h>
+# endif
 // import
 # include <fast_io.h>
 # include <uwvm2/utils/container/impl.h>
@@ -95,6 +99,379 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
     static_assert(wasm32_full_protection_front_guard_u64 + wasm32_full_protection_usable_u64 + wasm32_full_protection_back_guard_u64 ==
                   max_full_protection_wasm32_length);
 
+    /// @brief      Linux-only: initial linear-memory contents can be mapped `MAP_PRIVATE` from a memfd instead of being copied into the anonymous window.
+    /// @note       Restricted to 64-bit Linux hosts whose `mmap` takes a byte offset (`__NR_mmap` without `__NR_mmap2`, s390x excluded).
+# if defined(__linux__) && defined(__NR_memfd_create) && defined(__NR_ftruncate) && defined(__NR_mmap) && defined(__NR_munmap) && defined(__NR_close) &&       \
+     !defined(__NR_mmap2) && !defined(__s390x__)
+    inline constexpr bool mmap_memory_private_image_supported{true};
+# else
+    inline constexpr bool mmap_memory_private_image_supported{false};
+# endif
+
+    /// @brief      Huge-page backing requested for a linear memory.
+    enum class mmap_memory_huge_page_policy_t : unsigned
+    {
+        // Kernel default (`transparent_hugepage=always` still applies).
+        none,
+        // 2 MiB-align the usable window and `MADV_HUGEPAGE` the reservation; every fully committed 2 MiB extent becomes eligible for a PMD mapping.
+        transparent
+    };
+
+    /// @brief      Linux-only: transparent huge pages are requested with `madvise(MADV_HUGEPAGE)`.
+# if defined(__linux__) && defined(MADV_HUGEPAGE) && defined(__NR_madvise) && defined(__NR_mmap) && defined(__NR_munmap) && !defined(__NR_mmap2) &&          \
+     !defined(__s390x__)
+    inline constexpr bool mmap_memory_huge_page_supported{true};
+# else
+    inline constexpr bool mmap_memory_huge_page_supported{false};
+# endif
+
+    /// @brief      PMD huge-page size the usable window is aligned to (x86-64 and 4 KiB-granule AArch64).
+    inline constexpr ::std::size_t mmap_memory_huge_page_size{2uz * 1024uz * 1024uz};
+
+    /// @brief      Page-aligned, memfd-backed image of initial linear-memory contents.
+    /// @details    `create()` allocates a sparse memfd and a shared writable view of it. The caller fills `data()`, then `finish_writing()` drops the view
+    ///             and `mmap_memory_t::try_map_private_image()` maps the image copy-on-write into a linear memory. Pages never written by the guest stay
+    ///             shared with the page cache and fault in lazily; only written pages become private to the instance.
+    /// @note       The image may be mapped into any number of memories. Mappings stay valid after the image object is destroyed.
+    struct mmap_memory_image_t
+    {
+        int fd{-1};
+        ::std::byte* writable_begin{};
+        ::std::size_t length{};
+        // Byte offset of the image inside `fd`; non-zero only for images adopted from a region of an existing file.
+        ::std::size_t file_offset{};
+
+        inline constexpr mmap_memory_image_t() noexcept = default;
+
+        inline constexpr mmap_memory_image_t(mmap_memory_image_t const& other) noexcept = delete;
+
+        inline constexpr mmap_memory_image_t& operator= (mmap_memory_image_t const& other) noexcept = delete;
+
+        inline constexpr mmap_memory_image_t(mmap_memory_image_t&& other) noexcept
+        {
+            this->fd = other.fd;
+            this->writable_begin = other.writable_begin;
+            this->length = other.length;
+            this->file_offset = other.file_offset;
+
+            other.fd = -1;
+            other.writable_begin = nullptr;
+            other.length = 0uz;
+            other.file_offset = 0uz;
+        }
+
+        inline mmap_memory_image_t& operator= (mmap_memory_image_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+
+            this->clear();
+            this->fd = other.fd;
+            this->writable_begin = other.writable_begin;
+            this->length = other.length;
+            this->file_offset = other.file_offset;
+
+            other.fd = -1;
+            other.writable_begin = nullptr;
+            other.length = 0uz;
+            other.file_offset = 0uz;
+            return *this;
+        }
+
+        /// @brief      Create an image of `image_length` bytes (must be a multiple of the platform page size). Contents start zeroed.
+        /// @return     false if the platform lacks memfd support or any syscall fails; the object is then left empty.
+        inline bool create(::std::size_t image_length) noexcept
+        {
+            if constexpr(mmap_memory_private_image_supported)
+            {
+# if defined(__linux__) && defined(__NR_memfd_create) && defined(__NR_ftruncate) && defined(__NR_mmap) && defined(__NR_munmap) && defined(__NR_close) &&      \
+     !defined(__NR_mmap2) && !defined(__s390x__)
+                this->clear();
+
+                if(image_length == 0uz || image_length > static_cast<::std::size_t>(::std::numeric_limits<::std::ptrdiff_t>::max())) [[unlikely]]
+                {
+                    return false;
+                }
+
+                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+                if(!success || page_size == 0uz || (image_length & (page_size - 1uz)) != 0uz) [[unlikely]] { return false; }
+
+                // MFD_CLOEXEC
+                constexpr unsigned memfd_cloexec{0x0001u};
+                int const new_fd{::fast_io::system_call<__NR_memfd_create, int>("uwvm-memory-image", memfd_cloexec)};
+                if(::fast_io::linux_system_call_fails(new_fd)) [[unlikely]] { return false; }
+                this->fd = new_fd;
+
+                // ftruncate only sets the size; the file stays sparse until `data()` is written.
+                int const ftruncate_ret{::fast_io::system_call<__NR_ftruncate, int>(new_fd, static_cast<::std::ptrdiff_t>(image_length))};
+                if(::fast_io::linux_system_call_fails(ftruncate_ret)) [[unlikely]]
+                {
+                    this->clear();
+                    return false;
+                }
+
+                ::std::ptrdiff_t const view{
+                    ::fast_io::system_call<__NR_mmap, ::std::ptrdiff_t>(nullptr, image_length, PROT_READ | PROT_WRITE, MAP_SHARED, new_fd, 0)};
+                if(::fast_io::linux_system_call_fails(view)) [[unlikely]]
+                {
+                    this->clear();
+                    return false;
+                }
+
+                this->writable_begin = reinterpret_cast<::std::byte*>(view);
+                this->length = image_length;
+                return true;
+# endif
+            }
+            else
+            {
+                static_cast<void>(image_length);
+                return false;
+            }
+        }
+
+        /// @brief      Use `[region_offset, region_offset + region_length)` of an already opened, read-only file as the image. Takes ownership of
+        ///             `file_fd` on success. Both values must be platform-page aligned, and the caller must have checked that the file covers the
+        ///             whole region (touching a mapped page past EOF raises SIGBUS).
+        /// @return     false if the platform lacks support or the region is not aligned; `file_fd` is then left to the caller.
+        inline bool adopt_file_region(int file_fd, ::std::size_t region_offset, ::std::size_t region_length) noexcept
+        {
+            if constexpr(mmap_memory_private_image_supported)
+            {
+                if(file_fd == -1 || region_length == 0uz ||
+                   region_offset > static_cast<::std::size_t>(::std::numeric_limits<::std::ptrdiff_t>::max()) - region_length) [[unlikely]]
+                {
+                    return false;
+                }
+
+                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+                if(!success || page_size == 0uz) [[unlikely]] { return false; }
+                if(((region_offset | region_length) & (page_size - 1uz)) != 0uz) { return false; }
+
+                this->clear();
+                this->fd = file_fd;
+                this->length = region_length;
+                this->file_offset = region_offset;
+                return true;
+            }
+            else
+            {
+                static_cast<void>(file_fd);
+                static_cast<void>(region_offset);
+                static_cast<void>(region_length);
+                return false;
+            }
+        }
+
+        /// @brief      Writable view of the image; valid between `create()` and `finish_writing()`.
+        inline constexpr ::std::byte* data() const noexcept { return this->writable_begin; }
+
+        /// @brief      Drop the writable view. The memfd keeps the contents.
+        inline void finish_writing() noexcept
+        {
+# if defined(__linux__) && defined(__NR_munmap)
+            if(this->writable_begin != nullptr)
+            {
+                ::fast_io::system_call<__NR_munmap, int>(this->writable_begin, this->length);
+                this->writable_begin = nullptr;
+            }
+# endif
+        }
+
+        inline void clear() noexcept
+        {
+            this->finish_writing();
+# if defined(__linux__) && defined(__NR_close)
+            if(this->fd != -1) { ::fast_io::system_call<__NR_close, int>(this->fd); }
+# endif
+            this->fd = -1;
+            this->length = 0uz;
+            this->file_offset = 0uz;
+        }
+
+        inline ~mmap_memory_image_t() { this->clear(); }
+    };
+
+    /// @brief      Whether released reservations can be recycled through `mmap_memory_pool`.
+    /// @note       Recycling relies on `MADV_DONTNEED` zero-filling private anonymous pages, which is Linux semantics; other POSIX systems treat it as a
+    ///             hint, so a recycled slot could leak the previous instance's contents.
+# if defined(__linux__) && defined(__NR_madvise) && defined(__NR_mprotect) && defined(__NR_mmap) && defined(__NR_munmap) && !defined(__NR_mmap2) &&         \
+     !defined(__s390x__)
+    inline constexpr bool mmap_memory_pool_supported{true};
+# else
+    inline constexpr bool mmap_memory_pool_supported{false};
+# endif
+
+    struct mmap_memory_pool_stats_t
+    {
+        // Reservations served from a pooled slot.
+        ::std::size_t reused{};
+        // Reservations that had to map a new VMA while the pool was enabled.
+        ::std::size_t fresh{};
+        // Released memories whose slot was reset and kept.
+        ::std::size_t recycled{};
+        // Released memories unmapped because the pool was full or the reset failed.
+        ::std::size_t unmapped{};
+        // Current occupancy.
+        ::std::size_t pooled_slots{};
+        ::std::size_t pooled_bytes{};
+    };
+
+    /// @brief      Pool of pre-reserved `mmap_memory_t` VMAs.
+    /// @details    Instantiating and destroying many short-lived memories otherwise pays one `mmap` of the whole guard window (8 GiB for full-protection
+    ///             wasm32), an `mprotect`, and a `munmap` with its TLB shootdown per instance. A released memory instead drops its committed pages with
+    ///             `MADV_DONTNEED`, re-protects them `PROT_NONE`, and parks the untouched reservation here; the next memory of the same reserved size
+    ///             takes it over. The pool is disabled (zero slots) until `configure_mmap_memory_pool()` is called; uwvm does so from the runtime
+    ///             initializer when `--wasm-set-memory-pool` is given.
+    struct mmap_memory_pool_t
+    {
+        struct slot_t
+        {
+            ::std::byte* begin;
+            ::std::size_t length;
+            // Slots keep their `MADV_HUGEPAGE` state, so they are only handed to memories with the same policy.
+            mmap_memory_huge_page_policy_t huge_page_policy;
+        };
+
+        ::uwvm2::utils::mutex::mutex_t mutex{};
+        ::uwvm2::utils::container::vector<slot_t> slots{};
+        ::std::size_t max_slots{};
+        ::std::size_t max_bytes{};
+        mmap_memory_pool_stats_t stats{};
+
+        inline constexpr mmap_memory_pool_t() noexcept = default;
+
+        inline constexpr mmap_memory_pool_t(mmap_memory_pool_t const& other) noexcept = delete;
+
+        inline constexpr mmap_memory_pool_t& operator= (mmap_memory_pool_t const& other) noexcept = delete;
+
+        inline ~mmap_memory_pool_t()
+        {
+# if defined(__linux__) && defined(__NR_munmap)
+            for(auto const& slot: this->slots) { ::fast_io::system_call<__NR_munmap, int>(slot.begin, slot.length); }
+# endif
+        }
+    };
+
+    inline mmap_memory_pool_t mmap_memory_pool{};  // [global]
+
+    namespace details
+    {
+        /// @note   Call with `mmap_memory_pool.mutex` held.
+        inline void mmap_memory_pool_trim_locked(::std::size_t max_slots, ::std::size_t max_bytes) noexcept
+        {
+            auto& pool{mmap_memory_pool};
+            while(!pool.slots.empty() && (pool.slots.size() > max_slots || pool.stats.pooled_bytes > max_bytes))
+            {
+                auto const slot{pool.slots.back_unchecked()};
+                pool.slots.pop_back_unchecked();
+                --pool.stats.pooled_slots;
+                pool.stats.pooled_bytes -= slot.length;
+# if defined(__linux__) && defined(__NR_munmap)
+                ::fast_io::system_call<__NR_munmap, int>(slot.begin, slot.length);
+# endif
+            }
+        }
+
+        /// @brief  Take a pooled reservation of exactly `length` bytes (already `PROT_NONE` and zero), or nullptr.
+        inline ::std::byte* mmap_memory_pool_acquire(::std::size_t length, mmap_memory_huge_page_policy_t huge_page_policy) noexcept
+        {
+            if constexpr(mmap_memory_pool_supported)
+            {
+                auto& pool{mmap_memory_pool};
+                ::uwvm2::utils::mutex::mutex_guard_t guard{pool.mutex};
+                if(pool.max_slots == 0uz) { return nullptr; }
+
+                for(auto it{pool.slots.begin()}; it != pool.slots.end(); ++it)
+                {
+                    if(it->length != length || it->huge_page_policy != huge_page_policy) { continue; }
+
+                    auto const begin{it->begin};
+                    // Order does not matter; swap-with-last keeps removal O(1).
+                    *it = pool.slots.back_unchecked();
+                    pool.slots.pop_back_unchecked();
+                    --pool.stats.pooled_slots;
+                    pool.stats.pooled_bytes -= length;
+                    ++pool.stats.reused;
+                    return begin;
+                }
+
+                ++pool.stats.fresh;
+            }
+            else
+            {
+                static_cast<void>(length);
+                static_cast<void>(huge_page_policy);
+            }
+            return nullptr;
+        }
+
+        /// @brief  Whether a reservation of `length` bytes would currently fit. Checked before resetting so a full pool costs no extra syscalls.
+        inline bool mmap_memory_pool_has_room(::std::size_t length) noexcept
+        {
+            auto& pool{mmap_memory_pool};
+            ::uwvm2::utils::mutex::mutex_guard_t guard{pool.mutex};
+            return pool.slots.size() < pool.max_slots && length <= pool.max_bytes - pool.stats.pooled_bytes;
+        }
+
+        /// @brief  Hand a reset reservation to the pool.
+        /// @return false when a bound is hit; the caller still owns the reservation and must unmap it.
+        inline bool mmap_memory_pool_release(::std::byte* begin, ::std::size_t length, mmap_memory_huge_page_policy_t huge_page_policy) noexcept
+        {
+            auto& pool{mmap_memory_pool};
+            ::uwvm2::utils::mutex::mutex_guard_t guard{pool.mutex};
+            if(pool.slots.size() >= pool.max_slots || length > pool.max_bytes - pool.stats.pooled_bytes)
+            {
+                ++pool.stats.unmapped;
+                return false;
+            }
+
+            pool.slots.push_back({begin, length, huge_page_policy});
+            ++pool.stats.pooled_slots;
+            pool.stats.pooled_bytes += length;
+            ++pool.stats.recycled;
+            return true;
+        }
+
+        inline void mmap_memory_pool_count_unmapped() noexcept
+        {
+            auto& pool{mmap_memory_pool};
+            ::uwvm2::utils::mutex::mutex_guard_t guard{pool.mutex};
+            if(pool.max_slots != 0uz) { ++pool.stats.unmapped; }
+        }
+    }  // namespace details
+
+    /// @brief      Enable (or resize) the reservation pool: at most `max_slots` idle reservations totalling at most `max_reserved_bytes` of address space.
+    ///             Passing zero slots disables pooling and unmaps every idle slot.
+    /// @return     false if the platform does not support recycling; the pool then stays disabled.
+    inline bool configure_mmap_memory_pool(::std::size_t max_slots, ::std::size_t max_reserved_bytes) noexcept
+    {
+        if constexpr(!mmap_memory_pool_supported)
+        {
+            static_cast<void>(max_slots);
+            static_cast<void>(max_reserved_bytes);
+            return false;
+        }
+
+        auto& pool{mmap_memory_pool};
+        ::uwvm2::utils::mutex::mutex_guard_t guard{pool.mutex};
+        if(max_slots == 0uz || max_reserved_bytes == 0uz)
+        {
+            max_slots = 0uz;
+            max_reserved_bytes = 0uz;
+        }
+        pool.max_slots = max_slots;
+        pool.max_bytes = max_reserved_bytes;
+        details::mmap_memory_pool_trim_locked(max_slots, max_reserved_bytes);
+        return true;
+    }
+
+    [[nodiscard]] inline mmap_memory_pool_stats_t get_mmap_memory_pool_stats() noexcept
+    {
+        auto& pool{mmap_memory_pool};
+        ::uwvm2::utils::mutex::mutex_guard_t guard{pool.mutex};
+        return pool.stats;
+    }
+
     /// @note      Memory safety model for the mmap-backed linear memory:
     ///            - The base pointer `memory_begin` is stable for the lifetime of the instance; growth commits additional virtual address space instead of
     ///              reallocating or moving the buffer.
@@ -134,6 +511,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 
         mmap_memory_status_t status{};
 
+        // Set once `try_map_private_image()` placed a file-backed mapping in the window; `MADV_DONTNEED` would then refill from the file, so recycling
+        // the reservation must replace the committed range with fresh anonymous pages instead.
+        bool private_image_mapped{};
+
+        // Requested before `init_by_page_count()`; reset to `none` there when the memory cannot use huge pages.
+        mmap_memory_huge_page_policy_t huge_page_policy{};
+
         // This lock is used to prevent multithreaded growth.
         ::uwvm2::utils::mutex::mutex_t* growing_mutex_p{};
 
@@ -415,18 +799,53 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 
                     };
 
-#  ifdef UWVM_CPP_EXCEPTIONS
-                    try
-#  endif
+                    // Huge pages only pay off for standard 64 KiB wasm pages behind full guard windows; custom page sizes fall back to the default.
+                    if(this->huge_page_policy != mmap_memory_huge_page_policy_t::none)
                     {
-                        this->reserved_begin = ::fast_io::details::sys_mmap(nullptr, max_space, PROT_NONE, mmap_flags, -1, 0u);
+                        constexpr ::std::size_t default_wasm_page_size{static_cast<::std::size_t>(::uwvm2::object::memory::wasm_page::default_wasm32_page_size)};
+                        if(!mmap_memory_huge_page_supported || custom_page_size != default_wasm_page_size) { this->huge_page_policy = {}; }
                     }
-#  ifdef UWVM_CPP_EXCEPTIONS
-                    catch(::fast_io::error)
+
+                    // A pooled slot of the same reserved size is already PROT_NONE and zero; it skips the mmap below.
+                    if constexpr(mmap_memory_pool_supported)
                     {
-                        ::fast_io::fast_terminate();
+                        if UWVM_IF_NOT_CONSTEVAL
+                        {
+                            this->reserved_begin = details::mmap_memory_pool_acquire(this->get_acquire_reserved_space_ceil(), this->huge_page_policy);
+                        }
                     }
+
+                    if(this->reserved_begin == nullptr)
+                    {
+                        if(this->huge_page_policy != mmap_memory_huge_page_policy_t::none)
+                        {
+                            // Front guard and usable window are multiples of 2 MiB, so an aligned reservation gives an aligned `memory_begin`.
+                            this->reserved_begin = this->try_reserve_huge_page_aligned(this->get_acquire_reserved_space_ceil(), mmap_flags);
+                        }
+
+                        if(this->reserved_begin == nullptr)
+                        {
+#  ifdef UWVM_CPP_EXCEPTIONS
+                            try
+#  endif
+                            {
+                                this->reserved_begin = ::fast_io::details::sys_mmap(nullptr, max_space, PROT_NONE, mmap_flags, -1, 0u);
+                            }
+#  ifdef UWVM_CPP_EXCEPTIONS
+                            catch(::fast_io::error)
+                            {
+                                ::fast_io::fast_terminate();
+                            }
 #  endif
+                        }
+
+                        if(this->huge_page_policy == mmap_memory_huge_page_policy_t::transparent)
+                        {
+                            // The flag lives on the VMA and survives the `mprotect` splits done by init and grow, so one call covers every later commit.
+                            // Kernels without THP reject it; the memory then simply keeps base pages.
+                            this->advise_huge_pages(this->reserved_begin, this->get_acquire_reserved_space_ceil());
+                        }
+                    }
                 }
 # endif
 
@@ -920,6 +1339,109 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             return all_memory_length >> this->custom_page_size_log2;
         }
 
+        /// @brief      Replace `[offset, offset + image.length)` of the usable window with a copy-on-write mapping of `image`.
+        /// @return     false (memory unchanged) if the platform lacks support, the memory relies on sub-platform-page sizing, the range is not
+        ///             platform-page aligned, or it extends beyond the committed length. The caller must then fall back to copying.
+        /// @note       Only valid before WASM execution starts: the previous contents of the range are discarded, not merged.
+        inline bool try_map_private_image(::std::size_t offset, mmap_memory_image_t const& image) noexcept
+        {
+            if constexpr(mmap_memory_private_image_supported)
+            {
+# if defined(__linux__) && defined(__NR_memfd_create) && defined(__NR_ftruncate) && defined(__NR_mmap) && defined(__NR_munmap) && defined(__NR_close) &&      \
+     !defined(__NR_mmap2) && !defined(__s390x__)
+                if(this->memory_begin == nullptr || this->memory_length_p == nullptr || image.fd == -1 || image.length == 0uz) [[unlikely]] { return false; }
+
+                // Sub-platform-page memories rely on `memory_length_p` for bounds; keep them on the plain copy path.
+                if(this->require_dynamic_determination_memory_size()) { return false; }
+
+                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+                if(!success || page_size == 0uz) [[unlikely]] { return false; }
+
+                auto const page_size_minus_1{page_size - 1uz};
+                if((offset & page_size_minus_1) != 0uz || (image.length & page_size_minus_1) != 0uz) { return false; }
+
+                auto const memory_length{this->memory_length_p->load(::std::memory_order_acquire)};
+                if(offset > memory_length || image.length > memory_length - offset) { return false; }
+
+                auto const target{this->memory_begin + offset};
+                ::std::ptrdiff_t const mapped{::fast_io::system_call<__NR_mmap, ::std::ptrdiff_t>(
+                    target, image.length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, image.fd, static_cast<::std::ptrdiff_t>(image.file_offset))};
+                if(!::fast_io::linux_system_call_fails(mapped)) [[likely]]
+                {
+                    this->private_image_mapped = true;
+                    return true;
+                }
+
+                // A failed MAP_FIXED may already have torn down the old mapping; restore a zeroed anonymous window so the copy fallback is safe.
+                constexpr auto restore_flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED
+#  if defined(MAP_NORESERVE)
+                                             | MAP_NORESERVE
+#  endif
+                };
+                ::std::ptrdiff_t const restored{
+                    ::fast_io::system_call<__NR_mmap, ::std::ptrdiff_t>(target, image.length, PROT_READ | PROT_WRITE, restore_flags, -1, 0)};
+                if(::fast_io::linux_system_call_fails(restored)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                return false;
+# endif
+            }
+            else
+            {
+                static_cast<void>(offset);
+                static_cast<void>(image);
+                return false;
+            }
+        }
+
+        /// @brief      Return the memory to the state captured in `image`: `[0, image.length)` is re-mapped copy-on-write from the image and every
+        ///             page grown since is dropped with `MADV_DONTNEED` and re-protected `PROT_NONE`. The length becomes `image.length` again.
+        /// @details    Replacing a mapping only tears down the page-table entries that were populated, so the cost follows the pages the previous run
+        ///             touched rather than the size of the memory; clean pages are faulted back in from the page cache on demand.
+        /// @return     false if the platform lacks support, the memory relies on sub-platform-page sizing, or it is smaller than the image (memory
+        ///             unchanged), or if a syscall failed (length already reset, contents zeroed or stale). The caller must then fall back to copying.
+        /// @note       Only valid between WASM executions.
+        inline bool try_reset_to_private_image(mmap_memory_image_t const& image) noexcept
+        {
+            if constexpr(mmap_memory_private_image_supported)
+            {
+# if defined(__linux__) && defined(__NR_madvise) && defined(__NR_mprotect) && defined(__NR_mmap) && !defined(__NR_mmap2) && !defined(__s390x__)
+                if(this->memory_begin == nullptr || this->memory_length_p == nullptr || this->growing_mutex_p == nullptr || image.fd == -1 ||
+                   image.length == 0uz) [[unlikely]]
+                {
+                    return false;
+                }
+                if(this->require_dynamic_determination_memory_size()) { return false; }
+
+                ::uwvm2::utils::mutex::mutex_guard_t growing_mutex_guard{*this->growing_mutex_p};
+
+                // Without sub-platform-page sizing the committed length is the memory length itself.
+                auto const memory_length{this->memory_length_p->load(::std::memory_order_relaxed)};
+                if(memory_length < image.length) [[unlikely]] { return false; }
+
+                if(auto const grown_length{memory_length - image.length}; grown_length != 0uz)
+                {
+                    auto const grown_begin{this->memory_begin + image.length};
+                    if(::fast_io::linux_system_call_fails(::fast_io::system_call<__NR_madvise, int>(grown_begin, grown_length, MADV_DONTNEED)) ||
+                       ::fast_io::linux_system_call_fails(::fast_io::system_call<__NR_mprotect, int>(grown_begin, grown_length, PROT_NONE))) [[unlikely]]
+                    {
+                        return false;
+                    }
+                    this->memory_length_p->store(image.length, ::std::memory_order_release);
+                }
+
+                // A failed remap leaves a zeroed window (see `try_map_private_image()`); the caller's copy fallback then restores the contents.
+                return this->try_map_private_image(0uz, image);
+# else
+                static_cast<void>(image);
+                return false;
+# endif
+            }
+            else
+            {
+                static_cast<void>(image);
+                return false;
+            }
+        }
+
         inline constexpr mmap_memory_t(mmap_memory_t const& other) noexcept = delete;
 
         inline constexpr mmap_memory_t& operator= (mmap_memory_t const& other) noexcept = delete;
@@ -934,6 +1456,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->custom_page_size_log2 = other.custom_page_size_log2;
             this->require_dynamic_determination_memory_size_cached = other.require_dynamic_determination_memory_size_cached;
             this->status = other.status;
+            this->private_image_mapped = other.private_image_mapped;
+            this->huge_page_policy = other.huge_page_policy;
             this->growing_mutex_p = other.growing_mutex_p;
 
             // clear destory other
@@ -943,6 +1467,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             other.custom_page_size_log2 = 0u;
             other.require_dynamic_determination_memory_size_cached = false;
             other.status = mmap_memory_status_t{};
+            other.private_image_mapped = false;
+            other.huge_page_policy = mmap_memory_huge_page_policy_t{};
             other.growing_mutex_p = nullptr;
         }
 
@@ -960,6 +1486,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->custom_page_size_log2 = other.custom_page_size_log2;
             this->require_dynamic_determination_memory_size_cached = other.require_dynamic_determination_memory_size_cached;
             this->status = other.status;
+            this->private_image_mapped = other.private_image_mapped;
+            this->huge_page_policy = other.huge_page_policy;
             this->growing_mutex_p = other.growing_mutex_p;
 
             // clear destory other
@@ -969,11 +1497,194 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             other.custom_page_size_log2 = 0u;
             other.require_dynamic_determination_memory_size_cached = false;
             other.status = mmap_memory_status_t{};
+            other.private_image_mapped = false;
+            other.huge_page_policy = mmap_memory_huge_page_policy_t{};
             other.growing_mutex_p = nullptr;
 
             return *this;
         }
 
+        /// @brief      Zero `[first, first + length)` inside the committed window and return its whole platform pages to the OS.
+        /// @details    The caller has already bounds-checked the range against the current length. Partial pages at either end are cleared with
+        ///             `memset`; the aligned middle is dropped with `MADV_DONTNEED` (private anonymous pages read back as zero), or replaced by fresh
+        ///             anonymous pages when the window is a private file image, whose dropped pages would otherwise be refilled from the file.
+        ///             Targets without a zeroing discard fall back to `memset`, which keeps the semantics but not the RSS reduction.
+        inline void discard_committed_range(::std::byte* first, ::std::size_t length) const noexcept
+        {
+            if(length == 0uz) [[unlikely]] { return; }
+
+# if defined(__linux__) && defined(__NR_madvise) && defined(__NR_mmap) && !defined(__NR_mmap2) && !defined(__s390x__)
+            auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+            if(success && page_size != 0uz) [[likely]]
+            {
+                auto const page_size_minus_1{page_size - 1uz};
+                auto const first_addr{reinterpret_cast<::std::uintptr_t>(first)};
+                auto const last_addr{first_addr + length};
+                auto const aligned_first{(first_addr + page_size_minus_1) & ~static_cast<::std::uintptr_t>(page_size_minus_1)};
+                auto const aligned_last{last_addr & ~static_cast<::std::uintptr_t>(page_size_minus_1)};
+
+                if(aligned_first < aligned_last)
+                {
+                    auto const middle{reinterpret_cast<::std::byte*>(aligned_first)};
+                    auto const middle_length{static_cast<::std::size_t>(aligned_last - aligned_first)};
+
+                    bool released;
+                    if(this->private_image_mapped)
+                    {
+                        constexpr auto reset_flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED
+#  if defined(MAP_NORESERVE)
+                                                   | MAP_NORESERVE
+#  endif
+                        };
+                        released = !::fast_io::linux_system_call_fails(::fast_io::system_call<__NR_mmap, ::std::ptrdiff_t>(middle,
+                                                                                                                         middle_length,
+                                                                                                                         PROT_READ | PROT_WRITE,
+                                                                                                                         reset_flags,
+                                                                                                                         -1,
+                                                                                                                         0));
+                        // The new VMA does not inherit `MADV_HUGEPAGE`.
+                        if(released && this->huge_page_policy == mmap_memory_huge_page_policy_t::transparent) { advise_huge_pages(middle, middle_length); }
+                    }
+                    else
+                    {
+                        released = !::fast_io::linux_system_call_fails(::fast_io::system_call<__NR_madvise, int>(middle, middle_length, MADV_DONTNEED));
+                    }
+
+                    if(released) [[likely]]
+                    {
+                        ::std::memset(first, 0, static_cast<::std::size_t>(aligned_first - first_addr));
+                        ::std::memset(reinterpret_cast<::std::byte*>(aligned_last), 0, static_cast<::std::size_t>(last_addr - aligned_last));
+                        return;
+                    }
+                }
+            }
+# endif
+
+            ::std::memset(first, 0, length);
+        }
+
+        /// @brief      Reserve `length` bytes of `PROT_NONE` address space starting on a `mmap_memory_huge_page_size` boundary.
+        /// @details    Over-reserves by one huge page and unmaps the misaligned head and tail, leaving exactly `length` bytes so every other path
+        ///             (signal registration, unmapping, pooling) sees the usual reservation size.
+        /// @return     nullptr on failure; the caller falls back to an unaligned reservation.
+        inline static ::std::byte* try_reserve_huge_page_aligned(::std::size_t length, int mmap_flags) noexcept
+        {
+            if constexpr(mmap_memory_huge_page_supported)
+            {
+# if defined(__linux__) && defined(__NR_mmap) && defined(__NR_munmap)
+                constexpr auto alignment{mmap_memory_huge_page_size};
+                if(length > ::std::numeric_limits<::std::size_t>::max() - alignment) [[unlikely]] { return nullptr; }
+
+                ::std::ptrdiff_t const raw{
+                    ::fast_io::system_call<__NR_mmap, ::std::ptrdiff_t>(nullptr, length + alignment, PROT_NONE, mmap_flags, -1, 0)};
+                if(::fast_io::linux_system_call_fails(raw)) [[unlikely]] { return nullptr; }
+
+                auto const raw_begin{static_cast<::std::size_t>(raw)};
+                auto const aligned_begin{(raw_begin + (alignment - 1uz)) & ~(alignment - 1uz)};
+                auto const head{aligned_begin - raw_begin};
+                auto const tail{alignment - head};
+
+                if(head != 0uz) { ::fast_io::system_call<__NR_munmap, int>(reinterpret_cast<void*>(raw_begin), head); }
+                if(tail != 0uz) { ::fast_io::system_call<__NR_munmap, int>(reinterpret_cast<void*>(aligned_begin + length), tail); }
+                return reinterpret_cast<::std::byte*>(aligned_begin);
+# else
+                static_cast<void>(length);
+                static_cast<void>(mmap_flags);
+                return nullptr;
+# endif
+            }
+            else
+            {
+                static_cast<void>(length);
+                static_cast<void>(mmap_flags);
+                return nullptr;
+            }
+        }
+
+        inline static void advise_huge_pages(::std::byte* begin, ::std::size_t length) noexcept
+        {
+            if constexpr(mmap_memory_huge_page_supported)
+            {
+# if defined(__linux__) && defined(MADV_HUGEPAGE) && defined(__NR_madvise)
+                ::fast_io::system_call<__NR_madvise, int>(begin, length, MADV_HUGEPAGE);
+# else
+                static_cast<void>(begin);
+                static_cast<void>(length);
+# endif
+            }
+            else
+            {
+                static_cast<void>(begin);
+                static_cast<void>(length);
+            }
+        }
+
+        /// @brief      Reset the committed pages and hand the reservation to `mmap_memory_pool`.
+        /// @return     true when the pool took ownership; otherwise the caller unmaps the reservation as usual.
+        /// @note       Only called while the memory is being released, after WASM execution.
+        inline bool try_recycle_reservation(::std::size_t acquire_reserved_space_ceil) noexcept
+        {
+            if constexpr(mmap_memory_pool_supported)
+            {
+# if defined(__linux__) && defined(__NR_madvise) && defined(__NR_mprotect) && defined(__NR_mmap) && defined(__NR_munmap) && !defined(__NR_mmap2) &&       \
+     !defined(__s390x__)
+                if(!details::mmap_memory_pool_has_room(acquire_reserved_space_ceil)) [[likely]]
+                {
+                    details::mmap_memory_pool_count_unmapped();
+                    return false;
+                }
+
+                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+                if(!success || page_size == 0uz) [[unlikely]] { return false; }
+
+                auto const page_size_minus_1{page_size - 1uz};
+                auto const memory_length{this->memory_length_p == nullptr ? 0uz : this->memory_length_p->load(::std::memory_order_relaxed)};
+                if(memory_length > ::std::numeric_limits<::std::size_t>::max() - page_size_minus_1) [[unlikely]] { return false; }
+                auto const committed_length{(memory_length + page_size_minus_1) & ~page_size_minus_1};
+
+                if(committed_length != 0uz)
+                {
+                    if(this->private_image_mapped)
+                    {
+                        // File-backed pages would be refilled from the image; replace the window with fresh reserved-only anonymous memory.
+                        constexpr auto reset_flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED
+#  if defined(MAP_NORESERVE)
+                                                   | MAP_NORESERVE
+#  endif
+                        };
+                        ::std::ptrdiff_t const remapped{
+                            ::fast_io::system_call<__NR_mmap, ::std::ptrdiff_t>(this->memory_begin, committed_length, PROT_NONE, reset_flags, -1, 0)};
+                        if(::fast_io::linux_system_call_fails(remapped)) [[unlikely]] { return false; }
+                    }
+                    else
+                    {
+                        // Drop the pages (private anonymous memory reads back as zero) and return the window to the reserved-only state.
+                        if(::fast_io::linux_system_call_fails(
+                               ::fast_io::system_call<__NR_madvise, int>(this->memory_begin, committed_length, MADV_DONTNEED))) [[unlikely]]
+                        {
+                            return false;
+                        }
+                        if(::fast_io::linux_system_call_fails(::fast_io::system_call<__NR_mprotect, int>(this->memory_begin, committed_length, PROT_NONE)))
+                            [[unlikely]]
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                return details::mmap_memory_pool_release(this->reserved_begin, acquire_reserved_space_ceil, this->huge_page_policy);
+# else
+                static_cast<void>(acquire_reserved_space_ceil);
+                return false;
+# endif
+            }
+            else
+            {
+                static_cast<void>(acquire_reserved_space_ceil);
+                return false;
+            }
+        }
+
         inline constexpr ::std::size_t get_acquire_reserved_space() const noexcept
         {
             // UB will never appear; it has been preemptively checked.
@@ -1102,12 +1813,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
                 if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
 
                 // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
-                if(::fast_io::details::sys_munmap_nothrow(this->reserved_begin, acquire_reserved_space_ceil)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                if(!this->try_recycle_reservation(acquire_reserved_space_ceil) &&
+                   ::fast_io::details::sys_munmap_nothrow(this->reserved_begin, acquire_reserved_space_ceil)) [[unlikely]]
+                {
+                    ::fast_io::fast_terminate();
+                }
             }
 # endif
 
             this->reserved_begin = nullptr;
             this->memory_begin = nullptr;
+            this->private_image_mapped = false;
 
 # if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
             // The clear operation completes before the object is destroyed, so nullptr causes a crash.
@@ -1166,7 +1882,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
                     if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
 
                     // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
-                    if(::fast_io::details::sys_munmap_nothrow(this->reserved_begin, acquire_reserved_space_ceil)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                    if(!this->try_recycle_reservation(acquire_reserved_space_ceil) &&
+                       ::fast_io::details::sys_munmap_nothrow(this->reserved_begin, acquire_reserved_space_ceil)) [[unlikely]]
+                    {
+                        ::fast_io::fast_terminate();
+                    }
                 }
 # endif
             }
@@ -1189,6 +1909,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->custom_page_size_log2 = 0u;
             this->require_dynamic_determination_memory_size_cached = false;
             this->status = mmap_memory_status_t{};
+            this->private_image_mapped = false;
+            this->huge_page_policy = mmap_memory_huge_page_policy_t{};
             this->growing_mutex_p = nullptr;
         }
 
@@ -1237,7 +1959,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
                     if(page_size == 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
 
                     // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
-                    if(::fast_io::details::sys_munmap_nothrow(this->reserved_begin, acquire_reserved_space_ceil)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                    if(!this->try_recycle_reservation(acquire_reserved_space_ceil) &&
+                       ::fast_io::details::sys_munmap_nothrow(this->reserved_begin, acquire_reserved_space_ceil)) [[unlikely]]
+                    {
+                        ::fast_io::fast_terminate();
+                    }
                 }
 # endif
             }
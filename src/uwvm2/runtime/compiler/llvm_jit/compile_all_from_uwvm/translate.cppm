@@ -23,6 +23,7 @@
 module;
 
 // std
+# include <algorithm>
 # include <atomic>
 # include <bit>
 # include <climits>
@@ -54,8 +55,10 @@ module;
 #  include <llvm/IR/InlineAsm.h>
 #  include <llvm/IR/Intrinsics.h>
 #  include <llvm/IR/LLVMContext.h>
+#  include <llvm/IR/MDBuilder.h>
 #  include <llvm/IR/Metadata.h>
 #  include <llvm/IR/Module.h>
+#  include <llvm/IR/ProfileSummary.h>
 #  include <llvm/IR/Type.h>
 #  include <llvm/IR/Value.h>
 #  include <llvm/IR/Verifier.h>
@@ -24,6 +24,7 @@
 
 #ifndef UWVM_MODULE
 // std
+# include <algorithm>
 # include <atomic>
 # include <bit>
 # include <climits>
@@ -55,8 +56,10 @@
 #  include <llvm/IR/InlineAsm.h>
 #  include <llvm/IR/Intrinsics.h>
 #  include <llvm/IR/LLVMContext.h>
+#  include <llvm/IR/MDBuilder.h>
 #  include <llvm/IR/Metadata.h>
 #  include <llvm/IR/Module.h>
+#  include <llvm/IR/ProfileSummary.h>
 #  include <llvm/IR/Type.h>
 #  include <llvm/IR/Value.h>
 #  include <llvm/IR/Verifier.h>
@@ -104,7 +107,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::lib
         call_indirect_null_element,
         call_indirect_type_mismatch,
         memory_out_of_bounds,
-        runtime_invariant_failure
+        runtime_invariant_failure,
+        fuel_exhausted,
+        epoch_deadline
     };
 
     extern "C++"
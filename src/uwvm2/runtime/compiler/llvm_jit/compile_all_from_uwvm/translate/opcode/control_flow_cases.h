@@ -96,7 +96,7 @@ case wasm1_code::block:
     // [     safe    ] unsafe (could be the section_end)
     //                 ^^ op_begin
 
-    // WebAssembly 1.0/MVP blocktype is either 0x40 (empty) or one scalar value type.  Multi-value blocktypes can also
+    // WebAssembly 1.0/MVP blocktype is either 0x40 (empty) or one value type (scalar, or v128 with SIMD).  Multi-value blocktypes can also
     // encode a type index with parameters/results; when enabling that proposal, update this parser, runtime block-result
     // storage, branch label arity validation, and LLVM PHI/result lowering together.
     runtime_block_result_type block_result{};
@@ -133,6 +133,13 @@ case wasm1_code::block:
             block_result.end = f64_result_arr + 1u;
             break;
         }
+        case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(::uwvm2::parser::wasm::standard::wasm1p1::type::value_type::v128):
+        {
+            ensure_wasm1p1_value_type_enabled(op_begin, v128_result_arr[0u], ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+            block_result.begin = v128_result_arr;
+            block_result.end = v128_result_arr + 1u;
+            break;
+        }
         [[unlikely]] default:
         {
             // Unknown blocktype encoding; treat as invalid code.
@@ -196,7 +203,7 @@ case wasm1_code::loop:
     // [    safe    ] unsafe (could be the section_end)
     //                ^^ code_curr
 
-    // WebAssembly 1.0/MVP blocktype is either 0x40 (empty) or one scalar value type.  Multi-value blocktypes can also
+    // WebAssembly 1.0/MVP blocktype is either 0x40 (empty) or one value type (scalar, or v128 with SIMD).  Multi-value blocktypes can also
     // encode a type index with parameters/results; when enabling that proposal, update this parser, runtime block-result
     // storage, branch label arity validation, and LLVM loop-entry/latch lowering together.
     runtime_block_result_type block_result{};
@@ -233,6 +240,13 @@ case wasm1_code::loop:
             block_result.end = f64_result_arr + 1u;
             break;
         }
+        case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(::uwvm2::parser::wasm::standard::wasm1p1::type::value_type::v128):
+        {
+            ensure_wasm1p1_value_type_enabled(op_begin, v128_result_arr[0u], ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+            block_result.begin = v128_result_arr;
+            block_result.end = v128_result_arr + 1u;
+            break;
+        }
         [[unlikely]] default:
         {
             err.err_curr = op_begin;
@@ -298,7 +312,7 @@ case wasm1_code::if_:
     // [   safe   ] unsafe (could be the section_end)
     //              ^^ code_curr
 
-    // WebAssembly 1.0/MVP blocktype is either 0x40 (empty) or one scalar value type.  Multi-value blocktypes can also
+    // WebAssembly 1.0/MVP blocktype is either 0x40 (empty) or one value type (scalar, or v128 with SIMD).  Multi-value blocktypes can also
     // encode a type index with parameters/results; when enabling that proposal, update this parser, if/else result
     // merging, branch arity validation, and LLVM PHI/result lowering together.
     runtime_block_result_type block_result{};
@@ -334,6 +348,13 @@ case wasm1_code::if_:
             block_result.end = f64_result_arr + 1u;
             break;
         }
+        case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(::uwvm2::parser::wasm::standard::wasm1p1::type::value_type::v128):
+        {
+            ensure_wasm1p1_value_type_enabled(op_begin, v128_result_arr[0u], ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+            block_result.begin = v128_result_arr;
+            block_result.end = v128_result_arr + 1u;
+            break;
+        }
         [[unlikely]] default:
         {
             err.err_curr = op_begin;
@@ -0,0 +1,106 @@
+    // WebAssembly 1.1 fixed-width SIMD validation for the LLVM JIT path.
+    // The per-subopcode stack effect, immediate layout, lane bound, and memarg alignment limit all come from
+    // `get_llvm_jit_simd_instruction_signature`, so the prescan, this validator, and the unreachable-code skipper agree on
+    // instruction lengths.  IR is produced afterwards by the single-instruction emitter (`opcode/simd_emit_cases.h`).
+
+case static_cast<wasm1_code>(wasm1p1_code::simd_prefix):
+{
+    auto const op_begin{code_curr};
+    ++code_curr;
+
+    if(wasm1p1_para.disable_simd) [[unlikely]]
+    {
+        fail_wasm1p1_feature_required(op_begin,
+                                      opcode_byte(wasm1p1_code::simd_prefix),
+                                      ::uwvm2::parser::wasm::base::wasm1p1_feature_kind::simd,
+                                      ::uwvm2::parser::wasm::base::wasm1p1_error_subject::instruction);
+    }
+
+    auto const subopcode{read_leb128.template operator()<validation_module_traits_t::wasm_u32>(code_curr, code_end, op_begin, u8"simd")};
+    auto const simd_signature{get_llvm_jit_simd_instruction_signature(subopcode)};
+    if(!simd_signature.valid) [[unlikely]]
+    {
+        err.err_curr = op_begin;
+        err.err_selectable.u8 = static_cast<::std::uint_least8_t>(subopcode);
+        err.err_code = code_validation_error_code::illegal_opbase;
+        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+    }
+
+    // Immediates are decoded before the operand stack is touched so parse errors point at the instruction itself.
+    if(simd_signature.immediate_kind == llvm_jit_simd_immediate_kind::memarg || simd_signature.immediate_kind == llvm_jit_simd_immediate_kind::memarg_lane)
+    {
+        auto const align{read_leb128.template operator()<validation_module_traits_t::wasm_u32>(code_curr, code_end, op_begin, u8"simd.memarg.align")};
+        auto const offset{read_leb128.template operator()<validation_module_traits_t::wasm_u32>(code_curr, code_end, op_begin, u8"simd.memarg.offset")};
+
+        if(all_memory_count == 0u) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.no_memory.op_code_name = u8"simd";
+            err.err_selectable.no_memory.align = align;
+            err.err_selectable.no_memory.offset = offset;
+            err.err_code = code_validation_error_code::no_memory;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        if(align > simd_signature.max_align) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.illegal_memarg_alignment.op_code_name = u8"simd";
+            err.err_selectable.illegal_memarg_alignment.align = align;
+            err.err_selectable.illegal_memarg_alignment.max_align = simd_signature.max_align;
+            err.err_code = code_validation_error_code::illegal_memarg_alignment;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+    }
+
+    if(simd_signature.immediate_kind == llvm_jit_simd_immediate_kind::memarg_lane || simd_signature.immediate_kind == llvm_jit_simd_immediate_kind::lane)
+    {
+        auto const lane{read_u8_immediate(code_curr, code_end, op_begin, u8"simd.lane")};
+        if(static_cast<::std::uint_least8_t>(lane) >= simd_signature.lane_count) [[unlikely]] { fail_invalid_immediate(op_begin, u8"simd.lane"); }
+    }
+    else if(simd_signature.immediate_kind == llvm_jit_simd_immediate_kind::bytes16)
+    {
+        if(static_cast<::std::size_t>(code_end - code_curr) < 16uz) [[unlikely]]
+        {
+            fail_invalid_immediate(op_begin, u8"simd.bytes16", ::fast_io::parse_code::end_of_file);
+        }
+
+        // `v128.const` accepts any payload; `i8x16.shuffle` lane selectors index the 32 bytes of both inputs.
+        if(simd_signature.lane_count != 0u)
+        {
+            for(::std::size_t i{}; i != 16uz; ++i)
+            {
+                if(::std::to_integer<::std::uint_least8_t>(code_curr[i]) >= simd_signature.lane_count) [[unlikely]]
+                {
+                    fail_invalid_immediate(op_begin, u8"i8x16.shuffle");
+                }
+            }
+        }
+        code_curr += 16uz;
+    }
+
+    if(!is_polymorphic && concrete_operand_count() < simd_signature.operand_count) [[unlikely]]
+    {
+        report_operand_stack_underflow(op_begin, u8"simd", simd_signature.operand_count);
+    }
+
+    // Pop top-to-bottom; the signature lists operands in push order.
+    for(::std::size_t i{simd_signature.operand_count}; i != 0uz; --i)
+    {
+        auto const expected_type{static_cast<curr_operand_stack_value_type>(simd_signature.operand_types[i - 1uz])};
+        auto const operand{try_pop_concrete_operand()};
+        if(operand.from_stack && operand.type != expected_type) [[unlikely]]
+        {
+            err.err_curr = op_begin;
+            err.err_selectable.numeric_operand_type_mismatch.op_code_name = u8"simd";
+            err.err_selectable.numeric_operand_type_mismatch.expected_type = static_cast<wasm_value_type>(expected_type);
+            err.err_selectable.numeric_operand_type_mismatch.actual_type = to_wasm1_diagnostic_value_type(operand.type);
+            err.err_code = code_validation_error_code::numeric_operand_type_mismatch;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+    }
+
+    if(simd_signature.has_result) { operand_stack_push(static_cast<curr_operand_stack_value_type>(simd_signature.result_type)); }
+
+    break;
+}
@@ -0,0 +1,2163 @@
+    // WebAssembly 1.1 fixed-width SIMD single-instruction LLVM emission.
+    // v128 values travel on the operand stack as canonical `<2 x i64>` vectors; each case bitcasts to the lane shape it
+    // operates on and bitcasts the result back.  Lane numbering equals LLVM element numbering only on little-endian hosts,
+    // which the prescan enforces.  Memory forms use direct checked pointers into mmap-backed memory 0 and have no bridge
+    // fallback, so the prescan routes other memory configurations to the interpreter before emission starts.
+
+// v128.load
+// Loads 16 bytes as one vector.  The memarg alignment is only a hint, so the LLVM alignment never exceeds it.
+case wasm1p1_simd_code::v128_load:
+{
+    validation_module_traits_t::wasm_u32 align{};
+    validation_module_traits_t::wasm_u32 offset{};
+    if(!parse_wasm_leb128_immediate(code_curr, code_end, align) || !parse_wasm_leb128_immediate(code_curr, code_end, offset)) [[unlikely]] { return result; }
+
+    auto address{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    auto value{emit_simd_memory_load(emit_simd_memory_pointer(offset, 16uz, address),
+                                     get_llvm_type_from_wasm_value_type(llvm_context, runtime_operand_stack_v128_type),
+                                     get_llvm_memory_access_alignment(16uz, align))};
+    if(value == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, value);
+    break;
+}
+// v128.load8x8_s/u, v128.load16x4_s/u, v128.load32x2_s/u
+// Load 64 bits as half-width lanes and sign- or zero-extend each lane to twice its width.
+case wasm1p1_simd_code::v128_load8x8_s:
+case wasm1p1_simd_code::v128_load8x8_u:
+case wasm1p1_simd_code::v128_load16x4_s:
+case wasm1p1_simd_code::v128_load16x4_u:
+case wasm1p1_simd_code::v128_load32x2_s:
+case wasm1p1_simd_code::v128_load32x2_u:
+{
+    auto const simd_code{static_cast<wasm1p1_simd_code>(subopcode)};
+    unsigned lane_bits{};
+    switch(simd_code)
+    {
+        case wasm1p1_simd_code::v128_load8x8_s:
+        case wasm1p1_simd_code::v128_load8x8_u: lane_bits = 8u; break;
+        case wasm1p1_simd_code::v128_load16x4_s:
+        case wasm1p1_simd_code::v128_load16x4_u: lane_bits = 16u; break;
+        default: lane_bits = 32u; break;
+    }
+    bool const is_signed{simd_code == wasm1p1_simd_code::v128_load8x8_s || simd_code == wasm1p1_simd_code::v128_load16x4_s ||
+                         simd_code == wasm1p1_simd_code::v128_load32x2_s};
+
+    validation_module_traits_t::wasm_u32 align{};
+    validation_module_traits_t::wasm_u32 offset{};
+    if(!parse_wasm_leb128_immediate(code_curr, code_end, align) || !parse_wasm_leb128_immediate(code_curr, code_end, offset)) [[unlikely]] { return result; }
+
+    auto const lane_count{64u / lane_bits};
+    auto narrow_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, lane_bits), lane_count)};
+    auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, lane_bits * 2u), lane_count)};
+    auto address{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    auto narrow{emit_simd_memory_load(emit_simd_memory_pointer(offset, 8uz, address), narrow_type, get_llvm_memory_access_alignment(8uz, align))};
+    if(narrow == nullptr) [[unlikely]] { return result; }
+    auto wide{is_signed ? ir_builder.CreateSExt(narrow, wide_type) : ir_builder.CreateZExt(narrow, wide_type)};
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, wide));
+    break;
+}
+
+// v128.load8_splat/16_splat/32_splat/64_splat, v128.load32_zero/64_zero
+// Load one scalar lane and either broadcast it or place it in lane 0 of an otherwise zero vector.
+case wasm1p1_simd_code::v128_load8_splat:
+case wasm1p1_simd_code::v128_load16_splat:
+case wasm1p1_simd_code::v128_load32_splat:
+case wasm1p1_simd_code::v128_load64_splat:
+case wasm1p1_simd_code::v128_load32_zero:
+case wasm1p1_simd_code::v128_load64_zero:
+{
+    auto const simd_signature{get_llvm_jit_simd_instruction_signature(subopcode)};
+    bool const is_zero_fill{static_cast<wasm1p1_simd_code>(subopcode) == wasm1p1_simd_code::v128_load32_zero ||
+                            static_cast<wasm1p1_simd_code>(subopcode) == wasm1p1_simd_code::v128_load64_zero};
+    validation_module_traits_t::wasm_u32 align{};
+    validation_module_traits_t::wasm_u32 offset{};
+    if(!parse_wasm_leb128_immediate(code_curr, code_end, align) || !parse_wasm_leb128_immediate(code_curr, code_end, offset)) [[unlikely]] { return result; }
+
+    auto const access_bytes{static_cast<::std::size_t>(simd_signature.access_bytes)};
+    auto lane_type{::llvm::Type::getIntNTy(llvm_context, static_cast<unsigned>(access_bytes * 8uz))};
+    auto const lane_count{static_cast<unsigned>(16uz / access_bytes)};
+    auto address{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    auto lane_value{
+        emit_simd_memory_load(emit_simd_memory_pointer(offset, access_bytes, address), lane_type, get_llvm_memory_access_alignment(access_bytes, align))};
+    if(lane_value == nullptr) [[unlikely]] { return result; }
+
+    ::llvm::Value* vector{};
+    if(is_zero_fill)
+    {
+        vector = ir_builder.CreateInsertElement(::llvm::Constant::getNullValue(::llvm::FixedVectorType::get(lane_type, lane_count)), lane_value, 0ull);
+    }
+    else
+    {
+        vector = ir_builder.CreateVectorSplat(lane_count, lane_value);
+    }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, vector));
+    break;
+}
+
+// v128.store
+case wasm1p1_simd_code::v128_store:
+{
+    validation_module_traits_t::wasm_u32 align{};
+    validation_module_traits_t::wasm_u32 offset{};
+    if(!parse_wasm_leb128_immediate(code_curr, code_end, align) || !parse_wasm_leb128_immediate(code_curr, code_end, offset)) [[unlikely]] { return result; }
+
+    auto value{pop_simd_operand(runtime_operand_stack_v128_type)};
+    auto address{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    if(value == nullptr ||
+       !emit_simd_memory_store(emit_simd_memory_pointer(offset, 16uz, address), value, get_llvm_memory_access_alignment(16uz, align))) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+
+// v128.loadN_lane / v128.storeN_lane
+// Replace or extract a single lane through a scalar access of the lane width.  The lane immediate follows the memarg.
+case wasm1p1_simd_code::v128_load8_lane:
+case wasm1p1_simd_code::v128_load16_lane:
+case wasm1p1_simd_code::v128_load32_lane:
+case wasm1p1_simd_code::v128_load64_lane:
+case wasm1p1_simd_code::v128_store8_lane:
+case wasm1p1_simd_code::v128_store16_lane:
+case wasm1p1_simd_code::v128_store32_lane:
+case wasm1p1_simd_code::v128_store64_lane:
+{
+    auto const simd_signature{get_llvm_jit_simd_instruction_signature(subopcode)};
+    validation_module_traits_t::wasm_u32 align{};
+    validation_module_traits_t::wasm_u32 offset{};
+    if(!parse_wasm_leb128_immediate(code_curr, code_end, align) || !parse_wasm_leb128_immediate(code_curr, code_end, offset)) [[unlikely]] { return result; }
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<unsigned>(*code_curr)};
+    ++code_curr;
+
+    auto const access_bytes{static_cast<::std::size_t>(simd_signature.access_bytes)};
+    auto lane_type{::llvm::Type::getIntNTy(llvm_context, static_cast<unsigned>(access_bytes * 8uz))};
+    auto vector_type{::llvm::FixedVectorType::get(lane_type, static_cast<unsigned>(16uz / access_bytes))};
+    auto vector_operand{pop_simd_operand(runtime_operand_stack_v128_type)};
+    auto address{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    if(vector_operand == nullptr) [[unlikely]] { return result; }
+    auto vector{ir_builder.CreateBitCast(vector_operand, vector_type)};
+    auto direct_memory_pointer{emit_simd_memory_pointer(offset, access_bytes, address)};
+    auto const memory_alignment{get_llvm_memory_access_alignment(access_bytes, align)};
+
+    if(simd_signature.has_result)
+    {
+        auto lane_value{emit_simd_memory_load(direct_memory_pointer, lane_type, memory_alignment)};
+        if(lane_value == nullptr) [[unlikely]] { return result; }
+        push_operand(runtime_operand_stack_v128_type,
+                     emit_llvm_v128_canonical(ir_builder, ir_builder.CreateInsertElement(vector, lane_value, static_cast<::std::uint64_t>(lane))));
+    }
+    else if(!emit_simd_memory_store(direct_memory_pointer, ir_builder.CreateExtractElement(vector, static_cast<::std::uint64_t>(lane)), memory_alignment))
+        [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+
+// v128.const
+// The 16 immediate bytes are the little-endian image of the vector.
+case wasm1p1_simd_code::v128_const:
+{
+    if(static_cast<::std::size_t>(code_end - code_curr) < 16uz) [[unlikely]] { return result; }
+    ::std::uint8_t bytes[16u]{};
+    for(::std::size_t i{}; i != 16uz; ++i) { bytes[i] = ::std::to_integer<::std::uint8_t>(code_curr[i]); }
+    code_curr += 16uz;
+    push_operand(runtime_operand_stack_v128_type,
+                 emit_llvm_v128_canonical(ir_builder, ::llvm::ConstantDataVector::get(llvm_context, ::llvm::ArrayRef<::std::uint8_t>{bytes, 16uz})));
+    break;
+}
+
+// i8x16.shuffle
+// Lane selectors 0..15 pick from the first operand and 16..31 from the second, exactly LLVM's shufflevector mask.
+case wasm1p1_simd_code::i8x16_shuffle:
+{
+    if(static_cast<::std::size_t>(code_end - code_curr) < 16uz) [[unlikely]] { return result; }
+    int mask[16u]{};
+    for(::std::size_t i{}; i != 16uz; ++i) { mask[i] = ::std::to_integer<int>(code_curr[i]); }
+    code_curr += 16uz;
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateShuffleVector(left, right, ::llvm::ArrayRef<int>{mask, 16uz}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+
+// i8x16.swizzle
+// Out-of-range selectors produce zero.  Each selector is masked before the dynamic extract so LLVM never sees an
+// out-of-bounds element index, and the range check selects zero afterwards.
+case wasm1p1_simd_code::i8x16_swizzle:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* table, ::llvm::Value* selectors) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto llvm_i8_type{::llvm::Type::getInt8Ty(llvm_context)};
+                             ::llvm::Value* swizzled{::llvm::Constant::getNullValue(table->getType())};
+                             for(::std::uint64_t i{}; i != 16u; ++i)
+                             {
+                                 auto selector{ir_builder.CreateExtractElement(selectors, i)};
+                                 auto in_range{ir_builder.CreateICmpULT(selector, ::llvm::ConstantInt::get(llvm_i8_type, 16u))};
+                                 auto lane_index{ir_builder.CreateAnd(selector, ::llvm::ConstantInt::get(llvm_i8_type, 15u))};
+                                 auto picked{ir_builder.CreateExtractElement(table, lane_index)};
+                                 swizzled = ir_builder.CreateInsertElement(
+                                     swizzled, ir_builder.CreateSelect(in_range, picked, ::llvm::ConstantInt::get(llvm_i8_type, 0u)), i);
+                             }
+                             return swizzled;
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+
+// Splats.  Narrow integer lanes take the low bits of their i32 operand.
+case wasm1p1_simd_code::i8x16_splat:
+{
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    if(scalar == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateTrunc(scalar, ::llvm::Type::getInt8Ty(llvm_context))};
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateVectorSplat(16u, lane_value)));
+    break;
+}
+case wasm1p1_simd_code::i16x8_splat:
+{
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    if(scalar == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateTrunc(scalar, ::llvm::Type::getInt16Ty(llvm_context))};
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateVectorSplat(8u, lane_value)));
+    break;
+}
+case wasm1p1_simd_code::i32x4_splat:
+{
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    if(scalar == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateVectorSplat(4u, scalar)));
+    break;
+}
+case wasm1p1_simd_code::i64x2_splat:
+{
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i64)};
+    if(scalar == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateVectorSplat(2u, scalar)));
+    break;
+}
+case wasm1p1_simd_code::f32x4_splat:
+{
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::f32)};
+    if(scalar == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateVectorSplat(4u, scalar)));
+    break;
+}
+case wasm1p1_simd_code::f64x2_splat:
+{
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::f64)};
+    if(scalar == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateVectorSplat(2u, scalar)));
+    break;
+}
+
+// Lane extraction.  The lane immediate was range-checked by validation.
+case wasm1p1_simd_code::i8x16_extract_lane_s:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i8x16)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::i32, ir_builder.CreateSExt(lane_value, ::llvm::Type::getInt32Ty(llvm_context)));
+    break;
+}
+case wasm1p1_simd_code::i8x16_extract_lane_u:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i8x16)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::i32, ir_builder.CreateZExt(lane_value, ::llvm::Type::getInt32Ty(llvm_context)));
+    break;
+}
+case wasm1p1_simd_code::i16x8_extract_lane_s:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i16x8)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::i32, ir_builder.CreateSExt(lane_value, ::llvm::Type::getInt32Ty(llvm_context)));
+    break;
+}
+case wasm1p1_simd_code::i16x8_extract_lane_u:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i16x8)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::i32, ir_builder.CreateZExt(lane_value, ::llvm::Type::getInt32Ty(llvm_context)));
+    break;
+}
+case wasm1p1_simd_code::i32x4_extract_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i32x4)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::i32, lane_value);
+    break;
+}
+case wasm1p1_simd_code::i64x2_extract_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i64x2)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::i64, lane_value);
+    break;
+}
+case wasm1p1_simd_code::f32x4_extract_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::f32x4)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::f32, lane_value);
+    break;
+}
+case wasm1p1_simd_code::f64x2_extract_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::f64x2)};
+    if(vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateExtractElement(vector, lane)};
+    push_operand(runtime_operand_stack_value_type::f64, lane_value);
+    break;
+}
+
+// Lane replacement.  Narrow integer lanes take the low bits of their i32 operand.
+case wasm1p1_simd_code::i8x16_replace_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i8x16)};
+    if(scalar == nullptr || vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateTrunc(scalar, ::llvm::Type::getInt8Ty(llvm_context))};
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateInsertElement(vector, lane_value, lane)));
+    break;
+}
+case wasm1p1_simd_code::i16x8_replace_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i16x8)};
+    if(scalar == nullptr || vector == nullptr) [[unlikely]] { return result; }
+    auto lane_value{ir_builder.CreateTrunc(scalar, ::llvm::Type::getInt16Ty(llvm_context))};
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateInsertElement(vector, lane_value, lane)));
+    break;
+}
+case wasm1p1_simd_code::i32x4_replace_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i32x4)};
+    if(scalar == nullptr || vector == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateInsertElement(vector, scalar, lane)));
+    break;
+}
+case wasm1p1_simd_code::i64x2_replace_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::i64)};
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::i64x2)};
+    if(scalar == nullptr || vector == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateInsertElement(vector, scalar, lane)));
+    break;
+}
+case wasm1p1_simd_code::f32x4_replace_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::f32)};
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::f32x4)};
+    if(scalar == nullptr || vector == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateInsertElement(vector, scalar, lane)));
+    break;
+}
+case wasm1p1_simd_code::f64x2_replace_lane:
+{
+    if(code_curr == code_end) [[unlikely]] { return result; }
+    auto const lane{::std::to_integer<::std::uint64_t>(*code_curr)};
+    ++code_curr;
+    auto scalar{pop_simd_operand(runtime_operand_stack_value_type::f64)};
+    auto vector{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), llvm_jit_v128_shape::f64x2)};
+    if(scalar == nullptr || vector == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type, emit_llvm_v128_canonical(ir_builder, ir_builder.CreateInsertElement(vector, scalar, lane)));
+    break;
+}
+
+// Lane-wise comparisons.  Float `ne` is unordered so NaN lanes compare not-equal; every other float predicate is ordered.
+case wasm1p1_simd_code::i8x16_eq:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_EQ)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_ne:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_NE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_lt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_SLT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_lt_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_ULT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_gt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_SGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_gt_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_UGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_le_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_SLE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_le_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_ULE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_ge_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_SGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_ge_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i8x16, ::llvm::CmpInst::ICMP_UGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_eq:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_EQ)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_ne:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_NE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_lt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_SLT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_lt_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_ULT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_gt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_SGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_gt_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_UGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_le_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_SLE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_le_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_ULE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_ge_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_SGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_ge_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i16x8, ::llvm::CmpInst::ICMP_UGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_eq:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_EQ)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_ne:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_NE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_lt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_SLT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_lt_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_ULT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_gt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_SGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_gt_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_UGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_le_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_SLE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_le_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_ULE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_ge_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_SGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_ge_u:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i32x4, ::llvm::CmpInst::ICMP_UGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_eq:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i64x2, ::llvm::CmpInst::ICMP_EQ)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_ne:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i64x2, ::llvm::CmpInst::ICMP_NE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_lt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i64x2, ::llvm::CmpInst::ICMP_SLT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_gt_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i64x2, ::llvm::CmpInst::ICMP_SGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_le_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i64x2, ::llvm::CmpInst::ICMP_SLE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_ge_s:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::i64x2, ::llvm::CmpInst::ICMP_SGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f32x4_eq:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f32x4, ::llvm::CmpInst::FCMP_OEQ)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f32x4_ne:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f32x4, ::llvm::CmpInst::FCMP_UNE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f32x4_lt:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f32x4, ::llvm::CmpInst::FCMP_OLT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f32x4_gt:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f32x4, ::llvm::CmpInst::FCMP_OGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f32x4_le:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f32x4, ::llvm::CmpInst::FCMP_OLE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f32x4_ge:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f32x4, ::llvm::CmpInst::FCMP_OGE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f64x2_eq:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f64x2, ::llvm::CmpInst::FCMP_OEQ)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f64x2_ne:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f64x2, ::llvm::CmpInst::FCMP_UNE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f64x2_lt:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f64x2, ::llvm::CmpInst::FCMP_OLT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f64x2_gt:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f64x2, ::llvm::CmpInst::FCMP_OGT)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f64x2_le:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f64x2, ::llvm::CmpInst::FCMP_OLE)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::f64x2_ge:
+{
+    if(!emit_v128_compare(llvm_jit_v128_shape::f64x2, ::llvm::CmpInst::FCMP_OGE)) [[unlikely]] { return result; }
+    break;
+}
+
+// Bitwise operations are shape-agnostic and run on the canonical i64x2 view.
+case wasm1p1_simd_code::v128_not:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateNot(operand); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::v128_and:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateAnd(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::v128_andnot:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateAnd(left, ir_builder.CreateNot(right)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::v128_or:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateOr(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::v128_xor:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateXor(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// v128.bitselect
+// Bits of the top operand select between the first (set) and second (clear) operands.
+case wasm1p1_simd_code::v128_bitselect:
+{
+    auto mask{pop_simd_operand(runtime_operand_stack_v128_type)};
+    auto if_clear{pop_simd_operand(runtime_operand_stack_v128_type)};
+    auto if_set{pop_simd_operand(runtime_operand_stack_v128_type)};
+    if(mask == nullptr || if_clear == nullptr || if_set == nullptr) [[unlikely]] { return result; }
+    push_operand(runtime_operand_stack_v128_type,
+                 ir_builder.CreateOr(ir_builder.CreateAnd(if_set, mask), ir_builder.CreateAnd(if_clear, ir_builder.CreateNot(mask))));
+    break;
+}
+// v128.any_true
+case wasm1p1_simd_code::v128_any_true:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto bits{ir_builder.CreateBitCast(operand, ::llvm::Type::getInt128Ty(llvm_context))};
+                             return coerce_llvm_bool_to_i32(ir_builder, ir_builder.CreateICmpNE(bits, ::llvm::ConstantInt::get(bits->getType(), 0u)));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+
+// all_true / bitmask
+// Lane predicates are formed as an `<N x i1>` vector and reinterpreted as an N-bit integer, which keeps lane 0 in bit 0.
+case wasm1p1_simd_code::i8x16_all_true:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_nonzero{ir_builder.CreateICmpNE(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_nonzero, ::llvm::Type::getIntNTy(llvm_context, 16u))};
+                             auto all_ones{::llvm::Constant::getAllOnesValue(lane_bits->getType())};
+                             return coerce_llvm_bool_to_i32(ir_builder, ir_builder.CreateICmpEQ(lane_bits, all_ones));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_bitmask:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_negative{ir_builder.CreateICmpSLT(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_negative, ::llvm::Type::getIntNTy(llvm_context, 16u))};
+                             return ir_builder.CreateZExt(lane_bits, ::llvm::Type::getInt32Ty(llvm_context));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_all_true:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_nonzero{ir_builder.CreateICmpNE(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_nonzero, ::llvm::Type::getIntNTy(llvm_context, 8u))};
+                             auto all_ones{::llvm::Constant::getAllOnesValue(lane_bits->getType())};
+                             return coerce_llvm_bool_to_i32(ir_builder, ir_builder.CreateICmpEQ(lane_bits, all_ones));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_bitmask:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_negative{ir_builder.CreateICmpSLT(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_negative, ::llvm::Type::getIntNTy(llvm_context, 8u))};
+                             return ir_builder.CreateZExt(lane_bits, ::llvm::Type::getInt32Ty(llvm_context));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_all_true:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_nonzero{ir_builder.CreateICmpNE(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_nonzero, ::llvm::Type::getIntNTy(llvm_context, 4u))};
+                             auto all_ones{::llvm::Constant::getAllOnesValue(lane_bits->getType())};
+                             return coerce_llvm_bool_to_i32(ir_builder, ir_builder.CreateICmpEQ(lane_bits, all_ones));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_bitmask:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_negative{ir_builder.CreateICmpSLT(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_negative, ::llvm::Type::getIntNTy(llvm_context, 4u))};
+                             return ir_builder.CreateZExt(lane_bits, ::llvm::Type::getInt32Ty(llvm_context));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_all_true:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_nonzero{ir_builder.CreateICmpNE(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_nonzero, ::llvm::Type::getIntNTy(llvm_context, 2u))};
+                             auto all_ones{::llvm::Constant::getAllOnesValue(lane_bits->getType())};
+                             return coerce_llvm_bool_to_i32(ir_builder, ir_builder.CreateICmpEQ(lane_bits, all_ones));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_bitmask:
+{
+    if(!emit_v128_to_i32(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto lane_negative{ir_builder.CreateICmpSLT(operand, ::llvm::Constant::getNullValue(operand->getType()))};
+                             auto lane_bits{ir_builder.CreateBitCast(lane_negative, ::llvm::Type::getIntNTy(llvm_context, 2u))};
+                             return ir_builder.CreateZExt(lane_bits, ::llvm::Type::getInt32Ty(llvm_context));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+
+// Integer lane arithmetic.  `abs` passes `false` for is_int_min_poison so INT_MIN lanes wrap as Wasm requires.
+case wasm1p1_simd_code::i8x16_abs:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::abs, {operand, ::llvm::ConstantInt::getFalse(llvm_context)}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_neg:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateNeg(operand); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_add:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateAdd(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_sub:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSub(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_abs:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::abs, {operand, ::llvm::ConstantInt::getFalse(llvm_context)}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_neg:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateNeg(operand); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_add:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateAdd(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_sub:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSub(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_mul:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_abs:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::abs, {operand, ::llvm::ConstantInt::getFalse(llvm_context)}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_neg:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateNeg(operand); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_add:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateAdd(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_sub:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSub(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_mul:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_abs:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::abs, {operand, ::llvm::ConstantInt::getFalse(llvm_context)}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_neg:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateNeg(operand); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_add:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateAdd(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_sub:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSub(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_mul:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_popcnt:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::ctpop, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_add_sat_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::sadd_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_add_sat_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::uadd_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_sub_sat_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::ssub_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_sub_sat_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::usub_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_add_sat_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::sadd_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_add_sat_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::uadd_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_sub_sat_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::ssub_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_sub_sat_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::usub_sat, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_min_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::smin, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_min_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::umin, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_max_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::smax, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_max_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::umax, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_min_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::smin, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_min_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::umin, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_max_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::smax, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_max_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::umax, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_min_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::smin, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_min_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::umin, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_max_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::smax, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_max_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return call_v128_intrinsic(::llvm::Intrinsic::umax, {left, right}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// avgr_u rounds up: (a + b + 1) >> 1 computed in double-width lanes so the carry is kept.
+case wasm1p1_simd_code::i8x16_avgr_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, 16u), 16u)};
+                             auto wide_sum{ir_builder.CreateAdd(ir_builder.CreateZExt(left, wide_type), ir_builder.CreateZExt(right, wide_type))};
+                             auto sum{ir_builder.CreateAdd(wide_sum, ::llvm::ConstantInt::get(wide_type, 1u))};
+                             return ir_builder.CreateTrunc(ir_builder.CreateLShr(sum, ::llvm::ConstantInt::get(wide_type, 1u)), left->getType());
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_avgr_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, 32u), 8u)};
+                             auto wide_sum{ir_builder.CreateAdd(ir_builder.CreateZExt(left, wide_type), ir_builder.CreateZExt(right, wide_type))};
+                             auto sum{ir_builder.CreateAdd(wide_sum, ::llvm::ConstantInt::get(wide_type, 1u))};
+                             return ir_builder.CreateTrunc(ir_builder.CreateLShr(sum, ::llvm::ConstantInt::get(wide_type, 1u)), left->getType());
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// i16x8.q15mulr_sat_s: rounding Q15 multiply in i32 lanes.
+case wasm1p1_simd_code::i16x8_q15mulr_sat_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getInt32Ty(llvm_context), 8u)};
+                             auto product{ir_builder.CreateMul(ir_builder.CreateSExt(left, wide_type), ir_builder.CreateSExt(right, wide_type))};
+                             auto biased{ir_builder.CreateAdd(product, ::llvm::ConstantInt::get(wide_type, 0x4000u))};
+                             auto rounded{ir_builder.CreateAShr(biased, ::llvm::ConstantInt::get(wide_type, 15u))};
+                             // Only -32768 * -32768 exceeds the i16 range, so clamping the upper bound is sufficient.
+                             auto saturated{call_v128_intrinsic(::llvm::Intrinsic::smin, {rounded, ::llvm::ConstantInt::get(wide_type, 0x7fffu)})};
+                             return ir_builder.CreateTrunc(saturated, left->getType());
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// Saturating narrows clamp each signed input lane and concatenate the first operand's lanes before the second's.
+case wasm1p1_simd_code::i8x16_narrow_i16x8_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_v128_concat(emit_v128_saturating_narrow(left, true), emit_v128_saturating_narrow(right, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i8x16_narrow_i16x8_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_v128_concat(emit_v128_saturating_narrow(left, false), emit_v128_saturating_narrow(right, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_narrow_i32x4_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_v128_concat(emit_v128_saturating_narrow(left, true), emit_v128_saturating_narrow(right, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_narrow_i32x4_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_v128_concat(emit_v128_saturating_narrow(left, false), emit_v128_saturating_narrow(right, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// Widening conversions select the low or high half of the input lanes before extending.
+case wasm1p1_simd_code::i16x8_extend_low_i8x16_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, false, true); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extend_low_i8x16_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, false, false); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extend_high_i8x16_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, true, true); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extend_high_i8x16_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, true, false); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extmul_low_i8x16_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, false, true), emit_v128_extend_half(right, false, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extmul_low_i8x16_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, false, false), emit_v128_extend_half(right, false, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extmul_high_i8x16_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, true, true), emit_v128_extend_half(right, true, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extmul_high_i8x16_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i8x16,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, true, false), emit_v128_extend_half(right, true, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extend_low_i16x8_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, false, true); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extend_low_i16x8_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, false, false); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extend_high_i16x8_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, true, true); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extend_high_i16x8_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, true, false); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extmul_low_i16x8_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, false, true), emit_v128_extend_half(right, false, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extmul_low_i16x8_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, false, false), emit_v128_extend_half(right, false, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extmul_high_i16x8_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, true, true), emit_v128_extend_half(right, true, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extmul_high_i16x8_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, true, false), emit_v128_extend_half(right, true, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extend_low_i32x4_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, false, true); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extend_low_i32x4_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, false, false); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extend_high_i32x4_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, true, true); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extend_high_i32x4_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return emit_v128_extend_half(operand, true, false); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extmul_low_i32x4_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, false, true), emit_v128_extend_half(right, false, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extmul_low_i32x4_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, false, false), emit_v128_extend_half(right, false, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extmul_high_i32x4_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, true, true), emit_v128_extend_half(right, true, true)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i64x2_extmul_high_i32x4_u:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateMul(emit_v128_extend_half(left, true, false), emit_v128_extend_half(right, true, false)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// extadd_pairwise adds adjacent lane pairs after extending the even and odd lanes separately.
+case wasm1p1_simd_code::i16x8_extadd_pairwise_i8x16_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, 16u), 8u)};
+                            auto even{ir_builder.CreateSExt(emit_v128_lane_subset(operand, 0u, 8u, 2u), wide_type)};
+                            auto odd{ir_builder.CreateSExt(emit_v128_lane_subset(operand, 1u, 8u, 2u), wide_type)};
+                            return ir_builder.CreateAdd(even, odd);
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i16x8_extadd_pairwise_i8x16_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i8x16,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, 16u), 8u)};
+                            auto even{ir_builder.CreateZExt(emit_v128_lane_subset(operand, 0u, 8u, 2u), wide_type)};
+                            auto odd{ir_builder.CreateZExt(emit_v128_lane_subset(operand, 1u, 8u, 2u), wide_type)};
+                            return ir_builder.CreateAdd(even, odd);
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extadd_pairwise_i16x8_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, 32u), 4u)};
+                            auto even{ir_builder.CreateSExt(emit_v128_lane_subset(operand, 0u, 4u, 2u), wide_type)};
+                            auto odd{ir_builder.CreateSExt(emit_v128_lane_subset(operand, 1u, 4u, 2u), wide_type)};
+                            return ir_builder.CreateAdd(even, odd);
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_extadd_pairwise_i16x8_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i16x8,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, 32u), 4u)};
+                            auto even{ir_builder.CreateZExt(emit_v128_lane_subset(operand, 0u, 4u, 2u), wide_type)};
+                            auto odd{ir_builder.CreateZExt(emit_v128_lane_subset(operand, 1u, 4u, 2u), wide_type)};
+                            return ir_builder.CreateAdd(even, odd);
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// i32x4.dot_i16x8_s: pairwise sum of the full 32-bit products.
+case wasm1p1_simd_code::i32x4_dot_i16x8_s:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::i16x8,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         {
+                             auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getInt32Ty(llvm_context), 8u)};
+                             auto products{ir_builder.CreateMul(ir_builder.CreateSExt(left, wide_type), ir_builder.CreateSExt(right, wide_type))};
+                             return ir_builder.CreateAdd(emit_v128_lane_subset(products, 0u, 4u, 2u), emit_v128_lane_subset(products, 1u, 4u, 2u));
+                         })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// Shifts.
+case wasm1p1_simd_code::i8x16_shl:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i8x16, ::llvm::Instruction::Shl)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_shr_s:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i8x16, ::llvm::Instruction::AShr)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i8x16_shr_u:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i8x16, ::llvm::Instruction::LShr)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_shl:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i16x8, ::llvm::Instruction::Shl)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_shr_s:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i16x8, ::llvm::Instruction::AShr)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i16x8_shr_u:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i16x8, ::llvm::Instruction::LShr)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_shl:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i32x4, ::llvm::Instruction::Shl)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_shr_s:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i32x4, ::llvm::Instruction::AShr)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i32x4_shr_u:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i32x4, ::llvm::Instruction::LShr)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_shl:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i64x2, ::llvm::Instruction::Shl)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_shr_s:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i64x2, ::llvm::Instruction::AShr)) [[unlikely]] { return result; }
+    break;
+}
+case wasm1p1_simd_code::i64x2_shr_u:
+{
+    if(!emit_v128_shift(llvm_jit_v128_shape::i64x2, ::llvm::Instruction::LShr)) [[unlikely]] { return result; }
+    break;
+}
+
+// Float lane arithmetic.  Rounding uses the same intrinsics as the scalar f32/f64 lowering, and min/max reuse the
+// scalar Wasm NaN/signed-zero lowering, which is lane-wise.
+case wasm1p1_simd_code::f32x4_abs:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::fabs, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_neg:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateFNeg(operand); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_sqrt:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::sqrt, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_ceil:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::ceil, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_floor:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::floor, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_trunc:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::trunc, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_nearest:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::rint, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_add:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFAdd(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_sub:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFSub(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_mul:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFMul(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_div:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFDiv(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_min:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_llvm_float_min(ir_builder, left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_max:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_llvm_float_max(ir_builder, left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+// pmin/pmax are the C-style `b < a ? b : a` / `a < b ? b : a` selects.
+case wasm1p1_simd_code::f32x4_pmin:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSelect(ir_builder.CreateFCmpOLT(right, left), right, left); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_pmax:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f32x4,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSelect(ir_builder.CreateFCmpOLT(left, right), right, left); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_abs:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::fabs, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_neg:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateFNeg(operand); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_sqrt:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::sqrt, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_ceil:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::ceil, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_floor:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::floor, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_trunc:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::trunc, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_nearest:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return call_v128_intrinsic(::llvm::Intrinsic::rint, {operand}); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_add:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFAdd(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_sub:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFSub(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_mul:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFMul(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_div:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateFDiv(left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_min:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_llvm_float_min(ir_builder, left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_max:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return emit_llvm_float_max(ir_builder, left, right); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_pmin:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSelect(ir_builder.CreateFCmpOLT(right, left), right, left); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_pmax:
+{
+    if(!emit_v128_binary(llvm_jit_v128_shape::f64x2,
+                         [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                         { return ir_builder.CreateSelect(ir_builder.CreateFCmpOLT(left, right), right, left); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+
+// Conversions.  The LLVM saturating conversion intrinsics already map NaN to 0 and clamp out-of-range lanes.
+case wasm1p1_simd_code::i32x4_trunc_sat_f32x4_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            ::llvm::Type* overloaded_types[]{::llvm::FixedVectorType::get(::llvm::Type::getInt32Ty(llvm_context), 4u), operand->getType()};
+                            return call_llvm_intrinsic(*llvm_module, ir_builder, ::llvm::Intrinsic::fptosi_sat, overloaded_types, {operand});
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_trunc_sat_f32x4_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            ::llvm::Type* overloaded_types[]{::llvm::FixedVectorType::get(::llvm::Type::getInt32Ty(llvm_context), 4u), operand->getType()};
+                            return call_llvm_intrinsic(*llvm_module, ir_builder, ::llvm::Intrinsic::fptoui_sat, overloaded_types, {operand});
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_convert_i32x4_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateSIToFP(operand, ::llvm::FixedVectorType::get(::llvm::Type::getFloatTy(llvm_context), 4u)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_convert_i32x4_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        { return ir_builder.CreateUIToFP(operand, ::llvm::FixedVectorType::get(::llvm::Type::getFloatTy(llvm_context), 4u)); })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_trunc_sat_f64x2_s_zero:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto narrow_type{::llvm::FixedVectorType::get(::llvm::Type::getInt32Ty(llvm_context), 2u)};
+                            ::llvm::Type* overloaded_types[]{narrow_type, operand->getType()};
+                            auto converted{call_llvm_intrinsic(*llvm_module, ir_builder, ::llvm::Intrinsic::fptosi_sat, overloaded_types, {operand})};
+                            return emit_v128_concat(converted, ::llvm::Constant::getNullValue(narrow_type));
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::i32x4_trunc_sat_f64x2_u_zero:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto narrow_type{::llvm::FixedVectorType::get(::llvm::Type::getInt32Ty(llvm_context), 2u)};
+                            ::llvm::Type* overloaded_types[]{narrow_type, operand->getType()};
+                            auto converted{call_llvm_intrinsic(*llvm_module, ir_builder, ::llvm::Intrinsic::fptoui_sat, overloaded_types, {operand})};
+                            return emit_v128_concat(converted, ::llvm::Constant::getNullValue(narrow_type));
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_convert_low_i32x4_s:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getDoubleTy(llvm_context), 2u)};
+                            return ir_builder.CreateSIToFP(emit_v128_lane_subset(operand, 0u, 2u, 1u), wide_type);
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_convert_low_i32x4_u:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::i32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getDoubleTy(llvm_context), 2u)};
+                            return ir_builder.CreateUIToFP(emit_v128_lane_subset(operand, 0u, 2u, 1u), wide_type);
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f32x4_demote_f64x2_zero:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f64x2,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto narrow_type{::llvm::FixedVectorType::get(::llvm::Type::getFloatTy(llvm_context), 2u)};
+                            return emit_v128_concat(ir_builder.CreateFPTrunc(operand, narrow_type), ::llvm::Constant::getNullValue(narrow_type));
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
+case wasm1p1_simd_code::f64x2_promote_low_f32x4:
+{
+    if(!emit_v128_unary(llvm_jit_v128_shape::f32x4,
+                        [&](::llvm::Value* operand) constexpr noexcept -> ::llvm::Value*
+                        {
+                            auto wide_type{::llvm::FixedVectorType::get(::llvm::Type::getDoubleTy(llvm_context), 2u)};
+                            return ir_builder.CreateFPExt(emit_v128_lane_subset(operand, 0u, 2u, 1u), wide_type);
+                        })) [[unlikely]]
+    {
+        return result;
+    }
+    break;
+}
@@ -1,7 +1,8 @@
     // WebAssembly 1.1 scalar opcode validation/emission for the LLVM JIT path.
-    // Keep feature gates synchronized with validation/standard/wasm1p1/validator.h.  Value spaces that the current
-    // LLVM typed ABI cannot represent (funcref/externref/v128/multi-value block signatures) must disable emission rather
-    // than manufacture an ABI-incompatible LLVM value.
+    // Keep feature gates synchronized with validation/standard/wasm1p1/validator.h.  v128 values are lowered as
+    // <2 x i64> inside a function body (see simd_cases.h); value spaces that the current LLVM typed ABI cannot represent
+    // (funcref/externref/multi-value block signatures) must disable emission rather than manufacture an ABI-incompatible
+    // LLVM value.
 
 case static_cast<wasm1_code>(wasm1p1_code::select_t):
 {
@@ -74,9 +75,7 @@ case static_cast<wasm1_code>(wasm1p1_code::select_t):
         if(emit_llvm_jit_active)
         {
             llvm_jit_instruction_emitted_inline = true;
-            if(have_known_select_value_type &&
-               (select_value_type == curr_operand_stack_value_type::i32 || select_value_type == curr_operand_stack_value_type::i64 ||
-                select_value_type == curr_operand_stack_value_type::f32 || select_value_type == curr_operand_stack_value_type::f64))
+            if(have_known_select_value_type && is_runtime_wasm_value_type_inline_llvm_jit_local(select_value_type))
             {
                 if(!try_emit_runtime_local_func_llvm_jit_select(llvm_jit_emit_state)) [[unlikely]] { disable_inline_llvm_jit_emission(); }
             }
@@ -125,8 +124,7 @@ case static_cast<wasm1_code>(wasm1p1_code::select_t):
     if(emit_llvm_jit_active)
     {
         llvm_jit_instruction_emitted_inline = true;
-        if(result_type == curr_operand_stack_value_type::i32 || result_type == curr_operand_stack_value_type::i64 ||
-           result_type == curr_operand_stack_value_type::f32 || result_type == curr_operand_stack_value_type::f64)
+        if(is_runtime_wasm_value_type_inline_llvm_jit_local(result_type))
         {
             if(!try_emit_runtime_local_func_llvm_jit_select(llvm_jit_emit_state)) [[unlikely]] { disable_inline_llvm_jit_emission(); }
         }
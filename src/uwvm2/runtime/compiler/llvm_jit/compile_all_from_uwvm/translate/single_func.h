@@ -16,6 +16,31 @@ struct tiered_loop_reentry_storage_t
     ::std::uint_least32_t entry_id{};
 };
 
+// Branch and entry execution counts for one local defined function.  Tier-1 code records them and a later tier-2 compile
+// turns them into LLVM `!prof` metadata.  Slots are indexed by the function-relative byte offset of the branching
+// instruction: `if`/`br_if` use `[offset]` for the taken (then) edge and `[offset + 1]` for the fallthrough (else) edge,
+// `br_table` uses `[offset + i]` for case `i` and `[offset + N]` for the default, and `call_indirect` keeps a majority
+// target vote in `[offset]..[offset + 2]`.  Each of these instructions is at least as long as its slot run, so runs never
+// overlap.  The final slot counts normal function entries.
+struct llvm_jit_function_profile_t
+{
+    // Empty until the function is first emitted in collection mode; then `code size + 1` counters.
+    ::uwvm2::utils::container::vector<::std::size_t> counters{};
+};
+
+// How the emitter treats `llvm_jit_function_profile_t` storage supplied through `compile_option`.
+enum class llvm_jit_profile_mode_t : unsigned
+{
+    // No instrumentation and no profile metadata.
+    none,
+
+    // Emit counter updates at function entry and at every `if`/`br_if`/`br_table`/`call_indirect`.
+    collect,
+
+    // Attach recorded counts as branch weights and function entry counts, and devirtualize dominant `call_indirect` targets.
+    apply
+};
+
 // Borrowed runtime storage needed to validate and optionally emit one local defined function.
 struct local_func_storage_t
 {
@@ -147,6 +172,19 @@ struct compile_option
     // Emits compact DWARF/unwind metadata for optimized trap-stack reconstruction.
     bool emit_unwind_call_stack_frames{};
 
+    // Per-local-function execution profiles, indexed by local function index.  In `collect` mode the counters are written by
+    // generated code and must outlive it; in `apply` mode they are only read during emission.
+    llvm_jit_function_profile_t* function_profiles{};
+    ::std::size_t function_profile_count{};
+    llvm_jit_profile_mode_t profile_mode{};
+
+    // `--runtime-fuel` counter owned by the runtime. When set, every function entry and loop iteration decrements it and traps
+    // with `llvm_jit_trap_kind::fuel_exhausted` once it is empty; null emits no metering.
+    ::std::uint_least64_t* fuel_counter{};
+    // `--wasm-timeout` interruption flag owned by the runtime. When set, the same sites also load it and trap with
+    // `llvm_jit_trap_kind::epoch_deadline` once it is raised; null emits no check.
+    ::std::atomic_uint_least32_t const* epoch_interrupt{};
+
     // Optional per-task module callback used by optimization/linking pipelines.
     llvm_jit_task_module_pre_link_callback_t llvm_jit_task_module_pre_link_callback{};
     void* llvm_jit_task_module_pre_link_callback_context{};
@@ -782,7 +820,11 @@ namespace details
                                     bool emit_call_stack_frames = true,
                                     bool emit_unwind_call_stack_frames = false,
                                     parser_feature_parameter_t const* validator_feature_parameter = nullptr,
-                                    ::uwvm2::utils::container::vector<tiered_loop_reentry_storage_t>* tiered_loop_reentries_out = nullptr) UWVM_THROWS
+                                    ::uwvm2::utils::container::vector<tiered_loop_reentry_storage_t>* tiered_loop_reentries_out = nullptr,
+                                    llvm_jit_function_profile_t* function_profile = nullptr,
+                                    llvm_jit_profile_mode_t profile_mode = llvm_jit_profile_mode_t::none,
+                                    ::std::uint_least64_t* fuel_counter = nullptr,
+                                    ::std::atomic_uint_least32_t const* epoch_interrupt = nullptr) UWVM_THROWS
     {
         auto const function_index{local_func_storage.function_index};
         auto const code_begin{local_func_storage.code_begin};
@@ -1030,6 +1072,7 @@ namespace details
         static constexpr value_type_enum i64_result_arr[1u]{static_cast<value_type_enum>(::uwvm2::parser::wasm::standard::wasm1::type::value_type::i64)};
         static constexpr value_type_enum f32_result_arr[1u]{static_cast<value_type_enum>(::uwvm2::parser::wasm::standard::wasm1::type::value_type::f32)};
         static constexpr value_type_enum f64_result_arr[1u]{static_cast<value_type_enum>(::uwvm2::parser::wasm::standard::wasm1::type::value_type::f64)};
+        static constexpr value_type_enum v128_result_arr[1u]{static_cast<value_type_enum>(::uwvm2::parser::wasm::standard::wasm1p1::type::value_type::v128)};
 
         // Function block (label/result type is the function result).  MVP functions have zero or one result; if
         // multi-value results are enabled, the validator can already carry a pointer range but the LLVM emitter's PHI and
@@ -1061,7 +1104,11 @@ namespace details
                                                                                      lazy_defined_targets_are_atomic,
                                                                                      emit_tiered_loop_reentry_entries,
                                                                                      emit_call_stack_frames,
-                                                                                     emit_unwind_call_stack_frames)};
+                                                                                     emit_unwind_call_stack_frames,
+                                                                                     function_profile,
+                                                                                     profile_mode,
+                                                                                     fuel_counter,
+                                                                                     epoch_interrupt)};
 
         using wasm_value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
         using wasm1p1_code = ::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_basic;
@@ -1512,20 +1559,34 @@ namespace details
 
         for(auto const& local_part: wasm_code_ptr->locals)
         {
-            if(!is_runtime_wasm_value_type_inline_llvm_jit_scalar(static_cast<runtime_operand_stack_value_type>(local_part.type))) { return true; }
+            if(!is_runtime_wasm_value_type_inline_llvm_jit_local(static_cast<runtime_operand_stack_value_type>(local_part.type))) { return true; }
         }
 
-        auto const is_inline_scalar_blocktype_byte{[](::std::uint_least8_t blocktype_byte) constexpr noexcept
-                                                   {
-                                                       if(blocktype_byte == 0x40u) { return true; }
-                                                       auto const vt{static_cast<runtime_operand_stack_value_type>(blocktype_byte)};
-                                                       return is_runtime_wasm_value_type_inline_llvm_jit_scalar(vt);
-                                                   }};
+        auto const is_inline_blocktype_byte{[](::std::uint_least8_t blocktype_byte) constexpr noexcept
+                                            {
+                                                if(blocktype_byte == 0x40u) { return true; }
+                                                auto const vt{static_cast<runtime_operand_stack_value_type>(blocktype_byte)};
+                                                return is_runtime_wasm_value_type_inline_llvm_jit_local(vt);
+                                            }};
         auto const default_memory_supports_native_bulk_bridge{[&]() constexpr noexcept
                                                               {
                                                                   auto const access_info{resolve_runtime_memory_access_info(curr_module, 0u)};
                                                                   return access_info.memory_p != nullptr;
                                                               }};
+        // SIMD memory forms are lowered only as direct vector loads/stores; there is no v128 host bridge for allocator-backed
+        // or local-imported memories.
+        constexpr bool direct_simd_layout{runtime_native_memory_t::can_mmap && ::std::endian::native == ::std::endian::little};
+        auto const default_memory_supports_direct_simd_access{[&]() constexpr noexcept
+                                                              {
+                                                                  if constexpr(!direct_simd_layout)
+                                                                  {
+                                                                      return false;
+                                                                  }
+                                                                  else
+                                                                  {
+                                                                      return default_memory_supports_native_bulk_bridge();
+                                                                  }
+                                                              }};
 
         auto code_curr{local_func_storage.code_begin};
         auto const code_end{local_func_storage.code_end};
@@ -1545,7 +1606,7 @@ namespace details
                     ::std::uint_least8_t blocktype_byte{};
                     ::std::memcpy(::std::addressof(blocktype_byte), code_curr, sizeof(blocktype_byte));
                     ++code_curr;
-                    if(!is_inline_scalar_blocktype_byte(blocktype_byte)) { return true; }
+                    if(!is_inline_blocktype_byte(blocktype_byte)) { return true; }
                     break;
                 }
                 case static_cast<::std::uint_least8_t>(wasm1_code::call):
@@ -1582,7 +1643,7 @@ namespace details
                     ::std::uint_least8_t result_type_byte{};
                     ::std::memcpy(::std::addressof(result_type_byte), code_curr, sizeof(result_type_byte));
                     ++code_curr;
-                    if(!is_runtime_wasm_value_type_inline_llvm_jit_scalar(static_cast<runtime_operand_stack_value_type>(result_type_byte))) { return true; }
+                    if(!is_runtime_wasm_value_type_inline_llvm_jit_local(static_cast<runtime_operand_stack_value_type>(result_type_byte))) { return true; }
                     break;
                 }
                 case static_cast<::std::uint_least8_t>(wasm1p1_code::i32_extend8_s):
@@ -1644,10 +1705,42 @@ namespace details
                 case static_cast<::std::uint_least8_t>(wasm1p1_code::ref_null):
                 case static_cast<::std::uint_least8_t>(wasm1p1_code::ref_is_null):
                 case static_cast<::std::uint_least8_t>(wasm1p1_code::ref_func):
-                case static_cast<::std::uint_least8_t>(wasm1p1_code::simd_prefix):
                 {
                     return true;
                 }
+                case static_cast<::std::uint_least8_t>(wasm1_code::global_get):
+                case static_cast<::std::uint_least8_t>(wasm1_code::global_set):
+                {
+                    ++code_curr;
+                    validation_module_traits_t::wasm_u32 global_index{};
+                    if(!parse_wasm_leb128_immediate(code_curr, code_end, global_index)) [[unlikely]] { return true; }
+                    auto const global_access_info{resolve_runtime_global_access_info(curr_module, global_index)};
+                    if(is_runtime_wasm_value_type_inline_llvm_jit_scalar(global_access_info.value_type)) { break; }
+                    // Non-scalar globals have no bridge; only directly addressable v128 storage can be lowered.
+                    if(global_access_info.value_type != runtime_operand_stack_v128_type || global_access_info.storage_ptr == nullptr) { return true; }
+                    break;
+                }
+                case static_cast<::std::uint_least8_t>(wasm1p1_code::simd_prefix):
+                {
+                    // v128 lanes are lowered as LLVM vector elements, whose in-register order matches Wasm lane order only
+                    // on little-endian hosts.
+                    if constexpr(::std::endian::native != ::std::endian::little) { return true; }
+                    ++code_curr;
+                    auto const simd_begin{code_curr};
+                    validation_module_traits_t::wasm_u32 subopcode{};
+                    if(!parse_wasm_leb128_immediate(code_curr, code_end, subopcode)) [[unlikely]] { return true; }
+                    auto const signature{get_llvm_jit_simd_instruction_signature(subopcode)};
+                    if(!signature.valid) [[unlikely]] { return true; }
+                    if((signature.immediate_kind == llvm_jit_simd_immediate_kind::memarg ||
+                        signature.immediate_kind == llvm_jit_simd_immediate_kind::memarg_lane) &&
+                       !default_memory_supports_direct_simd_access())
+                    {
+                        return true;
+                    }
+                    code_curr = simd_begin;
+                    if(!skip_wasm_simd_instruction_immediates(code_curr, code_end)) [[unlikely]] { return true; }
+                    break;
+                }
                 default:
                 {
                     if(!skip_wasm_unreachable_noncontrol_instruction(code_curr, code_end)) [[unlikely]] { return true; }
@@ -1704,7 +1797,13 @@ namespace details
                                     options.emit_call_stack_frames,
                                     options.emit_unwind_call_stack_frames,
                                     options.validator_feature_parameter,
-                                    ::std::addressof(local_func_storage.tiered_loop_reentries));
+                                    ::std::addressof(local_func_storage.tiered_loop_reentries),
+                                    local_function_idx < options.function_profile_count && options.function_profiles != nullptr
+                                        ? options.function_profiles + local_function_idx
+                                        : nullptr,
+                                    options.profile_mode,
+                                    options.fuel_counter,
+                                    options.epoch_interrupt);
         return local_func_storage;
     }
 
@@ -188,8 +188,14 @@ public:
 [[nodiscard]] inline constexpr ::std::uint_least8_t get_runtime_wasm_value_type_encoding(runtime_operand_stack_value_type value_type) noexcept
 { return static_cast<::std::uint_least8_t>(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(value_type)); }
 
-// Map a supported Wasm MVP scalar type to its LLVM scalar type.  Unsupported or malformed runtime types return null so
-// callers can abort emission without manufacturing an invalid type.
+// Runtime tag for the SIMD `v128` value type.  The runtime value-type enum only names the MVP scalars, so the tag is spelled
+// through the WebAssembly 1.1 encoding.
+inline constexpr runtime_operand_stack_value_type runtime_operand_stack_v128_type{
+    static_cast<runtime_operand_stack_value_type>(::uwvm2::parser::wasm::standard::wasm1p1::type::value_type::v128)};
+
+// Map a supported Wasm value type to its LLVM type.  MVP scalars map to LLVM scalars and `v128` maps to the canonical
+// `<2 x i64>` vector; SIMD opcodes bitcast to their lane shape locally.  Unsupported or malformed runtime types return null
+// so callers can abort emission without manufacturing an invalid type.
 [[nodiscard]] inline constexpr ::llvm::Type* get_llvm_type_from_wasm_value_type(::llvm::LLVMContext& llvm_context,
                                                                                 runtime_operand_stack_value_type value_type) noexcept
 {
@@ -203,11 +209,57 @@ public:
             return ::llvm::Type::getFloatTy(llvm_context);
         case static_cast<::std::uint_least8_t>(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(runtime_operand_stack_value_type::f64)):
             return ::llvm::Type::getDoubleTy(llvm_context);
+        case static_cast<::std::uint_least8_t>(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(runtime_operand_stack_v128_type)):
+            return ::llvm::FixedVectorType::get(::llvm::Type::getInt64Ty(llvm_context), 2u);
         [[unlikely]] default:
             return nullptr;
     }
 }
 
+// Lane interpretations of a Wasm `v128` value.  Every SIMD opcode names exactly one of these shapes for its operands and
+// result.
+enum class llvm_jit_v128_shape : unsigned
+{
+    i8x16,
+    i16x8,
+    i32x4,
+    i64x2,
+    f32x4,
+    f64x2
+};
+
+// Return the LLVM vector type for one v128 lane shape.
+[[nodiscard]] inline constexpr ::llvm::FixedVectorType* get_llvm_v128_shape_type(::llvm::LLVMContext& llvm_context, llvm_jit_v128_shape shape) noexcept
+{
+    switch(shape)
+    {
+        case llvm_jit_v128_shape::i8x16: return ::llvm::FixedVectorType::get(::llvm::Type::getInt8Ty(llvm_context), 16u);
+        case llvm_jit_v128_shape::i16x8: return ::llvm::FixedVectorType::get(::llvm::Type::getInt16Ty(llvm_context), 8u);
+        case llvm_jit_v128_shape::i32x4: return ::llvm::FixedVectorType::get(::llvm::Type::getInt32Ty(llvm_context), 4u);
+        case llvm_jit_v128_shape::i64x2: return ::llvm::FixedVectorType::get(::llvm::Type::getInt64Ty(llvm_context), 2u);
+        case llvm_jit_v128_shape::f32x4: return ::llvm::FixedVectorType::get(::llvm::Type::getFloatTy(llvm_context), 4u);
+        case llvm_jit_v128_shape::f64x2: return ::llvm::FixedVectorType::get(::llvm::Type::getDoubleTy(llvm_context), 2u);
+        [[unlikely]] default: return nullptr;
+    }
+}
+
+// Reinterpret a canonical `<2 x i64>` v128 value as the requested lane shape.  The bitcast is free on little-endian hosts,
+// where LLVM vector element 0 occupies the lowest-addressed bytes exactly like Wasm lane 0.
+[[nodiscard]] inline constexpr ::llvm::Value* emit_llvm_v128_as_shape(::llvm::IRBuilder<>& ir_builder, ::llvm::Value* value, llvm_jit_v128_shape shape) noexcept
+{
+    if(value == nullptr) [[unlikely]] { return nullptr; }
+    auto shape_type{get_llvm_v128_shape_type(ir_builder.getContext(), shape)};
+    if(shape_type == nullptr) [[unlikely]] { return nullptr; }
+    return ir_builder.CreateBitCast(value, shape_type);
+}
+
+// Reinterpret any 128-bit LLVM vector back to the canonical v128 representation pushed on the operand stack.
+[[nodiscard]] inline constexpr ::llvm::Value* emit_llvm_v128_canonical(::llvm::IRBuilder<>& ir_builder, ::llvm::Value* value) noexcept
+{
+    if(value == nullptr) [[unlikely]] { return nullptr; }
+    return ir_builder.CreateBitCast(value, ::llvm::FixedVectorType::get(::llvm::Type::getInt64Ty(ir_builder.getContext()), 2u));
+}
+
 // Produce an LLVM pointer type in the requested address space.  The pointee is used only to recover the LLVM context
 // because opaque pointers no longer encode pointee type information.
 [[nodiscard]] inline constexpr ::llvm::PointerType* get_llvm_pointer_type(::llvm::Type* pointee_type, unsigned address_space = 0u) noexcept
@@ -817,6 +869,12 @@ inline constexpr ::llvm::CallInst* apply_llvm_jit_wasm_calling_conv(::llvm::Call
     }
 }
 
+// Value types that may live in locals, block results, and the transient operand stack of an inline-lowered function body.
+// `v128` is included here, but not in the function-signature predicate above, because the typed call ABI and the runtime
+// bridges still exchange scalars only.
+[[nodiscard]] inline constexpr bool is_runtime_wasm_value_type_inline_llvm_jit_local(runtime_operand_stack_value_type value_type) noexcept
+{ return is_runtime_wasm_value_type_inline_llvm_jit_scalar(value_type) || value_type == runtime_operand_stack_v128_type; }
+
 // Create the zero/null constant for a Wasm scalar type, used for local initialization and default reentry arguments.
 [[nodiscard]] inline constexpr ::llvm::Constant* get_llvm_zero_constant_from_wasm_value_type(::llvm::LLVMContext& llvm_context,
                                                                                              runtime_operand_stack_value_type value_type) noexcept
@@ -1215,36 +1273,47 @@ inline constexpr void
     return phi;
 }
 
-// Convert a signaling NaN to a quiet NaN while preserving the payload bits used by Wasm min/max propagation rules.
+// Convert a signaling NaN to a quiet NaN while preserving the payload bits used by Wasm min/max propagation rules.  Float
+// vectors (the SIMD f32x4/f64x2 shapes) are quieted lane-wise with a splatted mask.
 [[nodiscard]] inline constexpr ::llvm::Value* quiet_llvm_nan(::llvm::IRBuilder<>& ir_builder, ::llvm::Value* nan) noexcept
 {
     if(nan == nullptr) [[unlikely]] { return nullptr; }
 
-    if(nan->getType()->isFloatTy())
+    auto scalar_type{nan->getType()->getScalarType()};
+    if(scalar_type->isFloatTy())
     {
         // IEEE-754 quiet bit for binary32 significands.
-        auto int_value{ir_builder.CreateBitCast(nan, ::llvm::Type::getInt32Ty(ir_builder.getContext()))};
+        auto int_value{ir_builder.CreateBitCast(nan, nan->getType()->getWithNewType(::llvm::Type::getInt32Ty(ir_builder.getContext())))};
         auto quiet_mask{::llvm::ConstantInt::get(int_value->getType(), 0x00400000u)};
         return ir_builder.CreateBitCast(ir_builder.CreateOr(int_value, quiet_mask), nan->getType());
     }
 
-    if(nan->getType()->isDoubleTy())
+    if(scalar_type->isDoubleTy())
     {
         // IEEE-754 quiet bit for binary64 significands.
-        auto int_value{ir_builder.CreateBitCast(nan, ::llvm::Type::getInt64Ty(ir_builder.getContext()))};
+        auto int_value{ir_builder.CreateBitCast(nan, nan->getType()->getWithNewType(::llvm::Type::getInt64Ty(ir_builder.getContext())))};
         auto quiet_mask{::llvm::ConstantInt::get(int_value->getType(), 0x0008000000000000ull)};
         return ir_builder.CreateBitCast(ir_builder.CreateOr(int_value, quiet_mask), nan->getType());
     }
     return nullptr;
 }
 
+// Return the integer type with the same bit layout as a float scalar or float vector type.
+[[nodiscard]] inline constexpr ::llvm::Type* get_llvm_float_bits_type(::llvm::Type* float_type) noexcept
+{
+    if(float_type == nullptr) [[unlikely]] { return nullptr; }
+    auto const scalar_bits{float_type->getScalarType()->isFloatTy() ? 32u : 64u};
+    return float_type->getWithNewType(::llvm::Type::getIntNTy(float_type->getContext(), scalar_bits));
+}
+
 // Emit Wasm floating-point min.  This differs from many native/library min operations because NaNs are quieted and the
-// signed-zero tie is resolved by OR-ing the bit patterns, which preserves -0.0 for min(+0.0, -0.0).
+// signed-zero tie is resolved by OR-ing the bit patterns, which preserves -0.0 for min(+0.0, -0.0).  Every step is a
+// lane-wise compare/select, so the same lowering serves scalar f32/f64 and SIMD f32x4/f64x2.
 [[nodiscard]] inline constexpr ::llvm::Value* emit_llvm_float_min(::llvm::IRBuilder<>& ir_builder, ::llvm::Value* left, ::llvm::Value* right) noexcept
 {
     if(left == nullptr || right == nullptr) [[unlikely]] { return nullptr; }
 
-    auto int_type{left->getType()->isFloatTy() ? ::llvm::Type::getInt32Ty(ir_builder.getContext()) : ::llvm::Type::getInt64Ty(ir_builder.getContext())};
+    auto int_type{get_llvm_float_bits_type(left->getType())};
     auto is_left_nan{ir_builder.CreateFCmpUNO(left, left)};
     auto is_right_nan{ir_builder.CreateFCmpUNO(right, right)};
     auto is_left_less_than_right{ir_builder.CreateFCmpOLT(left, right)};
@@ -1273,7 +1342,7 @@ inline constexpr void
 {
     if(left == nullptr || right == nullptr) [[unlikely]] { return nullptr; }
 
-    auto int_type{left->getType()->isFloatTy() ? ::llvm::Type::getInt32Ty(ir_builder.getContext()) : ::llvm::Type::getInt64Ty(ir_builder.getContext())};
+    auto int_type{get_llvm_float_bits_type(left->getType())};
     auto is_left_nan{ir_builder.CreateFCmpUNO(left, left)};
     auto is_right_nan{ir_builder.CreateFCmpUNO(right, right)};
     auto is_left_less_than_right{ir_builder.CreateFCmpOLT(left, right)};
@@ -1577,6 +1646,11 @@ struct runtime_direct_callee_resolution_t
     get_llvm_lazy_raw_target_table_symbol_name(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module) noexcept
 { return ::uwvm2::utils::container::u8concat_uwvm(get_llvm_runtime_module_symbol_prefix(runtime_module), u8"_lazy_raw_targets"); }
 
+[[nodiscard]] inline constexpr ::uwvm2::utils::container::u8string
+    get_llvm_function_profile_symbol_name(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
+                                          ::std::size_t func_index_uz) noexcept
+{ return ::uwvm2::utils::container::u8concat_uwvm(get_llvm_runtime_module_symbol_prefix(runtime_module), u8"_profile_f", func_index_uz); }
+
 [[nodiscard]] inline constexpr ::uwvm2::utils::container::u8string
     get_llvm_lazy_typed_entry_target_table_symbol_name(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module) noexcept
 { return ::uwvm2::utils::container::u8concat_uwvm(get_llvm_runtime_module_symbol_prefix(runtime_module), u8"_lazy_typed_entry_targets"); }
@@ -2308,7 +2382,7 @@ struct runtime_global_access_info_t
     return result;
 }
 
-// Build an LLVM external-symbol pointer to the concrete scalar field inside a directly addressable global storage record.
+// Build an LLVM external-symbol pointer to the concrete scalar or v128 field inside a directly addressable global storage record.
 [[nodiscard]] inline constexpr ::llvm::Value* get_llvm_global_storage_pointer(::llvm::LLVMContext& llvm_context,
                                                                               ::llvm::IRBuilder<>& ir_builder,
                                                                               ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
@@ -2346,6 +2420,12 @@ struct runtime_global_access_info_t
             storage_address = reinterpret_cast<::std::uintptr_t>(::std::addressof(global_storage_ptr->storage.f64));
             break;
         }
+        case runtime_operand_stack_v128_type:
+        {
+            // `wasm_v128` is a 16-byte vector type, so the member keeps the natural alignment LLVM assumes for `<2 x i64>`.
+            storage_address = reinterpret_cast<::std::uintptr_t>(::std::addressof(global_storage_ptr->storage.v128));
+            break;
+        }
         [[unlikely]] default:
         {
             return nullptr;
@@ -3693,6 +3773,7 @@ inline constexpr runtime_operand_stack_value_type llvm_jit_i32_block_result_arr[
 inline constexpr runtime_operand_stack_value_type llvm_jit_i64_block_result_arr[]{runtime_operand_stack_value_type::i64};
 inline constexpr runtime_operand_stack_value_type llvm_jit_f32_block_result_arr[]{runtime_operand_stack_value_type::f32};
 inline constexpr runtime_operand_stack_value_type llvm_jit_f64_block_result_arr[]{runtime_operand_stack_value_type::f64};
+inline constexpr runtime_operand_stack_value_type llvm_jit_v128_block_result_arr[]{runtime_operand_stack_v128_type};
 
 // Kind of structured Wasm control context currently active in the lowering stack.
 enum class llvm_jit_control_context_type : unsigned
@@ -3773,7 +3854,7 @@ struct llvm_jit_branch_target_t
 { return get_runtime_block_result_count(result) == 1uz ? result.begin[0] : runtime_operand_stack_value_type{}; }
 
 // Parse the WebAssembly 1.0/MVP blocktype encoding used by block/loop/if.  This fast path supports only empty and
-// single-value block results; multi-value/type-index blocktypes must extend this parser, control-stack result storage, and
+// single-value block results (an MVP scalar or `v128`); multi-value/type-index blocktypes must extend this parser, control-stack result storage, and
 // LLVM PHI/result lowering together.
 [[nodiscard]] inline constexpr bool
     parse_wasm_block_result_type(::std::byte const*& code_curr, ::std::byte const* code_end, runtime_block_result_type& block_result) noexcept
@@ -3814,6 +3895,12 @@ struct llvm_jit_branch_target_t
             block_result.end = llvm_jit_f64_block_result_arr + 1u;
             return true;
         }
+        case static_cast<::std::uint_least8_t>(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(runtime_operand_stack_v128_type)):
+        {
+            block_result.begin = llvm_jit_v128_block_result_arr;
+            block_result.end = llvm_jit_v128_block_result_arr + 1u;
+            return true;
+        }
         [[unlikely]] default:
         {
             return false;
@@ -3830,6 +3917,369 @@ struct llvm_jit_branch_target_t
     return parse_wasm_leb128_immediate(code_curr, code_end, align) && parse_wasm_leb128_immediate(code_curr, code_end, offset);
 }
 
+// Immediate layout that follows a `simd_prefix` subopcode.
+enum class llvm_jit_simd_immediate_kind : unsigned
+{
+    none,
+    memarg,
+    memarg_lane,
+    lane,
+    bytes16
+};
+
+// Static shape of one SIMD instruction, shared by the prescan, the validator, and the unreachable-code skipper.  Operand
+// types are listed bottom-to-top in stack order.  `lane_count` bounds lane immediates (32 for `i8x16.shuffle`, which
+// indexes both inputs), and memory forms also carry their access width and maximum memarg alignment exponent.
+struct llvm_jit_simd_instruction_signature_t
+{
+    runtime_operand_stack_value_type operand_types[3u]{};
+    ::std::size_t operand_count{};
+    runtime_operand_stack_value_type result_type{};
+    bool has_result{};
+    llvm_jit_simd_immediate_kind immediate_kind{};
+    ::std::uint_least8_t lane_count{};
+    ::std::uint_least8_t access_bytes{};
+    validation_module_traits_t::wasm_u32 max_align{};
+    bool valid{};
+};
+
+// Look up the signature of a SIMD subopcode.  Unassigned subopcodes (including relaxed SIMD, which this translator does not
+// accept) return a signature whose `valid` flag is false.
+[[nodiscard]] inline constexpr llvm_jit_simd_instruction_signature_t
+    get_llvm_jit_simd_instruction_signature(validation_module_traits_t::wasm_u32 subopcode) noexcept
+{
+    using wasm1p1_simd_code = ::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_simd;
+    using enum llvm_jit_simd_immediate_kind;
+
+    constexpr auto i32{runtime_operand_stack_value_type::i32};
+    constexpr auto i64{runtime_operand_stack_value_type::i64};
+    constexpr auto f32{runtime_operand_stack_value_type::f32};
+    constexpr auto f64{runtime_operand_stack_value_type::f64};
+    constexpr auto v128{runtime_operand_stack_v128_type};
+
+    auto const unary{[](runtime_operand_stack_value_type operand, runtime_operand_stack_value_type result) constexpr noexcept
+                     {
+                         return llvm_jit_simd_instruction_signature_t{
+                             .operand_types = {operand}, .operand_count = 1uz, .result_type = result, .has_result = true, .valid = true};
+                     }};
+    auto const binary{[](runtime_operand_stack_value_type lhs, runtime_operand_stack_value_type rhs) constexpr noexcept
+                      {
+                          return llvm_jit_simd_instruction_signature_t{
+                              .operand_types = {lhs, rhs}, .operand_count = 2uz, .result_type = v128, .has_result = true, .valid = true};
+                      }};
+    auto const lane_op{[](llvm_jit_simd_instruction_signature_t signature, ::std::uint_least8_t lane_count) constexpr noexcept
+                       {
+                           signature.immediate_kind = lane;
+                           signature.lane_count = lane_count;
+                           return signature;
+                       }};
+    auto const load{[](::std::uint_least8_t access_bytes, validation_module_traits_t::wasm_u32 max_align) constexpr noexcept
+                    {
+                        return llvm_jit_simd_instruction_signature_t{.operand_types = {i32},
+                                                                     .operand_count = 1uz,
+                                                                     .result_type = v128,
+                                                                     .has_result = true,
+                                                                     .immediate_kind = memarg,
+                                                                     .access_bytes = access_bytes,
+                                                                     .max_align = max_align,
+                                                                     .valid = true};
+                    }};
+    auto const lane_memory{[](bool is_load, ::std::uint_least8_t access_bytes, validation_module_traits_t::wasm_u32 max_align) constexpr noexcept
+                           {
+                               return llvm_jit_simd_instruction_signature_t{.operand_types = {i32, v128},
+                                                                            .operand_count = 2uz,
+                                                                            .result_type = v128,
+                                                                            .has_result = is_load,
+                                                                            .immediate_kind = memarg_lane,
+                                                                            .lane_count = static_cast<::std::uint_least8_t>(16u / access_bytes),
+                                                                            .access_bytes = access_bytes,
+                                                                            .max_align = max_align,
+                                                                            .valid = true};
+                           }};
+
+    switch(static_cast<wasm1p1_simd_code>(subopcode))
+    {
+        case wasm1p1_simd_code::v128_load: return load(16u, 4u);
+        case wasm1p1_simd_code::v128_load8x8_s:
+        case wasm1p1_simd_code::v128_load8x8_u:
+        case wasm1p1_simd_code::v128_load16x4_s:
+        case wasm1p1_simd_code::v128_load16x4_u:
+        case wasm1p1_simd_code::v128_load32x2_s:
+        case wasm1p1_simd_code::v128_load32x2_u:
+        case wasm1p1_simd_code::v128_load64_splat:
+        case wasm1p1_simd_code::v128_load64_zero: return load(8u, 3u);
+        case wasm1p1_simd_code::v128_load8_splat: return load(1u, 0u);
+        case wasm1p1_simd_code::v128_load16_splat: return load(2u, 1u);
+        case wasm1p1_simd_code::v128_load32_splat:
+        case wasm1p1_simd_code::v128_load32_zero: return load(4u, 2u);
+        case wasm1p1_simd_code::v128_store:
+        {
+            return {.operand_types = {i32, v128}, .operand_count = 2uz, .immediate_kind = memarg, .access_bytes = 16u, .max_align = 4u, .valid = true};
+        }
+        case wasm1p1_simd_code::v128_load8_lane: return lane_memory(true, 1u, 0u);
+        case wasm1p1_simd_code::v128_load16_lane: return lane_memory(true, 2u, 1u);
+        case wasm1p1_simd_code::v128_load32_lane: return lane_memory(true, 4u, 2u);
+        case wasm1p1_simd_code::v128_load64_lane: return lane_memory(true, 8u, 3u);
+        case wasm1p1_simd_code::v128_store8_lane: return lane_memory(false, 1u, 0u);
+        case wasm1p1_simd_code::v128_store16_lane: return lane_memory(false, 2u, 1u);
+        case wasm1p1_simd_code::v128_store32_lane: return lane_memory(false, 4u, 2u);
+        case wasm1p1_simd_code::v128_store64_lane: return lane_memory(false, 8u, 3u);
+        case wasm1p1_simd_code::v128_const:
+        {
+            return {.result_type = v128, .has_result = true, .immediate_kind = bytes16, .valid = true};
+        }
+        case wasm1p1_simd_code::i8x16_shuffle:
+        {
+            auto signature{binary(v128, v128)};
+            signature.immediate_kind = bytes16;
+            signature.lane_count = 32u;
+            return signature;
+        }
+        case wasm1p1_simd_code::i8x16_splat:
+        case wasm1p1_simd_code::i16x8_splat:
+        case wasm1p1_simd_code::i32x4_splat: return unary(i32, v128);
+        case wasm1p1_simd_code::i64x2_splat: return unary(i64, v128);
+        case wasm1p1_simd_code::f32x4_splat: return unary(f32, v128);
+        case wasm1p1_simd_code::f64x2_splat: return unary(f64, v128);
+        case wasm1p1_simd_code::i8x16_extract_lane_s:
+        case wasm1p1_simd_code::i8x16_extract_lane_u: return lane_op(unary(v128, i32), 16u);
+        case wasm1p1_simd_code::i16x8_extract_lane_s:
+        case wasm1p1_simd_code::i16x8_extract_lane_u: return lane_op(unary(v128, i32), 8u);
+        case wasm1p1_simd_code::i32x4_extract_lane: return lane_op(unary(v128, i32), 4u);
+        case wasm1p1_simd_code::i64x2_extract_lane: return lane_op(unary(v128, i64), 2u);
+        case wasm1p1_simd_code::f32x4_extract_lane: return lane_op(unary(v128, f32), 4u);
+        case wasm1p1_simd_code::f64x2_extract_lane: return lane_op(unary(v128, f64), 2u);
+        case wasm1p1_simd_code::i8x16_replace_lane: return lane_op(binary(v128, i32), 16u);
+        case wasm1p1_simd_code::i16x8_replace_lane: return lane_op(binary(v128, i32), 8u);
+        case wasm1p1_simd_code::i32x4_replace_lane: return lane_op(binary(v128, i32), 4u);
+        case wasm1p1_simd_code::i64x2_replace_lane: return lane_op(binary(v128, i64), 2u);
+        case wasm1p1_simd_code::f32x4_replace_lane: return lane_op(binary(v128, f32), 4u);
+        case wasm1p1_simd_code::f64x2_replace_lane: return lane_op(binary(v128, f64), 2u);
+        case wasm1p1_simd_code::v128_bitselect:
+        {
+            return {.operand_types = {v128, v128, v128}, .operand_count = 3uz, .result_type = v128, .has_result = true, .valid = true};
+        }
+        case wasm1p1_simd_code::v128_any_true:
+        case wasm1p1_simd_code::i8x16_all_true:
+        case wasm1p1_simd_code::i8x16_bitmask:
+        case wasm1p1_simd_code::i16x8_all_true:
+        case wasm1p1_simd_code::i16x8_bitmask:
+        case wasm1p1_simd_code::i32x4_all_true:
+        case wasm1p1_simd_code::i32x4_bitmask:
+        case wasm1p1_simd_code::i64x2_all_true:
+        case wasm1p1_simd_code::i64x2_bitmask: return unary(v128, i32);
+        case wasm1p1_simd_code::i8x16_shl:
+        case wasm1p1_simd_code::i8x16_shr_s:
+        case wasm1p1_simd_code::i8x16_shr_u:
+        case wasm1p1_simd_code::i16x8_shl:
+        case wasm1p1_simd_code::i16x8_shr_s:
+        case wasm1p1_simd_code::i16x8_shr_u:
+        case wasm1p1_simd_code::i32x4_shl:
+        case wasm1p1_simd_code::i32x4_shr_s:
+        case wasm1p1_simd_code::i32x4_shr_u:
+        case wasm1p1_simd_code::i64x2_shl:
+        case wasm1p1_simd_code::i64x2_shr_s:
+        case wasm1p1_simd_code::i64x2_shr_u: return binary(v128, i32);
+        case wasm1p1_simd_code::v128_not:
+        case wasm1p1_simd_code::f32x4_demote_f64x2_zero:
+        case wasm1p1_simd_code::f64x2_promote_low_f32x4:
+        case wasm1p1_simd_code::i8x16_abs:
+        case wasm1p1_simd_code::i8x16_neg:
+        case wasm1p1_simd_code::i8x16_popcnt:
+        case wasm1p1_simd_code::f32x4_ceil:
+        case wasm1p1_simd_code::f32x4_floor:
+        case wasm1p1_simd_code::f32x4_trunc:
+        case wasm1p1_simd_code::f32x4_nearest:
+        case wasm1p1_simd_code::f64x2_ceil:
+        case wasm1p1_simd_code::f64x2_floor:
+        case wasm1p1_simd_code::f64x2_trunc:
+        case wasm1p1_simd_code::f64x2_nearest:
+        case wasm1p1_simd_code::i16x8_extadd_pairwise_i8x16_s:
+        case wasm1p1_simd_code::i16x8_extadd_pairwise_i8x16_u:
+        case wasm1p1_simd_code::i32x4_extadd_pairwise_i16x8_s:
+        case wasm1p1_simd_code::i32x4_extadd_pairwise_i16x8_u:
+        case wasm1p1_simd_code::i16x8_abs:
+        case wasm1p1_simd_code::i16x8_neg:
+        case wasm1p1_simd_code::i16x8_extend_low_i8x16_s:
+        case wasm1p1_simd_code::i16x8_extend_high_i8x16_s:
+        case wasm1p1_simd_code::i16x8_extend_low_i8x16_u:
+        case wasm1p1_simd_code::i16x8_extend_high_i8x16_u:
+        case wasm1p1_simd_code::i32x4_abs:
+        case wasm1p1_simd_code::i32x4_neg:
+        case wasm1p1_simd_code::i32x4_extend_low_i16x8_s:
+        case wasm1p1_simd_code::i32x4_extend_high_i16x8_s:
+        case wasm1p1_simd_code::i32x4_extend_low_i16x8_u:
+        case wasm1p1_simd_code::i32x4_extend_high_i16x8_u:
+        case wasm1p1_simd_code::i64x2_abs:
+        case wasm1p1_simd_code::i64x2_neg:
+        case wasm1p1_simd_code::i64x2_extend_low_i32x4_s:
+        case wasm1p1_simd_code::i64x2_extend_high_i32x4_s:
+        case wasm1p1_simd_code::i64x2_extend_low_i32x4_u:
+        case wasm1p1_simd_code::i64x2_extend_high_i32x4_u:
+        case wasm1p1_simd_code::f32x4_abs:
+        case wasm1p1_simd_code::f32x4_neg:
+        case wasm1p1_simd_code::f32x4_sqrt:
+        case wasm1p1_simd_code::f64x2_abs:
+        case wasm1p1_simd_code::f64x2_neg:
+        case wasm1p1_simd_code::f64x2_sqrt:
+        case wasm1p1_simd_code::i32x4_trunc_sat_f32x4_s:
+        case wasm1p1_simd_code::i32x4_trunc_sat_f32x4_u:
+        case wasm1p1_simd_code::f32x4_convert_i32x4_s:
+        case wasm1p1_simd_code::f32x4_convert_i32x4_u:
+        case wasm1p1_simd_code::i32x4_trunc_sat_f64x2_s_zero:
+        case wasm1p1_simd_code::i32x4_trunc_sat_f64x2_u_zero:
+        case wasm1p1_simd_code::f64x2_convert_low_i32x4_s:
+        case wasm1p1_simd_code::f64x2_convert_low_i32x4_u: return unary(v128, v128);
+        case wasm1p1_simd_code::i8x16_swizzle:
+        case wasm1p1_simd_code::i8x16_eq:
+        case wasm1p1_simd_code::i8x16_ne:
+        case wasm1p1_simd_code::i8x16_lt_s:
+        case wasm1p1_simd_code::i8x16_lt_u:
+        case wasm1p1_simd_code::i8x16_gt_s:
+        case wasm1p1_simd_code::i8x16_gt_u:
+        case wasm1p1_simd_code::i8x16_le_s:
+        case wasm1p1_simd_code::i8x16_le_u:
+        case wasm1p1_simd_code::i8x16_ge_s:
+        case wasm1p1_simd_code::i8x16_ge_u:
+        case wasm1p1_simd_code::i16x8_eq:
+        case wasm1p1_simd_code::i16x8_ne:
+        case wasm1p1_simd_code::i16x8_lt_s:
+        case wasm1p1_simd_code::i16x8_lt_u:
+        case wasm1p1_simd_code::i16x8_gt_s:
+        case wasm1p1_simd_code::i16x8_gt_u:
+        case wasm1p1_simd_code::i16x8_le_s:
+        case wasm1p1_simd_code::i16x8_le_u:
+        case wasm1p1_simd_code::i16x8_ge_s:
+        case wasm1p1_simd_code::i16x8_ge_u:
+        case wasm1p1_simd_code::i32x4_eq:
+        case wasm1p1_simd_code::i32x4_ne:
+        case wasm1p1_simd_code::i32x4_lt_s:
+        case wasm1p1_simd_code::i32x4_lt_u:
+        case wasm1p1_simd_code::i32x4_gt_s:
+        case wasm1p1_simd_code::i32x4_gt_u:
+        case wasm1p1_simd_code::i32x4_le_s:
+        case wasm1p1_simd_code::i32x4_le_u:
+        case wasm1p1_simd_code::i32x4_ge_s:
+        case wasm1p1_simd_code::i32x4_ge_u:
+        case wasm1p1_simd_code::f32x4_eq:
+        case wasm1p1_simd_code::f32x4_ne:
+        case wasm1p1_simd_code::f32x4_lt:
+        case wasm1p1_simd_code::f32x4_gt:
+        case wasm1p1_simd_code::f32x4_le:
+        case wasm1p1_simd_code::f32x4_ge:
+        case wasm1p1_simd_code::f64x2_eq:
+        case wasm1p1_simd_code::f64x2_ne:
+        case wasm1p1_simd_code::f64x2_lt:
+        case wasm1p1_simd_code::f64x2_gt:
+        case wasm1p1_simd_code::f64x2_le:
+        case wasm1p1_simd_code::f64x2_ge:
+        case wasm1p1_simd_code::v128_and:
+        case wasm1p1_simd_code::v128_andnot:
+        case wasm1p1_simd_code::v128_or:
+        case wasm1p1_simd_code::v128_xor:
+        case wasm1p1_simd_code::i8x16_narrow_i16x8_s:
+        case wasm1p1_simd_code::i8x16_narrow_i16x8_u:
+        case wasm1p1_simd_code::i8x16_add:
+        case wasm1p1_simd_code::i8x16_add_sat_s:
+        case wasm1p1_simd_code::i8x16_add_sat_u:
+        case wasm1p1_simd_code::i8x16_sub:
+        case wasm1p1_simd_code::i8x16_sub_sat_s:
+        case wasm1p1_simd_code::i8x16_sub_sat_u:
+        case wasm1p1_simd_code::i8x16_min_s:
+        case wasm1p1_simd_code::i8x16_min_u:
+        case wasm1p1_simd_code::i8x16_max_s:
+        case wasm1p1_simd_code::i8x16_max_u:
+        case wasm1p1_simd_code::i8x16_avgr_u:
+        case wasm1p1_simd_code::i16x8_q15mulr_sat_s:
+        case wasm1p1_simd_code::i16x8_narrow_i32x4_s:
+        case wasm1p1_simd_code::i16x8_narrow_i32x4_u:
+        case wasm1p1_simd_code::i16x8_add:
+        case wasm1p1_simd_code::i16x8_add_sat_s:
+        case wasm1p1_simd_code::i16x8_add_sat_u:
+        case wasm1p1_simd_code::i16x8_sub:
+        case wasm1p1_simd_code::i16x8_sub_sat_s:
+        case wasm1p1_simd_code::i16x8_sub_sat_u:
+        case wasm1p1_simd_code::i16x8_mul:
+        case wasm1p1_simd_code::i16x8_min_s:
+        case wasm1p1_simd_code::i16x8_min_u:
+        case wasm1p1_simd_code::i16x8_max_s:
+        case wasm1p1_simd_code::i16x8_max_u:
+        case wasm1p1_simd_code::i16x8_avgr_u:
+        case wasm1p1_simd_code::i16x8_extmul_low_i8x16_s:
+        case wasm1p1_simd_code::i16x8_extmul_high_i8x16_s:
+        case wasm1p1_simd_code::i16x8_extmul_low_i8x16_u:
+        case wasm1p1_simd_code::i16x8_extmul_high_i8x16_u:
+        case wasm1p1_simd_code::i32x4_add:
+        case wasm1p1_simd_code::i32x4_sub:
+        case wasm1p1_simd_code::i32x4_mul:
+        case wasm1p1_simd_code::i32x4_min_s:
+        case wasm1p1_simd_code::i32x4_min_u:
+        case wasm1p1_simd_code::i32x4_max_s:
+        case wasm1p1_simd_code::i32x4_max_u:
+        case wasm1p1_simd_code::i32x4_dot_i16x8_s:
+        case wasm1p1_simd_code::i32x4_extmul_low_i16x8_s:
+        case wasm1p1_simd_code::i32x4_extmul_high_i16x8_s:
+        case wasm1p1_simd_code::i32x4_extmul_low_i16x8_u:
+        case wasm1p1_simd_code::i32x4_extmul_high_i16x8_u:
+        case wasm1p1_simd_code::i64x2_add:
+        case wasm1p1_simd_code::i64x2_sub:
+        case wasm1p1_simd_code::i64x2_mul:
+        case wasm1p1_simd_code::i64x2_eq:
+        case wasm1p1_simd_code::i64x2_ne:
+        case wasm1p1_simd_code::i64x2_lt_s:
+        case wasm1p1_simd_code::i64x2_gt_s:
+        case wasm1p1_simd_code::i64x2_le_s:
+        case wasm1p1_simd_code::i64x2_ge_s:
+        case wasm1p1_simd_code::i64x2_extmul_low_i32x4_s:
+        case wasm1p1_simd_code::i64x2_extmul_high_i32x4_s:
+        case wasm1p1_simd_code::i64x2_extmul_low_i32x4_u:
+        case wasm1p1_simd_code::i64x2_extmul_high_i32x4_u:
+        case wasm1p1_simd_code::f32x4_add:
+        case wasm1p1_simd_code::f32x4_sub:
+        case wasm1p1_simd_code::f32x4_mul:
+        case wasm1p1_simd_code::f32x4_div:
+        case wasm1p1_simd_code::f32x4_min:
+        case wasm1p1_simd_code::f32x4_max:
+        case wasm1p1_simd_code::f32x4_pmin:
+        case wasm1p1_simd_code::f32x4_pmax:
+        case wasm1p1_simd_code::f64x2_add:
+        case wasm1p1_simd_code::f64x2_sub:
+        case wasm1p1_simd_code::f64x2_mul:
+        case wasm1p1_simd_code::f64x2_div:
+        case wasm1p1_simd_code::f64x2_min:
+        case wasm1p1_simd_code::f64x2_max:
+        case wasm1p1_simd_code::f64x2_pmin:
+        case wasm1p1_simd_code::f64x2_pmax: return binary(v128, v128);
+        [[unlikely]] default: return {};
+    }
+}
+
+// Skip the subopcode and immediates of one `simd_prefix` instruction.  The cursor must point just past the prefix byte.
+[[nodiscard]] inline constexpr bool skip_wasm_simd_instruction_immediates(::std::byte const*& code_curr, ::std::byte const* code_end) noexcept
+{
+    validation_module_traits_t::wasm_u32 subopcode{};
+    if(!parse_wasm_leb128_immediate(code_curr, code_end, subopcode)) [[unlikely]] { return false; }
+
+    auto const signature{get_llvm_jit_simd_instruction_signature(subopcode)};
+    if(!signature.valid) [[unlikely]] { return false; }
+
+    auto const skip_raw_bytes{[&](::std::size_t byte_count) constexpr noexcept -> bool
+                              {
+                                  if(static_cast<::std::size_t>(code_end - code_curr) < byte_count) [[unlikely]] { return false; }
+                                  code_curr += byte_count;
+                                  return true;
+                              }};
+
+    switch(signature.immediate_kind)
+    {
+        case llvm_jit_simd_immediate_kind::memarg: return skip_wasm_memarg(code_curr, code_end);
+        case llvm_jit_simd_immediate_kind::memarg_lane: return skip_wasm_memarg(code_curr, code_end) && skip_raw_bytes(1uz);
+        case llvm_jit_simd_immediate_kind::lane: return skip_raw_bytes(1uz);
+        case llvm_jit_simd_immediate_kind::bytes16: return skip_raw_bytes(16uz);
+        default: return true;
+    }
+}
+
 // Advance over a non-control instruction while the current structured context is unreachable.  This avoids emitting IR for
 // dead code while still honoring nested block/else/end boundaries in the dispatcher.
 [[nodiscard]] inline constexpr bool skip_wasm_unreachable_noncontrol_instruction(::std::byte const*& code_curr, ::std::byte const* code_end) noexcept
@@ -3933,6 +4383,11 @@ struct llvm_jit_branch_target_t
             ++code_curr;
             return parse_wasm_reserved_zero_byte(code_curr, code_end);
         }
+        case static_cast<wasm1_code>(::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_basic::simd_prefix):
+        {
+            ++code_curr;
+            return skip_wasm_simd_instruction_immediates(code_curr, code_end);
+        }
         [[unlikely]] default:
         {
             ++code_curr;
@@ -3974,6 +4429,16 @@ struct runtime_local_func_llvm_jit_emit_state_t
     // Enables DWARF/unwind metadata so optimized native frames can be mapped back to Wasm frames.
     bool emit_unwind_call_stack_frames{};
 
+    // Execution profile slot for this function and whether emission records into it or reads from it.
+    llvm_jit_function_profile_t* function_profile{};
+    llvm_jit_profile_mode_t profile_mode{};
+
+    // `--runtime-fuel` counter charged at function entry and on every loop iteration; null disables metering.
+    ::std::uint_least64_t* fuel_counter{};
+
+    // `--wasm-timeout` interruption flag checked at the same sites as the fuel charge; null disables the check.
+    ::std::atomic_uint_least32_t const* epoch_interrupt{};
+
     // Runtime local-function storage being compiled.
     local_func_storage_t const* local_func_storage_ptr{};
 
@@ -4039,13 +4504,410 @@ struct runtime_local_func_llvm_jit_emit_state_t
     ::std::size_t unreachable_control_depth{};
 };
 
-// Allocate LLVM context/module storage for a runtime module and optionally initialize compact DWARF metadata.
-[[nodiscard]] inline constexpr bool try_prepare_runtime_llvm_jit_module_storage(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
-                                                                                llvm_jit_module_storage_t& module_storage,
-                                                                                bool emit_unwind_call_stack_frames = false) noexcept
+// Size the counter storage of a function about to be emitted with profiling.  Collection sizes it once and never again,
+// because generated tier-1 code embeds the counter address; application only accepts a layout matching this body.
+[[nodiscard]] inline constexpr bool try_prepare_runtime_local_func_llvm_jit_profile(local_func_storage_t const& local_func_storage,
+                                                                                   llvm_jit_function_profile_t& function_profile,
+                                                                                   llvm_jit_profile_mode_t profile_mode) noexcept
+{
+    auto const code_begin{local_func_storage.code_begin};
+    auto const code_end{local_func_storage.code_end};
+    if(code_begin == nullptr || code_end == nullptr || code_begin > code_end) [[unlikely]] { return false; }
+
+    auto const slot_count{static_cast<::std::size_t>(code_end - code_begin) + 1uz};
+    if(function_profile.counters.size() == slot_count) { return true; }
+    if(profile_mode != llvm_jit_profile_mode_t::collect || !function_profile.counters.empty()) { return false; }
+
+    function_profile.counters.resize(slot_count);
+    return function_profile.counters.size() == slot_count;
+}
+
+// Address of counter slot `slot_index` (an intptr-typed value) for the function being emitted in collection mode.
+[[nodiscard]] inline constexpr ::llvm::Value* get_runtime_local_func_llvm_jit_profile_counter_pointer(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                                      ::llvm::Value* slot_index) noexcept
+{
+    if(state.profile_mode != llvm_jit_profile_mode_t::collect || state.function_profile == nullptr || state.function_profile->counters.empty() ||
+       state.ir_builder == nullptr || state.local_func_storage_ptr == nullptr || state.local_func_storage_ptr->runtime_module_ptr == nullptr ||
+       slot_index == nullptr) [[unlikely]]
+    {
+        return nullptr;
+    }
+
+    auto& ir_builder{*state.ir_builder};
+    auto llvm_counter_type{::llvm::Type::getIntNTy(ir_builder.getContext(), static_cast<unsigned>(sizeof(::std::size_t) * 8u))};
+    auto const& local_func_storage{*state.local_func_storage_ptr};
+    auto const symbol_name{get_llvm_function_profile_symbol_name(*local_func_storage.runtime_module_ptr, local_func_storage.function_index)};
+    auto counter_base{get_llvm_external_host_object_pointer(ir_builder,
+                                                            reinterpret_cast<::std::uintptr_t>(state.function_profile->counters.data()),
+                                                            llvm_counter_type,
+                                                            ::uwvm2::utils::container::u8string_view{symbol_name.data(), symbol_name.size()})};
+    if(counter_base == nullptr) [[unlikely]] { return nullptr; }
+    // The external declaration is a single counter; the real object is the whole slot array, so this GEP is not inbounds.
+    return ir_builder.CreateGEP(llvm_counter_type, counter_base, slot_index, get_llvm_string_ref(u8"profile.slot"));
+}
+
+// Bump one profile counter.  Relaxed load/add/store instead of an atomic RMW: a lost increment under contention only
+// perturbs a ratio, while a locked add on every branch would dominate tier-1 hot loops.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_profile_increment(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                      ::llvm::Value* slot_index) noexcept
+{
+    auto counter_pointer{get_runtime_local_func_llvm_jit_profile_counter_pointer(state, slot_index)};
+    if(counter_pointer == nullptr) [[unlikely]] { return false; }
+
+    auto& ir_builder{*state.ir_builder};
+    auto llvm_counter_type{::llvm::Type::getIntNTy(ir_builder.getContext(), static_cast<unsigned>(sizeof(::std::size_t) * 8u))};
+    auto const counter_align{::llvm::Align{alignof(::std::size_t)}};
+
+    auto count{ir_builder.CreateAlignedLoad(llvm_counter_type, counter_pointer, counter_align, get_llvm_string_ref(u8"profile.count"))};
+    count->setAtomic(::llvm::AtomicOrdering::Monotonic);
+    auto next_count{ir_builder.CreateAdd(count, ::llvm::ConstantInt::get(llvm_counter_type, 1u), get_llvm_string_ref(u8"profile.count.next"))};
+    auto store{ir_builder.CreateAlignedStore(next_count, counter_pointer, counter_align)};
+    store->setAtomic(::llvm::AtomicOrdering::Monotonic);
+    return true;
+}
+
+[[nodiscard]] inline constexpr ::llvm::Value* get_runtime_local_func_llvm_jit_profile_slot_constant(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                                    ::std::size_t slot) noexcept
+{
+    auto llvm_counter_type{::llvm::Type::getIntNTy(state.ir_builder->getContext(), static_cast<unsigned>(sizeof(::std::size_t) * 8u))};
+    return ::llvm::ConstantInt::get(llvm_counter_type, static_cast<::std::uint_least64_t>(slot));
+}
+
+// Count a normal function entry in the last slot (collection), or publish the recorded entry count (application).  Called
+// from the normal-init block, so tiered OSR reentries that jump straight into a loop body are not counted as calls.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_profile_entry(runtime_local_func_llvm_jit_emit_state_t& state) noexcept
+{
+    if(state.function_profile == nullptr || state.function_profile->counters.empty()) { return true; }
+    auto const entry_slot{state.function_profile->counters.size() - 1uz};
+
+    if(state.profile_mode == llvm_jit_profile_mode_t::collect)
+    {
+        return emit_runtime_local_func_llvm_jit_profile_increment(state, get_runtime_local_func_llvm_jit_profile_slot_constant(state, entry_slot));
+    }
+
+    if(state.profile_mode == llvm_jit_profile_mode_t::apply && state.llvm_public_entry_function != nullptr)
+    {
+        auto const entry_count{state.function_profile->counters.index_unchecked(entry_slot)};
+        if(entry_count != 0uz)
+        {
+            state.llvm_public_entry_function->setEntryCount(
+                ::llvm::Function::ProfileCount(static_cast<::std::uint_least64_t>(entry_count), ::llvm::Function::PCT_Real));
+        }
+    }
+    return true;
+}
+
+// Charge one unit of `--runtime-fuel`: trap when the counter is already empty, otherwise decrement it.  The counter is a
+// plain load/store because only the thread running guest code touches it, and the u2 interpreter charges the same sites.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_fuel_charge(runtime_local_func_llvm_jit_emit_state_t& state) noexcept
+{
+    if(state.fuel_counter == nullptr) { return true; }
+    if(state.llvm_module == nullptr || state.ir_builder == nullptr) [[unlikely]] { return false; }
+
+    auto& ir_builder{*state.ir_builder};
+    auto llvm_fuel_type{::llvm::Type::getInt64Ty(ir_builder.getContext())};
+    auto const fuel_align{::llvm::Align{alignof(::std::uint_least64_t)}};
+    auto fuel_pointer{get_llvm_external_host_object_pointer(ir_builder,
+                                                            reinterpret_cast<::std::uintptr_t>(state.fuel_counter),
+                                                            llvm_fuel_type,
+                                                            ::uwvm2::utils::container::u8string_view{u8"uwvm_runtime_fuel_remaining"})};
+    if(fuel_pointer == nullptr) [[unlikely]] { return false; }
+
+    auto remaining{ir_builder.CreateAlignedLoad(llvm_fuel_type, fuel_pointer, fuel_align, get_llvm_string_ref(u8"fuel.remaining"))};
+    auto exhausted{ir_builder.CreateICmpEQ(remaining, ::llvm::ConstantInt::get(llvm_fuel_type, 0u), get_llvm_string_ref(u8"fuel.exhausted"))};
+    emit_llvm_conditional_trap(*state.llvm_module, ir_builder, exhausted, ::uwvm2::runtime::lib::llvm_jit_trap_kind::fuel_exhausted);
+    auto next_remaining{ir_builder.CreateSub(remaining, ::llvm::ConstantInt::get(llvm_fuel_type, 1u), get_llvm_string_ref(u8"fuel.remaining.next"))};
+    ir_builder.CreateAlignedStore(next_remaining, fuel_pointer, fuel_align);
+    return true;
+}
+
+// Check the `--wasm-timeout` epoch flag and trap once the runtime has raised it.  The deadline comparison happens on the
+// thread that advances the epoch, so guest code pays one monotonic load and a predictable branch per site.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_epoch_check(runtime_local_func_llvm_jit_emit_state_t& state) noexcept
+{
+    if(state.epoch_interrupt == nullptr) { return true; }
+    if(state.llvm_module == nullptr || state.ir_builder == nullptr) [[unlikely]] { return false; }
+
+    auto& ir_builder{*state.ir_builder};
+    auto llvm_flag_type{::llvm::Type::getInt32Ty(ir_builder.getContext())};
+    auto flag_pointer{get_llvm_external_host_object_pointer(ir_builder,
+                                                            reinterpret_cast<::std::uintptr_t>(state.epoch_interrupt),
+                                                            llvm_flag_type,
+                                                            ::uwvm2::utils::container::u8string_view{u8"uwvm_runtime_epoch_interrupt"})};
+    if(flag_pointer == nullptr) [[unlikely]] { return false; }
+
+    auto flag{ir_builder.CreateAlignedLoad(llvm_flag_type,
+                                           flag_pointer,
+                                           ::llvm::Align{alignof(::std::atomic_uint_least32_t)},
+                                           get_llvm_string_ref(u8"epoch.interrupt"))};
+    flag->setAtomic(::llvm::AtomicOrdering::Monotonic);
+    auto reached{ir_builder.CreateICmpNE(flag, ::llvm::ConstantInt::get(llvm_flag_type, 0u), get_llvm_string_ref(u8"epoch.reached"))};
+    emit_llvm_conditional_trap(*state.llvm_module, ir_builder, reached, ::uwvm2::runtime::lib::llvm_jit_trap_kind::epoch_deadline);
+    return true;
+}
+
+// Record one execution of a two-way branch at the current instruction: `[offset]` when `cond_i1` holds (the taken/then
+// edge), otherwise `[offset + 1]`.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_profile_two_way(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                    ::llvm::Value* cond_i1) noexcept
+{
+    if(state.profile_mode != llvm_jit_profile_mode_t::collect || state.function_profile == nullptr) { return true; }
+    auto const offset{state.current_wasm_op_offset};
+    if(offset == SIZE_MAX || offset + 1uz >= state.function_profile->counters.size()) [[unlikely]] { return true; }
+
+    auto slot_index{state.ir_builder->CreateSelect(cond_i1,
+                                                   get_runtime_local_func_llvm_jit_profile_slot_constant(state, offset),
+                                                   get_runtime_local_func_llvm_jit_profile_slot_constant(state, offset + 1uz),
+                                                   get_llvm_string_ref(u8"profile.edge"))};
+    return emit_runtime_local_func_llvm_jit_profile_increment(state, slot_index);
+}
+
+// Record one execution of a `br_table` with `case_count` explicit targets: `[offset + i]` for case `i`, `[offset + N]` for
+// the default.  `condition` is the i32 selector.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_profile_multi_way(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                      ::llvm::Value* condition,
+                                                                                      ::std::size_t case_count) noexcept
+{
+    if(state.profile_mode != llvm_jit_profile_mode_t::collect || state.function_profile == nullptr) { return true; }
+    auto const offset{state.current_wasm_op_offset};
+    if(offset == SIZE_MAX || case_count >= state.function_profile->counters.size() || offset >= state.function_profile->counters.size() - case_count)
+        [[unlikely]]
+    {
+        return true;
+    }
+
+    auto& ir_builder{*state.ir_builder};
+    auto llvm_counter_type{::llvm::Type::getIntNTy(ir_builder.getContext(), static_cast<unsigned>(sizeof(::std::size_t) * 8u))};
+    auto case_count_value{::llvm::ConstantInt::get(condition->getType(), static_cast<::std::uint_least64_t>(case_count))};
+    auto case_index{ir_builder.CreateSelect(ir_builder.CreateICmpULT(condition, case_count_value),
+                                            condition,
+                                            case_count_value,
+                                            get_llvm_string_ref(u8"profile.case"))};
+    auto slot_index{ir_builder.CreateAdd(ir_builder.CreateZExtOrTrunc(case_index, llvm_counter_type),
+                                         get_runtime_local_func_llvm_jit_profile_slot_constant(state, offset),
+                                         get_llvm_string_ref(u8"profile.case.slot"))};
+    return emit_runtime_local_func_llvm_jit_profile_increment(state, slot_index);
+}
+
+// Record the table element selected by a `call_indirect` at the current instruction.  `[offset]` holds the majority
+// candidate (selector + 1, zero when empty), `[offset + 1]` its Boyer-Moore vote, and `[offset + 2]` the call count, so a
+// monomorphic site ends with vote == count.  Lost updates under races only weaken the vote.
+[[nodiscard]] inline constexpr bool emit_runtime_local_func_llvm_jit_profile_call_target(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                                        ::llvm::Value* selector) noexcept
+{
+    if(state.profile_mode != llvm_jit_profile_mode_t::collect || state.function_profile == nullptr) { return true; }
+    auto const offset{state.current_wasm_op_offset};
+    if(offset == SIZE_MAX || offset + 2uz >= state.function_profile->counters.size()) [[unlikely]] { return true; }
+
+    auto candidate_ptr{get_runtime_local_func_llvm_jit_profile_counter_pointer(state, get_runtime_local_func_llvm_jit_profile_slot_constant(state, offset))};
+    auto vote_ptr{get_runtime_local_func_llvm_jit_profile_counter_pointer(state, get_runtime_local_func_llvm_jit_profile_slot_constant(state, offset + 1uz))};
+    if(candidate_ptr == nullptr || vote_ptr == nullptr) [[unlikely]] { return false; }
+
+    auto& ir_builder{*state.ir_builder};
+    auto llvm_counter_type{::llvm::Type::getIntNTy(ir_builder.getContext(), static_cast<unsigned>(sizeof(::std::size_t) * 8u))};
+    auto const counter_align{::llvm::Align{alignof(::std::size_t)}};
+    auto const one{::llvm::ConstantInt::get(llvm_counter_type, 1u)};
+
+    auto observed{ir_builder.CreateAdd(ir_builder.CreateZExtOrTrunc(selector, llvm_counter_type), one, get_llvm_string_ref(u8"profile.target"))};
+    auto candidate{ir_builder.CreateAlignedLoad(llvm_counter_type, candidate_ptr, counter_align, get_llvm_string_ref(u8"profile.candidate"))};
+    auto vote{ir_builder.CreateAlignedLoad(llvm_counter_type, vote_ptr, counter_align, get_llvm_string_ref(u8"profile.vote"))};
+    candidate->setAtomic(::llvm::AtomicOrdering::Monotonic);
+    vote->setAtomic(::llvm::AtomicOrdering::Monotonic);
+
+    auto vacant{ir_builder.CreateICmpEQ(vote, ::llvm::ConstantInt::get(llvm_counter_type, 0u))};
+    auto agrees{ir_builder.CreateOr(vacant, ir_builder.CreateICmpEQ(candidate, observed))};
+    auto next_candidate{ir_builder.CreateSelect(vacant, observed, candidate, get_llvm_string_ref(u8"profile.candidate.next"))};
+    auto next_vote{ir_builder.CreateSelect(agrees,
+                                           ir_builder.CreateAdd(vote, one),
+                                           ir_builder.CreateSub(vote, one),
+                                           get_llvm_string_ref(u8"profile.vote.next"))};
+    ir_builder.CreateAlignedStore(next_candidate, candidate_ptr, counter_align)->setAtomic(::llvm::AtomicOrdering::Monotonic);
+    ir_builder.CreateAlignedStore(next_vote, vote_ptr, counter_align)->setAtomic(::llvm::AtomicOrdering::Monotonic);
+
+    return emit_runtime_local_func_llvm_jit_profile_increment(state, get_runtime_local_func_llvm_jit_profile_slot_constant(state, offset + 2uz));
+}
+
+// Recorded majority target of a `call_indirect` site in application mode.
+struct llvm_jit_profile_call_target_t
+{
+    // False when the site never ran or no table element won at least half of the calls.
+    bool dominant{};
+
+    // Table element index that dominated the site.
+    ::std::size_t selector{};
+
+    // Lower bound on calls that went to `selector`, and all calls at the site.
+    ::std::uint_least64_t hits{};
+    ::std::uint_least64_t total{};
+};
+
+[[nodiscard]] inline constexpr llvm_jit_profile_call_target_t
+    get_runtime_local_func_llvm_jit_profile_call_target(runtime_local_func_llvm_jit_emit_state_t const& state) noexcept
+{
+    if(state.profile_mode != llvm_jit_profile_mode_t::apply || state.function_profile == nullptr) { return {}; }
+    auto const offset{state.current_wasm_op_offset};
+    auto const& counters{state.function_profile->counters};
+    if(offset == SIZE_MAX || offset + 2uz >= counters.size()) [[unlikely]] { return {}; }
+
+    auto const candidate{counters.index_unchecked(offset)};
+    auto const vote{static_cast<::std::uint_least64_t>(counters.index_unchecked(offset + 1uz))};
+    auto const total{static_cast<::std::uint_least64_t>(counters.index_unchecked(offset + 2uz))};
+    // A Boyer-Moore vote of at least half the calls means the candidate took at least three quarters of them.
+    if(candidate == 0uz || total == 0u || vote > total || vote < total - vote) { return {}; }
+    return {.dominant = true, .selector = candidate - 1uz, .hits = vote, .total = total};
+}
+
+// Two-way branch weights for a speculation guard: `hits` on the expected edge, the rest on the fallback.
+inline constexpr void apply_runtime_local_func_llvm_jit_profile_guard_weights(::llvm::Instruction* terminator,
+                                                                              ::std::uint_least64_t hits,
+                                                                              ::std::uint_least64_t total) noexcept
+{
+    if(terminator == nullptr || total == 0u || hits > total) [[unlikely]] { return; }
+    unsigned shift{};
+    while((total >> shift) > static_cast<::std::uint_least64_t>((::std::numeric_limits<::std::uint32_t>::max)())) { ++shift; }
+    terminator->setMetadata(::llvm::LLVMContext::MD_prof,
+                            ::llvm::MDBuilder(terminator->getContext())
+                                .createBranchWeights(static_cast<::std::uint32_t>(hits >> shift), static_cast<::std::uint32_t>((total - hits) >> shift)));
+}
+
+// Attach `!prof` branch weights read from `count` consecutive slots in the given order.  LLVM weights are 32-bit, so large
+// counts are scaled down together to keep their ratios.  A site that never executed gets no metadata.
+inline constexpr void apply_runtime_local_func_llvm_jit_profile_weights(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                        ::llvm::Instruction* terminator,
+                                                                        ::std::size_t const* slots,
+                                                                        ::std::size_t count) noexcept
+{
+    if(state.profile_mode != llvm_jit_profile_mode_t::apply || state.function_profile == nullptr || terminator == nullptr) { return; }
+    auto const& counters{state.function_profile->counters};
+
+    ::std::uint_least64_t max_count{};
+    for(::std::size_t i{}; i != count; ++i)
+    {
+        if(slots[i] >= counters.size()) [[unlikely]] { return; }
+        max_count = ::std::max(max_count, static_cast<::std::uint_least64_t>(counters.index_unchecked(slots[i])));
+    }
+    if(max_count == 0u) { return; }
+
+    unsigned shift{};
+    while((max_count >> shift) > static_cast<::std::uint_least64_t>((::std::numeric_limits<::std::uint32_t>::max)())) { ++shift; }
+
+    ::llvm::SmallVector<::std::uint32_t, 8u> weights{};
+    weights.reserve(count);
+    for(::std::size_t i{}; i != count; ++i)
+    {
+        weights.push_back(static_cast<::std::uint32_t>(static_cast<::std::uint_least64_t>(counters.index_unchecked(slots[i])) >> shift));
+    }
+    terminator->setMetadata(::llvm::LLVMContext::MD_prof, ::llvm::MDBuilder(terminator->getContext()).createBranchWeights(weights));
+}
+
+inline constexpr void apply_runtime_local_func_llvm_jit_profile_two_way(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                        ::llvm::Instruction* terminator) noexcept
+{
+    auto const offset{state.current_wasm_op_offset};
+    if(offset == SIZE_MAX) [[unlikely]] { return; }
+    ::std::size_t const slots[2]{offset, offset + 1uz};
+    apply_runtime_local_func_llvm_jit_profile_weights(state, terminator, slots, 2uz);
+}
+
+// Switch weights list the default destination first, then each case in `addCase` order.
+inline constexpr void apply_runtime_local_func_llvm_jit_profile_multi_way(runtime_local_func_llvm_jit_emit_state_t& state,
+                                                                          ::llvm::Instruction* terminator,
+                                                                          ::std::size_t case_count) noexcept
+{
+    if(state.profile_mode != llvm_jit_profile_mode_t::apply) { return; }
+    auto const offset{state.current_wasm_op_offset};
+    if(offset == SIZE_MAX || case_count == SIZE_MAX) [[unlikely]] { return; }
+
+    ::uwvm2::utils::container::vector<::std::size_t> slots{};
+    slots.reserve(case_count + 1uz);
+    slots.push_back(offset + case_count);
+    for(::std::size_t i{}; i != case_count; ++i) { slots.push_back(offset + i); }
+    apply_runtime_local_func_llvm_jit_profile_weights(state, terminator, slots.data(), slots.size());
+}
+
+// Publish an instrumentation profile summary for a module emitted in application mode.  Profile-guided passes (inline
+// hotness, hot/cold splitting, block placement) consult `ProfileSummaryInfo`, which treats `!prof` data as absent without
+// it.  The detailed summary follows LLVM's default cutoffs, computed here to avoid linking the ProfileData library.  The
+// few `call_indirect` candidate slots hold table indices rather than counts; they are too small to move the hot cutoffs.
+inline constexpr void attach_runtime_llvm_jit_profile_summary(::llvm::Module& llvm_module,
+                                                              llvm_jit_function_profile_t const* function_profiles,
+                                                              ::std::size_t function_profile_count) noexcept
+{
+    if(function_profiles == nullptr || function_profile_count == 0uz) { return; }
+
+    ::uwvm2::utils::container::vector<::std::uint_least64_t> counts{};
+    ::std::uint_least64_t total_count{};
+    ::std::uint_least64_t max_count{};
+    ::std::uint_least64_t max_internal_count{};
+    ::std::uint_least64_t max_function_count{};
+    ::std::uint_least64_t num_counts{};
+    ::std::uint_least32_t num_functions{};
+
+    for(::std::size_t i{}; i != function_profile_count; ++i)
+    {
+        auto const& counters{function_profiles[i].counters};
+        if(counters.empty()) { continue; }
+        ++num_functions;
+        for(::std::size_t slot{}; slot != counters.size(); ++slot)
+        {
+            auto const count{static_cast<::std::uint_least64_t>(counters.index_unchecked(slot))};
+            ++num_counts;
+            if(count == 0u) { continue; }
+            counts.push_back(count);
+            total_count += count;
+            max_count = ::std::max(max_count, count);
+            if(slot + 1uz == counters.size()) { max_function_count = ::std::max(max_function_count, count); }
+            else
+            {
+                max_internal_count = ::std::max(max_internal_count, count);
+            }
+        }
+    }
+    if(counts.empty()) { return; }
+
+    ::std::sort(counts.begin(), counts.end(), [](::std::uint_least64_t a, ::std::uint_least64_t b) constexpr noexcept { return a > b; });
+
+    constexpr ::std::uint_least32_t cutoff_scale{1000000u};
+    constexpr ::std::uint_least32_t cutoffs[]{
+        10000u, 100000u, 200000u, 300000u, 400000u, 500000u, 600000u, 700000u, 800000u, 900000u, 950000u, 990000u, 999000u, 999900u, 999990u, 999999u};
+
+    ::llvm::SummaryEntryVector detailed_summary{};
+    ::std::uint_least64_t accumulated{};
+    ::std::size_t count_index{};
+    for(auto const cutoff: cutoffs)
+    {
+        // `total * cutoff / scale` without overflowing 64 bits.
+        auto const desired{total_count / cutoff_scale * cutoff + total_count % cutoff_scale * cutoff / cutoff_scale};
+        while(accumulated < desired && count_index != counts.size()) { accumulated += counts.index_unchecked(count_index++); }
+        auto const min_count{counts.index_unchecked(count_index == 0uz ? 0uz : count_index - 1uz)};
+        detailed_summary.push_back(::llvm::ProfileSummaryEntry{cutoff, min_count, static_cast<::std::uint_least64_t>(count_index)});
+    }
+
+    ::llvm::ProfileSummary summary{::llvm::ProfileSummary::PSK_Instr,
+                                   detailed_summary,
+                                   total_count,
+                                   max_count,
+                                   max_internal_count,
+                                   max_function_count,
+                                   static_cast<::std::uint32_t>(::std::min(num_counts, static_cast<::std::uint_least64_t>(UINT32_MAX))),
+                                   num_functions};
+    llvm_module.setProfileSummary(summary.getMD(llvm_module.getContext()), ::llvm::ProfileSummary::PSK_Instr);
+}
+
+// Allocate LLVM context/module storage for a runtime module and optionally initialize compact DWARF metadata.  Callers that
+// recycle contexts (the lazy JIT session) pass an idle context whose previous modules have already been destroyed.
+[[nodiscard]] inline constexpr bool
+    try_prepare_runtime_llvm_jit_module_storage(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
+                                                llvm_jit_module_storage_t& module_storage,
+                                                bool emit_unwind_call_stack_frames = false,
+                                                ::uwvm2::utils::container::delete_owned_ptr<::llvm::LLVMContext>&& reused_llvm_context = {}) noexcept
 {
     module_storage = {};
-    module_storage.llvm_context_holder = ::uwvm2::utils::container::make_delete_owned<::llvm::LLVMContext>();
+    module_storage.llvm_context_holder = ::std::move(reused_llvm_context);
+    if(module_storage.llvm_context_holder == nullptr)
+    {
+        module_storage.llvm_context_holder = ::uwvm2::utils::container::make_delete_owned<::llvm::LLVMContext>();
+    }
     if(module_storage.llvm_context_holder == nullptr) [[unlikely]] { return false; }
 
     auto const llvm_module_name{get_llvm_wasm_ir_module_name(runtime_module)};
@@ -4090,7 +4952,11 @@ struct runtime_local_func_llvm_jit_emit_state_t
                                                                                        bool lazy_defined_targets_are_atomic = false,
                                                                                        bool emit_tiered_loop_reentry_entries = false,
                                                                                        bool emit_call_stack_frames = true,
-                                                                                       bool emit_unwind_call_stack_frames = false) noexcept
+                                                                                       bool emit_unwind_call_stack_frames = false,
+                                                                                       llvm_jit_function_profile_t* function_profile = nullptr,
+                                                                                       llvm_jit_profile_mode_t profile_mode = llvm_jit_profile_mode_t::none,
+                                                                                       ::std::uint_least64_t* fuel_counter = nullptr,
+                                                                                       ::std::atomic_uint_least32_t const* epoch_interrupt = nullptr) noexcept
 {
     state = {};
     state.verify_llvm_jit_ir = verify_llvm_jit_ir;
@@ -4103,6 +4969,14 @@ struct runtime_local_func_llvm_jit_emit_state_t
     state.emit_tiered_loop_reentry_entries = emit_tiered_loop_reentry_entries;
     state.emit_call_stack_frames = emit_call_stack_frames;
     state.emit_unwind_call_stack_frames = emit_unwind_call_stack_frames;
+    state.fuel_counter = fuel_counter;
+    state.epoch_interrupt = epoch_interrupt;
+    if(function_profile != nullptr && profile_mode != llvm_jit_profile_mode_t::none &&
+       try_prepare_runtime_local_func_llvm_jit_profile(local_func_storage, *function_profile, profile_mode))
+    {
+        state.function_profile = function_profile;
+        state.profile_mode = profile_mode;
+    }
 
     auto function_type_ptr{local_func_storage.function_type_ptr};
     auto wasm_code_ptr{local_func_storage.wasm_code_ptr};
@@ -4358,6 +5232,9 @@ struct runtime_local_func_llvm_jit_emit_state_t
     state.branch_target_stack.push_back({.params = state.function_result, .block = state.return_block, .phi = state.return_phi, .control_stack_index = 0uz});
     // The implicit function label sits at branch depth equal to the outermost target.  `return` reuses the same branch
     // machinery as `br` by selecting this first branch-target entry.
+    if(!emit_runtime_local_func_llvm_jit_profile_entry(state)) [[unlikely]] { return false; }
+    if(!emit_runtime_local_func_llvm_jit_fuel_charge(state)) [[unlikely]] { return false; }
+    if(!emit_runtime_local_func_llvm_jit_epoch_check(state)) [[unlikely]] { return false; }
     state.valid = true;
     return true;
 }
@@ -4460,8 +5337,11 @@ struct runtime_local_func_llvm_jit_emit_state_t
                                                        get_llvm_string_ref(u8"tiered.local.addr"))};
                     auto typed_local_address{
                         load_builder.CreateBitCast(local_address, get_llvm_pointer_type(llvm_local_type), get_llvm_string_ref(u8"tiered.local.typed.addr"))};
-                    load_builder.CreateStore(load_builder.CreateLoad(llvm_local_type, typed_local_address, get_llvm_string_ref(u8"tiered.local")),
-                                             local_pointer);
+                    // Serialized locals are packed, so a v128 slot is not guaranteed to meet the 16-byte natural alignment LLVM
+                    // would otherwise assume for a vector load.
+                    load_builder.CreateStore(
+                        load_builder.CreateAlignedLoad(llvm_local_type, typed_local_address, ::llvm::MaybeAlign(1u), get_llvm_string_ref(u8"tiered.local")),
+                        local_pointer);
                 }
                 load_builder.CreateBr(target_block);
             }
@@ -5075,6 +5955,9 @@ inline constexpr void truncate_runtime_local_func_llvm_jit_operand_stack_to(runt
     ir_builder.SetInsertPoint(loop_body_block);
 
     if(!try_record_runtime_local_func_llvm_jit_tiered_reentry(state, loop_body_block)) [[unlikely]] { return false; }
+    // Back-edges target `loop.body`, so the charge runs once per iteration; OSR reentries are charged here as well.
+    if(!emit_runtime_local_func_llvm_jit_fuel_charge(state)) [[unlikely]] { return false; }
+    if(!emit_runtime_local_func_llvm_jit_epoch_check(state)) [[unlikely]] { return false; }
 
     auto const control_stack_index{state.control_stack.size()};
     state.control_stack.push_back({.type = llvm_jit_control_context_type::loop,
@@ -5124,7 +6007,9 @@ inline constexpr void truncate_runtime_local_func_llvm_jit_operand_stack_to(runt
     if(get_runtime_block_result_count(block_result) == 1uz && end_phi == nullptr) [[unlikely]] { return false; }
 
     auto cond_i1{ir_builder.CreateICmpNE(condition.value, ::llvm::ConstantInt::get(condition.value->getType(), 0u))};
-    ir_builder.CreateCondBr(cond_i1, then_block, else_block);
+    if(!emit_runtime_local_func_llvm_jit_profile_two_way(state, cond_i1)) [[unlikely]] { return false; }
+    auto branch_inst{ir_builder.CreateCondBr(cond_i1, then_block, else_block)};
+    apply_runtime_local_func_llvm_jit_profile_two_way(state, branch_inst);
     ir_builder.SetInsertPoint(then_block);
 
     auto const control_stack_index{state.control_stack.size()};
@@ -5301,7 +6186,9 @@ inline constexpr void truncate_runtime_local_func_llvm_jit_operand_stack_to(runt
 
     auto fallthrough_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"br_if.cont"), llvm_function)};
     auto cond_i1{ir_builder.CreateICmpNE(condition.value, ::llvm::ConstantInt::get(condition.value->getType(), 0u))};
-    ir_builder.CreateCondBr(cond_i1, branch_target->block, fallthrough_block);
+    if(!emit_runtime_local_func_llvm_jit_profile_two_way(state, cond_i1)) [[unlikely]] { return false; }
+    auto branch_inst{ir_builder.CreateCondBr(cond_i1, branch_target->block, fallthrough_block)};
+    apply_runtime_local_func_llvm_jit_profile_two_way(state, branch_inst);
     mark_runtime_local_func_llvm_jit_branch_target_has_incoming(state, *branch_target);
     ir_builder.SetInsertPoint(fallthrough_block);
     return true;
@@ -5397,12 +6284,14 @@ inline constexpr void truncate_runtime_local_func_llvm_jit_operand_stack_to(runt
         if(branch_target == nullptr || !add_target_incoming(*branch_target)) [[unlikely]] { return false; }
     }
 
+    if(!emit_runtime_local_func_llvm_jit_profile_multi_way(state, condition.value, label_indices.size())) [[unlikely]] { return false; }
     auto switch_inst{ir_builder.CreateSwitch(condition.value, default_target->block, static_cast<unsigned>(label_indices.size()))};
     for(::std::size_t target_index{}; target_index != label_indices.size(); ++target_index)
     {
         switch_inst->addCase(::llvm::ConstantInt::get(::llvm::Type::getInt32Ty(llvm_context), target_index),
                              branch_targets.index_unchecked(target_index)->block);
     }
+    apply_runtime_local_func_llvm_jit_profile_multi_way(state, switch_inst, label_indices.size());
 
     enter_runtime_local_func_llvm_jit_unreachable_control_context(state);
     return true;
@@ -6318,6 +7207,8 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
                                               ::uwvm2::utils::container::u8string_view{table_view_symbol_name.data(), table_view_symbol_name.size()})};
     if(table_view_base_ptr == nullptr) [[unlikely]] { return false; }
 
+    if(!emit_runtime_local_func_llvm_jit_profile_call_target(state, selector.value)) [[unlikely]] { return false; }
+
     auto selector_index{ir_builder.CreateZExt(selector.value, llvm_intptr_type, get_llvm_string_ref(u8"call_indirect.selector.index"))};
     auto table_view_ptr{ir_builder.CreateInBoundsGEP(table_view_struct_type,
                                                      table_view_base_ptr,
@@ -6382,6 +7273,59 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
     if(current_block == nullptr || current_block->getParent() == nullptr) [[unlikely]] { return false; }
 
     auto llvm_function{current_block->getParent()};
+
+    // Profile-guided devirtualization: when tier-1 saw one table element dominate this site and it is a same-module function
+    // of the expected type, call that function directly (so LLVM may inline it) whenever the selected record's typed entry
+    // is that function.  Any other target, including a table element replaced since profiling, takes the generic path.
+    ::llvm::CallInst* speculative_call{};
+    ::llvm::BasicBlock* speculative_end_block{};
+    if(auto const call_target{get_runtime_local_func_llvm_jit_profile_call_target(state)};
+       call_target.dominant && !state.route_wasm_calls_through_runtime_bridge && state.lazy_defined_typed_entry_target_base_address == 0u)
+    {
+        auto const table_storage{resolve_runtime_table_storage(*runtime_module_ptr, table_index)};
+        auto const import_func_count{runtime_module_ptr->imported_function_vec_storage.size()};
+        runtime_call_indirect_callee_resolution_t callee_resolution{};
+        if(table_storage != nullptr && call_target.selector < table_storage->elems.size())
+        {
+            callee_resolution = resolve_runtime_call_indirect_callee(*runtime_module_ptr, table_storage->elems.index_unchecked(call_target.selector));
+        }
+
+        if(callee_resolution.state_valid && callee_resolution.belongs_to_current_module &&
+           static_cast<::std::size_t>(callee_resolution.func_index) >= import_func_count && callee_resolution.function_type_ptr != nullptr &&
+           runtime_wasm_function_types_equal(*callee_resolution.function_type_ptr, *callee_type_ptr))
+        {
+            auto callee_function{get_or_create_llvm_wasm_function_declaration(*llvm_module,
+                                                                              llvm_context,
+                                                                              *runtime_module_ptr,
+                                                                              callee_resolution.func_index,
+                                                                              *callee_resolution.function_type_ptr)};
+            if(callee_function == nullptr) [[unlikely]] { return false; }
+
+            auto speculative_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call_indirect.speculative"), llvm_function)};
+            auto generic_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call_indirect.generic"), llvm_function)};
+            if(speculative_block == nullptr || generic_block == nullptr) [[unlikely]] { return false; }
+
+            auto guard_branch{ir_builder.CreateCondBr(
+                ir_builder.CreateICmpEQ(typed_entry_address,
+                                        ir_builder.CreatePtrToInt(callee_function, llvm_intptr_type, get_llvm_string_ref(u8"call_indirect.speculative.addr")),
+                                        get_llvm_string_ref(u8"call_indirect.speculative.hit")),
+                speculative_block,
+                generic_block)};
+            apply_runtime_local_func_llvm_jit_profile_guard_weights(guard_branch, call_target.hits, call_target.total);
+
+            ir_builder.SetInsertPoint(speculative_block);
+            speculative_call = emit_runtime_local_func_llvm_jit_direct_wasm_call_value(state,
+                                                                                       *runtime_module_ptr,
+                                                                                       callee_resolution.func_index,
+                                                                                       *callee_resolution.function_type_ptr,
+                                                                                       {prepared_call.arguments.data(), prepared_call.arguments.size()});
+            if(speculative_call == nullptr) [[unlikely]] { return false; }
+            speculative_end_block = ir_builder.GetInsertBlock();
+
+            ir_builder.SetInsertPoint(generic_block);
+        }
+    }
+
     auto typed_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call_indirect.typed"), llvm_function)};
     auto raw_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call_indirect.raw"), llvm_function)};
     auto merge_block{::llvm::BasicBlock::Create(llvm_context, get_llvm_string_ref(u8"call_indirect.merge"), llvm_function)};
@@ -6422,14 +7366,21 @@ template <auto I32BridgeFunction, auto I64BridgeFunction, auto F32BridgeFunction
     auto raw_end_block{ir_builder.GetInsertBlock()};
     ir_builder.CreateBr(merge_block);
 
+    if(speculative_end_block != nullptr)
+    {
+        ir_builder.SetInsertPoint(speculative_end_block);
+        ir_builder.CreateBr(merge_block);
+    }
+
     ir_builder.SetInsertPoint(merge_block);
     ::llvm::Value* result_value{};
     if(prepared_call.has_result)
     {
         if(typed_call == nullptr || raw_bridge_result.result_value == nullptr) [[unlikely]] { return false; }
-        auto result_phi{ir_builder.CreatePHI(typed_call->getType(), 2u, get_llvm_string_ref(u8"call_indirect.result"))};
+        auto result_phi{ir_builder.CreatePHI(typed_call->getType(), speculative_end_block == nullptr ? 2u : 3u, get_llvm_string_ref(u8"call_indirect.result"))};
         result_phi->addIncoming(typed_call, typed_end_block);
         result_phi->addIncoming(raw_bridge_result.result_value, raw_end_block);
+        if(speculative_end_block != nullptr) { result_phi->addIncoming(speculative_call, speculative_end_block); }
         result_value = result_phi;
     }
 
@@ -6533,6 +7484,7 @@ template <typename CreateValue>
     constexpr bool result{};
     using wasm1p1_code = ::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_basic;
     using wasm1p1_numeric_code = ::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_numeric;
+    using wasm1p1_simd_code = ::uwvm2::parser::wasm::standard::wasm1p1::opcode::op_simd;
 
     // Push a typed LLVM value onto the transient operand stack.
     auto const push_operand{[&](runtime_operand_stack_value_type type, ::llvm::Value* value) constexpr noexcept
@@ -8020,6 +8972,191 @@ template <typename CreateValue>
             return true;
         }};
 
+    // Pop one operand for a SIMD case and check its Wasm type.  A null result means the replayed stack shape disagrees with
+    // validation, and the caller aborts inline emission.
+    auto const pop_simd_operand{[&](runtime_operand_stack_value_type expected_type) constexpr noexcept -> ::llvm::Value*
+                                {
+                                    if(operand_stack.empty()) [[unlikely]] { return nullptr; }
+                                    auto const operand{operand_stack.back()};
+                                    operand_stack.pop_back();
+                                    if(operand.type != expected_type) [[unlikely]] { return nullptr; }
+                                    return operand.value;
+                                }};
+
+    // SIMD unary helper: view the v128 operand in one lane shape and push the (canonicalized) vector result.
+    auto const emit_v128_unary{[&](llvm_jit_v128_shape shape, auto&& create_value) constexpr noexcept -> bool
+                               {
+                                   auto operand{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), shape)};
+                                   if(operand == nullptr) [[unlikely]] { return false; }
+
+                                   auto value{emit_llvm_v128_canonical(ir_builder, create_value(operand))};
+                                   if(value == nullptr) [[unlikely]] { return false; }
+
+                                   push_operand(runtime_operand_stack_v128_type, value);
+                                   return true;
+                               }};
+
+    // SIMD binary helper.  The right operand is on top of the stack, matching Wasm operand order.
+    auto const emit_v128_binary{[&](llvm_jit_v128_shape shape, auto&& create_value) constexpr noexcept -> bool
+                                {
+                                    auto right{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), shape)};
+                                    auto left{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), shape)};
+                                    if(left == nullptr || right == nullptr) [[unlikely]] { return false; }
+
+                                    auto value{emit_llvm_v128_canonical(ir_builder, create_value(left, right))};
+                                    if(value == nullptr) [[unlikely]] { return false; }
+
+                                    push_operand(runtime_operand_stack_v128_type, value);
+                                    return true;
+                                }};
+
+    // SIMD reduction helper for any_true/all_true/bitmask, whose result is a scalar i32.
+    auto const emit_v128_to_i32{[&](llvm_jit_v128_shape shape, auto&& create_value) constexpr noexcept -> bool
+                                {
+                                    auto operand{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), shape)};
+                                    if(operand == nullptr) [[unlikely]] { return false; }
+
+                                    auto value{create_value(operand)};
+                                    if(value == nullptr) [[unlikely]] { return false; }
+
+                                    push_operand(runtime_operand_stack_value_type::i32, value);
+                                    return true;
+                                }};
+
+    // Lane-wise comparisons produce all-ones/all-zeros masks in an integer shape of the same lane width.
+    auto const emit_v128_compare{[&](llvm_jit_v128_shape shape, ::llvm::CmpInst::Predicate predicate) constexpr noexcept -> bool
+                                 {
+                                     return emit_v128_binary(shape,
+                                                             [&](::llvm::Value* left, ::llvm::Value* right) constexpr noexcept -> ::llvm::Value*
+                                                             {
+                                                                 auto vector_type{::llvm::cast<::llvm::VectorType>(left->getType())};
+                                                                 auto mask_type{::llvm::VectorType::getInteger(vector_type)};
+                                                                 auto const is_fp{::llvm::CmpInst::isFPPredicate(predicate)};
+                                                                 auto compare{is_fp ? ir_builder.CreateFCmp(predicate, left, right)
+                                                                                    : ir_builder.CreateICmp(predicate, left, right)};
+                                                                 return ir_builder.CreateSExt(compare, mask_type);
+                                                             });
+                                 }};
+
+    // Lane-wise shifts take the count modulo the lane width, as Wasm requires, before splatting it to every lane.
+    auto const emit_v128_shift{[&](llvm_jit_v128_shape shape, ::llvm::Instruction::BinaryOps shift_opcode) constexpr noexcept -> bool
+                               {
+                                   auto count{pop_simd_operand(runtime_operand_stack_value_type::i32)};
+                                   auto operand{emit_llvm_v128_as_shape(ir_builder, pop_simd_operand(runtime_operand_stack_v128_type), shape)};
+                                   if(count == nullptr || operand == nullptr) [[unlikely]] { return false; }
+
+                                   auto vector_type{::llvm::cast<::llvm::FixedVectorType>(operand->getType())};
+                                   auto lane_type{vector_type->getElementType()};
+                                   auto const lane_bits{lane_type->getIntegerBitWidth()};
+                                   auto masked_count{ir_builder.CreateAnd(count, ::llvm::ConstantInt::get(count->getType(), lane_bits - 1u))};
+                                   auto lane_count_value{ir_builder.CreateZExtOrTrunc(masked_count, lane_type)};
+                                   auto splat_count{ir_builder.CreateVectorSplat(vector_type->getNumElements(), lane_count_value)};
+
+                                   auto value{emit_llvm_v128_canonical(ir_builder, ir_builder.CreateBinOp(shift_opcode, operand, splat_count))};
+                                   if(value == nullptr) [[unlikely]] { return false; }
+
+                                   push_operand(runtime_operand_stack_v128_type, value);
+                                   return true;
+                               }};
+
+    // Select `lane_count` lanes starting at `first_lane` with stride `lane_step`; used for low/high halves and even/odd
+    // pairs in the widening SIMD operations.
+    auto const emit_v128_lane_subset{[&](::llvm::Value* vector, unsigned first_lane, unsigned lane_count, unsigned lane_step) constexpr noexcept
+                                     -> ::llvm::Value*
+                                     {
+                                         int mask[16]{};
+                                         for(unsigned i{}; i != lane_count; ++i) { mask[i] = static_cast<int>(first_lane + i * lane_step); }
+                                         return ir_builder.CreateShuffleVector(vector, ::llvm::ArrayRef<int>{mask, lane_count});
+                                     }};
+
+    // Concatenate two equally sized vectors into one vector with twice as many lanes.
+    auto const emit_v128_concat{[&](::llvm::Value* low, ::llvm::Value* high) constexpr noexcept -> ::llvm::Value*
+                                {
+                                    auto const half_lane_count{::llvm::cast<::llvm::FixedVectorType>(low->getType())->getNumElements()};
+                                    int mask[16]{};
+                                    for(unsigned i{}; i != half_lane_count * 2u; ++i) { mask[i] = static_cast<int>(i); }
+                                    return ir_builder.CreateShuffleVector(low, high, ::llvm::ArrayRef<int>{mask, half_lane_count * 2u});
+                                }};
+
+    // Widen the low or high half of an integer vector to lanes of twice the width.
+    auto const emit_v128_extend_half{[&](::llvm::Value* vector, bool high_half, bool is_signed) constexpr noexcept -> ::llvm::Value*
+                                     {
+                                         auto vector_type{::llvm::cast<::llvm::FixedVectorType>(vector->getType())};
+                                         auto const half_lane_count{vector_type->getNumElements() / 2u};
+                                         auto half{emit_v128_lane_subset(vector, high_half ? half_lane_count : 0u, half_lane_count, 1u)};
+                                         auto wide_type{::llvm::FixedVectorType::get(
+                                             ::llvm::Type::getIntNTy(llvm_context, vector_type->getElementType()->getIntegerBitWidth() * 2u),
+                                             half_lane_count)};
+                                         return is_signed ? ir_builder.CreateSExt(half, wide_type) : ir_builder.CreateZExt(half, wide_type);
+                                     }};
+
+    // Saturate each lane of a wide integer vector to the signed or unsigned range of half its width, then truncate.  Both
+    // narrow variants interpret their inputs as signed.
+    auto const emit_v128_saturating_narrow{
+        [&](::llvm::Value* vector, bool is_signed) constexpr noexcept -> ::llvm::Value*
+        {
+            auto vector_type{::llvm::cast<::llvm::FixedVectorType>(vector->getType())};
+            auto const narrow_bits{vector_type->getElementType()->getIntegerBitWidth() / 2u};
+            auto const min_value{is_signed ? ::llvm::APInt::getSignedMinValue(narrow_bits).sext(narrow_bits * 2u) : ::llvm::APInt{narrow_bits * 2u, 0u}};
+            auto const max_value{is_signed ? ::llvm::APInt::getSignedMaxValue(narrow_bits).sext(narrow_bits * 2u)
+                                           : ::llvm::APInt::getMaxValue(narrow_bits).zext(narrow_bits * 2u)};
+            ::llvm::Type* overloaded_types[]{vector_type};
+            ::llvm::Value* lower_arguments[]{vector, ::llvm::ConstantInt::get(vector_type, min_value)};
+            auto lower_clamped{call_llvm_intrinsic(*llvm_module, ir_builder, ::llvm::Intrinsic::smax, overloaded_types, lower_arguments)};
+            ::llvm::Value* upper_arguments[]{lower_clamped, ::llvm::ConstantInt::get(vector_type, max_value)};
+            auto clamped{call_llvm_intrinsic(*llvm_module, ir_builder, ::llvm::Intrinsic::smin, overloaded_types, upper_arguments)};
+            return ir_builder.CreateTrunc(
+                clamped,
+                ::llvm::FixedVectorType::get(::llvm::Type::getIntNTy(llvm_context, narrow_bits), vector_type->getNumElements()));
+        }};
+
+    // Apply a one- or two-operand overloaded LLVM intrinsic to a SIMD lane vector.
+    auto const call_v128_intrinsic{[&](::llvm::Intrinsic::ID intrinsic_id, ::llvm::ArrayRef<::llvm::Value*> arguments) constexpr noexcept -> ::llvm::Value*
+                                   {
+                                       ::llvm::Type* overloaded_types[]{arguments.front()->getType()};
+                                       return call_llvm_intrinsic(*llvm_module, ir_builder, intrinsic_id, overloaded_types, arguments);
+                                   }};
+
+    // Resolve a checked direct byte pointer for a SIMD memory access.  SIMD memory forms have no runtime bridge, so the
+    // prescan only admits them for direct mmap-backed memory 0; a null pointer here aborts inline emission.
+    auto const emit_simd_memory_pointer{[&](validation_module_traits_t::wasm_u32 static_offset, ::std::size_t access_size, ::llvm::Value* address_value)
+                                            constexpr noexcept -> ::llvm::Value*
+                                        {
+                                            if(!ensure_memory0_access_info() || address_value == nullptr) [[unlikely]] { return nullptr; }
+                                            if constexpr(::std::endian::native == ::std::endian::little)
+                                            {
+                                                return emit_direct_memory_byte_pointer(static_offset, access_size, address_value);
+                                            }
+                                            else
+                                            {
+                                                return nullptr;
+                                            }
+                                        }};
+
+    // Emit a direct guest-memory load of `llvm_type`.  Like the scalar direct loads, the access is volatile so LLVM does not
+    // invent or drop guest-memory traffic around the bounds and growth machinery.
+    auto const emit_simd_memory_load{[&](::llvm::Value* direct_memory_pointer, ::llvm::Type* llvm_type, ::llvm::Align memory_alignment) constexpr noexcept
+                                     -> ::llvm::Value*
+                                     {
+                                         if(direct_memory_pointer == nullptr) [[unlikely]] { return nullptr; }
+                                         auto typed_pointer{ir_builder.CreatePointerCast(direct_memory_pointer, get_llvm_pointer_type(llvm_type))};
+                                         auto load_inst{ir_builder.CreateLoad(llvm_type, typed_pointer, get_llvm_string_ref(u8"memory.simd.load"))};
+                                         load_inst->setAlignment(memory_alignment);
+                                         load_inst->setVolatile(true);
+                                         return load_inst;
+                                     }};
+
+    auto const emit_simd_memory_store{[&](::llvm::Value* direct_memory_pointer, ::llvm::Value* value, ::llvm::Align memory_alignment) constexpr noexcept
+                                      -> bool
+                                      {
+                                          if(direct_memory_pointer == nullptr || value == nullptr) [[unlikely]] { return false; }
+                                          auto typed_pointer{ir_builder.CreatePointerCast(direct_memory_pointer, get_llvm_pointer_type(value->getType()))};
+                                          auto store_inst{ir_builder.CreateStore(value, typed_pointer)};
+                                          store_inst->setAlignment(memory_alignment);
+                                          store_inst->setVolatile(true);
+                                          return true;
+                                      }};
+
     if(control_stack.empty() || code_curr == code_end) [[unlikely]] { return false; }
 
     // Decode the opcode byte and record its function-relative offset for tiered OSR metadata.
@@ -8109,6 +9246,26 @@ template <typename CreateValue>
         return code_curr == code_end;
     }
 
+    if(static_cast<::std::uint_least8_t>(curr_opbase) == static_cast<::std::uint_least8_t>(wasm1p1_code::simd_prefix))
+    {
+        ++code_curr;
+
+        validation_module_traits_t::wasm_u32 subopcode{};
+        if(!parse_wasm_leb128_immediate(code_curr, code_end, subopcode)) [[unlikely]] { return false; }
+
+        switch(static_cast<wasm1p1_simd_code>(subopcode))
+        {
+// SIMD cases share the dispatcher-local v128 helpers above and keep the same single-instruction contract.
+#include "opcode/simd_emit_cases.h"
+            [[unlikely]] default:
+            {
+                return result;
+            }
+        }
+
+        return code_curr == code_end;
+    }
+
     // Main opcode dispatch for opcodes implemented directly in this file.  Larger opcode families live in include files
     // that share the dispatcher lambdas above.
     switch(curr_opbase)
@@ -76,6 +76,7 @@ for(;;)
 #include "opcode/int_numeric_cases.h"
 #include "opcode/float_numeric_convert_cases.h"
 #include "opcode/wasm1p1_cases.h"
+#include "opcode/simd_cases.h"
         [[unlikely]] default:
         {
             err.err_curr = code_curr;
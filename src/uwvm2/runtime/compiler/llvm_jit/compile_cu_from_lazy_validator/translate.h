@@ -186,6 +186,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             key, u8"emit-call-stack-frames", bool_key_value(opt.emit_call_stack_frames));
         ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(
             key, u8"emit-unwind-call-stack-frames", bool_key_value(opt.emit_unwind_call_stack_frames));
+        // Collection mode adds counter updates that reference a per-function profile symbol.
+        using profile_mode_t = ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::llvm_jit_profile_mode_t;
+        ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(
+            key, u8"llvm-jit-profile-mode", opt.profile_mode == profile_mode_t::collect ? u8"collect" : u8"none");
+        // Fuel metering adds charges that reference the runtime fuel counter symbol.
+        ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(key, u8"fuel", bool_key_value(opt.fuel_counter != nullptr));
+        // Epoch interruption adds checks that reference the runtime epoch flag symbol.
+        ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(key, u8"epoch", bool_key_value(opt.epoch_interrupt != nullptr));
     }
 
     [[nodiscard]] inline constexpr ::uwvm2::runtime::llvm_jit_cache::cache_policy lazy_llvm_jit_object_cache_policy() noexcept
@@ -310,9 +318,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
         // Validation/emission metadata returned by the full LLVM JIT local-function translator.
         local_func_storage_t local_func{};
 
-        // The LLVM context and MCJIT engine must outlive all native entry addresses returned from the engine.
-        ::uwvm2::utils::container::delete_owned_ptr<::llvm::LLVMContext> llvm_context_holder{};
-        ::uwvm2::utils::container::delete_owned_ptr<::llvm::ExecutionEngine> llvm_jit_engine{};
+        // Native code behind the addresses below lives in the process-wide lazy JIT session, not in this record.
 
         // Typed public entry point for normal Wasm-to-Wasm calls.
         ::std::uintptr_t entry_address{};
@@ -324,9 +330,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
         ::uwvm2::utils::container::vector<tiered_loop_reentry_storage_t> tiered_loop_reentries{};
         ::uwvm2::utils::container::vector<::std::uintptr_t> tiered_loop_reentry_raw_entry_addresses{};
 
-        // Publication flag for the non-atomic payload above.  Writers fill `entry_address`, `raw_entry_address`,
-        // reentry vectors, and the LLVM owner fields first, then publish `ready == true` with release semantics.  Readers
-        // must use an acquire load through `std::atomic_ref<bool>` before touching those payload fields.
+        // Publication flag for the non-atomic payload above.  Writers fill `entry_address`, `raw_entry_address`, and the
+        // reentry vectors first, then publish `ready == true` with release semantics.  Readers must use an acquire load
+        // through `std::atomic_ref<bool>` before touching those payload fields.
         //
         // Keep the storage type as `bool` rather than `std::atomic_bool`: the project vector type moves these records, and
         // `std::atomic_ref` gives the required synchronization without making the record itself non-movable.
@@ -915,6 +921,163 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             return all_details::verify_llvm_jit_module(module, verify_llvm_jit_ir);
         }
 
+        // One long-lived MCJIT engine per codegen level hosts every lazily materialized module in the process.  Sharing the
+        // engine means one TargetMachine, one symbol table that later modules resolve against, and one section memory
+        // manager whose partially used code/data pages are refilled by later objects instead of each group mapping its own.
+        // All members are accessed only while `lazy_materialize_lock` is held.
+        struct lazy_llvm_jit_session_t
+        {
+            // Intentionally never destroyed: published entry addresses point into this engine's memory manager for the rest
+            // of the process, and MCJIT teardown from static destructors is unsafe (see `compiled_module_record`).
+            ::llvm::ExecutionEngine* engine{};
+
+            // Borrowed from `engine`; used for module target setup, optimization and the object cache context.
+            ::llvm::TargetMachine* target_machine{};
+
+            // Listeners already attached to `engine`.  Registration is engine-wide, so each listener is added once.
+            ::uwvm2::utils::container::vector<::llvm::JITEventListener*> registered_listeners{};
+
+            // Number of IR modules finalized by this session, reported in the lazy runtime log.
+            ::std::size_t materialized_module_count{};
+        };
+
+        inline constexpr ::std::size_t lazy_llvm_jit_session_count{static_cast<::std::size_t>(::llvm::CodeGenOptLevel::Aggressive) + 1uz};
+        inline lazy_llvm_jit_session_t lazy_llvm_jit_sessions[lazy_llvm_jit_session_count]{};  // [global]
+
+        // IR contexts are recycled between groups instead of being created and destroyed per group.  A context keeps the
+        // types and uniqued constants of every module it has hosted, so it is retired after a bounded number of modules.
+        // Emission and materialization of a group both run under `lazy_materialize_lock`, so a single idle slot serves the
+        // one active compile worker.
+        inline constexpr ::std::size_t lazy_llvm_jit_context_reuse_limit{64uz};
+
+        struct lazy_llvm_jit_context_pool_t
+        {
+            ::uwvm2::utils::container::delete_owned_ptr<::llvm::LLVMContext> idle_context{};
+            ::std::size_t idle_context_uses{};
+            ::std::size_t active_context_uses{};
+        };
+
+        inline lazy_llvm_jit_context_pool_t lazy_llvm_jit_context_pool{};  // [global]
+
+        // Hands out the idle context, or null so the caller allocates a fresh one.  The caller must hold
+        // `lazy_materialize_lock` until the context is returned through `recycle_lazy_llvm_jit_context`.
+        [[nodiscard]] inline constexpr ::uwvm2::utils::container::delete_owned_ptr<::llvm::LLVMContext> take_lazy_llvm_jit_context() noexcept
+        {
+            auto& pool{lazy_llvm_jit_context_pool};
+            pool.active_context_uses = pool.idle_context == nullptr ? 0uz : pool.idle_context_uses;
+            pool.idle_context_uses = 0uz;
+            return ::std::move(pool.idle_context);
+        }
+
+        // Returns a context whose modules have all been destroyed.  Worn-out contexts are freed here.
+        inline constexpr void recycle_lazy_llvm_jit_context(::uwvm2::utils::container::delete_owned_ptr<::llvm::LLVMContext>&& llvm_context) noexcept
+        {
+            auto& pool{lazy_llvm_jit_context_pool};
+            auto const uses{pool.active_context_uses + 1uz};
+            pool.active_context_uses = 0uz;
+            if(llvm_context == nullptr || uses >= lazy_llvm_jit_context_reuse_limit) { return; }
+            pool.idle_context = ::std::move(llvm_context);
+            pool.idle_context_uses = uses;
+        }
+
+        // Returns the shared session for `codegen_opt_level`, creating its engine on first use.  MCJIT can only be built
+        // around an initial module, so an empty anchor module is used and removed again immediately.
+        [[nodiscard]] inline constexpr lazy_llvm_jit_session_t* get_lazy_llvm_jit_session(::llvm::CodeGenOptLevel codegen_opt_level) noexcept
+        {
+            auto const session_index{static_cast<::std::size_t>(codegen_opt_level)};
+            if(session_index >= lazy_llvm_jit_session_count) [[unlikely]] { return nullptr; }
+            auto& session{lazy_llvm_jit_sessions[session_index]};
+            if(session.engine != nullptr) [[likely]] { return ::std::addressof(session); }
+
+            if(!ensure_llvm_jit_native_target_initialized()) [[unlikely]] { return nullptr; }
+
+            auto const& target_config{get_llvm_jit_native_target_config()};
+            ::llvm::SmallVector<::llvm::StringRef, 16> host_target_attributes{};
+            append_llvm_jit_host_target_attribute_refs(target_config.feature_storage, host_target_attributes);
+
+            auto anchor_context{::uwvm2::utils::container::make_delete_owned<::llvm::LLVMContext>()};
+            if(anchor_context == nullptr) [[unlikely]] { return nullptr; }
+            auto anchor_module{::uwvm2::utils::container::make_delete_owned<::llvm::Module>(all_details::get_llvm_string_ref(u8"uwvm2.lazy-jit-session"),
+                                                                                           *anchor_context)};
+            if(anchor_module == nullptr) [[unlikely]] { return nullptr; }
+            auto const anchor_module_ptr{anchor_module.get()};
+
+            auto raw_engine{
+                ::llvm::EngineBuilder(details::llvm_module_owner_t{anchor_module.release()})
+                    .setEngineKind(::llvm::EngineKind::JIT)
+                    .setOptLevel(codegen_opt_level)
+                    .setMCPU(all_details::get_llvm_string_ref(target_config.cpu_name))
+                    .setMAttrs(host_target_attributes)
+                    .setMCJITMemoryManager(llvm_jit_memory_manager_owner_t{
+                        ::uwvm2::utils::container::make_delete_owned<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_section_memory_manager>()
+                            .release()})
+                    .create()};
+            if(raw_engine == nullptr) [[unlikely]] { return nullptr; }
+
+            auto const target_machine{raw_engine->getTargetMachine()};
+            if(target_machine == nullptr) [[unlikely]] { return nullptr; }
+            if(codegen_opt_level == ::llvm::CodeGenOptLevel::None) { target_machine->setFastISel(true); }
+
+            // The anchor never contributes code.  Taking it back lets its context go away with it.
+            if(raw_engine->removeModule(anchor_module_ptr)) { ::uwvm2::utils::container::delete_owned_ptr<::llvm::Module>{anchor_module_ptr}.reset(); }
+            else
+            {
+                static_cast<void>(anchor_context.release());
+            }
+
+            session.engine = raw_engine;
+            session.target_machine = target_machine;
+            return ::std::addressof(session);
+        }
+
+        // Adds one optimized module to the session engine and compiles it.  Only modules added since the previous call are
+        // code-generated; symbols they do not define resolve against earlier session objects before process symbols.
+        inline constexpr void finalize_lazy_llvm_jit_session_module(lazy_llvm_jit_session_t& session,
+                                                                    ::uwvm2::utils::container::delete_owned_ptr<::llvm::Module>&& llvm_module,
+                                                                    ::uwvm2::runtime::llvm_jit_cache::llvm_jit_object_cache& llvm_jit_object_cache,
+                                                                    ::llvm::JITEventListener* jit_event_listener) noexcept
+        {
+            if(jit_event_listener != nullptr &&
+               ::std::find(session.registered_listeners.begin(), session.registered_listeners.end(), jit_event_listener) == session.registered_listeners.end())
+            {
+                // Lazy unwind call-stack mode needs DWARF sections as well as executable sections so optimized inline Wasm
+                // frames can be reconstructed from the generated objects.
+                session.engine->setProcessAllSections(true);
+                session.engine->RegisterJITEventListener(jit_event_listener);
+                session.registered_listeners.push_back(jit_event_listener);
+            }
+
+            session.engine->addModule(details::llvm_module_owner_t{llvm_module.release()});
+            session.engine->setObjectCache(::std::addressof(llvm_jit_object_cache));
+            session.engine->finalizeObject();
+            session.engine->setObjectCache(nullptr);
+            ++session.materialized_module_count;
+        }
+
+        // Number of modules the session for `codegen_opt_level` has finalized so far; zero before the session exists.
+        [[nodiscard]] inline constexpr ::std::size_t lazy_llvm_jit_session_module_count(::llvm::CodeGenOptLevel codegen_opt_level) noexcept
+        {
+            auto const session_index{static_cast<::std::size_t>(codegen_opt_level)};
+            if(session_index >= lazy_llvm_jit_session_count) [[unlikely]] { return 0uz; }
+            return lazy_llvm_jit_sessions[session_index].materialized_module_count;
+        }
+
+        // Drops the IR of a finalized module once all of its addresses have been resolved.  Native code stays in the
+        // session memory manager; only the IR and its context go back to the pool.
+        inline constexpr void release_lazy_llvm_jit_session_module(lazy_llvm_jit_session_t& session,
+                                                                   ::llvm::Module* llvm_module,
+                                                                   ::uwvm2::utils::container::delete_owned_ptr<::llvm::LLVMContext>&& llvm_context) noexcept
+        {
+            if(llvm_module == nullptr || !session.engine->removeModule(llvm_module)) [[unlikely]]
+            {
+                // The engine still references the module, so its context must stay alive as well.
+                static_cast<void>(llvm_context.release());
+                return;
+            }
+            ::uwvm2::utils::container::delete_owned_ptr<::llvm::Module>{llvm_module}.reset();
+            recycle_lazy_llvm_jit_context(::std::move(llvm_context));
+        }
+
         // Resolves an emitted LLVM function symbol to a native address, with a fallback for older MCJIT paths that need
         // an IR Function pointer before materializing the address.
         [[nodiscard]] inline constexpr ::std::uintptr_t resolve_llvm_function_address(::llvm::ExecutionEngine& engine,
@@ -931,8 +1094,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             return function_address == nullptr ? 0u : reinterpret_cast<::std::uintptr_t>(function_address);
         }
 
-        // Takes a single-function LLVM IR module, creates an MCJIT engine, resolves all public/raw entry points, and
-        // stores the owning LLVM objects in the materialized function record.
+        // Takes a single-function LLVM IR module, compiles it in the shared session engine, and resolves all public/raw
+        // entry points into the materialized function record.
         [[nodiscard]] inline constexpr bool materialize_lazy_local_function(runtime_module_storage_t const& curr_module,
                                                                             lazy_module_storage_t& storage,
                                                                             lazy_compile_options const& options,
@@ -949,8 +1112,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             materialized.raw_entry_address = 0u;
             materialized.tiered_loop_reentries.clear();
             materialized.tiered_loop_reentry_raw_entry_addresses.clear();
-            materialized.llvm_jit_engine.reset();
-            materialized.llvm_context_holder.reset();
 
             // The emitter hands over a context/module pair.  Materialization consumes both and clears `llvm_ir_storage`
             // so failed callers cannot accidentally reuse moved LLVM objects.
@@ -958,34 +1119,25 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             {
                 return false;
             }
-            if(!ensure_llvm_jit_native_target_initialized()) [[unlikely]] { return false; }
+            auto const session{get_lazy_llvm_jit_session(options.codegen_opt_level)};
+            if(session == nullptr) [[unlikely]] { return false; }
 
+            // The debug-info builder only references module metadata; drop it before the module and context are released.
+            llvm_ir_storage.llvm_di_builder.reset();
             auto llvm_context_holder{::std::move(llvm_ir_storage.llvm_context_holder)};
             auto llvm_module{::std::move(llvm_ir_storage.llvm_module)};
             llvm_ir_storage.emitted = false;
 
             if(llvm_context_holder == nullptr || llvm_module == nullptr) [[unlikely]] { return false; }
 
-            // Match the eager JIT target setup but keep the target machine temporary; MCJIT takes ownership through
-            // ExecutionEngine creation below.
+            // Target setup uses the session engine's own TargetMachine so optimization sees exactly what MCJIT emits for.
             auto const& target_config{get_llvm_jit_native_target_config()};
-            ::llvm::SmallVector<::llvm::StringRef, 16> host_target_attributes{};
-            append_llvm_jit_host_target_attribute_refs(target_config.feature_storage, host_target_attributes);
-
-            ::llvm::EngineBuilder target_builder{};
-            target_builder.setEngineKind(::llvm::EngineKind::JIT)
-                .setOptLevel(options.codegen_opt_level)
-                .setMCPU(all_details::get_llvm_string_ref(target_config.cpu_name))
-                .setMAttrs(host_target_attributes);
-
-            ::uwvm2::utils::container::delete_owned_ptr<::llvm::TargetMachine> target_machine{target_builder.selectTarget()};
-            if(target_machine == nullptr) [[unlikely]] { return false; }
-            if(options.codegen_opt_level == ::llvm::CodeGenOptLevel::None) { target_machine->setFastISel(true); }
+            auto& target_machine{*session->target_machine};
 
-            set_llvm_module_target_triple_from_machine(*llvm_module, *target_machine);
-            llvm_module->setDataLayout(target_machine->createDataLayout());
-            apply_llvm_jit_native_target_function_attrs(*llvm_module, target_config, *target_machine);
-            if(!optimize_lazy_llvm_jit_module(*llvm_module, *target_machine, options.codegen_opt_level, options.compile_options.verify_llvm_jit_ir))
+            set_llvm_module_target_triple_from_machine(*llvm_module, target_machine);
+            llvm_module->setDataLayout(target_machine.createDataLayout());
+            apply_llvm_jit_native_target_function_attrs(*llvm_module, target_config, target_machine);
+            if(!optimize_lazy_llvm_jit_module(*llvm_module, target_machine, options.codegen_opt_level, options.compile_options.verify_llvm_jit_ir))
                 [[unlikely]]
             {
                 return false;
@@ -1017,36 +1169,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             auto llvm_jit_cache_context{::uwvm2::runtime::llvm_jit_cache::default_cache_context(
                 ::uwvm2::utils::container::u8string_view{llvm_jit_cache_key.data(), llvm_jit_cache_key.size()},
                 ::uwvm2::utils::container::u8string_view{llvm_jit_cache_codegen_policy.data(), llvm_jit_cache_codegen_policy.size()},
-                *target_machine)};
+                target_machine)};
             llvm_jit_cache_context.cache_key_is_complete = true;
             ::uwvm2::runtime::llvm_jit_cache::llvm_jit_object_cache llvm_jit_object_cache{::std::move(llvm_jit_cache_context),
                                                                                           lazy_llvm_jit_object_cache_policy()};
 
-            auto raw_engine{
-                ::llvm::EngineBuilder(details::llvm_module_owner_t{llvm_module.release()})
-                    .setEngineKind(::llvm::EngineKind::JIT)
-                    .setOptLevel(options.codegen_opt_level)
-                    .setMCPU(all_details::get_llvm_string_ref(target_config.cpu_name))
-                    .setMAttrs(host_target_attributes)
-                    .setMCJITMemoryManager(llvm_jit_memory_manager_owner_t{
-                        ::uwvm2::utils::container::make_delete_owned<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_section_memory_manager>()
-                            .release()})
-                    .create(target_machine.get())};
-            if(raw_engine == nullptr) [[unlikely]] { return false; }
-            static_cast<void>(target_machine.release());
-
-            ::uwvm2::utils::container::delete_owned_ptr<::llvm::ExecutionEngine> engine{raw_engine};
-
-            engine->setObjectCache(::std::addressof(llvm_jit_object_cache));
-            if(options.jit_event_listener != nullptr)
-            {
-                // Lazy unwind call-stack mode needs DWARF sections as well as executable sections so optimized inline
-                // Wasm frames can be reconstructed from the generated object.
-                engine->setProcessAllSections(true);
-                engine->RegisterJITEventListener(options.jit_event_listener);
-            }
-            engine->finalizeObject();
-            engine->setObjectCache(nullptr);
+            auto const llvm_module_ptr{llvm_module.get()};
+            finalize_lazy_llvm_jit_session_module(*session, ::std::move(llvm_module), llvm_jit_object_cache, options.jit_event_listener);
+            auto& engine{*session->engine};
 
             auto const import_func_count{curr_module.imported_function_vec_storage.size()};
             auto const function_index{import_func_count + local_function_index};
@@ -1059,8 +1189,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             auto const& runtime_func{curr_module.local_defined_function_vec_storage.index_unchecked(local_function_index)};
             if(runtime_func.function_type_ptr == nullptr) [[unlikely]] { return false; }
             auto const typed_entry_required{all_details::is_runtime_wasm_function_type_inline_llvm_jit_supported(*runtime_func.function_type_ptr)};
-            auto const entry_address{typed_entry_required ? resolve_llvm_function_address(*engine, function_name) : 0u};
-            auto const raw_entry_address{resolve_llvm_function_address(*engine, raw_function_name)};
+            auto const entry_address{typed_entry_required ? resolve_llvm_function_address(engine, function_name) : 0u};
+            auto const raw_entry_address{resolve_llvm_function_address(engine, raw_function_name)};
             if(raw_entry_address == 0u || (typed_entry_required && entry_address == 0u)) [[unlikely]] { return false; }
 
             // Reentry wrapper symbols are generated only when the local-function translator discovered tiered loop
@@ -1072,24 +1202,21 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             {
                 auto const reentry_function_name{
                     all_details::get_llvm_wasm_tiered_loop_reentry_raw_function_name(curr_module, function_index_u32, reentry.wasm_code_offset)};
-                auto const reentry_address{resolve_llvm_function_address(*engine, reentry_function_name)};
+                auto const reentry_address{resolve_llvm_function_address(engine, reentry_function_name)};
                 if(reentry_address == 0u) [[unlikely]] { return false; }
                 materialized.tiered_loop_reentry_raw_entry_addresses.push_back(reentry_address);
             }
 
             materialized.entry_address = entry_address;
             materialized.raw_entry_address = raw_entry_address;
-            materialized.llvm_context_holder = ::std::move(llvm_context_holder);
-            materialized.llvm_jit_engine = ::std::move(engine);
-            // Publish the fully resolved single-function record.  Acquire readers can now safely consume the addresses
-            // and rely on the owner fields to keep MCJIT code alive.
+            release_lazy_llvm_jit_session_module(*session, llvm_module_ptr, ::std::move(llvm_context_holder));
+            // Publish the fully resolved single-function record.  Acquire readers can now safely consume the addresses;
+            // the process-lifetime session keeps the native code alive.
             store_lazy_materialized_ready(materialized, true, ::std::memory_order_release);
             return true;
         }
 
-        // Materializes a group of local functions from one LLVM IR module.  All functions share one LLVMContext and one
-        // MCJIT engine; the first materialized record owns those objects and therefore owns the native code lifetime for
-        // the whole group.
+        // Materializes a group of local functions from one LLVM IR module as a single object in the shared session engine.
         [[nodiscard]] inline constexpr bool
             materialize_lazy_local_function_group(runtime_module_storage_t const& curr_module,
                                                   lazy_module_storage_t& storage,
@@ -1110,43 +1237,33 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 materialized.raw_entry_address = 0u;
                 materialized.tiered_loop_reentries.clear();
                 materialized.tiered_loop_reentry_raw_entry_addresses.clear();
-                materialized.llvm_jit_engine.reset();
-                materialized.llvm_context_holder.reset();
             }
 
-            // Consume the generated IR module exactly once; the resulting ExecutionEngine owns the compiled code.
+            // Consume the generated IR module exactly once; the shared session engine then owns the compiled code.
             if(!llvm_ir_storage.emitted || llvm_ir_storage.llvm_context_holder == nullptr || llvm_ir_storage.llvm_module == nullptr) [[unlikely]]
             {
                 return false;
             }
-            if(!ensure_llvm_jit_native_target_initialized()) [[unlikely]] { return false; }
+            auto const session{get_lazy_llvm_jit_session(options.codegen_opt_level)};
+            if(session == nullptr) [[unlikely]] { return false; }
 
+            // The debug-info builder only references module metadata; drop it before the module and context are released.
+            llvm_ir_storage.llvm_di_builder.reset();
             auto llvm_context_holder{::std::move(llvm_ir_storage.llvm_context_holder)};
             auto llvm_module{::std::move(llvm_ir_storage.llvm_module)};
             llvm_ir_storage.emitted = false;
 
             if(llvm_context_holder == nullptr || llvm_module == nullptr) [[unlikely]] { return false; }
 
-            // Select and apply the native target before verification/optimization so data-layout-sensitive passes see
-            // the same target description used by MCJIT.
+            // Apply the session target before verification/optimization so data-layout-sensitive passes see the same
+            // target description used by MCJIT.
             auto const& target_config{get_llvm_jit_native_target_config()};
-            ::llvm::SmallVector<::llvm::StringRef, 16> host_target_attributes{};
-            append_llvm_jit_host_target_attribute_refs(target_config.feature_storage, host_target_attributes);
-
-            ::llvm::EngineBuilder target_builder{};
-            target_builder.setEngineKind(::llvm::EngineKind::JIT)
-                .setOptLevel(options.codegen_opt_level)
-                .setMCPU(all_details::get_llvm_string_ref(target_config.cpu_name))
-                .setMAttrs(host_target_attributes);
+            auto& target_machine{*session->target_machine};
 
-            ::uwvm2::utils::container::delete_owned_ptr<::llvm::TargetMachine> target_machine{target_builder.selectTarget()};
-            if(target_machine == nullptr) [[unlikely]] { return false; }
-            if(options.codegen_opt_level == ::llvm::CodeGenOptLevel::None) { target_machine->setFastISel(true); }
-
-            set_llvm_module_target_triple_from_machine(*llvm_module, *target_machine);
-            llvm_module->setDataLayout(target_machine->createDataLayout());
-            apply_llvm_jit_native_target_function_attrs(*llvm_module, target_config, *target_machine);
-            if(!optimize_lazy_llvm_jit_module(*llvm_module, *target_machine, options.codegen_opt_level, options.compile_options.verify_llvm_jit_ir))
+            set_llvm_module_target_triple_from_machine(*llvm_module, target_machine);
+            llvm_module->setDataLayout(target_machine.createDataLayout());
+            apply_llvm_jit_native_target_function_attrs(*llvm_module, target_config, target_machine);
+            if(!optimize_lazy_llvm_jit_module(*llvm_module, target_machine, options.codegen_opt_level, options.compile_options.verify_llvm_jit_ir))
                 [[unlikely]]
             {
                 return false;
@@ -1207,36 +1324,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             auto llvm_jit_cache_context{::uwvm2::runtime::llvm_jit_cache::default_cache_context(
                 ::uwvm2::utils::container::u8string_view{llvm_jit_cache_key.data(), llvm_jit_cache_key.size()},
                 ::uwvm2::utils::container::u8string_view{llvm_jit_cache_codegen_policy.data(), llvm_jit_cache_codegen_policy.size()},
-                *target_machine)};
+                target_machine)};
             llvm_jit_cache_context.cache_key_is_complete = true;
             ::uwvm2::runtime::llvm_jit_cache::llvm_jit_object_cache llvm_jit_object_cache{::std::move(llvm_jit_cache_context),
                                                                                           lazy_llvm_jit_object_cache_policy()};
 
-            auto raw_engine{
-                ::llvm::EngineBuilder(details::llvm_module_owner_t{llvm_module.release()})
-                    .setEngineKind(::llvm::EngineKind::JIT)
-                    .setOptLevel(options.codegen_opt_level)
-                    .setMCPU(all_details::get_llvm_string_ref(target_config.cpu_name))
-                    .setMAttrs(host_target_attributes)
-                    .setMCJITMemoryManager(llvm_jit_memory_manager_owner_t{
-                        ::uwvm2::utils::container::make_delete_owned<::uwvm2::runtime::compiler::llvm_jit::details::runtime_llvm_jit_section_memory_manager>()
-                            .release()})
-                    .create(target_machine.get())};
-            if(raw_engine == nullptr) [[unlikely]] { return false; }
-            static_cast<void>(target_machine.release());
-
-            ::uwvm2::utils::container::delete_owned_ptr<::llvm::ExecutionEngine> engine{raw_engine};
-
-            engine->setObjectCache(::std::addressof(llvm_jit_object_cache));
-            if(options.jit_event_listener != nullptr)
-            {
-                // Lazy group materialization can inline or split functions across one MCJIT object; keep DWARF metadata
-                // available to the listener so traps can recover the logical Wasm stack.
-                engine->setProcessAllSections(true);
-                engine->RegisterJITEventListener(options.jit_event_listener);
-            }
-            engine->finalizeObject();
-            engine->setObjectCache(nullptr);
+            auto const llvm_module_ptr{llvm_module.get()};
+            finalize_lazy_llvm_jit_session_module(*session, ::std::move(llvm_module), llvm_jit_object_cache, options.jit_event_listener);
+            auto& engine{*session->engine};
 
             auto const import_func_count{curr_module.imported_function_vec_storage.size()};
             using wasm_u32 = all_details::validation_module_traits_t::wasm_u32;
@@ -1251,8 +1346,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 auto const& runtime_func{curr_module.local_defined_function_vec_storage.index_unchecked(local_function_index)};
                 if(runtime_func.function_type_ptr == nullptr) [[unlikely]] { return false; }
                 auto const typed_entry_required{all_details::is_runtime_wasm_function_type_inline_llvm_jit_supported(*runtime_func.function_type_ptr)};
-                auto const entry_address{typed_entry_required ? resolve_llvm_function_address(*engine, function_name) : 0u};
-                auto const raw_entry_address{resolve_llvm_function_address(*engine, raw_function_name)};
+                auto const entry_address{typed_entry_required ? resolve_llvm_function_address(engine, function_name) : 0u};
+                auto const raw_entry_address{resolve_llvm_function_address(engine, raw_function_name)};
                 if(raw_entry_address == 0u || (typed_entry_required && entry_address == 0u)) [[unlikely]] { return false; }
 
                 auto& materialized{storage.materialized_functions.index_unchecked(local_function_index)};
@@ -1263,7 +1358,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 {
                     auto const reentry_function_name{
                         all_details::get_llvm_wasm_tiered_loop_reentry_raw_function_name(curr_module, function_index_u32, reentry.wasm_code_offset)};
-                    auto const reentry_address{resolve_llvm_function_address(*engine, reentry_function_name)};
+                    auto const reentry_address{resolve_llvm_function_address(engine, reentry_function_name)};
                     if(reentry_address == 0u) [[unlikely]] { return false; }
                     materialized.tiered_loop_reentry_raw_entry_addresses.push_back(reentry_address);
                 }
@@ -1271,18 +1366,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 materialized.raw_entry_address = raw_entry_address;
             }
 
-            // Store the shared LLVM owners on one record before publishing any member as ready.  Other records contain
-            // only addresses into the same engine, so the owner record must remain alive for as long as any grouped
-            // address can be called.
-            auto const owner_local_function_index{local_function_indices.front_unchecked()};
-            auto& owner{storage.materialized_functions.index_unchecked(owner_local_function_index)};
-            owner.llvm_context_holder = ::std::move(llvm_context_holder);
-            owner.llvm_jit_engine = ::std::move(engine);
+            // Every address is resolved, so the IR is no longer needed.  The native code stays in the session memory
+            // manager for the life of the process.
+            release_lazy_llvm_jit_session_module(*session, llvm_module_ptr, ::std::move(llvm_context_holder));
             for(auto const local_function_index: local_function_indices)
             {
                 auto& materialized{storage.materialized_functions.index_unchecked(local_function_index)};
-                // Release-publish after the shared owner has been installed.  This prevents a racing tiered probe from
-                // observing a callable address before the object lifetime anchor is stored in the lazy table.
+                // Release-publish after every grouped address has been stored, so a racing tiered probe never observes a
+                // partially filled record.
                 store_lazy_materialized_ready(materialized, true, ::std::memory_order_release);
             }
             return true;
@@ -1573,8 +1664,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                 }
                 emit_options.route_wasm_calls_through_runtime_bridge = !use_direct_wasm_calls_for_claimed_group;
                 llvm_jit_module_storage_t llvm_ir_storage{};
-                if(!all_details::try_prepare_runtime_llvm_jit_module_storage(curr_module, llvm_ir_storage, emit_options.emit_unwind_call_stack_frames))
-                    [[unlikely]]
+                if(!all_details::try_prepare_runtime_llvm_jit_module_storage(curr_module,
+                                                                             llvm_ir_storage,
+                                                                             emit_options.emit_unwind_call_stack_frames,
+                                                                             take_lazy_llvm_jit_context())) [[unlikely]]
                 {
                     ::fast_io::fast_terminate();
                 }
@@ -1622,7 +1715,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
         }
 
         // Single-function materialization path retained for direct internal use.  The public lazy compile entry normally
-        // uses the group path so direct callees can be warmed together.
+        // uses the group path so direct callees can be warmed together.  Like the group path, callers must hold
+        // `lazy_materialize_lock`, which also guards the shared JIT session and its context pool.
         inline constexpr void compile_lazy_local_function(runtime_module_storage_t const& curr_module,
                                                           lazy_module_storage_t& storage,
                                                           lazy_compile_options& options,
@@ -1642,7 +1736,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
             }
             emit_options.route_wasm_calls_through_runtime_bridge = true;
             llvm_jit_module_storage_t llvm_ir_storage{};
-            if(!all_details::try_prepare_runtime_llvm_jit_module_storage(curr_module, llvm_ir_storage, emit_options.emit_unwind_call_stack_frames)) [[unlikely]]
+            if(!all_details::try_prepare_runtime_llvm_jit_module_storage(curr_module,
+                                                                         llvm_ir_storage,
+                                                                         emit_options.emit_unwind_call_stack_frames,
+                                                                         take_lazy_llvm_jit_context())) [[unlikely]]
             {
                 ::fast_io::fast_terminate();
             }
@@ -1754,6 +1851,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::llvm_jit::compile_cu_from
                                        ctx->compile_unit_index,
                                        u8" state=",
                                        compile_state_name(fn.materialization_state.state.load(::std::memory_order_acquire)),
+                                       u8" session_modules=",
+                                       lazy_llvm_jit_session_module_count(ctx->options.codegen_opt_level),
                                        u8" time=",
                                        compile_end_time - compile_start_time);
             }
@@ -303,6 +303,15 @@ case wasm1_code::call:
         }
     }
 
+    // Same-module local callees on the spilled path can stay inside the dispatch chain (see `uwvmint_call_frameless`). The runtime only
+    // requests this for eager translation, where every callee body exists before the first call executes.
+    [[maybe_unused]] bool use_frameless_call{};
+    if constexpr(CompileOption.is_tail_call)
+    {
+        use_frameless_call = options.frameless_local_calls && call_module_id == SIZE_MAX && func_index_uz >= import_func_count &&
+                             !use_stacktop_call_fast && !use_stacktop_call0_void_fast;
+    }
+
     // Translate: `call` bridge (module_id + function_index).
     namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
     bool fuse_call_drop{};
@@ -346,8 +355,9 @@ case wasm1_code::call:
                 }
             }
         }
-        else
+        else if(!use_frameless_call)
         {
+            // Fused call opfuncs always go through the bridge; a frameless call saves more than the fused dispatch would.
             wasm1_code next_op;  // no init
             ::std::memcpy(::std::addressof(next_op), code_curr, sizeof(next_op));
 
@@ -833,9 +843,23 @@ case wasm1_code::call:
     else
 #endif
     {
-        emit_opfunc_to(bytecode, translate::get_uwvmint_call_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
-        emit_imm_to(bytecode, call_module_id);
-        emit_imm_to(bytecode, call_function_imm);
+        bool emitted_frameless_call{};
+        if constexpr(CompileOption.is_tail_call)
+        {
+            if(use_frameless_call)
+            {
+                emit_opfunc_to(bytecode, translate::get_uwvmint_call_frameless_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+                emit_imm_to(bytecode, call_function_imm);
+                emitted_frameless_call = true;
+            }
+        }
+
+        if(!emitted_frameless_call)
+        {
+            emit_opfunc_to(bytecode, translate::get_uwvmint_call_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+            emit_imm_to(bytecode, call_module_id);
+            emit_imm_to(bytecode, call_function_imm);
+        }
     }
 
     // Update the validation operand stack after the `call` is encoded.
@@ -1127,7 +1151,7 @@ case wasm1_code::call_indirect:
         }
     }
 
-    // Translate: `call_indirect` bridge (module_id + type_index + table_index).
+    // Translate: `call_indirect` bridge (module_id + type_index + table_index + a zeroed per-site inline cache reservation).
     namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
     auto const emit_call_indirect_normal{
         [&]() constexpr noexcept
@@ -1136,6 +1160,7 @@ case wasm1_code::call_indirect:
             emit_imm_to(bytecode, options.curr_wasm_id);
             emit_imm_to(bytecode, static_cast<::std::size_t>(type_index));
             emit_imm_to(bytecode, static_cast<::std::size_t>(table_index));
+            emit_imm_to(bytecode, ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_stream_t{});
         }};
 #ifdef UWVM_ENABLE_UWVM_INT_COMBINE_OPS
     if constexpr(CompileOption.is_tail_call)
@@ -1282,6 +1307,7 @@ case wasm1_code::call_indirect:
             emit_imm_to(bytecode, options.curr_wasm_id);
             emit_imm_to(bytecode, static_cast<::std::size_t>(type_index));
             emit_imm_to(bytecode, static_cast<::std::size_t>(table_index));
+            emit_imm_to(bytecode, ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_stream_t{});
             if(fuse_call_indirect_local_set) { emit_imm_to(bytecode, fused_local_off); }
         }
         else
@@ -238,6 +238,19 @@ case wasm1_code::loop:
                  }
              }
 #endif
+             // Fuel is charged after the OSR poll, so an iteration that transfers to the LLVM tier is charged only there.
+             if(options.fuel_counter != nullptr && !is_polymorphic)
+             {
+                 namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
+                 emit_opfunc_to(bytecode, translate::get_uwvmint_fuel_charge_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+                 emit_imm(options.fuel_counter);
+             }
+             if(options.epoch_interrupt != nullptr && !is_polymorphic)
+             {
+                 namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
+                 emit_opfunc_to(bytecode, translate::get_uwvmint_epoch_check_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+                 emit_imm(options.epoch_interrupt);
+             }
              return loop_start;
          }()};
 
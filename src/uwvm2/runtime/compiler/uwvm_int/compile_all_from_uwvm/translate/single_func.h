@@ -326,32 +326,6 @@ namespace details
         return validation_module;
     }
 
-    inline constexpr void validate_runtime_module_with_standard_wasm1p1_validator(
-        ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& curr_module,
-        ::uwvm2::validation::error::code_validation_error_impl& err,
-        parser_feature_parameter_t const* wasm_feature_parameter) UWVM_THROWS
-    {
-        parser_feature_parameter_t const default_wasm_feature_parameter{};
-        auto const& effective_wasm_feature_parameter{wasm_feature_parameter == nullptr ? default_wasm_feature_parameter : *wasm_feature_parameter};
-        auto const validation_module{build_runtime_validation_module(curr_module)};
-        auto const import_func_count{curr_module.imported_function_vec_storage.size()};
-
-        for(::std::size_t local_function_idx{}; local_function_idx != curr_module.local_defined_function_vec_storage.size(); ++local_function_idx)
-        {
-            auto const& local_func{curr_module.local_defined_function_vec_storage.index_unchecked(local_function_idx)};
-            if(local_func.wasm_code_ptr == nullptr) [[unlikely]] { runtime_storage_bug(); }
-            auto const code_begin{reinterpret_cast<::std::byte const*>(local_func.wasm_code_ptr->body.expr_begin)};
-            auto const code_end{reinterpret_cast<::std::byte const*>(local_func.wasm_code_ptr->body.code_end)};
-            ::uwvm2::validation::standard::wasm1p1::validate_code(::uwvm2::validation::standard::wasm1p1::wasm1p1_code_version{},
-                                                                  validation_module,
-                                                                  import_func_count + local_function_idx,
-                                                                  code_begin,
-                                                                  code_end,
-                                                                  err,
-                                                                  effective_wasm_feature_parameter);
-        }
-    }
-
     struct local_function_task_group
     {
         ::std::size_t begin_index{};
@@ -439,6 +413,139 @@ namespace details
         return task_groups;
     }
 
+    inline constexpr void validate_runtime_local_func_range_with_standard_wasm1p1_validator(
+        ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& curr_module,
+        validation_module_storage_t const& validation_module,
+        local_function_task_group task_group,
+        ::uwvm2::validation::error::code_validation_error_impl& err,
+        parser_feature_parameter_t const& wasm_feature_parameter) UWVM_THROWS
+    {
+        auto const import_func_count{curr_module.imported_function_vec_storage.size()};
+
+        for(::std::size_t local_function_idx{task_group.begin_index}; local_function_idx != task_group.end_index; ++local_function_idx)
+        {
+            auto const& local_func{curr_module.local_defined_function_vec_storage.index_unchecked(local_function_idx)};
+            if(local_func.wasm_code_ptr == nullptr) [[unlikely]] { runtime_storage_bug(); }
+            auto const code_begin{reinterpret_cast<::std::byte const*>(local_func.wasm_code_ptr->body.expr_begin)};
+            auto const code_end{reinterpret_cast<::std::byte const*>(local_func.wasm_code_ptr->body.code_end)};
+            ::uwvm2::validation::standard::wasm1p1::validate_code(::uwvm2::validation::standard::wasm1p1::wasm1p1_code_version{},
+                                                                  validation_module,
+                                                                  import_func_count + local_function_idx,
+                                                                  code_begin,
+                                                                  code_end,
+                                                                  err,
+                                                                  wasm_feature_parameter);
+        }
+    }
+
+    inline constexpr void validate_runtime_module_with_standard_wasm1p1_validator(
+        ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& curr_module,
+        ::uwvm2::validation::error::code_validation_error_impl& err,
+        parser_feature_parameter_t const* wasm_feature_parameter) UWVM_THROWS
+    {
+        parser_feature_parameter_t const default_wasm_feature_parameter{};
+        auto const& effective_wasm_feature_parameter{wasm_feature_parameter == nullptr ? default_wasm_feature_parameter : *wasm_feature_parameter};
+        auto const validation_module{build_runtime_validation_module(curr_module)};
+
+        validate_runtime_local_func_range_with_standard_wasm1p1_validator(
+            curr_module,
+            validation_module,
+            {.begin_index = 0uz, .end_index = curr_module.local_defined_function_vec_storage.size()},
+            err,
+            effective_wasm_feature_parameter);
+    }
+
+    struct parallel_validation_task_group_result
+    {
+        // Every task group owns its diagnostic so the caller can always report the lowest failing function index,
+        // independent of which worker happened to fail first.
+        ::uwvm2::validation::error::code_validation_error_impl err{};
+#ifdef UWVM_CPP_EXCEPTIONS
+        ::std::exception_ptr exception{};
+#endif
+    };
+
+    inline ::uwvm2::utils::thread::scheduled_task
+        make_validate_runtime_local_func_group_task(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& curr_module,
+                                                    validation_module_storage_t const& validation_module,
+                                                    local_function_task_group task_group,
+                                                    ::std::size_t task_group_index,
+                                                    parallel_validation_task_group_result& result,
+                                                    ::std::atomic_size_t& first_failed_task_group_index,
+                                                    parser_feature_parameter_t const& wasm_feature_parameter) noexcept
+    {
+        // Groups after an already failed group cannot hold the reported (lowest-index) failure.
+        if(first_failed_task_group_index.load(::std::memory_order_acquire) < task_group_index) { co_return; }
+
+#ifdef UWVM_CPP_EXCEPTIONS
+        try
+#endif
+        {
+            validate_runtime_local_func_range_with_standard_wasm1p1_validator(curr_module, validation_module, task_group, result.err, wasm_feature_parameter);
+        }
+#ifdef UWVM_CPP_EXCEPTIONS
+        catch(...)
+        {
+            result.exception = ::std::current_exception();
+            ::uwvm2::utils::thread::atomic_store_min_index(first_failed_task_group_index, task_group_index);
+        }
+#endif
+
+        co_return;
+    }
+
+    inline constexpr void validate_runtime_module_with_standard_wasm1p1_validator(
+        ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& curr_module,
+        ::uwvm2::validation::error::code_validation_error_impl& err,
+        parser_feature_parameter_t const* wasm_feature_parameter,
+        ::uwvm2::utils::container::vector<local_function_task_group> const& task_groups,
+        ::std::size_t extra_compile_threads) UWVM_THROWS
+    {
+        // Parallel whole-module validation reuses the translation task groups and worker budget. It still runs to
+        // completion before any translation starts, so translators keep seeing only validated bodies.
+        extra_compile_threads = ::uwvm2::utils::thread::clamp_extra_worker_count(task_groups.size(), extra_compile_threads);
+        if(extra_compile_threads == 0uz)
+        {
+            validate_runtime_module_with_standard_wasm1p1_validator(curr_module, err, wasm_feature_parameter);
+            return;
+        }
+
+        parser_feature_parameter_t const default_wasm_feature_parameter{};
+        auto const& effective_wasm_feature_parameter{wasm_feature_parameter == nullptr ? default_wasm_feature_parameter : *wasm_feature_parameter};
+        auto const validation_module{build_runtime_validation_module(curr_module)};
+
+        ::uwvm2::utils::container::vector<parallel_validation_task_group_result> results{};
+        results.resize(task_groups.size());
+        ::std::atomic_size_t first_failed_task_group_index{::std::numeric_limits<::std::size_t>::max()};
+
+        ::uwvm2::utils::thread::scheduled_task_batch task_batch{task_groups.size()};
+        for(::std::size_t task_group_index{}; task_group_index != task_groups.size(); ++task_group_index)
+        {
+            auto task{make_validate_runtime_local_func_group_task(curr_module,
+                                                                  validation_module,
+                                                                  task_groups.index_unchecked(task_group_index),
+                                                                  task_group_index,
+                                                                  results.index_unchecked(task_group_index),
+                                                                  first_failed_task_group_index,
+                                                                  effective_wasm_feature_parameter)};
+            ::std::construct_at(task_batch.handles.buffer + task_batch.handle_count, task.release());
+            ++task_batch.handle_count;
+        }
+
+        ::uwvm2::utils::thread::native_thread_pool thread_pool{};
+        thread_pool.run(task_batch, extra_compile_threads);
+
+#ifdef UWVM_CPP_EXCEPTIONS
+        auto const failed_task_group_index{first_failed_task_group_index.load(::std::memory_order_acquire)};
+        if(failed_task_group_index != ::std::numeric_limits<::std::size_t>::max())
+        {
+            auto& result{results.index_unchecked(failed_task_group_index)};
+            err = result.err;
+            ::std::rethrow_exception(result.exception);
+        }
+#endif
+    }
+
     [[nodiscard]] inline constexpr ::std::size_t calculate_total_local_function_task_weight(
         ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& curr_module,
         ::uwvm2::runtime::compiler::uwvm_int::compile_all_from_uwvm::compile_task_split_policy_t split_policy) noexcept
@@ -707,12 +814,13 @@ inline constexpr ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter
 
     auto const local_func_count{curr_module.local_defined_function_vec_storage.size()};
     details::initialize_local_defined_call_info(curr_module, options, storage);
-    details::validate_runtime_module_with_standard_wasm1p1_validator(curr_module, err, wasm_feature_parameter);
 
     split_config = resolve_effective_compile_task_split_config(curr_module, split_config, extra_compile_threads);
 
     if(details::should_run_local_functions_serially(curr_module, split_config, extra_compile_threads))
     {
+        details::validate_runtime_module_with_standard_wasm1p1_validator(curr_module, err, wasm_feature_parameter);
+
         for(::std::size_t local_function_idx{}; local_function_idx != local_func_count; ++local_function_idx)
         {
             details::compile_all_from_uwvm_local_func<CompileOption>(curr_module, options, storage, local_function_idx, wasm_feature_parameter, err);
@@ -733,6 +841,9 @@ inline constexpr ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter
     auto const task_groups{details::build_local_function_task_groups(curr_module, split_config)};
     auto const effective_extra_compile_threads{::uwvm2::utils::thread::clamp_extra_worker_count(task_groups.size(), extra_compile_threads)};
 
+    // Whole-module validation fans out over the same task groups; a failure reports the lowest failing function index.
+    details::validate_runtime_module_with_standard_wasm1p1_validator(curr_module, err, wasm_feature_parameter, task_groups, effective_extra_compile_threads);
+
     if(effective_extra_compile_threads == 0uz)
     {
         for(auto const& task_group: task_groups)
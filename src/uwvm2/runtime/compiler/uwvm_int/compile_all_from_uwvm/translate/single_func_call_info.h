@@ -77,9 +77,11 @@ if(local_func_count != 0uz)
         // Look for tiny canonical function bodies that can be executed directly by the call bridge
         // without entering the translated interpreter body. The matcher only reports bytecode shape;
         // the signature checks below prove that the matched body is ABI-compatible with the function type.
+        // `--runtime-fuel` charges every function entry inside the translated body, which the fast path never enters, so metered code
+        // publishes no descriptor and every call runs the body.
         auto const m{details::match_trivial_call_inline_body(curr_module.local_defined_function_vec_storage.index_unchecked(i).wasm_code_ptr)};
         using trivial_kind_t = ::uwvm2::runtime::compiler::uwvm_int::optable::trivial_defined_call_kind;
-        if(m.kind != trivial_kind_t::none)
+        if(m.kind != trivial_kind_t::none && options.fuel_counter == nullptr)
         {
             // Cache signature arity and a narrow type predicate to keep each fast-path guard explicit.
             auto const param_n{static_cast<::std::size_t>(ft->parameter.end - ft->parameter.begin)};
@@ -13,8 +13,10 @@ bool const runtime_uwvm_int_opcode_conbination_enabled{
 [[maybe_unused]] bool const runtime_uwvm_int_opcode_conbination_soft_enabled{runtime_uwvm_int_opcode_conbination_enabled};
 [[maybe_unused]] bool const runtime_uwvm_int_opcode_conbination_heavy_enabled{
     runtime_uwvm_int_opcode_conbination_level_at_least(runtime_uwvm_int_opcode_conbination_level, runtime_uwvm_int_opcode_conbination_level_t::heavy)};
+// Extra-level `*_loop_run` fusions execute whole loops inside one opfunc and would skip the per-iteration fuel charge and epoch check.
 [[maybe_unused]] bool const runtime_uwvm_int_opcode_conbination_extra_enabled{
-    runtime_uwvm_int_opcode_conbination_level_at_least(runtime_uwvm_int_opcode_conbination_level, runtime_uwvm_int_opcode_conbination_level_t::extra)};
+    runtime_uwvm_int_opcode_conbination_level_at_least(runtime_uwvm_int_opcode_conbination_level, runtime_uwvm_int_opcode_conbination_level_t::extra) &&
+    options.fuel_counter == nullptr && options.epoch_interrupt == nullptr};
 [[maybe_unused]] bool const runtime_uwvm_int_delay_local_enabled{runtime_uwvm_int_opcode_conbination_enabled &&
                                                                  !::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_disable_delay_local};
 [[maybe_unused]] bool const runtime_uwvm_int_instruction_reorder_enabled{
@@ -26,7 +28,8 @@ bool const runtime_uwvm_int_opcode_conbination_enabled{
 };
 [[maybe_unused]] bool const runtime_uwvm_int_loop_unwind_enabled{
 #if defined(UWVM_ENABLE_UWVM_INT_LOOP_UNWIND)
-    !::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_disable_loop_unwind
+    // Unwound iterations replay the body without passing the loop header, so fuel metering and epoch checks keep loops rolled.
+    !::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_disable_loop_unwind && options.fuel_counter == nullptr && options.epoch_interrupt == nullptr
 #else
     false
 #endif
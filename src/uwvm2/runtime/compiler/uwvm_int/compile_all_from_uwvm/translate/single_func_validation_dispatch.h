@@ -4522,6 +4522,21 @@ auto const translate_one_opcode{
         }
     }};
 
+// `--runtime-fuel`: every function entry costs one unit, charged before the first translated opcode.
+if(options.fuel_counter != nullptr)
+{
+    namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
+    emit_opfunc_to(bytecode, translate::get_uwvmint_fuel_charge_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+    emit_imm(options.fuel_counter);
+}
+// `--wasm-timeout`: the epoch flag is checked at the same sites as the fuel charge.
+if(options.epoch_interrupt != nullptr)
+{
+    namespace translate = ::uwvm2::runtime::compiler::uwvm_int::optable::translate;
+    emit_opfunc_to(bytecode, translate::get_uwvmint_epoch_check_fptr_from_tuple<CompileOption>(curr_stacktop, interpreter_tuple));
+    emit_imm(options.epoch_interrupt);
+}
+
 // Main validation/translation loop. Each iteration consumes exactly one Wasm opcode plus its
 // immediates and delegates semantic handling to the opcode include fragments above.
 for(;;)
@@ -79,6 +79,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         UWVM_GNU_HOT inline constexpr void call_indirect(::std::size_t curr_module_id,
                                                          ::std::size_t type_index,
                                                          ::std::size_t table_index,
+                                                         ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t* inline_cache,
                                                          ::std::byte** uwvm_int_operand_stack_top_ptr) UWVM_THROWS
         {
             if(::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_func == nullptr) [[unlikely]]
@@ -89,7 +90,122 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                 ::fast_io::fast_terminate();
             }
 
-            ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_func(curr_module_id, type_index, table_index, uwvm_int_operand_stack_top_ptr);
+            ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_func(curr_module_id,
+                                                                              type_index,
+                                                                              table_index,
+                                                                              inline_cache,
+                                                                              uwvm_int_operand_stack_top_ptr);
+        }
+
+        /// @brief Locates the per-site inline cache slot that follows `table_index` and advances the bytecode pointer past its reservation.
+        /// @details
+        /// - Bytecode layout: `[... table_index][call_indirect_inline_cache_stream_bytes][...]`; the slot is the first naturally aligned
+        ///   `call_indirect_inline_cache_t` inside the reservation.
+        /// @note The code page is only viewed through `std::byte const*`; the underlying buffer is mutable and owned by the compiled function.
+        UWVM_ALWAYS_INLINE inline constexpr ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t*
+            take_call_indirect_inline_cache(::std::byte const*& ip) noexcept
+        {
+            using inline_cache_t = ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t;
+            constexpr ::std::uintptr_t align_mask{alignof(inline_cache_t) - 1u};
+            auto const slot_addr{(reinterpret_cast<::std::uintptr_t>(ip) + align_mask) & ~align_mask};
+            ip += ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_stream_bytes;
+            return reinterpret_cast<inline_cache_t*>(slot_addr);
+        }
+
+        /// @brief Callee frame produced by `enter_frameless_call`; `ip == nullptr` means the call must go through the bridge instead.
+        struct frameless_call_frame_t
+        {
+            ::std::byte const* ip{};
+            ::std::byte* stack_top{};
+            ::std::byte* local_base{};
+        };
+
+        /// @brief Builds the callee frame on the per-thread frameless stack and records how to resume the caller.
+        /// @details
+        /// - Frame layout matches the runtime bridge: params copied into the locals, the Wasm-visible remainder zeroed, then a 16-byte aligned
+        ///   operand stack sized by the compiler. Locals take at least one byte so every live frame has a distinct `local_base`.
+        /// - Trivial callees, missing metadata and a full stack decline (`ip == nullptr`); the caller then uses `details::call`.
+        UWVM_ALWAYS_INLINE inline frameless_call_frame_t
+            enter_frameless_call([[maybe_unused]] ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const& info,
+                                 [[maybe_unused]] ::std::byte const* resume_ip,
+                                 [[maybe_unused]] ::std::byte* caller_stack_top,
+                                 [[maybe_unused]] ::std::byte* caller_local_base) noexcept
+        {
+# if defined(UWVM_USE_THREAD_LOCAL)
+            auto& fs{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+            auto const cf{info.compiled_func};
+            if(info.trivial_kind != ::uwvm2::runtime::compiler::uwvm_int::optable::trivial_defined_call_kind::none || cf == nullptr ||
+               fs.records_curr == fs.records_end) [[unlikely]]
+            {
+                return {};
+            }
+
+            constexpr ::std::uintptr_t kFrameAlignMask{15u};
+            ::std::size_t const local_n{cf->local_bytes_max == 0uz ? 1uz : cf->local_bytes_max};
+            ::std::size_t const stack_cap{cf->operand_stack_byte_max};
+            auto const avail{static_cast<::std::size_t>(fs.region_end - fs.region_curr)};
+            // `region_curr` is kept 16-byte aligned, so the worst case is the locals, one alignment pad and the operand stack.
+            if(local_n > avail || stack_cap > avail - local_n || kFrameAlignMask > avail - local_n - stack_cap) [[unlikely]] { return {}; }
+
+#  if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            if(info.param_bytes > cf->local_bytes_zeroinit_end || cf->local_bytes_zeroinit_end > cf->local_bytes_max || stack_cap < info.result_bytes)
+                [[unlikely]]
+            {
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+            }
+#  endif
+
+            auto const frame_begin{fs.region_curr};
+            auto const local_base{frame_begin};
+            auto const caller_args_begin{caller_stack_top - info.param_bytes};
+            if(info.param_bytes != 0uz) { ::std::memcpy(local_base, caller_args_begin, info.param_bytes); }
+            auto const zero_n{cf->local_bytes_zeroinit_end - info.param_bytes};
+            if(zero_n != 0uz) { ::std::memset(local_base + info.param_bytes, 0, zero_n); }
+
+            auto const operand_base{reinterpret_cast<::std::byte*>((reinterpret_cast<::std::uintptr_t>(local_base + local_n) + kFrameAlignMask) &
+                                                                   ~kFrameAlignMask)};
+            fs.region_curr =
+                reinterpret_cast<::std::byte*>((reinterpret_cast<::std::uintptr_t>(operand_base + stack_cap) + kFrameAlignMask) & ~kFrameAlignMask);
+
+            ::std::construct_at(fs.records_curr,
+                                ::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_record_t{.resume_ip = resume_ip,
+                                                                                                      .caller_stack_top = caller_args_begin,
+                                                                                                      .caller_local_base = caller_local_base,
+                                                                                                      .callee_local_base = local_base,
+                                                                                                      .frame_begin = frame_begin,
+                                                                                                      .callee_info = ::std::addressof(info)});
+            ++fs.records_curr;
+
+            return {.ip = cf->op.operands.data(), .stack_top = operand_base, .local_base = local_base};
+# else
+            return {};
+# endif
+        }
+
+        /// @brief Pops the frameless record owned by the returning function, if any.
+        /// @details Returns the caller frame to resume with the results already appended to the caller's operand stack, or `ip == nullptr`
+        ///          when the returning function was entered through the native bridge and must return natively.
+        UWVM_ALWAYS_INLINE inline frameless_call_frame_t leave_frameless_call([[maybe_unused]] ::std::byte* callee_stack_top,
+                                                                              [[maybe_unused]] ::std::byte* callee_local_base) noexcept
+        {
+# if defined(UWVM_USE_THREAD_LOCAL)
+            auto& fs{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+            if(fs.records_curr == fs.records_begin) { return {}; }
+            auto const rec{fs.records_curr - 1};
+            // Bridge-entered frames live in native/scratch memory, never in the frameless region, so they cannot match the top record; the
+            // records the runtime pushes for them in unwind call-stack mode carry a null local base for the same reason.
+            if(rec->callee_local_base != callee_local_base) { return {}; }
+
+            auto const result_bytes{rec->callee_info->result_bytes};
+            if(result_bytes != 0uz) { ::std::memcpy(rec->caller_stack_top, callee_stack_top - result_bytes, result_bytes); }
+
+            frameless_call_frame_t const caller{.ip = rec->resume_ip, .stack_top = rec->caller_stack_top + result_bytes, .local_base = rec->caller_local_base};
+            fs.region_curr = rec->frame_begin;
+            fs.records_curr = rec;
+            return caller;
+# else
+            return {};
+# endif
         }
     }  // namespace details
 
@@ -145,11 +261,64 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         UWVM_MUSTTAIL return next_interpreter(type...);
     }
 
+    /// @brief `call` opcode for a same-module local callee (tail-call): enters the callee without leaving the threaded code.
+    /// @details
+    /// - Stack-top optimization: same as `uwvmint_call`; the translator spills every cached value first, so the stack-top slots are dead
+    ///   across the call and the callee may reuse them.
+    /// - `type[0]` layout: `[opfunc_ptr][call_info][next_opfunc_ptr]`, where `call_info` is a `compiled_defined_call_info const*`.
+    /// @note The callee frame is pushed on the per-thread frameless stack and control tail-calls the callee's first opfunc; its `return`
+    ///       resumes at `next_opfunc_ptr` (see `details::leave_frameless_call`). When the frame cannot be built here the call goes through the
+    ///       bridge exactly like `uwvmint_call` with the `SIZE_MAX` module sentinel.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+        requires (CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_call_frameless(Type... type) UWVM_THROWS
+    {
+        static_assert(sizeof...(Type) >= 3uz);
+        static_assert(::std::same_as<Type...[0u], ::std::byte const*>);
+        static_assert(::std::same_as<Type...[1u], ::std::byte*>);
+        static_assert(::std::same_as<Type...[2u], ::std::byte*>);
+
+        type...[0] += sizeof(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...>);
+
+        ::std::size_t call_function;  // no init
+        ::std::memcpy(::std::addressof(call_function), type...[0], sizeof(call_function));
+
+        type...[0] += sizeof(call_function);
+
+        // curr_uwvmint_call_frameless call_info next_op
+        // safe
+        //                                       ^^ type...[0]
+
+        auto const& info{*reinterpret_cast<::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const*>(call_function)};
+        auto const callee{details::enter_frameless_call(info, type...[0], type...[1], type...[2])};
+
+        if(callee.ip == nullptr) [[unlikely]]
+        {
+            details::call(SIZE_MAX, call_function, ::std::addressof(type...[1]));
+
+            ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
+            ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
+
+            UWVM_MUSTTAIL return next_interpreter(type...);
+        }
+
+        type...[0] = callee.ip;
+        type...[1] = callee.stack_top;
+        type...[2] = callee.local_base;
+
+        ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...> callee_interpreter;  // no init
+        ::std::memcpy(::std::addressof(callee_interpreter), type...[0], sizeof(callee_interpreter));
+
+        UWVM_MUSTTAIL return callee_interpreter(type...);
+    }
+
     /// @brief `call_indirect` opcode (tail-call): calls a function through a table entry and then tail-calls the next interpreter op.
     /// @details
     /// - Stack-top optimization: requires all arguments (and the table index operand) to reside in the operand stack memory. When stack-top caching is enabled,
     ///   the compiler must emit stack-top spills so `type...[1u]` points at the full operand stack before executing `call_indirect`.
-    /// - `type[0]` layout: `[opfunc_ptr][curr_module_id][type_index][table_index][next_opfunc_ptr]`.
+    /// - `type[0]` layout: `[opfunc_ptr][curr_module_id][type_index][table_index][inline_cache][next_opfunc_ptr]`, where `inline_cache` is the
+    ///   per-site slot reservation read by `details::take_call_indirect_inline_cache`.
     /// @note The actual bounds/null/type checks are performed by `call_indirect_func` provided by the runtime.
     template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
               ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
@@ -173,7 +342,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         ::std::memcpy(::std::addressof(table_index), type...[0], sizeof(table_index));
         type...[0] += sizeof(table_index);
 
-        details::call_indirect(curr_module_id, type_index, table_index, ::std::addressof(type...[1]));
+        auto const inline_cache{details::take_call_indirect_inline_cache(type...[0])};
+
+        details::call_indirect(curr_module_id, type_index, table_index, inline_cache, ::std::addressof(type...[1]));
 
         ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
         ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
@@ -236,7 +407,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
     /// @brief `call_indirect` opcode (non-tail-call/byref): advances `typeref...[0]` and triggers the indirect call.
     /// @details
     /// - Stack-top optimization: not supported.
-    /// - `type[0]` layout: `[opfunc_ptr][curr_module_id][type_index][table_index][next_opfunc_ptr]`; after execution `typeref...[0]` points at
+    /// - `type[0]` layout: `[opfunc_ptr][curr_module_id][type_index][table_index][inline_cache][next_opfunc_ptr]`; after execution `typeref...[0]` points at
     ///   `next_opfunc_ptr`.
     template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
               ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeRef>
@@ -265,7 +436,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         ::std::memcpy(::std::addressof(table_index), typeref...[0], sizeof(table_index));
         typeref...[0] += sizeof(table_index);
 
-        details::call_indirect(curr_module_id, type_index, table_index, ::std::addressof(typeref...[1]));
+        auto const inline_cache{details::take_call_indirect_inline_cache(typeref...[0])};
+
+        details::call_indirect(curr_module_id, type_index, table_index, inline_cache, ::std::addressof(typeref...[1]));
     }
 
     namespace translate
@@ -295,6 +468,23 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
                                              ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
         { return get_uwvmint_call_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
 
+        /// @brief Translator: returns the interpreter function pointer for the frameless local `call` (tail-call only).
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_t<Type...>
+            get_uwvmint_call_frameless_fptr(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return uwvmint_call_frameless<CompileOption, Type...>; }
+
+        /// @brief Translator: infers types from a tuple and returns the frameless local `call` function pointer (tail-call only).
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (CompileOption.is_tail_call)
+        inline constexpr auto
+            get_uwvmint_call_frameless_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                       ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_call_frameless_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
+
         /// @brief Translator: returns the interpreter function pointer for `call_indirect` (tail-call).
         template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
                   ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
@@ -2277,7 +2277,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
      * - The callee signature is `(i32 x ParamCount) -> RetT` (RetT = `void` or `wasm_i32`).
      * - The selector index (i32) is on the stack-top above the params.
      *
-     * Bytecode layout: `[opfunc_ptr][curr_module_id][type_index][table_index][next_opfunc_ptr]`.
+     * Bytecode layout: `[opfunc_ptr][curr_module_id][type_index][table_index][inline_cache][next_opfunc_ptr]`.
      */
     template <uwvm_interpreter_translate_option_t CompileOption,
               ::std::size_t curr_i32_stack_top,
@@ -2315,6 +2315,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         ::std::memcpy(::std::addressof(table_index), type...[0], sizeof(table_index));
         type...[0] += sizeof(table_index);
 
+        auto const inline_cache{details::take_call_indirect_inline_cache(type...[0])};
+
         // Scratch operand stack for the call_indirect bridge: [params..., selector].
         constexpr ::std::size_t param_bytes{ParamCount * sizeof(wasm_i32)};
         constexpr ::std::size_t selector_bytes{sizeof(wasm_i32)};
@@ -2333,7 +2335,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         wasm_i32 const selector{get_curr_val_from_operand_stack_top<CompileOption, wasm_i32, curr_i32_stack_top>(type...)};
         ::std::memcpy(scratch.data() + param_bytes, ::std::addressof(selector), sizeof(selector));
 
-        details::call_indirect(curr_module_id, type_index, table_index, ::std::addressof(scratch_top));
+        details::call_indirect(curr_module_id, type_index, table_index, inline_cache, ::std::addressof(scratch_top));
 
         if constexpr(!::std::is_void_v<RetT>)
         {
@@ -2357,7 +2359,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
      * @details
      * Net stack effect: pop (ParamCount + selector).
      *
-     * Bytecode layout: `[opfunc_ptr][curr_module_id][type_index][table_index][next_opfunc_ptr]`.
+     * Bytecode layout: `[opfunc_ptr][curr_module_id][type_index][table_index][inline_cache][next_opfunc_ptr]`.
      */
     template <uwvm_interpreter_translate_option_t CompileOption, ::std::size_t curr_i32_stack_top, ::std::size_t ParamCount, uwvm_int_stack_top_type... Type>
         requires (CompileOption.is_tail_call)
@@ -2387,6 +2389,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         ::std::memcpy(::std::addressof(table_index), type...[0], sizeof(table_index));
         type...[0] += sizeof(table_index);
 
+        auto const inline_cache{details::take_call_indirect_inline_cache(type...[0])};
+
         constexpr ::std::size_t param_bytes{ParamCount * sizeof(wasm_i32)};
         constexpr ::std::size_t selector_bytes{sizeof(wasm_i32)};
         constexpr ::std::size_t arg_bytes{param_bytes + selector_bytes};
@@ -2401,7 +2405,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         wasm_i32 const selector{get_curr_val_from_operand_stack_top<CompileOption, wasm_i32, curr_i32_stack_top>(type...)};
         ::std::memcpy(scratch.data() + param_bytes, ::std::addressof(selector), sizeof(selector));
 
-        details::call_indirect(curr_module_id, type_index, table_index, ::std::addressof(scratch_top));
+        details::call_indirect(curr_module_id, type_index, table_index, inline_cache, ::std::addressof(scratch_top));
 
         uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
         ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
@@ -2414,7 +2418,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
      * @details
      * Net stack effect: pop (ParamCount + selector) (result is consumed by local.set).
      *
-     * Bytecode layout: `[opfunc_ptr][curr_module_id][type_index][table_index][local_offset][next_opfunc_ptr]`.
+     * Bytecode layout: `[opfunc_ptr][curr_module_id][type_index][table_index][inline_cache][local_offset][next_opfunc_ptr]`.
      */
     template <uwvm_interpreter_translate_option_t CompileOption, ::std::size_t curr_i32_stack_top, ::std::size_t ParamCount, uwvm_int_stack_top_type... Type>
         requires (CompileOption.is_tail_call)
@@ -2445,6 +2449,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         ::std::memcpy(::std::addressof(table_index), type...[0], sizeof(table_index));
         type...[0] += sizeof(table_index);
 
+        auto const inline_cache{details::take_call_indirect_inline_cache(type...[0])};
+
         auto const local_off{conbine_details::read_imm<conbine_details::local_offset_t>(type...[0])};
 
         constexpr ::std::size_t param_bytes{ParamCount * sizeof(wasm_i32)};
@@ -2459,7 +2465,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         wasm_i32 const selector{get_curr_val_from_operand_stack_top<CompileOption, wasm_i32, curr_i32_stack_top>(type...)};
         ::std::memcpy(scratch.data() + param_bytes, ::std::addressof(selector), sizeof(selector));
 
-        details::call_indirect(curr_module_id, type_index, table_index, ::std::addressof(scratch_top));
+        details::call_indirect(curr_module_id, type_index, table_index, inline_cache, ::std::addressof(scratch_top));
 
         wasm_i32 out;  // no init
         ::std::memcpy(::std::addressof(out), scratch.data(), sizeof(out));
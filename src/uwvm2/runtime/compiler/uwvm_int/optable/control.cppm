@@ -43,6 +43,7 @@ import uwvm2.parser.wasm.standard.wasm1;
 import uwvm2.object;
 import :define;
 import :storage;
+import :call;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -44,6 +44,7 @@
 # include <uwvm2/utils/thread/impl.h>
 # include "define.h"
 # include "storage.h"
+# include "call.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -546,6 +547,226 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
     }  // namespace translate
 # endif
 
+    namespace details
+    {
+        /// @brief Runtime trap bridge: the `--runtime-fuel` budget ran out.
+        /// @note Same fallback contract as `unreachable()`: a null or returning callback terminates the VM.
+        UWVM_NOINLINE UWVM_GNU_COLD [[noreturn]] inline constexpr void trap_fuel_exhausted() UWVM_THROWS
+        {
+            if(::uwvm2::runtime::compiler::uwvm_int::optable::trap_fuel_exhausted_func == nullptr) [[unlikely]]
+            {
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+# endif
+                ::fast_io::fast_terminate();
+            }
+
+            ::uwvm2::runtime::compiler::uwvm_int::optable::trap_fuel_exhausted_func();
+            ::fast_io::fast_terminate();
+        }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        UWVM_INTERPRETER_OPFUNC_COLD_MACRO UWVM_NOINLINE inline constexpr void trap_fuel_exhausted_tail(Type... /*type*/) UWVM_THROWS
+        { trap_fuel_exhausted(); }
+    }  // namespace details
+
+    /// @brief Fuel charge (tail-call): takes one unit from the `--runtime-fuel` counter, trapping once it is empty.
+    /// @details
+    /// - Emitted only when `compile_option::fuel_counter` is set: once at function entry and once at every loop header.
+    /// - Stack-top optimization: not applicable (no operand-stack interaction).
+    /// - `type[0]` layout: `[opfunc_ptr][counter_ptr][next_opfunc_ptr]`.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+        requires (CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_fuel_charge(Type... type) UWVM_THROWS
+    {
+        static_assert(sizeof...(Type) >= 1uz);
+        static_assert(::std::same_as<Type...[0u], ::std::byte const*>);
+
+        using opfunc_t = ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...>;
+
+        auto const imm_ip{type...[0] + sizeof(opfunc_t)};
+        ::std::uint_least64_t* counter;  // no init
+        ::std::memcpy(::std::addressof(counter), imm_ip, sizeof(counter));
+
+        auto const remaining{*counter};
+        if(remaining == 0u) [[unlikely]] { UWVM_MUSTTAIL return details::trap_fuel_exhausted_tail<CompileOption>(type...); }
+        *counter = remaining - 1u;
+
+        type...[0] = imm_ip + sizeof(counter);
+        opfunc_t next_interpreter;  // no init
+        ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
+
+        UWVM_MUSTTAIL return next_interpreter(type...);
+    }
+
+    /// @brief Fuel charge (non-tail-call/byref): takes one unit from the `--runtime-fuel` counter, trapping once it is empty.
+    /// @details
+    /// - `typeref[0]` layout: `[opfunc_ptr][counter_ptr]`; on return `typeref[0]` points at the next opfunc slot.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeRef>
+        requires (!CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_fuel_charge(TypeRef & ... typeref) UWVM_THROWS
+    {
+        static_assert(sizeof...(TypeRef) >= 1uz);
+        static_assert(::std::same_as<TypeRef...[0u], ::std::byte const*>);
+
+        using opfunc_t = ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_byref_t<TypeRef...>;
+
+        auto const imm_ip{typeref...[0] + sizeof(opfunc_t)};
+        ::std::uint_least64_t* counter;  // no init
+        ::std::memcpy(::std::addressof(counter), imm_ip, sizeof(counter));
+
+        auto const remaining{*counter};
+        if(remaining == 0u) [[unlikely]] { details::trap_fuel_exhausted(); }
+        *counter = remaining - 1u;
+
+        typeref...[0] = imm_ip + sizeof(counter);
+    }
+
+    namespace translate
+    {
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_t<Type...>
+            get_uwvmint_fuel_charge_fptr(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return uwvmint_fuel_charge<CompileOption, Type...>; }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (CompileOption.is_tail_call)
+        inline constexpr auto
+            get_uwvmint_fuel_charge_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_fuel_charge_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (!CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_byref_t<Type...>
+            get_uwvmint_fuel_charge_fptr(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return uwvmint_fuel_charge<CompileOption, Type...>; }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (!CompileOption.is_tail_call)
+        inline constexpr auto
+            get_uwvmint_fuel_charge_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_fuel_charge_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
+    }  // namespace translate
+
+    namespace details
+    {
+        /// @brief Runtime trap bridge: the epoch deadline (`--wasm-timeout` or the embedding API) has passed.
+        /// @note Same fallback contract as `unreachable()`: a null or returning callback terminates the VM.
+        UWVM_NOINLINE UWVM_GNU_COLD [[noreturn]] inline constexpr void trap_epoch_deadline() UWVM_THROWS
+        {
+            if(::uwvm2::runtime::compiler::uwvm_int::optable::trap_epoch_deadline_func == nullptr) [[unlikely]]
+            {
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+# endif
+                ::fast_io::fast_terminate();
+            }
+
+            ::uwvm2::runtime::compiler::uwvm_int::optable::trap_epoch_deadline_func();
+            ::fast_io::fast_terminate();
+        }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        UWVM_INTERPRETER_OPFUNC_COLD_MACRO UWVM_NOINLINE inline constexpr void trap_epoch_deadline_tail(Type... /*type*/) UWVM_THROWS
+        { trap_epoch_deadline(); }
+    }  // namespace details
+
+    /// @brief Epoch check (tail-call): one relaxed load of the runtime's interruption flag, trapping once it is raised.
+    /// @details
+    /// - Emitted only when `compile_option::epoch_interrupt` is set, at the same sites as the fuel charge.
+    /// - Stack-top optimization: not applicable (no operand-stack interaction).
+    /// - `type[0]` layout: `[opfunc_ptr][flag_ptr][next_opfunc_ptr]`.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+        requires (CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_epoch_check(Type... type) UWVM_THROWS
+    {
+        static_assert(sizeof...(Type) >= 1uz);
+        static_assert(::std::same_as<Type...[0u], ::std::byte const*>);
+
+        using opfunc_t = ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...>;
+
+        auto const imm_ip{type...[0] + sizeof(opfunc_t)};
+        ::std::atomic_uint_least32_t const* flag;  // no init
+        ::std::memcpy(::std::addressof(flag), imm_ip, sizeof(flag));
+
+        if(flag->load(::std::memory_order_relaxed) != 0u) [[unlikely]] { UWVM_MUSTTAIL return details::trap_epoch_deadline_tail<CompileOption>(type...); }
+
+        type...[0] = imm_ip + sizeof(flag);
+        opfunc_t next_interpreter;  // no init
+        ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
+
+        UWVM_MUSTTAIL return next_interpreter(type...);
+    }
+
+    /// @brief Epoch check (non-tail-call/byref): one relaxed load of the runtime's interruption flag, trapping once it is raised.
+    /// @details
+    /// - `typeref[0]` layout: `[opfunc_ptr][flag_ptr]`; on return `typeref[0]` points at the next opfunc slot.
+    template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+              ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeRef>
+        requires (!CompileOption.is_tail_call)
+    UWVM_INTERPRETER_OPFUNC_HOT_MACRO inline constexpr void uwvmint_epoch_check(TypeRef & ... typeref) UWVM_THROWS
+    {
+        static_assert(sizeof...(TypeRef) >= 1uz);
+        static_assert(::std::same_as<TypeRef...[0u], ::std::byte const*>);
+
+        using opfunc_t = ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_byref_t<TypeRef...>;
+
+        auto const imm_ip{typeref...[0] + sizeof(opfunc_t)};
+        ::std::atomic_uint_least32_t const* flag;  // no init
+        ::std::memcpy(::std::addressof(flag), imm_ip, sizeof(flag));
+
+        if(flag->load(::std::memory_order_relaxed) != 0u) [[unlikely]] { details::trap_epoch_deadline(); }
+
+        typeref...[0] = imm_ip + sizeof(flag);
+    }
+
+    namespace translate
+    {
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_t<Type...>
+            get_uwvmint_epoch_check_fptr(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return uwvmint_epoch_check<CompileOption, Type...>; }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (CompileOption.is_tail_call)
+        inline constexpr auto
+            get_uwvmint_epoch_check_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_epoch_check_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
+            requires (!CompileOption.is_tail_call)
+        inline constexpr uwvm_interpreter_opfunc_byref_t<Type...>
+            get_uwvmint_epoch_check_fptr(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const&) noexcept
+        { return uwvmint_epoch_check<CompileOption, Type...>; }
+
+        template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
+                  ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... TypeInTuple>
+            requires (!CompileOption.is_tail_call)
+        inline constexpr auto
+            get_uwvmint_epoch_check_fptr_from_tuple(::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_stacktop_currpos_t const& curr_stacktop,
+                                                    ::uwvm2::utils::container::tuple<TypeInTuple...> const&) noexcept
+        { return get_uwvmint_epoch_check_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
+    }  // namespace translate
+
     /// @brief `br_if` opcode (tail-call): conditional branch based on an i32 condition.
     /// @details
     /// - Stack-top optimization: supported for the i32 condition when i32 stack-top caching is enabled; `curr_i32_stack_top` selects which cached slot is read.
@@ -1026,12 +1247,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         { return get_uwvmint_br_table_fptr<CompileOption, TypeInTuple...>(curr_stacktop); }
     }  // namespace translate
 
-    /// @brief `return` opcode (tail-call): terminates the current tail-call dispatch chain.
+    /// @brief `return` opcode (tail-call): resumes a frameless caller, or terminates the current tail-call dispatch chain.
     /// @details
     /// - Stack-top optimization: not applicable (no operand access here).
     /// - `type[0]` layout: `[opfunc_ptr]` (advances past the opfunc slot and returns to the outer interpreter loop).
     /// @note In tail-call mode this opcode does not pop results; before `return`, cached stack-top values must be flushed back to the operand stack via
-    /// `stacktop_stack`.
+    /// `stacktop_stack`. A function entered by `uwvmint_call_frameless` instead appends its results to the caller's operand stack and tail-calls the
+    /// caller's next opfunc.
     template <::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_translate_option_t CompileOption,
               ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_int_stack_top_type... Type>
         requires (CompileOption.is_tail_call)
@@ -1051,7 +1273,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         // safe
         //                     ^^ type...[0]
 
-        // For tail calls, the return method does nothing.
+        // Frameless callee: hand results and control back to the caller inside the same dispatch chain.
+        if constexpr(sizeof...(Type) >= 3uz)
+        {
+            auto const caller{details::leave_frameless_call(type...[1], type...[2])};
+            if(caller.ip != nullptr)
+            {
+                type...[0] = caller.ip;
+                type...[1] = caller.stack_top;
+                type...[2] = caller.local_base;
+
+                ::uwvm2::runtime::compiler::uwvm_int::optable::uwvm_interpreter_opfunc_t<Type...> next_interpreter;  // no init
+                ::std::memcpy(::std::addressof(next_interpreter), type...[0], sizeof(next_interpreter));
+
+                UWVM_MUSTTAIL return next_interpreter(type...);
+            }
+        }
+
+        // For tail calls, the return method otherwise does nothing.
         // Before the return instruction, all data must be pushed back onto the stack from the registers using the stacktop_stack operation.
     }
 
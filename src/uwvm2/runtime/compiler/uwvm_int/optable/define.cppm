@@ -22,6 +22,7 @@
 module;
 
 // std
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
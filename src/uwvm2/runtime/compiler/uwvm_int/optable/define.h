@@ -23,6 +23,7 @@
 
 #ifndef UWVM_MODULE
 // std
+# include <atomic>
 # include <cstddef>
 # include <cstdint>
 # include <cstring>
@@ -102,6 +103,32 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
         ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32 trivial_imm2{};
     };
 
+    /// @brief One interpreter-to-interpreter call entered without a native frame (see `uwvmint_call_frameless`).
+    /// @note  In unwind call-stack mode the runtime also pushes a record per bridge-entered call; only `callee_info` is meaningful there and
+    ///        `callee_local_base` stays null so `uwvmint_return` returns natively.
+    struct frameless_call_record_t
+    {
+        ::std::byte const* resume_ip{};    // caller opfunc slot that follows the call immediates
+        ::std::byte* caller_stack_top{};   // caller operand stack top after the params were popped
+        ::std::byte* caller_local_base{};
+        ::std::byte* callee_local_base{};  // identifies the callee frame when it reaches `return`
+        ::std::byte* frame_begin{};        // region position released when the callee returns
+        compiled_defined_call_info const* callee_info{};
+    };
+
+    /// @brief Per-thread contiguous wasm stack backing frameless calls.
+    /// @details All pointers stay null until the runtime provisions the current thread; an empty or exhausted stack makes
+    ///          `uwvmint_call_frameless` fall back to the native call bridge, so provisioning is an optimization, not a requirement.
+    struct frameless_call_stack_t
+    {
+        ::std::byte* region_begin{};
+        ::std::byte* region_curr{};
+        ::std::byte* region_end{};
+        frameless_call_record_t* records_begin{};
+        frameless_call_record_t* records_curr{};
+        frameless_call_record_t* records_end{};
+    };
+
     struct uwvm_interpreter_full_function_symbol_t
     {
         ::std::size_t local_count{};
@@ -385,11 +412,33 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
     using interpreter_call_func_t =
         void(UWVM_INTERPRETER_OPFUNC_TYPE_MACRO*)(::std::size_t wasm_module_id, ::std::size_t func_index, ::std::byte** stack_top_ptr) UWVM_THROWS;
 
+    /// @brief Per-site `call_indirect` inline cache slot, embedded in the bytecode stream of every `call_indirect` opfunc.
+    /// @details Each way holds an opaque runtime pointer (zero means empty). The runtime owns the encoding and must treat a way as a hint that is
+    ///          re-validated against the live table element before use, so table mutation (`table.set`/`table.grow`/`table.init`/...) can never
+    ///          dispatch through a stale entry. Ways are accessed with relaxed atomics because one code page may run on several threads.
+    struct alignas(::std::uintptr_t) call_indirect_inline_cache_t
+    {
+        inline static constexpr ::std::size_t way_count{2uz};
+
+        ::std::uintptr_t ways[way_count];
+    };
+
+    /// @brief Bytecode bytes reserved for one inline cache slot.
+    /// @details The stream itself has no alignment guarantee, so the translator reserves enough zero bytes for the opfunc to align the slot up in
+    ///          place; the next immediate always starts at a fixed distance from `table_index`.
+    inline constexpr ::std::size_t call_indirect_inline_cache_stream_bytes{sizeof(call_indirect_inline_cache_t) + alignof(call_indirect_inline_cache_t) - 1uz};
+
+    struct call_indirect_inline_cache_stream_t
+    { ::std::byte bytes[call_indirect_inline_cache_stream_bytes]; };
+
     /// @details `call_indirect` requires resolving a table element and validating the signature at runtime.
     ///          The interpreter provides a callback bridge so the runtime can implement the full semantics (bounds/null/type checks + call).
-    using interpreter_call_indirect_func_t = void(
-        UWVM_INTERPRETER_OPFUNC_TYPE_MACRO*)(::std::size_t wasm_module_id, ::std::size_t type_index, ::std::size_t table_index, ::std::byte** stack_top_ptr)
-        UWVM_THROWS;
+    ///          `inline_cache` is the calling site's slot (see `call_indirect_inline_cache_t`); bridges that do not cache may ignore it.
+    using interpreter_call_indirect_func_t = void(UWVM_INTERPRETER_OPFUNC_TYPE_MACRO*)(::std::size_t wasm_module_id,
+                                                                                       ::std::size_t type_index,
+                                                                                       ::std::size_t table_index,
+                                                                                       call_indirect_inline_cache_t* inline_cache,
+                                                                                       ::std::byte** stack_top_ptr) UWVM_THROWS;
 
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
     inline constexpr ::std::uintptr_t interpreter_tiered_loop_osr_disabled_state_address{::std::numeric_limits<::std::uintptr_t>::max()};
@@ -475,6 +524,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
     {
         // Indicates the module number of the currently compiled WASM, used for external function calls.
         ::std::size_t curr_wasm_id{};
+        // Emit `uwvmint_call_frameless` for same-module local calls (tail-call builds only). Only valid when every local body is translated
+        // before execution starts: the opfunc jumps straight into the callee's code without passing the lazy-compile gate.
+        bool frameless_local_calls{};
+        // Fuel counter shared with the LLVM backend (`--runtime-fuel`). When set, `uwvmint_fuel_charge` is emitted at function entry and at
+        // every loop header; null emits no metering at all.
+        ::std::uint_least64_t* fuel_counter{};
+        // Epoch interruption flag (`--wasm-timeout`), raised by the runtime once the epoch deadline passes. When set,
+        // `uwvmint_epoch_check` is emitted next to the fuel charge sites; null emits no check.
+        ::std::atomic_uint_least32_t const* epoch_interrupt{};
     };
 
     template <uwvm_int_stack_top_type... Type>
@@ -59,6 +59,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::compiler::uwvm_int::optable
     inline ::uwvm2::runtime::compiler::uwvm_int::optable::unreachable_func_t trap_integer_overflow_func{};               // [global]
     inline ::uwvm2::runtime::compiler::uwvm_int::optable::unreachable_func_t trap_table_out_of_bounds_func{};            // [global]
     inline ::uwvm2::runtime::compiler::uwvm_int::optable::memory_out_of_bounds_func_t trap_memory_out_of_bounds_func{};  // [global]
+    inline ::uwvm2::runtime::compiler::uwvm_int::optable::unreachable_func_t trap_fuel_exhausted_func{};                 // [global]
+    inline ::uwvm2::runtime::compiler::uwvm_int::optable::unreachable_func_t trap_epoch_deadline_func{};                 // [global]
+# if defined(UWVM_USE_THREAD_LOCAL)
+    inline thread_local ::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack_t frameless_call_stack{};  // [global] [thread_local]
+# endif
 }
 #endif
 
@@ -76,6 +76,12 @@
 # elif !UWVM_HAS_BUILTIN(__builtin_alloca)
 #  include <alloca.h>
 # endif
+// The sampling profiler arms a per-thread CPU-time timer that delivers SIGPROF; the LLVM perf map is named after the process id.
+# if defined(__linux__)
+#  include <signal.h>
+#  include <time.h>
+#  include <unistd.h>
+# endif
 # if defined(UWVM_RUNTIME_LLVM_JIT)
 // Keep LLVM dependencies behind the backend macro so interpreter-only builds do not pay the compile-time or link dependency cost.
 #  include <llvm/Analysis/TargetTransformInfo.h>
@@ -102,6 +108,7 @@
 #  include <llvm/IR/Verifier.h>
 #  include <llvm/Linker/Linker.h>
 #  include <llvm/Object/ObjectFile.h>
+#  include <llvm/Object/SymbolSize.h>
 #  include <llvm/PassRegistry.h>
 #  include <llvm/Passes/OptimizationLevel.h>
 #  include <llvm/Passes/PassBuilder.h>
@@ -270,6 +277,17 @@ extern "C" void __deregister_frame(void const*);
 # define UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR
 #endif
 
+// `--runtime-sample-profile` needs a per-thread CPU-time timer (raw timer_create with SIGEV_THREAD_ID), the machine context of the
+// interrupted guest code, and plain thread_local access to the logical stack from the signal handler.
+#pragma push_macro("UWVM2_RUNTIME_HAS_SAMPLE_PROFILER")
+#undef UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+#if (defined(UWVM_RUNTIME_UWVM_INTERPRETER) || defined(UWVM_RUNTIME_LLVM_JIT)) && defined(__linux__) && defined(UWVM_SUPPORT_MMAP) &&                         \
+    defined(UWVM_USE_THREAD_LOCAL) && defined(__NR_timer_create) && defined(__NR_timer_settime) && defined(__NR_timer_delete) && defined(__NR_gettid)
+# define UWVM2_RUNTIME_HAS_SAMPLE_PROFILER 1
+#else
+# define UWVM2_RUNTIME_HAS_SAMPLE_PROFILER 0
+#endif
+
 namespace uwvm2::runtime::lib
 {
     namespace
@@ -394,6 +412,7 @@ namespace uwvm2::runtime::lib
         [[nodiscard]] inline constexpr bool tiered_runtime_active() noexcept;
         [[nodiscard]] inline constexpr bool tiered_t0_enabled() noexcept;
         [[nodiscard]] inline constexpr bool tiered_t2_enabled() noexcept;
+        [[nodiscard]] inline constexpr bool tiered_full_compile_uses_profile() noexcept;
         [[nodiscard]] inline constexpr bool tiered_uses_tiered_targets() noexcept;
         [[nodiscard]] inline constexpr bool tiered_full_ready(compiled_module_record const& rec) noexcept;
         [[nodiscard]] inline constexpr bool tiered_large_module_long_run_active(compiled_module_record const& rec) noexcept;
@@ -481,6 +500,10 @@ namespace uwvm2::runtime::lib
             ::std::uint_least8_t tiered_large_long_run_ready{};
             ::uwvm2::utils::container::vector<::std::uint_least32_t> tiered_entry_hot_counters{};
             ::uwvm2::utils::container::vector<::std::uint_least32_t> tiered_osr_request_counters{};
+            // Tier-1 branch/entry counts per local function, consumed by a profile-guided tier-2 compile.  Sized once before
+            // execution and never reallocated, because tier-1 code holds the address of each counter array.
+            ::uwvm2::utils::container::vector<::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::llvm_jit_function_profile_t>
+                tiered_function_profiles{};
 #endif
 
             // Canonical type-index table for fast call_indirect signature checks.
@@ -603,6 +626,20 @@ namespace uwvm2::runtime::lib
             ::std::size_t lazy_prefetch_local_function_index{SIZE_MAX};
             ::std::atomic_size_t lazy_runtime_miss_count{};
             ::std::atomic_size_t lazy_runtime_compiled_hit_count{};
+            // `--runtime-fuel` counter. Both backends embed its address in generated code and decrement it in place; it is refilled before
+            // every run and only touched by the thread executing guest code.
+            ::std::uint_least64_t fuel_remaining{};
+            // `--wasm-timeout` epoch state. Guest code only loads `epoch_interrupt`; the epoch/deadline comparison runs on whoever advances
+            // the epoch (the ticker thread or the embedding API) under `epoch_lock`, so re-arming a deadline cannot race a stale raise.
+            ::std::atomic_flag epoch_lock = ATOMIC_FLAG_INIT;
+            ::std::uint_least64_t epoch{};
+            ::std::uint_least64_t epoch_deadline{UINT_LEAST64_MAX};
+            ::std::atomic_uint_least32_t epoch_interrupt{};
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            // Per-site call_indirect inline cache outcomes; only maintained while the runtime log is enabled.
+            ::std::atomic_size_t call_indirect_inline_cache_hit_count{};
+            ::std::atomic_size_t call_indirect_inline_cache_miss_count{};
+# endif
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             // Tiered counters feed adaptive scheduling and runtime logs. Exact counts are not correctness-critical, so relaxed atomics
             // are used where the hot path only needs approximate pressure signals.
@@ -626,6 +663,329 @@ namespace uwvm2::runtime::lib
 
         inline runtime_global_state g_runtime{};  // [global]
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) || defined(UWVM_RUNTIME_LLVM_JIT)
+        // `--runtime-fuel`: codegen receives the counter address only when metering was requested, so unmetered code carries no charge.
+        [[nodiscard]] inline ::std::uint_least64_t* runtime_fuel_counter() noexcept
+        { return ::uwvm2::uwvm::runtime::runtime_mode::runtime_fuel_existed ? ::std::addressof(g_runtime.fuel_remaining) : nullptr; }
+
+        // Every run (including each `--runtime-reset-repeat` iteration) starts with the full budget.
+        inline void refill_runtime_fuel() noexcept { g_runtime.fuel_remaining = ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_fuel; }
+
+        // `--wasm-timeout`: like the fuel counter, the interrupt flag is only handed to codegen when epoch checks were requested.
+        [[nodiscard]] inline ::std::atomic_uint_least32_t const* runtime_epoch_interrupt() noexcept
+        { return ::uwvm2::uwvm::runtime::runtime_mode::wasm_timeout_existed ? ::std::addressof(g_runtime.epoch_interrupt) : nullptr; }
+
+        inline void lock_runtime_epoch() noexcept
+        {
+            while(g_runtime.epoch_lock.test_and_set(::std::memory_order_acquire)) { ::uwvm2::utils::thread::lazy_compile_thread_yield(); }
+        }
+
+        inline void unlock_runtime_epoch() noexcept { g_runtime.epoch_lock.clear(::std::memory_order_release); }
+
+        // Advance the epoch by one tick and raise the interrupt flag once the armed deadline is reached.
+        inline void increment_runtime_epoch() noexcept
+        {
+            lock_runtime_epoch();
+            ++g_runtime.epoch;
+            if(g_runtime.epoch >= g_runtime.epoch_deadline) { g_runtime.epoch_interrupt.store(1u, ::std::memory_order_relaxed); }
+            unlock_runtime_epoch();
+        }
+
+        // Arm the deadline `ticks` epochs from now (saturating). Zero ticks interrupts at the next check.
+        inline void set_runtime_epoch_deadline(::std::uint_least64_t ticks) noexcept
+        {
+            lock_runtime_epoch();
+            auto const epoch{g_runtime.epoch};
+            auto const deadline{ticks > UINT_LEAST64_MAX - epoch ? UINT_LEAST64_MAX : epoch + ticks};
+            g_runtime.epoch_deadline = deadline;
+            g_runtime.epoch_interrupt.store(deadline <= epoch ? 1u : 0u, ::std::memory_order_relaxed);
+            unlock_runtime_epoch();
+        }
+
+# ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+        // One epoch per millisecond while a non-zero `--wasm-timeout` is configured. The thread is started on the first run and joined at exit.
+        struct runtime_epoch_ticker_t
+        {
+            ::std::atomic_bool stop{};
+            ::fast_io::native_thread thread{};
+
+            inline constexpr runtime_epoch_ticker_t() noexcept = default;
+            inline constexpr runtime_epoch_ticker_t(runtime_epoch_ticker_t const&) noexcept = delete;
+            inline constexpr runtime_epoch_ticker_t& operator= (runtime_epoch_ticker_t const&) noexcept = delete;
+
+            inline ~runtime_epoch_ticker_t()
+            {
+                this->stop.store(true, ::std::memory_order_relaxed);
+                if(this->thread.joinable()) { this->thread.join(); }
+            }
+        };
+
+        inline runtime_epoch_ticker_t g_runtime_epoch_ticker{};  // [global]
+
+        inline void ensure_runtime_epoch_ticker_started() noexcept
+        {
+            if(g_runtime_epoch_ticker.thread.joinable()) { return; }
+            g_runtime_epoch_ticker.thread = ::fast_io::native_thread{
+                []() noexcept
+                {
+                    constexpr ::fast_io::unix_timestamp one_millisecond{.seconds = 0,
+                                                                        .subseconds = ::fast_io::uint_least64_subseconds_per_second / 1000u};
+                    while(!g_runtime_epoch_ticker.stop.load(::std::memory_order_relaxed))
+                    {
+                        ::fast_io::this_thread::sleep_for(one_millisecond);
+                        increment_runtime_epoch();
+                    }
+                }};
+        }
+# endif
+
+        // Every run starts with a fresh `--wasm-timeout` window. A zero timeout only enables the checks; the embedding API owns the deadline then.
+        inline void arm_runtime_epoch_deadline() noexcept
+        {
+            if(!::uwvm2::uwvm::runtime::runtime_mode::wasm_timeout_existed) { return; }
+            auto const timeout_ms{::uwvm2::uwvm::runtime::runtime_mode::global_wasm_timeout_ms};
+            if(timeout_ms == 0u) { return; }
+# ifdef UWVM_UTILS_HAS_FAST_IO_NATIVE_THREAD
+            ensure_runtime_epoch_ticker_started();
+# endif
+            set_runtime_epoch_deadline(timeout_ms);
+        }
+#endif
+
+#if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+        // `--runtime-function-profile`: per-function counters charged at the runtime's call boundaries (interpreter call bridge, LLVM
+        // raw entries, loop OSR, demand compilation). Guest code runs on one thread, so frames and counters are plain data; the only
+        // cost left when the option is absent is the `active` test at each boundary.
+        struct function_profile_counters_t
+        {
+            ::std::uint_least64_t calls{};
+            ::std::uint_least64_t llvm_calls{};
+            ::std::uint_least64_t osr_entries{};
+            ::std::uint_least64_t total_ticks{};
+            ::std::uint_least64_t self_ticks{};
+            ::std::uint_least64_t llvm_self_ticks{};
+            ::std::uint_least64_t compile_ticks{};
+            // Open frames of this function; recursive calls charge total time once, from the outermost frame.
+            ::std::size_t open_frames{};
+        };
+
+        struct function_profile_frame_t
+        {
+            function_profile_counters_t* counters{};
+            ::std::uint_least64_t start{};
+            // Time charged elsewhere while this frame was open: callee frames and demand compilation.
+            ::std::uint_least64_t excluded_ticks{};
+            // Self time an interpreter frame spent in LLVM code after a loop OSR.
+            ::std::uint_least64_t osr_llvm_ticks{};
+            bool llvm{};
+        };
+
+        struct function_profile_module_t
+        {
+            ::std::size_t counter_base{};
+            ::std::size_t import_count{};
+            ::std::size_t local_count{};
+        };
+
+        struct function_profile_state_t
+        {
+            ::uwvm2::utils::container::vector<function_profile_module_t> modules{};
+            ::uwvm2::utils::container::vector<function_profile_counters_t> counters{};
+            ::uwvm2::utils::container::vector<function_profile_frame_t> frames{};
+            ::std::uint_least64_t start_ticks{};
+            ::std::uint_least64_t start_ns{};
+            bool active{};
+            bool started{};
+            bool finished{};
+        };
+
+        inline function_profile_state_t g_function_profile{};  // [global]
+
+        [[nodiscard]] inline ::std::uint_least64_t function_profile_clock_ns() noexcept
+        {
+            ::fast_io::unix_timestamp ts{};
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                ts = ::fast_io::posix_clock_gettime(::fast_io::posix_clock_id::monotonic_raw);
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                return 0u;
+            }
+# endif
+            constexpr ::std::uint_least64_t subseconds_per_ns{::fast_io::uint_least64_subseconds_per_second / 1000000000u};
+            return static_cast<::std::uint_least64_t>(ts.seconds) * 1000000000u + ts.subseconds / subseconds_per_ns;
+        }
+
+        // Boundaries read the cycle counter where it is one instruction; the report converts ticks to nanoseconds against the
+        // monotonic clock measured over the whole profile.
+        [[nodiscard]] UWVM_ALWAYS_INLINE inline ::std::uint_least64_t function_profile_ticks() noexcept
+        {
+# if (defined(__x86_64__) || defined(__i386__)) && UWVM_HAS_BUILTIN(__builtin_ia32_rdtsc)
+            return static_cast<::std::uint_least64_t>(__builtin_ia32_rdtsc());
+# elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+            ::std::uint_least64_t ticks;
+            __asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+            return ticks;
+# else
+            return function_profile_clock_ns();
+# endif
+        }
+
+        [[nodiscard]] inline function_profile_counters_t* function_profile_counters(::std::size_t module_id, ::std::size_t function_index) noexcept
+        {
+            auto& prof{g_function_profile};
+            if(module_id >= prof.modules.size()) [[unlikely]] { return nullptr; }
+            auto const& mod{prof.modules.index_unchecked(module_id)};
+            if(function_index < mod.import_count || function_index - mod.import_count >= mod.local_count) [[unlikely]] { return nullptr; }
+            return ::std::addressof(prof.counters.index_unchecked(mod.counter_base + (function_index - mod.import_count)));
+        }
+
+        [[nodiscard]] inline function_profile_counters_t const*
+            function_profile_enter(::std::size_t module_id, ::std::size_t function_index, bool llvm) noexcept
+        {
+            auto const counters{function_profile_counters(module_id, function_index)};
+            if(counters == nullptr) [[unlikely]] { return nullptr; }
+            ++counters->calls;
+            if(llvm) { ++counters->llvm_calls; }
+            ++counters->open_frames;
+            g_function_profile.frames.push_back(function_profile_frame_t{.counters = counters, .start = function_profile_ticks(), .llvm = llvm});
+            return counters;
+        }
+
+        inline void function_profile_leave(function_profile_counters_t const* counters) noexcept
+        {
+            auto& prof{g_function_profile};
+            auto const now{function_profile_ticks()};
+            if(prof.frames.empty() || prof.frames.back().counters != counters) [[unlikely]] { return; }
+            auto const frame{prof.frames.back()};
+            prof.frames.pop_back();
+
+            auto const elapsed{now - frame.start};
+            auto const self{elapsed > frame.excluded_ticks ? elapsed - frame.excluded_ticks : 0u};
+            auto& c{*frame.counters};
+            c.self_ticks += self;
+            c.llvm_self_ticks += frame.llvm ? self : (frame.osr_llvm_ticks < self ? frame.osr_llvm_ticks : self);
+            if(--c.open_frames == 0uz) { c.total_ticks += elapsed; }
+            if(!prof.frames.empty()) { prof.frames.back().excluded_ticks += elapsed; }
+        }
+
+        // One wasm function execution, either interpreted (`llvm == false`) or entered through generated code.
+        struct function_profile_scope
+        {
+            function_profile_counters_t const* counters{};
+
+            UWVM_ALWAYS_INLINE inline function_profile_scope(::std::size_t module_id, ::std::size_t function_index, bool llvm) noexcept
+            {
+                if(!g_function_profile.active) [[likely]] { return; }
+                this->counters = function_profile_enter(module_id, function_index, llvm);
+            }
+
+            inline function_profile_scope(function_profile_scope const&) noexcept = delete;
+            inline function_profile_scope& operator= (function_profile_scope const&) noexcept = delete;
+
+            UWVM_ALWAYS_INLINE inline ~function_profile_scope()
+            {
+                if(this->counters != nullptr) [[unlikely]] { function_profile_leave(this->counters); }
+            }
+        };
+
+        // A loop OSR keeps the interpreter frame but finishes it in generated code; that stretch counts as LLVM time of the frame.
+        struct function_profile_osr_scope
+        {
+            // An index, not a pointer: frames opened by the OSR'd code may reallocate the frame stack.
+            ::std::size_t frame_index{SIZE_MAX};
+            ::std::uint_least64_t start{};
+            ::std::uint_least64_t excluded_before{};
+
+            UWVM_ALWAYS_INLINE inline function_profile_osr_scope(::std::size_t module_id, ::std::size_t function_index) noexcept
+            {
+                if(!g_function_profile.active) [[likely]] { return; }
+                auto const counters{function_profile_counters(module_id, function_index)};
+                if(counters == nullptr) [[unlikely]] { return; }
+                ++counters->osr_entries;
+                auto& frames{g_function_profile.frames};
+                if(frames.empty() || frames.back().counters != counters) { return; }
+                this->frame_index = frames.size() - 1uz;
+                this->excluded_before = frames.back().excluded_ticks;
+                this->start = function_profile_ticks();
+            }
+
+            inline function_profile_osr_scope(function_profile_osr_scope const&) noexcept = delete;
+            inline function_profile_osr_scope& operator= (function_profile_osr_scope const&) noexcept = delete;
+
+            UWVM_ALWAYS_INLINE inline ~function_profile_osr_scope()
+            {
+                if(this->frame_index == SIZE_MAX) [[likely]] { return; }
+                auto& frames{g_function_profile.frames};
+                if(this->frame_index >= frames.size()) [[unlikely]] { return; }
+                auto& frame{frames.index_unchecked(this->frame_index)};
+                auto const elapsed{function_profile_ticks() - this->start};
+                auto const excluded{frame.excluded_ticks - this->excluded_before};
+                if(elapsed > excluded) { frame.osr_llvm_ticks += elapsed - excluded; }
+            }
+        };
+
+        // Blocking demand compilation of one function. The wait is charged to that function and kept out of its caller's self time.
+        struct function_profile_compile_scope
+        {
+            function_profile_counters_t* counters{};
+            ::std::uint_least64_t start{};
+
+            UWVM_ALWAYS_INLINE inline function_profile_compile_scope(::std::size_t module_id, ::std::size_t function_index) noexcept
+            {
+                if(!g_function_profile.active) [[likely]] { return; }
+                this->counters = function_profile_counters(module_id, function_index);
+                this->start = function_profile_ticks();
+            }
+
+            inline function_profile_compile_scope(function_profile_compile_scope const&) noexcept = delete;
+            inline function_profile_compile_scope& operator= (function_profile_compile_scope const&) noexcept = delete;
+
+            UWVM_ALWAYS_INLINE inline ~function_profile_compile_scope()
+            {
+                if(this->counters == nullptr) [[likely]] { return; }
+                auto const elapsed{function_profile_ticks() - this->start};
+                this->counters->compile_ticks += elapsed;
+                auto& frames{g_function_profile.frames};
+                if(!frames.empty()) { frames.back().excluded_ticks += elapsed; }
+            }
+        };
+
+        // Counters accumulate across `--runtime-reset-repeat` runs; the table is built on the first run, once every module is loaded.
+        inline void start_function_profile_if_requested() noexcept
+        {
+            if(!::uwvm2::uwvm::runtime::runtime_mode::runtime_function_profile_existed) { return; }
+            auto& prof{g_function_profile};
+            if(prof.started) { return; }
+            prof.started = true;
+
+            ::std::size_t total{};
+            prof.modules.reserve(g_runtime.modules.size());
+            for(auto const& rec: g_runtime.modules)
+            {
+                function_profile_module_t mod{.counter_base = total};
+                if(rec.runtime_module != nullptr) [[likely]]
+                {
+                    mod.import_count = rec.runtime_module->imported_function_vec_storage.size();
+                    mod.local_count = rec.runtime_module->local_defined_function_vec_storage.size();
+                }
+                total += mod.local_count;
+                prof.modules.push_back_unchecked(mod);
+            }
+            prof.counters.resize(total);
+            // Deep recursion grows this on demand; the reserve only covers ordinary call depths.
+            prof.frames.reserve(1024uz);
+
+            prof.start_ns = function_profile_clock_ns();
+            prof.start_ticks = function_profile_ticks();
+            prof.active = true;
+        }
+#endif
+
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
 # if defined(UWVM_USE_THREAD_LOCAL)
 // Entry hotness probing is per-thread to avoid a global cache-line bounce on every interpreted function entry.
@@ -724,11 +1084,7 @@ namespace uwvm2::runtime::lib
                 // than running destructors that may touch already-destroyed LLVM globals.
                 static_cast<void>(llvm_jit_compiled.llvm_jit_module.llvm_module.release());
                 static_cast<void>(llvm_jit_compiled.llvm_jit_module.llvm_context_holder.release());
-                for(auto& materialized_func: llvm_jit_lazy_compiled.materialized_functions)
-                {
-                    static_cast<void>(materialized_func.llvm_jit_engine.release());
-                    static_cast<void>(materialized_func.llvm_context_holder.release());
-                }
+                // Lazily materialized code is owned by the process-lifetime lazy JIT session, which is never torn down.
                 static_cast<void>(llvm_jit_engine.release());
                 static_cast<void>(llvm_jit_context_holder.release());
             }
@@ -742,6 +1098,10 @@ namespace uwvm2::runtime::lib
             // Store logical wasm identity instead of native return addresses so interpreter and JIT trap output share one format.
             ::std::size_t module_id{};
             ::std::size_t function_index{};
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_USE_THREAD_LOCAL)
+            // Frameless interpreter calls pushed before this frame; trap output interleaves the newer records above it.
+            ::std::size_t frameless_depth{};
+#endif
         };
 
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -830,21 +1190,53 @@ namespace uwvm2::runtime::lib
             static_assert((kCallIndirectCacheEntries & (kCallIndirectCacheEntries - 1uz)) == 0uz, "cache size must be power-of-two.");
             ::uwvm2::utils::container::array<call_indirect_cache_entry, kCallIndirectCacheEntries> call_indirect_cache{};
 
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+            // Frame count the SIGPROF handler may walk. It trails the frame store on push and leads the removal on pop, with a signal
+            // fence between, so the handler never reads a slot the interrupted code has not finished writing.
+            ::std::size_t signal_visible_depth{};
+#endif
+
             inline constexpr call_stack_tls_state() noexcept { frames.reserve(kCallStackMaxDepth); }
 
             inline constexpr void push(call_stack_frame fr) noexcept
             {
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_USE_THREAD_LOCAL)
+                auto const& frameless{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+                fr.frameless_depth = static_cast<::std::size_t>(frameless.records_curr - frameless.records_begin);
+#endif
                 // Reserve the common maximum depth up front, but allow slow-path growth instead of failing on diagnostic-heavy stacks.
                 if(frames.size() < frames.capacity()) [[likely]] { frames.push_back_unchecked(fr); }
                 else
                 {
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+                    // Reallocation frees the storage the SIGPROF handler walks, so keep the handler out until the vector is consistent.
+                    ::sigset_t prof_set;
+                    ::sigset_t old_set;
+                    ::sigemptyset(::std::addressof(prof_set));
+                    ::sigaddset(::std::addressof(prof_set), SIGPROF);
+                    ::pthread_sigmask(SIG_BLOCK, ::std::addressof(prof_set), ::std::addressof(old_set));
+                    frames.push_back(fr);
+                    ::pthread_sigmask(SIG_SETMASK, ::std::addressof(old_set), nullptr);
+#else
                     frames.push_back(fr);
+#endif
                 }
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+                ::std::atomic_signal_fence(::std::memory_order_release);
+                signal_visible_depth = frames.size();
+#endif
             }
 
             inline constexpr void pop() noexcept
             {
-                if(!frames.empty()) [[likely]] { frames.pop_back_unchecked(); }
+                if(!frames.empty()) [[likely]]
+                {
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+                    signal_visible_depth = frames.size() - 1uz;
+                    ::std::atomic_signal_fence(::std::memory_order_release);
+#endif
+                    frames.pop_back_unchecked();
+                }
             }
         };
 
@@ -1060,6 +1452,24 @@ namespace uwvm2::runtime::lib
         { return get_thread_state().tiered_counter_sample_tick; }
 #endif
 
+        [[nodiscard]] inline constexpr ::std::size_t current_wasm_caller_module_id(call_stack_tls_state const& call_stack) noexcept
+        {
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_USE_THREAD_LOCAL)
+            // Interpreter records newer than the last logical frame (frameless calls, or every bridge-entered call in uwvm-int unwind
+            // call-stack mode) are the innermost wasm frames.
+            auto const& frameless{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+            auto const record_depth{static_cast<::std::size_t>(frameless.records_curr - frameless.records_begin)};
+            auto const logical_record_depth{call_stack.frames.empty() ? 0uz : call_stack.frames.back().frameless_depth};
+            if(record_depth > logical_record_depth)
+            {
+                auto const info{frameless.records_curr[-1].callee_info};
+                if(info != nullptr) [[likely]] { return info->module_id; }
+            }
+#endif
+            if(call_stack.frames.empty()) [[unlikely]] { return preload_call_context_t::invalid_module_id; }
+            return call_stack.frames.back().module_id;
+        }
+
         struct preload_call_context_guard
         {
             preload_call_context_t* ctx{};
@@ -1074,12 +1484,7 @@ namespace uwvm2::runtime::lib
                 if(caller_module_id != preload_call_context_t::invalid_module_id) { ctx->module_id = caller_module_id; }
                 else
                 {
-                    auto& call_stack{get_call_stack()};
-                    if(!call_stack.frames.empty()) [[likely]] { ctx->module_id = call_stack.frames.back().module_id; }
-                    else
-                    {
-                        ctx->module_id = preload_call_context_t::invalid_module_id;
-                    }
+                    ctx->module_id = current_wasm_caller_module_id(get_call_stack());
                 }
                 ctx->preload_module_memory_attribute = attribute;
                 ctx->capi_function = function;
@@ -1160,6 +1565,10 @@ namespace uwvm2::runtime::lib
             table_out_of_bounds,
             memory_out_of_bounds,
             runtime_invariant_failure,
+            // `--runtime-fuel` budget ran out
+            fuel_exhausted,
+            // `--wasm-timeout` epoch deadline passed
+            epoch_deadline,
             // uncatched int error (wasm 3.0, exception)
             uncatched_int_tag
 
@@ -1209,6 +1618,14 @@ namespace uwvm2::runtime::lib
                 {
                     return ::uwvm2::utils::container::u8string_view{u8"runtime invariant failure"};
                 }
+                case trap_kind::fuel_exhausted:
+                {
+                    return ::uwvm2::utils::container::u8string_view{u8"fuel exhausted"};
+                }
+                case trap_kind::epoch_deadline:
+                {
+                    return ::uwvm2::utils::container::u8string_view{u8"epoch deadline reached (timeout)"};
+                }
                 case trap_kind::uncatched_int_tag:
                 {
                     return ::uwvm2::utils::container::u8string_view{u8"tag: uncatched wasm exception"};
@@ -1579,12 +1996,208 @@ namespace uwvm2::runtime::lib
             return ::llvm::object::OwningBinary<::llvm::object::ObjectFile>{::std::move(*copied_object_expected), ::std::move(copied_buffer)};
         }
 
+# if defined(__linux__)
+        // `--runtime-llvm-jit-perf-map`: perf symbolizes anonymous executable memory through `/tmp/perf-<pid>.map`, one
+        // `START SIZE name` line (hex address and size) per function.  Objects can be loaded from background compile threads, so
+        // each object's lines are formatted first and appended under a spin lock with a single write.
+        struct llvm_jit_perf_map_state
+        {
+            ::std::atomic_flag lock{};
+            ::fast_io::u8native_file file{};
+            bool opened{};
+            bool failed{};
+        };
+
+        inline llvm_jit_perf_map_state g_llvm_jit_perf_map{};  // [global]
+
+        [[nodiscard]] inline constexpr bool runtime_llvm_jit_perf_map_requested() noexcept
+        { return ::uwvm2::uwvm::runtime::runtime_mode::runtime_llvm_jit_perf_map; }
+
+        inline constexpr void append_llvm_jit_perf_map_name(::uwvm2::utils::container::u8string& out, ::llvm::StringRef symbol_name) noexcept
+        {
+            // Generated wasm functions are named `<module prefix>_func_<index>` and variants; map them back to `module::function` as
+            // the sample profiler does.  Bridges and other helpers keep their LLVM name.  A newline would end the record.
+            ::uwvm2::utils::container::u8string_view const name{reinterpret_cast<char8_t const*>(symbol_name.data()), symbol_name.size()};
+            auto const append_sanitized{[&out](::uwvm2::utils::container::u8string_view s) constexpr noexcept
+                                        {
+                                            for(auto const c: s) { out.push_back(c == u8'\n' || c == u8'\r' ? u8'_' : c); }
+                                        }};
+            ::uwvm2::utils::container::u8string_ref_uwvm ref{::std::addressof(out)};
+
+            struct symbol_kind
+            {
+                ::uwvm2::utils::container::u8string_view infix;
+                ::uwvm2::utils::container::u8string_view tag;
+            };
+
+            constexpr symbol_kind kinds[]{
+                {u8"_func_",                 {}                },
+                {u8"_raw_func_",             u8" [raw]"        },
+                {u8"_tiered_core_func_",     u8" [tiered-core]"},
+                {u8"_tiered_loop_raw_func_", u8" [osr]"        },
+            };
+
+            for(auto const& mod_rec: g_runtime.modules)
+            {
+                if(mod_rec.runtime_module == nullptr) [[unlikely]] { continue; }
+
+                auto const prefix{::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::details::get_llvm_runtime_module_symbol_prefix(
+                    *mod_rec.runtime_module)};
+                ::uwvm2::utils::container::u8string_view const prefix_view{prefix.data(), prefix.size()};
+                if(name.size() <= prefix_view.size() || name.substr(0uz, prefix_view.size()) != prefix_view) { continue; }
+
+                auto const rest{name.substr(prefix_view.size())};
+                for(auto const& kind: kinds)
+                {
+                    if(rest.size() <= kind.infix.size() || rest.substr(0uz, kind.infix.size()) != kind.infix) { continue; }
+
+                    ::std::size_t function_index{};
+                    ::std::size_t digits{};
+                    for(auto const c: rest.substr(kind.infix.size()))
+                    {
+                        if(c < u8'0' || c > u8'9') { break; }
+                        function_index = function_index * 10uz + static_cast<::std::size_t>(c - u8'0');
+                        ++digits;
+                    }
+                    if(digits == 0uz) { continue; }
+
+                    append_sanitized(resolve_module_display_name(mod_rec.module_name));
+                    ::fast_io::io::print(ref, u8"::");
+                    auto const fn_name{resolve_func_display_name(mod_rec.module_name, function_index)};
+                    if(fn_name.empty()) { ::fast_io::io::print(ref, u8"func[", function_index, u8"]"); }
+                    else
+                    {
+                        append_sanitized(fn_name);
+                    }
+                    ::fast_io::io::print(ref, kind.tag);
+                    return;
+                }
+            }
+
+            append_sanitized(name);
+        }
+
+        inline constexpr void write_llvm_jit_perf_map(::llvm::object::ObjectFile const& obj, ::llvm::RuntimeDyld::LoadedObjectInfo const& loaded) noexcept
+        {
+            ::uwvm2::utils::container::u8string lines{};
+            ::uwvm2::utils::container::u8string_ref_uwvm lines_ref{::std::addressof(lines)};
+
+            for(auto const& [symbol, size]: ::llvm::object::computeSymbolSizes(obj))
+            {
+                if(size == 0u) { continue; }
+
+                auto type{symbol.getType()};
+                if(!type)
+                {
+                    ::llvm::consumeError(type.takeError());
+                    continue;
+                }
+                if(*type != ::llvm::object::SymbolRef::ST_Function) { continue; }
+
+                auto symbol_name{symbol.getName()};
+                if(!symbol_name)
+                {
+                    ::llvm::consumeError(symbol_name.takeError());
+                    continue;
+                }
+
+                auto symbol_address{symbol.getAddress()};
+                if(!symbol_address)
+                {
+                    ::llvm::consumeError(symbol_address.takeError());
+                    continue;
+                }
+
+                auto section{symbol.getSection()};
+                if(!section)
+                {
+                    ::llvm::consumeError(section.takeError());
+                    continue;
+                }
+                if(*section == obj.section_end()) { continue; }
+
+                // Symbol addresses are object-relative; rebase them onto the section's final load address.
+                auto const section_load_address{loaded.getSectionLoadAddress(**section)};
+                if(section_load_address == 0u) { continue; }
+                auto const load_address{section_load_address + (*symbol_address - (*section)->getAddress())};
+
+                ::fast_io::io::print(lines_ref, ::fast_io::mnp::hex(load_address), u8" ", ::fast_io::mnp::hex(size), u8" ");
+                append_llvm_jit_perf_map_name(lines, *symbol_name);
+                lines.push_back(u8'\n');
+            }
+
+            if(lines.empty()) { return; }
+
+            auto& perf_map{g_llvm_jit_perf_map};
+            while(perf_map.lock.test_and_set(::std::memory_order_acquire)) {}
+
+            if(!perf_map.opened)
+            {
+                perf_map.opened = true;
+                auto const path{::uwvm2::utils::container::u8concat_uwvm(u8"/tmp/perf-", ::getpid(), u8".map")};
+#  ifdef UWVM_CPP_EXCEPTIONS
+                try
+#  endif
+                {
+                    perf_map.file = ::fast_io::u8native_file{path, ::fast_io::open_mode::out | ::fast_io::open_mode::creat | ::fast_io::open_mode::trunc};
+                }
+#  ifdef UWVM_CPP_EXCEPTIONS
+                catch(::fast_io::error e)
+                {
+                    perf_map.failed = true;
+                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                        u8"[warn]  ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Unable to open perf map \"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                        path,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"\": ",
+                                        e,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                        u8" (runtime-llvm-jit-perf-map)\n",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                }
+#  endif
+            }
+
+            if(!perf_map.failed)
+            {
+#  ifdef UWVM_CPP_EXCEPTIONS
+                try
+#  endif
+                {
+                    ::fast_io::operations::write_all(perf_map.file, lines.cbegin(), lines.cend());
+                }
+#  ifdef UWVM_CPP_EXCEPTIONS
+                catch(::fast_io::error)
+                {
+                    // A short map only loses names in the perf report; stop writing rather than interrupt the run.
+                    perf_map.failed = true;
+                }
+#  endif
+            }
+
+            perf_map.lock.clear(::std::memory_order_release);
+        }
+# endif
+
         class uwvm_llvm_jit_debug_listener final : public ::llvm::JITEventListener
         {
         public:
             constexpr void
                 notifyObjectLoaded(ObjectKey, ::llvm::object::ObjectFile const& obj, ::llvm::RuntimeDyld::LoadedObjectInfo const& loaded) noexcept override
             {
+# if defined(__linux__)
+                if(runtime_llvm_jit_perf_map_requested()) { write_llvm_jit_perf_map(obj, loaded); }
+# endif
+                // The listener is also registered for the perf map alone, which allows background compilation; everything below
+                // belongs to unwind call stacks and runs on the main thread only.
+                if(!runtime_llvm_jit_unwind_call_stack_requested()) { return; }
+
                 // MCJIT reports loaded sections through this listener. Capture text ranges for fast IP filtering and retain debug
                 // objects so DWARF inline-frame lookup remains valid after finalization.
                 for(auto const& section: obj.sections())
@@ -2960,10 +3573,44 @@ namespace uwvm2::runtime::lib
             }
 #endif
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_USE_THREAD_LOCAL)
+            // Frameless interpreter calls never touch the logical stack. Each logical frame remembers how many frameless records existed
+            // when it was pushed, so the records between two frames are printed above the older one, newest first.
+            auto const& frameless{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+            auto const frameless_depth{static_cast<::std::size_t>(frameless.records_curr - frameless.records_begin)};
+            auto const dump_frameless_records{[&](::std::size_t lo, ::std::size_t hi) constexpr noexcept
+                                              {
+                                                  if(hi > frameless_depth) [[unlikely]] { hi = frameless_depth; }
+                                                  for(::std::size_t r{hi}; r > lo; --r)
+                                                  {
+                                                      auto const info{frameless.records_begin[r - 1uz].callee_info};
+                                                      if(info == nullptr) [[unlikely]] { continue; }
+                                                      if(info->module_id == suppressed_frame.module_id && info->function_index == suppressed_frame.function_index)
+                                                      {
+                                                          continue;
+                                                      }
+                                                      if(printed_frames.contains(info->module_id, info->function_index)) { continue; }
+                                                      if(dump_call_stack_frame_for_trap(u8log_output_ul, printed_frame_count, info->module_id, info->function_index))
+                                                      {
+                                                          printed_frames.record(info->module_id, info->function_index);
+                                                          ++printed_frame_count;
+                                                      }
+                                                  }
+                                              }};
+            ::std::size_t frameless_upper{frameless_depth};
+#endif
+
             for(::std::size_t i{}; i != n; ++i)
             {
                 auto const frame_index{n - 1uz - i};
                 auto const& fr{frames.index_unchecked(frame_index)};
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_USE_THREAD_LOCAL)
+                if(fr.frameless_depth < frameless_upper)
+                {
+                    dump_frameless_records(fr.frameless_depth, frameless_upper);
+                    frameless_upper = fr.frameless_depth;
+                }
+#endif
                 if(fr.module_id == suppressed_frame.module_id && fr.function_index == suppressed_frame.function_index) { continue; }
                 if(printed_frames.contains(fr.module_id, fr.function_index)) { continue; }
                 if(dump_call_stack_frame_for_trap(u8log_output_ul, printed_frame_count, fr.module_id, fr.function_index))
@@ -2973,6 +3620,12 @@ namespace uwvm2::runtime::lib
                 }
             }
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_USE_THREAD_LOCAL)
+            // Records below the oldest logical frame come from uwvm-int unwind call-stack mode (bridge-entered calls push no logical
+            // frame) or from a host entry that bypassed the logical stack.
+            dump_frameless_records(0uz, frameless_upper);
+#endif
+
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             auto const& tiered_snapshot{tiered_snapshot_for_trap};
             if(tiered_snapshot.active)
@@ -3011,11 +3664,22 @@ namespace uwvm2::runtime::lib
             ::fast_io::io::perrln(u8log_output_ul);
         }
 
+        inline constexpr void flush_wasip1_stdio_before_trap() noexcept
+        {
+#if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
+            // Guest output still held by `--wasip1-*-stdio-buffer` belongs before the trap report. The trap may come from a signal handler or
+            // interrupt a thread inside fd_write, so a buffer whose lock is taken is skipped instead of waited on.
+            ::uwvm2::uwvm::imported::wasi::wasip1::storage::flush_all_wasip1_stdio_buffers(false);
+#endif
+        }
+
 #if UWVM_HAS_CPP_ATTRIBUTE(clang::disable_tail_calls)
         [[clang::disable_tail_calls]]
 #endif
         inline constexpr void print_trap_fatal_message(trap_kind k) noexcept
         {
+            flush_wasip1_stdio_before_trap();
+
             // Print the fatal headline separately from the call stack so memory traps can reuse the same formatting after printing
             // detailed memory diagnostics.
             ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
@@ -3206,6 +3870,7 @@ namespace uwvm2::runtime::lib
 
         inline constexpr void print_memory_out_of_bounds_trap(::uwvm2::object::memory::error::memory_error_t const& memerr) noexcept
         {
+            flush_wasip1_stdio_before_trap();
             // Memory traps include structured memory-error details before the generic runtime trap headline and wasm call stack.
             ::uwvm2::object::memory::error::output_memory_error_line(memerr);
             print_trap_fatal_message(trap_kind::memory_out_of_bounds);
@@ -3226,6 +3891,7 @@ namespace uwvm2::runtime::lib
                                                      memerr.stack_pointer);
 #  endif
 # endif
+            flush_wasip1_stdio_before_trap();
             ::uwvm2::object::memory::error::output_mmap_memory_error_line(memerr);
             print_trap_fatal_message(trap_kind::memory_out_of_bounds);
             dump_call_stack_for_trap(trap_kind::memory_out_of_bounds);
@@ -3737,6 +4403,10 @@ namespace uwvm2::runtime::lib
             auto const compiled_functions{lazy_compiled_function_count()};
             auto const miss_count{g_runtime.lazy_runtime_miss_count.load(::std::memory_order_relaxed)};
             auto const compiled_hit_count{g_runtime.lazy_runtime_compiled_hit_count.load(::std::memory_order_relaxed)};
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            auto const call_indirect_ic_hits{g_runtime.call_indirect_inline_cache_hit_count.load(::std::memory_order_relaxed)};
+            auto const call_indirect_ic_misses{g_runtime.call_indirect_inline_cache_miss_count.load(::std::memory_order_relaxed)};
+# endif
 # if defined(UWVM_RUNTIME_LLVM_JIT)
             auto const llvm_jit_urgent_requests{g_runtime.llvm_jit_urgent_request_count.load(::std::memory_order_relaxed)};
 # endif
@@ -3810,6 +4480,13 @@ namespace uwvm2::runtime::lib
                                  miss_count,
                                  u8" compiled_hits=",
                                  compiled_hit_count
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+                                 ,
+                                 u8" call_indirect_ic_hits=",
+                                 call_indirect_ic_hits,
+                                 u8" call_indirect_ic_misses=",
+                                 call_indirect_ic_misses
+# endif
 # if defined(UWVM_RUNTIME_LLVM_JIT)
                                  ,
                                  u8" llvm_jit_urgent_requests=",
@@ -3956,6 +4633,28 @@ namespace uwvm2::runtime::lib
                                      g_runtime.llvm_jit_urgent_scheduler.queue_capacity,
                                      u8"\n");
             }
+# endif
+# if defined(UWVM_SUPPORT_MMAP)
+            // Only meaningful with `--wasm-set-memory-pool`; `fresh` counts reservations that missed the pool.
+            if(::uwvm2::uwvm::wasm::storage::configured_memory_pool.max_slots != 0uz)
+            {
+                auto const pool_stats{::uwvm2::object::memory::linear::get_mmap_memory_pool_stats()};
+                ::fast_io::io::print(::uwvm2::uwvm::io::u8runtime_log_output,
+                                     log_prefix,
+                                     u8"memory-pool fresh=",
+                                     pool_stats.fresh,
+                                     u8" reused=",
+                                     pool_stats.reused,
+                                     u8" recycled=",
+                                     pool_stats.recycled,
+                                     u8" unmapped=",
+                                     pool_stats.unmapped,
+                                     u8" pooled_slots=",
+                                     pool_stats.pooled_slots,
+                                     u8" pooled_bytes=",
+                                     pool_stats.pooled_bytes,
+                                     u8"\n");
+            }
 # endif
         }
 #endif
@@ -4438,6 +5137,19 @@ namespace uwvm2::runtime::lib
             return !::uwvm2::uwvm::runtime::runtime_mode::runtime_tiered_disable_llvm_full_jit;
         }
 
+        [[nodiscard]] inline constexpr bool tiered_full_compile_uses_profile() noexcept
+        {
+            // T1 branch counts only pay for their instrumentation when T2 runs a PassBuilder pipeline that reads `!prof`
+            // (block placement, inline hotness, hot/cold splitting); lighter full policies would ignore them.
+            namespace runtime_mode = ::uwvm2::uwvm::runtime::runtime_mode;
+            if(!tiered_t2_enabled() || !runtime_mode::runtime_tiered_profile_guided_full_jit || !runtime_mode::runtime_llvm_jit_full_policy_existed)
+            {
+                return false;
+            }
+            return runtime_mode::global_runtime_llvm_jit_full_policy == runtime_mode::runtime_llvm_jit_full_policy_t::passbuilder_o2 ||
+                   runtime_mode::global_runtime_llvm_jit_full_policy == runtime_mode::runtime_llvm_jit_full_policy_t::passbuilder_o3;
+        }
+
         [[nodiscard]] inline constexpr bool tiered_uses_tiered_targets() noexcept
         {
             // Direct-call slots become atomic tiered targets when either the interpreter tier or full LLVM tier can replace entries.
@@ -4795,6 +5507,31 @@ namespace uwvm2::runtime::lib
                 return;
             }
             configure_runtime_llvm_jit_call_stack_policy(opt);
+            opt.fuel_counter = runtime_fuel_counter();
+            opt.epoch_interrupt = runtime_epoch_interrupt();
+
+            // Snapshot T1 counts so T2 emission reads stable values while T1 code keeps running.  Counter arrays are sized by lazy
+            // emission under the materialize lock, so the copy takes the same lock to observe complete layouts.
+            ::uwvm2::utils::container::vector<::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::llvm_jit_function_profile_t> profile_snapshot{};
+            if(tiered_full_compile_uses_profile() && rec->tiered_function_profiles.size() == local_func_count)
+            {
+                ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::details::lazy_materialize_lock_guard materialize_guard{};
+                profile_snapshot.resize(local_func_count);
+                for(::std::size_t local_index{}; local_index != local_func_count; ++local_index)
+                {
+                    auto& live_counters{rec->tiered_function_profiles.index_unchecked(local_index).counters};
+                    auto& snapshot_counters{profile_snapshot.index_unchecked(local_index).counters};
+                    snapshot_counters.resize(live_counters.size());
+                    for(::std::size_t slot{}; slot != live_counters.size(); ++slot)
+                    {
+                        snapshot_counters.index_unchecked(slot) =
+                            ::std::atomic_ref<::std::size_t>{live_counters.index_unchecked(slot)}.load(::std::memory_order_relaxed);
+                    }
+                }
+                opt.function_profiles = profile_snapshot.data();
+                opt.function_profile_count = profile_snapshot.size();
+                opt.profile_mode = ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::llvm_jit_profile_mode_t::apply;
+            }
 
             bool compiled_ok{};
 #  ifdef UWVM_CPP_EXCEPTIONS
@@ -4821,6 +5558,15 @@ namespace uwvm2::runtime::lib
                 return;
             }
 
+            if(opt.profile_mode == ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::llvm_jit_profile_mode_t::apply &&
+               rec->llvm_jit_compiled.llvm_jit_module.llvm_module != nullptr)
+            {
+                ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::details::attach_runtime_llvm_jit_profile_summary(
+                    *rec->llvm_jit_compiled.llvm_jit_module.llvm_module,
+                    profile_snapshot.data(),
+                    profile_snapshot.size());
+            }
+
             if(!try_materialize_runtime_module_llvm_jit(*rec, false, ::llvm::CodeGenOptLevel::Less, 0uz)) [[unlikely]]
             {
                 mark_tiered_full_compile_failed(*rec);
@@ -5742,7 +6488,12 @@ namespace uwvm2::runtime::lib
             // edge for the interpreter callers. Capture the boundary before the raw entry so a trap inside an inlined or optimized
             // loop body can still report the interpreter caller chain below the generated frame.
             tiered_jit_entry_call_stack_snapshot_guard snapshot_guard{call_stack};
-            entry_fn(0u, reinterpret_cast<::std::uintptr_t>(result_buffer), result_bytes, reinterpret_cast<::std::uintptr_t>(local_base), local_bytes);
+            {
+#  if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+                function_profile_osr_scope profile{module_id, function_index};
+#  endif
+                entry_fn(0u, reinterpret_cast<::std::uintptr_t>(result_buffer), result_bytes, reinterpret_cast<::std::uintptr_t>(local_base), local_bytes);
+            }
             if(log_enabled) [[unlikely]] { g_runtime.tiered_osr_ready_count.fetch_add(1uz, ::std::memory_order_relaxed); }
             record_tiered_llvm_jit_switch(rec);
             return true;
@@ -7213,6 +7964,44 @@ namespace uwvm2::runtime::lib
             }
         }
 
+        [[nodiscard]] inline constexpr bool preload_memory_discard_impl(::std::size_t memory_index, ::std::uint_least64_t offset, ::std::size_t size) noexcept
+        {
+            // Discard has write semantics (the range reads back as zero), so it goes through the same descriptor and rights resolution as write.
+            resolved_preload_memory_t resolved{};
+            if(!try_build_preload_memory_descriptor(memory_index, nullptr, ::std::addressof(resolved), nullptr)) [[unlikely]] { return false; }
+
+            switch(resolved.kind)
+            {
+                case resolved_preload_memory_t::target_kind::native_defined:
+                {
+                    auto const memory{resolved.native_memory};
+                    if(memory == nullptr) [[unlikely]] { return false; }
+                    return ::uwvm2::object::memory::linear::discard_memory_range(*memory, offset, size);
+                }
+                case resolved_preload_memory_t::target_kind::local_imported:
+                {
+                    // Native-module memories only expose copy access; zero the range through it.
+                    auto const local_imported{resolved.local_imported};
+                    if(local_imported == nullptr) [[unlikely]] { return false; }
+
+                    constexpr ::std::size_t zero_chunk_size{4096uz};
+                    static constexpr ::std::byte zero_chunk[zero_chunk_size]{};
+                    while(size != 0uz)
+                    {
+                        auto const chunk{size < zero_chunk_size ? size : zero_chunk_size};
+                        if(!local_imported->memory_write_to_index(resolved.local_imported_index, offset, zero_chunk, chunk)) [[unlikely]] { return false; }
+                        offset += chunk;
+                        size -= chunk;
+                    }
+                    return true;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+        }
+
         // IMPORTANT:
         // Do NOT wrap `alloca` in a helper function that returns the pointer: `alloca` is stack-frame bound,
         // so allocating in a callee and returning the pointer is a dangling pointer unless the compiler inlines it.
@@ -7479,6 +8268,93 @@ namespace uwvm2::runtime::lib
             return reinterpret_cast<::std::byte*>((v + (a - 1uz)) & ~(a - 1uz));
         }
 
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) && defined(UWVM_USE_THREAD_LOCAL)
+        struct frameless_call_stack_owner
+        {
+            // Owns this thread's `optable::frameless_call_stack`. Frames that do not fit make `uwvmint_call_frameless` fall back to the
+            // native call bridge, so these sizes only bound how much wasm recursion stays inside one tail-call dispatch chain.
+            inline static constexpr ::std::size_t kRegionBytes{1uz << 20u};
+            inline static constexpr ::std::size_t kRecordCount{8192uz};
+            inline static constexpr ::std::size_t kRegionAlign{16uz};
+
+            using frameless_call_record_t = ::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_record_t;
+
+            ::std::byte* region{};
+            frameless_call_record_t* records{};
+
+            inline constexpr frameless_call_stack_owner() noexcept = default;
+
+            frameless_call_stack_owner(frameless_call_stack_owner const&) = delete;
+            frameless_call_stack_owner& operator= (frameless_call_stack_owner const&) = delete;
+
+            inline constexpr ~frameless_call_stack_owner()
+            {
+                ::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack = {};
+                if(records != nullptr) { byte_allocator::deallocate(records); }
+                if(region != nullptr) { byte_allocator::deallocate(region); }
+            }
+
+            inline constexpr void ensure() noexcept
+            {
+                // Provisioned once per thread and never moved: live records point into the region.
+                if(region != nullptr) [[likely]] { return; }
+
+                region = static_cast<::std::byte*>(byte_allocator::allocate(kRegionBytes + (kRegionAlign - 1uz)));
+                records = static_cast<frameless_call_record_t*>(byte_allocator::allocate(kRecordCount * sizeof(frameless_call_record_t)));
+                if(region == nullptr || records == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+                auto const region_begin{align_ptr_up(region, kRegionAlign)};
+                ::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack = {.region_begin = region_begin,
+                                                                                       .region_curr = region_begin,
+                                                                                       .region_end = region_begin + kRegionBytes,
+                                                                                       .records_begin = records,
+                                                                                       .records_curr = records,
+                                                                                       .records_end = records + kRecordCount};
+            }
+        };
+
+# if UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__tls_model__)
+#  ifdef UWVM
+        [[__gnu__::__tls_model__("local-exec")]]
+#  else
+        [[__gnu__::__tls_model__("local-dynamic")]]
+#  endif
+# endif
+        inline thread_local frameless_call_stack_owner g_frameless_call_stack{};  // [global] [thread_local]
+
+        [[nodiscard]] UWVM_ALWAYS_INLINE inline constexpr bool uwvm_int_unwind_call_stack_requested() noexcept
+        {
+            return ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_uwvm_int_call_stack ==
+                   ::uwvm2::uwvm::runtime::runtime_mode::runtime_uwvm_int_call_stack_t::unwind;
+        }
+
+        struct uwvm_int_unwind_frame_guard
+        {
+            // uwvm-int unwind call-stack mode: a bridge-entered interpreter call leaves one record on the frameless record stack instead
+            // of a logical frame. Its null local base never matches `uwvmint_return`, so the callee still returns natively; trap output
+            // walks the record stack and names the frame through the call-info pointer the call site already holds.
+            using frameless_call_record_t = ::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_record_t;
+
+            frameless_call_record_t* rec{};
+
+            inline constexpr explicit uwvm_int_unwind_frame_guard(::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack_t& fs,
+                                                                  ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const& info) noexcept :
+                rec{fs.records_curr}
+            {
+                rec->callee_local_base = nullptr;
+                rec->callee_info = ::std::addressof(info);
+                fs.records_curr = rec + 1;
+            }
+
+            uwvm_int_unwind_frame_guard(uwvm_int_unwind_frame_guard const&) = delete;
+            uwvm_int_unwind_frame_guard& operator= (uwvm_int_unwind_frame_guard const&) = delete;
+
+            // Pops this record on normal return.  The bridge is noexcept and a trap terminates from inside the callee, so this never
+            // runs on a trap path: the trap printer sees the record stack as it was when the trap fired.
+            inline constexpr ~uwvm_int_unwind_frame_guard() { ::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack.records_curr = rec; }
+        };
+#endif
+
         [[nodiscard]] inline constexpr ::uwvm2::utils::container::vector<::std::size_t> build_type_canon_index(runtime_module_storage_t const& module) noexcept
         {
             // Deduplicate equivalent type-section signatures so call_indirect checks can compare small canonical ids.
@@ -7758,7 +8634,14 @@ namespace uwvm2::runtime::lib
             constexpr ::std::size_t kAllocaMaxBytesPerFrame{4096uz};
             constexpr ::std::size_t kAllocaMaxCallDepth{128uz};
 # if defined(UWVM_USE_THREAD_LOCAL)
-            bool const use_scratch{frame_alloc_n > kAllocaMaxBytesPerFrame || call_stack.frames.size() > kAllocaMaxCallDepth};
+            // In uwvm-int unwind call-stack mode bridge-entered frames are counted on the record stack, not the logical one.
+            auto call_depth{call_stack.frames.size()};
+            if(uwvm_int_unwind_call_stack_requested())
+            {
+                auto const& frameless{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+                call_depth += static_cast<::std::size_t>(frameless.records_curr - frameless.records_begin);
+            }
+            bool const use_scratch{frame_alloc_n > kAllocaMaxBytesPerFrame || call_depth > kAllocaMaxCallDepth};
             thread_local_bump_allocator::mark_t scratch_mark{};
             if(use_scratch) { scratch_mark = g_call_scratch.mark(); }
 # else
@@ -7941,6 +8824,9 @@ namespace uwvm2::runtime::lib
                 ::fast_io::fast_terminate();
             }
             if(fn.primary_cu_index >= rec.lazy_compiled.compile_units.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
+# if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+            function_profile_compile_scope profile{module_id, function_index};
+# endif
 
             ::uwvm2::validation::error::code_validation_error_impl err{};
             ::uwvm2::runtime::compiler::uwvm_int::compile_cu_from_lazy_validator::lazy_compile_request_context ctx{.curr_module = runtime_module,
@@ -8037,7 +8923,7 @@ namespace uwvm2::runtime::lib
             if(para_bytes != 0uz) { ::std::memcpy(parbuf, caller_args_begin, para_bytes); }
 
             auto& call_stack{get_call_stack()};
-            auto const caller_module_id{call_stack.frames.empty() ? preload_call_context_t::invalid_module_id : call_stack.frames.back().module_id};
+            auto const caller_module_id{current_wasm_caller_module_id(call_stack)};
             call_local_imported_with_wasip1_env(*m, tgt.index, resbuf, parbuf, caller_module_id);
 
             if(res_bytes != 0uz) { ::std::memcpy(*caller_stack_top_ptr, resbuf, res_bytes); }
@@ -8067,7 +8953,7 @@ namespace uwvm2::runtime::lib
             if(para_bytes != 0uz) { ::std::memcpy(parbuf, caller_args_begin, para_bytes); }
 
             auto& call_stack{get_call_stack()};
-            auto const caller_module_id{call_stack.frames.empty() ? preload_call_context_t::invalid_module_id : call_stack.frames.back().module_id};
+            auto const caller_module_id{current_wasm_caller_module_id(call_stack)};
             call_capi_with_wasip1_env(*f, preload_module_memory_attribute, resbuf, parbuf, caller_module_id);
 
             if(res_bytes != 0uz) { ::std::memcpy(*caller_stack_top_ptr, resbuf, res_bytes); }
@@ -8130,6 +9016,9 @@ namespace uwvm2::runtime::lib
                 return false;
             }
             if(fn.primary_cu_index >= rec.llvm_jit_lazy_compiled.compile_units.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
+# if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+            function_profile_compile_scope profile{module_id, function_index};
+# endif
 
             ::uwvm2::validation::error::code_validation_error_impl err{};
             ::uwvm2::runtime::compiler::llvm_jit::compile_cu_from_lazy_validator::lazy_compile_request_context ctx{
@@ -8308,6 +9197,9 @@ namespace uwvm2::runtime::lib
             using entry_fn_t =
                 void(UWVM2_RUNTIME_LLVM_JIT_RAW_ENTRY_PTR_ABI*)(::std::uintptr_t, ::std::uintptr_t, ::std::size_t, ::std::uintptr_t, ::std::size_t);
             auto const entry_fn{reinterpret_cast<entry_fn_t>(function_address)};
+# if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+            function_profile_scope profile{module_id, function_index, true};
+# endif
             if(push_logical_entry_frame)
             {
                 // Tiered/no-T0 enters the raw JIT entry directly from the host. Some noreturn traps let LLVM erase or
@@ -8436,7 +9328,12 @@ namespace uwvm2::runtime::lib
             // interpreter stack. The guard makes that mixed boundary explicit, which is necessary when LLVM inlines the faulting
             // callee or folds the raw wrapper such that platform unwind data no longer exposes the original wasm caller chain.
             tiered_jit_entry_call_stack_snapshot_guard snapshot_guard{call_stack};
-            entry_fn(0u, pointer_to_uintptr(args_begin), result_bytes, pointer_to_uintptr(args_begin), param_bytes);
+            {
+#  if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+                function_profile_scope profile{module_id, function_index, true};
+#  endif
+                entry_fn(0u, pointer_to_uintptr(args_begin), result_bytes, pointer_to_uintptr(args_begin), param_bytes);
+            }
             *stack_top_ptr = args_begin + result_bytes;
             record_tiered_llvm_jit_switch(rec);
             return true;
@@ -8490,7 +9387,12 @@ namespace uwvm2::runtime::lib
             // native unwind, but its interpreter-side caller frames live only in TLS. Keep a short boundary snapshot across the
             // call so traps raised before control returns can merge both views into one wasm call stack.
             tiered_jit_entry_call_stack_snapshot_guard snapshot_guard{call_stack};
-            entry_fn(0u, pointer_to_uintptr(result_buffer), result_bytes, pointer_to_uintptr(param_buffer), param_bytes);
+            {
+#  if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+                function_profile_scope profile{module_id, function_index, true};
+#  endif
+                entry_fn(0u, pointer_to_uintptr(result_buffer), result_bytes, pointer_to_uintptr(param_buffer), param_bytes);
+            }
             record_tiered_llvm_jit_switch(rec);
             return true;
         }
@@ -8508,6 +9410,9 @@ namespace uwvm2::runtime::lib
             // Normal interpreter execution path: materialize the function lazily when needed, then run the compiled interpreter body.
             if(runtime_func == nullptr || compiled_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
             ensure_lazy_defined_function_compiled(module_id, function_index);
+# if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+            function_profile_scope profile{module_id, function_index, false};
+# endif
             execute_compiled_defined(call_stack, runtime_func, compiled_func, param_bytes, result_bytes, stack_top_ptr);
         }
 
@@ -8556,6 +9461,9 @@ namespace uwvm2::runtime::lib
             if(try_execute_tiered_llvm_jit_defined_from_stack_active(module_id, function_index, param_bytes, result_bytes, stack_top_ptr)) { return; }
             record_tiered_interpreter_entry(module_id, function_index);
             ensure_tiered_lazy_defined_function_compiled(module_id, function_index);
+#  if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+            function_profile_scope profile{module_id, function_index, false};
+#  endif
             execute_compiled_defined(call_stack, runtime_func, compiled_func, param_bytes, result_bytes, stack_top_ptr);
         }
 # endif
@@ -8655,6 +9563,9 @@ namespace uwvm2::runtime::lib
             {
                 ensure_lazy_defined_function_compiled(frame.module_id, frame.function_index);
             }
+# if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+            function_profile_scope profile{frame.module_id, frame.function_index, false};
+# endif
             execute_compiled_defined(call_stack, runtime_func, compiled_func, param_bytes, result_bytes, ::std::addressof(stack_top_ptr));
 
             if(result_bytes != 0uz) { ::std::memcpy(result_buffer, host_stack_base, result_bytes); }
@@ -10678,6 +11589,16 @@ namespace uwvm2::runtime::lib
             ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
                                                                               u8"call-stack",
                                                                               get_runtime_llvm_jit_call_stack_mode_name());
+            ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
+                                                                              u8"fuel",
+                                                                              ::uwvm2::uwvm::runtime::runtime_mode::runtime_fuel_existed
+                                                                                  ? ::uwvm2::utils::container::u8string_view{u8"on"}
+                                                                                  : ::uwvm2::utils::container::u8string_view{u8"off"});
+            ::uwvm2::runtime::llvm_jit_cache::details::append_cache_key_value(llvm_jit_cache_codegen_policy,
+                                                                              u8"epoch",
+                                                                              ::uwvm2::uwvm::runtime::runtime_mode::wasm_timeout_existed
+                                                                                  ? ::uwvm2::utils::container::u8string_view{u8"on"}
+                                                                                  : ::uwvm2::utils::container::u8string_view{u8"off"});
             append_runtime_llvm_jit_native_target_codegen_policy(llvm_jit_cache_codegen_policy, host_cpu_name, host_tune_cpu_name);
             auto llvm_jit_cache_context{::uwvm2::runtime::llvm_jit_cache::default_cache_context(
                 ::uwvm2::utils::container::u8string_view{llvm_jit_cache_key.data(), llvm_jit_cache_key.size()},
@@ -10690,6 +11611,9 @@ namespace uwvm2::runtime::lib
             // Reusing such an object across processes would turn those constants into stale pointers.
             llvm_jit_cache_policy.enable = false;
 # endif
+            // A profile-guided tier-2 module embeds this run's branch counts, so its object is neither reproducible from the key
+            // above nor worth reusing for a run with a different hot path.
+            if(merged_module->getProfileSummary(false) != nullptr) { llvm_jit_cache_policy.enable = false; }
 
             ::uwvm2::utils::container::vector<::uwvm2::utils::container::u8string> parallel_object_outputs{};
             ::std::size_t parallel_object_defined_function_count{};
@@ -10896,6 +11820,13 @@ namespace uwvm2::runtime::lib
                 llvm_jit_engine->setProcessAllSections(true);
                 llvm_jit_engine->RegisterJITEventListener(::std::addressof(get_uwvm_llvm_jit_debug_listener()));
             }
+# if defined(__linux__)
+            else if(runtime_llvm_jit_perf_map_requested())
+            {
+                // The perf map only needs symbol tables, so no extra sections are kept.
+                llvm_jit_engine->RegisterJITEventListener(::std::addressof(get_uwvm_llvm_jit_debug_listener()));
+            }
+# endif
             if(use_parallel_objects)
             {
                 // Feed each externally emitted object back into the MCJIT engine so symbol lookup and debug listeners work normally.
@@ -11108,6 +12039,10 @@ namespace uwvm2::runtime::lib
             trap_memory_out_of_bounds(::uwvm2::object::memory::error::memory_error_t const& memerr) noexcept
         { print_memory_out_of_bounds_trap(memerr); }
 
+        UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void trap_fuel_exhausted() noexcept { trap_fatal(trap_kind::fuel_exhausted); }
+
+        UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void trap_epoch_deadline() noexcept { trap_fatal(trap_kind::epoch_deadline); }
+
         template <bool TryTieredJit, typename... Args>
         UWVM_ALWAYS_INLINE inline constexpr void execute_defined_for_bridge(Args&&... args) noexcept
         {
@@ -11122,6 +12057,47 @@ namespace uwvm2::runtime::lib
             }
         }
 
+        template <bool TryTieredJit>
+        UWVM_ALWAYS_INLINE inline constexpr void
+            execute_tracked_defined_for_bridge(call_stack_tls_state& call_stack,
+                                               ::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const& info,
+                                               ::std::byte** stack_top_ptr) noexcept
+        {
+            // Every bridge-entered defined call is visible to trap output. The plain interpreter bridge can leave that to the interpreter's
+            // own record stack in unwind call-stack mode; tiered bridges may enter generated code and keep the logical frame.
+# if defined(UWVM_USE_THREAD_LOCAL)
+            if constexpr(!TryTieredJit)
+            {
+                if(uwvm_int_unwind_call_stack_requested())
+                {
+                    auto& frameless{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+                    if(frameless.records_curr != frameless.records_end) [[likely]]
+                    {
+                        uwvm_int_unwind_frame_guard g{frameless, info};
+                        execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+                        return;
+                    }
+                }
+            }
+# endif
+            call_stack_guard g{call_stack, info.module_id, info.function_index};
+            execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+        }
+
+        template <bool TryTieredJit>
+        UWVM_ALWAYS_INLINE inline constexpr void
+            execute_tracked_defined_for_bridge(call_stack_tls_state& call_stack, compiled_defined_func_info const& info, ::std::byte** stack_top_ptr) noexcept
+        {
+            // Cache entries without a compiler call-info record have no identity the record stack can hold; they stay logical.
+            if(info.compiled_call_info != nullptr) [[likely]]
+            {
+                execute_tracked_defined_for_bridge<TryTieredJit>(call_stack, *info.compiled_call_info, stack_top_ptr);
+                return;
+            }
+            call_stack_guard g{call_stack, info.module_id, info.function_index};
+            execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+        }
+
         template <bool TryTieredJit>
         inline constexpr void call_bridge_impl(::std::size_t wasm_module_id, ::std::size_t func_index, ::std::byte** stack_top_ptr) UWVM_THROWS
         {
@@ -11142,9 +12118,7 @@ namespace uwvm2::runtime::lib
 
                 if(try_execute_trivial_defined_call(*info, stack_top_ptr)) { return; }
 
-                auto& call_stack{get_call_stack()};
-                call_stack_guard g{call_stack, info->module_id, info->function_index};
-                execute_defined_for_bridge<TryTieredJit>(call_stack, *info, stack_top_ptr);
+                execute_tracked_defined_for_bridge<TryTieredJit>(get_call_stack(), *info, stack_top_ptr);
                 return;
             }
 
@@ -11207,13 +12181,12 @@ namespace uwvm2::runtime::lib
 
             auto const local_index{func_index - import_n};
             auto const lf{::std::addressof(module.local_defined_function_vec_storage.index_unchecked(local_index))};
-            call_stack_guard g{call_stack, wasm_module_id, func_index};
             if(wasm_module_id >= g_runtime.defined_func_cache.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
             auto const& mod_cache{g_runtime.defined_func_cache.index_unchecked(wasm_module_id)};
             if(local_index >= mod_cache.size()) [[unlikely]] { ::fast_io::fast_terminate(); }
             auto const& info{mod_cache.index_unchecked(local_index)};
             if(info.runtime_func != lf) [[unlikely]] { ::fast_io::fast_terminate(); }
-            execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+            execute_tracked_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
         }
 
         UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void
@@ -11232,10 +12205,31 @@ namespace uwvm2::runtime::lib
         }
 # endif
 
+        // Per-site call_indirect inline cache ways hold a `compiled_defined_call_info const*` for defined targets or a tagged
+        // `cached_import_target const*` for imported ones. Both point into metadata that outlives the compiled bytecode owning the slot.
+        inline constexpr ::std::uintptr_t call_indirect_inline_cache_imported_tag{1u};
+
+        inline constexpr void publish_call_indirect_inline_cache(::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t* inline_cache,
+                                                                 ::std::uintptr_t way_value) noexcept
+        {
+            // Insert most-recently-resolved first and shift older ways down. Concurrent readers may see a partially shifted slot; that is
+            // harmless because every way is re-validated against the live table element before dispatch.
+            if(inline_cache == nullptr) [[unlikely]] { return; }
+            constexpr auto way_count{::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t::way_count};
+            if(::std::atomic_ref<::std::uintptr_t>{inline_cache->ways[0]}.load(::std::memory_order_relaxed) == way_value) { return; }
+            for(::std::size_t way{way_count - 1uz}; way != 0uz; --way)
+            {
+                auto const older{::std::atomic_ref<::std::uintptr_t>{inline_cache->ways[way - 1uz]}.load(::std::memory_order_relaxed)};
+                ::std::atomic_ref<::std::uintptr_t>{inline_cache->ways[way]}.store(older, ::std::memory_order_relaxed);
+            }
+            ::std::atomic_ref<::std::uintptr_t>{inline_cache->ways[0]}.store(way_value, ::std::memory_order_relaxed);
+        }
+
         template <bool TryTieredJit>
         inline constexpr void call_indirect_bridge_impl(::std::size_t wasm_module_id,
                                                         ::std::size_t type_index,
                                                         ::std::size_t table_index,
+                                                        ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t* inline_cache,
                                                         ::std::byte** stack_top_ptr) UWVM_THROWS
         {
             // call_indirect must enforce wasm table bounds, null-element, and signature rules even when the eventual target is native
@@ -11260,6 +12254,98 @@ namespace uwvm2::runtime::lib
 
             auto const& elem{table->elems.index_unchecked(static_cast<::std::size_t>(selector_u32))};
 
+            auto const dispatch_defined{[&](::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const& info) UWVM_THROWS
+                                        {
+                                            if(try_execute_trivial_defined_call(info, stack_top_ptr)) { return; }
+                                            auto const rf{static_cast<runtime_local_func_storage_t const*>(info.runtime_func)};
+                                            if(rf == nullptr || info.compiled_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+                                            execute_tracked_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+                                        }};
+
+            auto const dispatch_imported{[&](cached_import_target const& tgt) UWVM_THROWS
+                                         {
+                                             call_stack_guard g{call_stack, tgt.frame.module_id, tgt.frame.function_index};
+                                             switch(tgt.k)
+                                             {
+                                                 case cached_import_target::kind::defined:
+                                                 {
+                                                     execute_defined_for_bridge<TryTieredJit>(call_stack,
+                                                                                              tgt.frame.module_id,
+                                                                                              tgt.frame.function_index,
+                                                                                              tgt.u.defined.runtime_func,
+                                                                                              tgt.u.defined.compiled_func,
+                                                                                              tgt.param_bytes,
+                                                                                              tgt.result_bytes,
+                                                                                              stack_top_ptr);
+                                                     return;
+                                                 }
+                                                 case cached_import_target::kind::local_imported:
+                                                 {
+                                                     invoke_local_imported(tgt.u.local_imported, tgt.param_bytes, tgt.result_bytes, stack_top_ptr);
+                                                     return;
+                                                 }
+                                                 case cached_import_target::kind::dl:
+                                                 case cached_import_target::kind::weak_symbol:
+                                                 {
+                                                     invoke_capi(tgt.u.capi_ptr,
+                                                                 tgt.preload_module_memory_attribute,
+                                                                 tgt.param_bytes,
+                                                                 tgt.result_bytes,
+                                                                 stack_top_ptr);
+                                                     return;
+                                                 }
+                                                 [[unlikely]] default:
+                                                 {
+                                                     ::fast_io::fast_terminate();
+                                                 }
+                                             }
+                                         }};
+
+            // Per-site inline cache: the slot belongs to this call_indirect instruction, so the expected type is fixed and a hit only has
+            // to prove that the live element still names the cached target. That check doubles as invalidation for table.set/grow/init.
+            if(inline_cache != nullptr) [[likely]]
+            {
+                for(::std::size_t way{}; way != ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t::way_count; ++way)
+                {
+                    auto const cached{::std::atomic_ref<::std::uintptr_t>{inline_cache->ways[way]}.load(::std::memory_order_relaxed)};
+                    if(cached == 0u) { break; }
+
+                    if((cached & call_indirect_inline_cache_imported_tag) == 0u)
+                    {
+                        if(elem.type != ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t::func_ref_defined) { continue; }
+                        auto const& info{*reinterpret_cast<::uwvm2::runtime::compiler::uwvm_int::optable::compiled_defined_call_info const*>(cached)};
+                        if(info.runtime_func != static_cast<void const*>(elem.storage.defined_ptr)) { continue; }
+                        if(::uwvm2::uwvm::io::enable_runtime_log) [[unlikely]]
+                        {
+                            g_runtime.call_indirect_inline_cache_hit_count.fetch_add(1uz, ::std::memory_order_relaxed);
+                        }
+                        dispatch_defined(info);
+                        return;
+                    }
+
+                    if(elem.type != ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t::func_ref_imported) { continue; }
+                    auto const tgt_ptr{reinterpret_cast<cached_import_target const*>(cached & ~call_indirect_inline_cache_imported_tag)};
+                    auto const imp_ptr{elem.storage.imported_ptr};
+                    auto const imp_base{module.imported_function_vec_storage.data()};
+                    auto const imp_n{module.imported_function_vec_storage.size()};
+                    if(imp_ptr == nullptr || imp_base == nullptr || imp_ptr < imp_base || imp_ptr >= imp_base + imp_n) { continue; }
+                    auto const& imp_cache{g_import_call_cache.index_unchecked(wasm_module_id)};
+                    auto const imp_idx{static_cast<::std::size_t>(imp_ptr - imp_base)};
+                    if(imp_idx >= imp_cache.size() || ::std::addressof(imp_cache.index_unchecked(imp_idx)) != tgt_ptr) { continue; }
+                    if(::uwvm2::uwvm::io::enable_runtime_log) [[unlikely]]
+                    {
+                        g_runtime.call_indirect_inline_cache_hit_count.fetch_add(1uz, ::std::memory_order_relaxed);
+                    }
+                    dispatch_imported(*tgt_ptr);
+                    return;
+                }
+
+                if(::uwvm2::uwvm::io::enable_runtime_log) [[unlikely]]
+                {
+                    g_runtime.call_indirect_inline_cache_miss_count.fetch_add(1uz, ::std::memory_order_relaxed);
+                }
+            }
+
             // The expected signature is taken from the caller module's type section, as required by the wasm call_indirect operand.
             auto const type_begin{module.type_section_storage.type_section_begin};
             auto const type_end{module.type_section_storage.type_section_end};
@@ -11270,8 +12356,8 @@ namespace uwvm2::runtime::lib
             auto const expected_ft_ptr{type_begin + type_index};
             if(expected_ft_ptr == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
 
-            // Inline cache: the common hot case is a stable (table, selector, expected-type) triple inside a loop.
-            // Cache the resolved call target to avoid repeating signature checks, pointer arithmetic and cache lookups.
+            // Thread-local second-level cache: shared by every site on this thread, so it still catches megamorphic sites whose targets keep
+            // rotating through the per-site ways. A hit refills the per-site slot.
             void const* const elems_data{table->elems.data()};
             auto const cache_index{static_cast<::std::size_t>(selector_u32) & (call_stack_tls_state::kCallIndirectCacheEntries - 1uz)};
             {
@@ -11284,12 +12370,8 @@ namespace uwvm2::runtime::lib
                         auto const def_ptr{elem.storage.defined_ptr};
                         if(def_ptr != nullptr && ic.target_ptr == static_cast<void const*>(def_ptr) && ic.defined_info != nullptr)
                         {
-                            auto const& info{*ic.defined_info};
-                            if(try_execute_trivial_defined_call(info, stack_top_ptr)) { return; }
-                            call_stack_guard g{call_stack, info.module_id, info.function_index};
-                            auto const rf{static_cast<runtime_local_func_storage_t const*>(info.runtime_func)};
-                            if(rf == nullptr || info.compiled_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
-                            execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+                            publish_call_indirect_inline_cache(inline_cache, reinterpret_cast<::std::uintptr_t>(ic.defined_info));
+                            dispatch_defined(*ic.defined_info);
                             return;
                         }
                     }
@@ -11298,38 +12380,10 @@ namespace uwvm2::runtime::lib
                         auto const imp_ptr{elem.storage.imported_ptr};
                         if(imp_ptr != nullptr && ic.target_ptr == static_cast<void const*>(imp_ptr) && ic.imported_tgt != nullptr)
                         {
-                            auto const& tgt{*ic.imported_tgt};
-                            call_stack_guard g{call_stack, tgt.frame.module_id, tgt.frame.function_index};
-                            switch(tgt.k)
-                            {
-                                case cached_import_target::kind::defined:
-                                {
-                                    execute_defined_for_bridge<TryTieredJit>(call_stack,
-                                                                             tgt.frame.module_id,
-                                                                             tgt.frame.function_index,
-                                                                             tgt.u.defined.runtime_func,
-                                                                             tgt.u.defined.compiled_func,
-                                                                             tgt.param_bytes,
-                                                                             tgt.result_bytes,
-                                                                             stack_top_ptr);
-                                    return;
-                                }
-                                case cached_import_target::kind::local_imported:
-                                {
-                                    invoke_local_imported(tgt.u.local_imported, tgt.param_bytes, tgt.result_bytes, stack_top_ptr);
-                                    return;
-                                }
-                                case cached_import_target::kind::dl:
-                                case cached_import_target::kind::weak_symbol:
-                                {
-                                    invoke_capi(tgt.u.capi_ptr, tgt.preload_module_memory_attribute, tgt.param_bytes, tgt.result_bytes, stack_top_ptr);
-                                    return;
-                                }
-                                [[unlikely]] default:
-                                {
-                                    ::fast_io::fast_terminate();
-                                }
-                            }
+                            publish_call_indirect_inline_cache(inline_cache,
+                                                               reinterpret_cast<::std::uintptr_t>(ic.imported_tgt) | call_indirect_inline_cache_imported_tag);
+                            dispatch_imported(*ic.imported_tgt);
+                            return;
                         }
                     }
                 }
@@ -11421,13 +12475,16 @@ namespace uwvm2::runtime::lib
                         ic.defined_info = info.compiled_call_info;
                         ic.imported_tgt = nullptr;
                     }
+                    if(info.compiled_call_info != nullptr)
+                    {
+                        publish_call_indirect_inline_cache(inline_cache, reinterpret_cast<::std::uintptr_t>(info.compiled_call_info));
+                    }
 
                     if(try_execute_trivial_defined_call(info, stack_top_ptr)) { return; }
 
-                    call_stack_guard g{call_stack, info.module_id, info.function_index};
                     auto const rf{static_cast<runtime_local_func_storage_t const*>(info.runtime_func)};
                     if(rf == nullptr || info.compiled_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
-                    execute_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
+                    execute_tracked_defined_for_bridge<TryTieredJit>(call_stack, info, stack_top_ptr);
                     return;
                 }
                 case ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t::func_ref_imported:
@@ -11499,38 +12556,11 @@ namespace uwvm2::runtime::lib
                         ic.defined_info = nullptr;
                         ic.imported_tgt = ::std::addressof(tgt);
                     }
+                    publish_call_indirect_inline_cache(inline_cache,
+                                                       reinterpret_cast<::std::uintptr_t>(::std::addressof(tgt)) | call_indirect_inline_cache_imported_tag);
 
-                    call_stack_guard g{call_stack, tgt.frame.module_id, tgt.frame.function_index};
-                    switch(tgt.k)
-                    {
-                        case cached_import_target::kind::defined:
-                        {
-                            execute_defined_for_bridge<TryTieredJit>(call_stack,
-                                                                     tgt.frame.module_id,
-                                                                     tgt.frame.function_index,
-                                                                     tgt.u.defined.runtime_func,
-                                                                     tgt.u.defined.compiled_func,
-                                                                     tgt.param_bytes,
-                                                                     tgt.result_bytes,
-                                                                     stack_top_ptr);
-                            return;
-                        }
-                        case cached_import_target::kind::local_imported:
-                        {
-                            invoke_local_imported(tgt.u.local_imported, tgt.param_bytes, tgt.result_bytes, stack_top_ptr);
-                            return;
-                        }
-                        case cached_import_target::kind::dl:
-                        case cached_import_target::kind::weak_symbol:
-                        {
-                            invoke_capi(tgt.u.capi_ptr, tgt.preload_module_memory_attribute, tgt.param_bytes, tgt.result_bytes, stack_top_ptr);
-                            return;
-                        }
-                        [[unlikely]] default:
-                        {
-                            ::fast_io::fast_terminate();
-                        }
-                    }
+                    dispatch_imported(tgt);
+                    return;
                 }
                 [[unlikely]] default:
                 {
@@ -11540,20 +12570,26 @@ namespace uwvm2::runtime::lib
         }
 
         UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void
-            call_indirect_bridge(::std::size_t wasm_module_id, ::std::size_t type_index, ::std::size_t table_index, ::std::byte** stack_top_ptr) UWVM_THROWS
+            call_indirect_bridge(::std::size_t wasm_module_id,
+                                 ::std::size_t type_index,
+                                 ::std::size_t table_index,
+                                 ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t* inline_cache,
+                                 ::std::byte** stack_top_ptr) UWVM_THROWS
         {
             // Standard interpreter call_indirect callback with wasm table/type checks and optional backend dispatch.
-            call_indirect_bridge_impl<false>(wasm_module_id, type_index, table_index, stack_top_ptr);
+            call_indirect_bridge_impl<false>(wasm_module_id, type_index, table_index, inline_cache, stack_top_ptr);
         }
 
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
-        UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void tiered_call_indirect_bridge(::std::size_t wasm_module_id,
-                                                                                                       ::std::size_t type_index,
-                                                                                                       ::std::size_t table_index,
-                                                                                                       ::std::byte** stack_top_ptr) UWVM_THROWS
+        UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR inline constexpr void
+            tiered_call_indirect_bridge(::std::size_t wasm_module_id,
+                                        ::std::size_t type_index,
+                                        ::std::size_t table_index,
+                                        ::uwvm2::runtime::compiler::uwvm_int::optable::call_indirect_inline_cache_t* inline_cache,
+                                        ::std::byte** stack_top_ptr) UWVM_THROWS
         {
             // Tier-aware indirect-call callback keeps wasm validation checks identical while allowing ready generated targets.
-            call_indirect_bridge_impl<true>(wasm_module_id, type_index, table_index, stack_top_ptr);
+            call_indirect_bridge_impl<true>(wasm_module_id, type_index, table_index, inline_cache, stack_top_ptr);
         }
 # endif
 
@@ -11604,6 +12640,8 @@ namespace uwvm2::runtime::lib
                 ::uwvm2::runtime::compiler::uwvm_int::optable::trap_integer_overflow_func = trap_integer_overflow;
                 ::uwvm2::runtime::compiler::uwvm_int::optable::trap_table_out_of_bounds_func = trap_table_out_of_bounds;
                 ::uwvm2::runtime::compiler::uwvm_int::optable::trap_memory_out_of_bounds_func = trap_memory_out_of_bounds;
+                ::uwvm2::runtime::compiler::uwvm_int::optable::trap_fuel_exhausted_func = trap_fuel_exhausted;
+                ::uwvm2::runtime::compiler::uwvm_int::optable::trap_epoch_deadline_func = trap_epoch_deadline;
 
 # if defined(UWVM_RUNTIME_LLVM_JIT) && defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
                 ::uwvm2::runtime::compiler::uwvm_int::optable::tiered_loop_osr_func = tiered_try_enter_loop_osr;
@@ -11655,6 +12693,10 @@ namespace uwvm2::runtime::lib
             // Interpreter-generated code stores callbacks in global optable slots, so those slots must be ready before any compiled
             // interpreter body can execute.
             if(initialize_interpreter_bridges && compile_uwvm_int_translation) { ensure_bridges_initialized(); }
+#  if defined(UWVM_USE_THREAD_LOCAL)
+            // Eager interpreter-only translation emits frameless local calls; every thread entering wasm here gets its frameless stack.
+            if(runtime_compiler == ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_only) { g_frameless_call_stack.ensure(); }
+#  endif
 # endif
             if(g_runtime.compiled_all.load(::std::memory_order_acquire)) { return; }
 
@@ -11989,6 +13031,10 @@ namespace uwvm2::runtime::lib
             g_runtime.lazy_prefetch_local_function_index = SIZE_MAX;
             g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+#  if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            g_runtime.call_indirect_inline_cache_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.call_indirect_inline_cache_miss_count.store(0uz, ::std::memory_order_relaxed);
+#  endif
             g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
 # endif
             g_runtime.modules.clear();
@@ -12072,6 +13118,14 @@ namespace uwvm2::runtime::lib
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
                 ::uwvm2::runtime::compiler::uwvm_int::optable::compile_option opt{};
                 opt.curr_wasm_id = module_id;
+                opt.fuel_counter = runtime_fuel_counter();
+                opt.epoch_interrupt = runtime_epoch_interrupt();
+                // Every body is translated before execution in this mode, so local calls may bypass the bridge's lazy-compile gate.
+                opt.frameless_local_calls = runtime_compiler == ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_only;
+#  if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+                // `--runtime-function-profile` counts calls at the bridge, and a frameless call never reaches it.
+                if(::uwvm2::uwvm::runtime::runtime_mode::runtime_function_profile_existed) { opt.frameless_local_calls = false; }
+#  endif
                 // First resolve the split size against the actual module before deciding how many worker threads are worthwhile.
                 auto const thread_resolution_compile_task_split_conf{
                     ::uwvm2::runtime::compiler::uwvm_int::compile_all_from_uwvm::resolve_effective_compile_task_split_config(*rec.runtime_module,
@@ -12285,6 +13339,8 @@ namespace uwvm2::runtime::lib
                         if(llvm_jit_wasm_feature_parameter == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
                         llvm_jit_opt.validator_feature_parameter = llvm_jit_wasm_feature_parameter;
                         configure_runtime_llvm_jit_call_stack_policy(llvm_jit_opt);
+                        llvm_jit_opt.fuel_counter = runtime_fuel_counter();
+                        llvm_jit_opt.epoch_interrupt = runtime_epoch_interrupt();
                         runtime_llvm_jit_legacy_light_task_preopt_context legacy_light_task_preopt_context{};
                         bool legacy_light_task_preopt_enabled{};
                         if(effective_module_extra_compile_threads != 0uz)
@@ -12719,6 +13775,8 @@ namespace uwvm2::runtime::lib
             g_import_call_cache.clear();
             g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.call_indirect_inline_cache_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.call_indirect_inline_cache_miss_count.store(0uz, ::std::memory_order_relaxed);
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
             g_wasip1_runtime_module_context_cache.clear();
 # endif
@@ -12772,6 +13830,8 @@ namespace uwvm2::runtime::lib
 
                 ::uwvm2::runtime::compiler::uwvm_int::optable::compile_option opt{};
                 opt.curr_wasm_id = module_id;
+                opt.fuel_counter = runtime_fuel_counter();
+                opt.epoch_interrupt = runtime_epoch_interrupt();
 
                 rec.lazy_compile_options.compile_options = opt;
                 rec.lazy_compile_options.validation_mode = lazy_validation_mode;
@@ -12959,6 +14019,8 @@ namespace uwvm2::runtime::lib
 
             g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.call_indirect_inline_cache_hit_count.store(0uz, ::std::memory_order_relaxed);
+            g_runtime.call_indirect_inline_cache_miss_count.store(0uz, ::std::memory_order_relaxed);
             g_runtime.lazy_prefetch_module_id = SIZE_MAX;
             g_runtime.lazy_prefetch_local_function_index = SIZE_MAX;
             g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
@@ -13157,6 +14219,8 @@ namespace uwvm2::runtime::lib
                 opt.curr_wasm_id = module_id;
                 opt.verify_llvm_jit_ir = !::uwvm2::uwvm::runtime::runtime_mode::runtime_llvm_jit_disable_ir_verifaction;
                 configure_runtime_llvm_jit_call_stack_policy(opt);
+                opt.fuel_counter = runtime_fuel_counter();
+                opt.epoch_interrupt = runtime_epoch_interrupt();
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
                 opt.emit_tiered_loop_reentry_entries = tiered_t0_backend;
 # endif
@@ -13167,8 +14231,12 @@ namespace uwvm2::runtime::lib
                     tiered_backend ? ::llvm::CodeGenOptLevel::Less :
 # endif
                                    ::llvm::CodeGenOptLevel::Less);
+                bool llvm_jit_listener_needed{opt.emit_unwind_call_stack_frames};
+# if defined(__linux__)
+                llvm_jit_listener_needed = llvm_jit_listener_needed || runtime_llvm_jit_perf_map_requested();
+# endif
                 rec.llvm_jit_lazy_compile_options.jit_event_listener =
-                    opt.emit_unwind_call_stack_frames ? ::std::addressof(get_uwvm_llvm_jit_debug_listener()) : nullptr;
+                    llvm_jit_listener_needed ? ::std::addressof(get_uwvm_llvm_jit_debug_listener()) : nullptr;
                 rec.llvm_jit_lazy_compile_options.validator_module_storage = find_lazy_validator_module_storage(rec.module_name);
                 rec.llvm_jit_lazy_compile_options.validator_feature_parameter = find_lazy_validator_feature_parameter_storage(rec.module_name);
                 opt.validator_feature_parameter = rec.llvm_jit_lazy_compile_options.validator_feature_parameter;
@@ -13205,6 +14273,8 @@ namespace uwvm2::runtime::lib
                     // while no-T0 tiered/lazy-JIT modes still need it for wasm1p1 constructs that are validated but not inline-lowered.
                     ::uwvm2::runtime::compiler::uwvm_int::optable::compile_option interpreter_opt{};
                     interpreter_opt.curr_wasm_id = module_id;
+                    interpreter_opt.fuel_counter = runtime_fuel_counter();
+                    interpreter_opt.epoch_interrupt = runtime_epoch_interrupt();
 
                     rec.lazy_compile_options.compile_options = interpreter_opt;
                     rec.lazy_compile_options.validation_mode = interpreter_lazy_validation_mode;
@@ -13322,6 +14392,15 @@ namespace uwvm2::runtime::lib
                     rec.tiered_entry_hot_counters.resize(local_n);
                     rec.tiered_osr_request_counters.clear();
                     rec.tiered_osr_request_counters.resize(local_n);
+                    rec.tiered_function_profiles.clear();
+                    if(tiered_full_compile_uses_profile())
+                    {
+                        rec.tiered_function_profiles.resize(local_n);
+                        auto& lazy_opt{rec.llvm_jit_lazy_compile_options.compile_options};
+                        lazy_opt.function_profiles = rec.tiered_function_profiles.data();
+                        lazy_opt.function_profile_count = rec.tiered_function_profiles.size();
+                        lazy_opt.profile_mode = ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm::llvm_jit_profile_mode_t::collect;
+                    }
                 }
                 else
                 {
@@ -13333,6 +14412,7 @@ namespace uwvm2::runtime::lib
                     rec.tiered_large_long_run_ready = 0u;
                     rec.tiered_entry_hot_counters.clear();
                     rec.tiered_osr_request_counters.clear();
+                    rec.tiered_function_profiles.clear();
                 }
 # endif
 
@@ -13615,6 +14695,567 @@ namespace uwvm2::runtime::lib
         }
 #endif
 
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+        // =========================================================================
+        // Sampling profiler (`--runtime-sample-profile`)
+        // -------------------------------------------------------------------------
+        // A per-thread CPU-time timer delivers SIGPROF to the guest thread. The handler only copies raw data into buffers sized at
+        // start: the interrupted PC and the logical wasm stack (TLS frames merged with uwvm-int frameless records, innermost first).
+        // Symbolization happens once at finish, because the JIT code-range and unwind-entry vectors are mutated by background
+        // compiler threads and cannot be searched from a signal handler.
+        // =========================================================================
+        struct sample_profile_sample_t
+        {
+            ::std::uintptr_t pc{};
+            ::std::uint_least32_t frame_begin{};
+            ::std::uint_least32_t frame_count{};
+        };
+
+        struct sample_profile_frame_t
+        {
+            ::std::uint_least32_t module_id{};
+            ::std::uint_least32_t function_index{};
+        };
+
+        struct sample_profile_state_t
+        {
+            inline static constexpr ::std::size_t max_samples{1uz << 18uz};
+            inline static constexpr ::std::size_t max_frame_pool{1uz << 19uz};
+            // Deeper stacks keep their innermost frames; folded output then starts below the true root.
+            inline static constexpr ::std::size_t max_stack_depth{64uz};
+
+            ::uwvm2::utils::container::vector<sample_profile_sample_t> samples{};
+            ::uwvm2::utils::container::vector<sample_profile_frame_t> frames{};
+            ::std::size_t sample_count{};
+            ::std::size_t frame_count{};
+            ::std::size_t dropped{};
+            int timer_id{};
+            bool timer_created{};
+            bool started{};
+            bool finished{};
+            ::std::atomic_bool active{};
+        };
+
+        inline sample_profile_state_t g_sample_profile{};  // [global]
+
+        // Kernel `struct sigevent` layout; the libc one hides the SIGEV_THREAD_ID target behind version-dependent member names.
+        struct sample_profile_kernel_sigevent_t
+        {
+            ::sigval value{};
+            int signo{};
+            int notify{};
+            int thread_id{};
+            int pad[(64uz - sizeof(::sigval)) / sizeof(int) - 3uz]{};
+        };
+
+        static_assert(sizeof(sample_profile_kernel_sigevent_t) == 64uz);
+
+        // `__NR_timer_settime` takes the `long`-based itimerspec on every Linux ABI, independent of the libc time_t width.
+        struct sample_profile_kernel_itimerspec_t
+        {
+            long interval_sec{};
+            long interval_nsec{};
+            long value_sec{};
+            long value_nsec{};
+        };
+
+# ifdef SIGEV_THREAD_ID
+        inline constexpr int sample_profile_sigev_thread_id{SIGEV_THREAD_ID};
+# else
+        inline constexpr int sample_profile_sigev_thread_id{4};
+# endif
+
+        inline void sample_profile_signal_handler([[maybe_unused]] int signal, [[maybe_unused]] ::siginfo_t* siginfo, void* context) noexcept
+        {
+            auto& prof{g_sample_profile};
+            if(!prof.active.load(::std::memory_order_relaxed)) [[unlikely]] { return; }
+
+            if(prof.sample_count == prof.samples.size() || prof.frames.size() - prof.frame_count < sample_profile_state_t::max_stack_depth) [[unlikely]]
+            {
+                ++prof.dropped;
+                return;
+            }
+
+            auto const frame_begin{prof.frame_count};
+            auto const frame_out{prof.frames.data() + frame_begin};
+            ::std::size_t depth{};
+            auto const record{[&](::std::size_t module_id, ::std::size_t function_index) constexpr noexcept
+                              {
+                                  if(depth == sample_profile_state_t::max_stack_depth) { return; }
+                                  frame_out[depth++] = sample_profile_frame_t{static_cast<::std::uint_least32_t>(module_id),
+                                                                              static_cast<::std::uint_least32_t>(function_index)};
+                              }};
+
+            // Same merge as the trap dump: frameless records newer than a logical frame sit above it, newest first.
+            // Walk the published depth rather than `frames.size()`: growth runs with SIGPROF blocked, so `frames.data()` is stable here, and
+            // the fence pairs with the one in `push`/`pop` so every slot below the snapshot is fully written.
+            auto const& call_stack{get_call_stack()};
+            auto const n{call_stack.signal_visible_depth};
+            ::std::atomic_signal_fence(::std::memory_order_acquire);
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            auto const& frameless{::uwvm2::runtime::compiler::uwvm_int::optable::frameless_call_stack};
+            auto const frameless_depth{static_cast<::std::size_t>(frameless.records_curr - frameless.records_begin)};
+            auto const record_frameless{[&](::std::size_t lo, ::std::size_t hi) constexpr noexcept
+                                        {
+                                            if(hi > frameless_depth) [[unlikely]] { hi = frameless_depth; }
+                                            for(::std::size_t r{hi}; r > lo; --r)
+                                            {
+                                                auto const info{frameless.records_begin[r - 1uz].callee_info};
+                                                if(info != nullptr) [[likely]] { record(info->module_id, info->function_index); }
+                                            }
+                                        }};
+            ::std::size_t frameless_upper{frameless_depth};
+# endif
+            for(::std::size_t i{}; i != n && depth != sample_profile_state_t::max_stack_depth; ++i)
+            {
+                auto const& fr{call_stack.frames.index_unchecked(n - 1uz - i)};
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+                if(fr.frameless_depth < frameless_upper)
+                {
+                    record_frameless(fr.frameless_depth, frameless_upper);
+                    frameless_upper = fr.frameless_depth;
+                }
+# endif
+                record(fr.module_id, fr.function_index);
+            }
+# if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+            record_frameless(0uz, frameless_upper);
+# endif
+
+            // Hot loops sample the same stack over and over; point at the previous sample's frames instead of growing the pool.
+            auto stored_begin{frame_begin};
+            if(prof.sample_count != 0uz)
+            {
+                auto const& prev{prof.samples.index_unchecked(prof.sample_count - 1uz)};
+                if(prev.frame_count == depth)
+                {
+                    auto const prev_frames{prof.frames.data() + prev.frame_begin};
+                    bool same{true};
+                    for(::std::size_t i{}; i != depth; ++i)
+                    {
+                        if(prev_frames[i].module_id != frame_out[i].module_id || prev_frames[i].function_index != frame_out[i].function_index)
+                        {
+                            same = false;
+                            break;
+                        }
+                    }
+                    if(same) { stored_begin = prev.frame_begin; }
+                }
+            }
+            if(stored_begin == frame_begin) { prof.frame_count += depth; }
+
+            prof.samples.index_unchecked(prof.sample_count++) =
+                sample_profile_sample_t{::uwvm2::object::memory::signal::detail::get_signal_instruction_address(context),
+                                        static_cast<::std::uint_least32_t>(stored_begin),
+                                        static_cast<::std::uint_least32_t>(depth)};
+        }
+
+        template <typename... Args>
+        inline constexpr void sample_profile_warn(Args&&... args) noexcept
+        {
+            if(!::uwvm2::uwvm::io::show_runtime_warning) { return; }
+
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                u8"[warn]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                ::std::forward<Args>(args)...,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8" (runtime-sample-profile)\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        // Arm the timer on the calling (guest) thread. Runs once; later `--runtime-reset-repeat` iterations keep accumulating.
+        inline void start_sample_profile_if_requested() noexcept
+        {
+            if(!::uwvm2::uwvm::runtime::runtime_mode::runtime_sample_profile_existed) { return; }
+
+            auto& prof{g_sample_profile};
+            if(prof.started) { return; }
+            prof.started = true;
+
+            prof.samples.resize(sample_profile_state_t::max_samples);
+            prof.frames.resize(sample_profile_state_t::max_frame_pool);
+            // Construct this thread's logical stack now so the handler never runs a TLS initializer.
+            static_cast<void>(get_call_stack());
+
+            struct ::sigaction act{};
+            act.sa_sigaction = sample_profile_signal_handler;
+            sigemptyset(::std::addressof(act.sa_mask));
+            act.sa_flags = SA_SIGINFO | SA_RESTART;
+            if(::uwvm2::object::memory::signal::posix::sigaction(SIGPROF, ::std::addressof(act), nullptr) != 0) [[unlikely]]
+            {
+                sample_profile_warn(u8"Unable to install the SIGPROF handler; no samples will be taken.");
+                return;
+            }
+
+            sample_profile_kernel_sigevent_t sev{};
+            sev.signo = SIGPROF;
+            sev.notify = sample_profile_sigev_thread_id;
+            sev.thread_id = ::fast_io::system_call<__NR_gettid, int>();
+
+            int timer_id{};
+            if(::fast_io::system_call<__NR_timer_create, int>(CLOCK_THREAD_CPUTIME_ID, ::std::addressof(sev), ::std::addressof(timer_id)) < 0) [[unlikely]]
+            {
+                sample_profile_warn(u8"Unable to create the thread CPU-time timer; no samples will be taken.");
+                return;
+            }
+            prof.timer_id = timer_id;
+            prof.timer_created = true;
+
+            constexpr ::std::uint_least64_t nanoseconds_per_second{1000000000u};
+            auto const period_ns{nanoseconds_per_second / ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_sample_profile_hz};
+            auto const sec{static_cast<long>(period_ns / nanoseconds_per_second)};
+            auto const nsec{static_cast<long>(period_ns % nanoseconds_per_second)};
+            sample_profile_kernel_itimerspec_t const its{sec, nsec, sec, nsec};
+
+            prof.active.store(true, ::std::memory_order_relaxed);
+            if(::fast_io::system_call<__NR_timer_settime, int>(timer_id, 0, ::std::addressof(its), nullptr) < 0) [[unlikely]]
+            {
+                prof.active.store(false, ::std::memory_order_relaxed);
+                sample_profile_warn(u8"Unable to arm the thread CPU-time timer; no samples will be taken.");
+            }
+        }
+
+        inline void append_sample_profile_frame_name(::uwvm2::utils::container::u8string& out, ::std::size_t module_id, ::std::size_t function_index) noexcept
+        {
+            // `;` separates frames and a newline ends the record in the folded format.
+            auto const append_sanitized{[&out](::uwvm2::utils::container::u8string_view s) constexpr noexcept
+                                        {
+                                            for(auto const c: s) { out.push_back(c == u8';' || c == u8'\n' || c == u8'\r' ? u8'_' : c); }
+                                        }};
+
+            ::uwvm2::utils::container::u8string_ref_uwvm ref{::std::addressof(out)};
+            if(module_id >= g_runtime.modules.size()) [[unlikely]]
+            {
+                ::fast_io::io::print(ref, u8"[unknown]::func[", function_index, u8"]");
+                return;
+            }
+
+            auto const& mod_rec{g_runtime.modules.index_unchecked(module_id)};
+            append_sanitized(resolve_module_display_name(mod_rec.module_name));
+            ::fast_io::io::print(ref, u8"::");
+            auto const fn_name{resolve_func_display_name(mod_rec.module_name, function_index)};
+            if(fn_name.empty()) { ::fast_io::io::print(ref, u8"func[", function_index, u8"]"); }
+            else
+            {
+                append_sanitized(fn_name);
+            }
+        }
+
+        // Stop sampling, symbolize, and write the folded stacks. Later calls are no-ops.
+        inline void finish_sample_profile() noexcept
+        {
+            auto& prof{g_sample_profile};
+            if(!prof.started || prof.finished) { return; }
+            prof.finished = true;
+
+            prof.active.store(false, ::std::memory_order_relaxed);
+            if(prof.timer_created) { ::fast_io::system_call<__NR_timer_delete, int>(prof.timer_id); }
+            ::std::atomic_signal_fence(::std::memory_order_seq_cst);
+
+            ::uwvm2::utils::container::unordered_flat_map<::uwvm2::utils::container::u8string,
+                                                          ::std::uint_least64_t,
+                                                          ::uwvm2::utils::container::pred::u8string_view_hash,
+                                                          ::uwvm2::utils::container::pred::u8string_view_equal>
+                stacks{};
+
+            ::uwvm2::utils::container::u8string key{};
+            for(::std::size_t s{}; s != prof.sample_count; ++s)
+            {
+                auto const& sample{prof.samples.index_unchecked(s)};
+                auto const frames{prof.frames.data() + sample.frame_begin};
+                key.clear();
+
+                // Frames are stored innermost first; folded stacks list the root first.
+                for(::std::size_t i{sample.frame_count}; i != 0uz; --i)
+                {
+                    if(!key.empty()) { key.push_back(u8';'); }
+                    append_sample_profile_frame_name(key, frames[i - 1uz].module_id, frames[i - 1uz].function_index);
+                }
+
+# if defined(UWVM_RUNTIME_LLVM_JIT)
+                // In LLVM unwind call-stack mode generated code pushes no logical frames, so the PC supplies the leaf.
+                if(auto const resolved{resolve_llvm_jit_unwind_entry(sample.pc)}; resolved.entry != nullptr)
+                {
+                    auto const leaf_module_id{resolved.entry->module_id};
+                    auto const leaf_function_index{resolved.entry->function_index};
+                    if(sample.frame_count == 0uz || frames[0].module_id != leaf_module_id || frames[0].function_index != leaf_function_index)
+                    {
+                        if(!key.empty()) { key.push_back(u8';'); }
+                        append_sample_profile_frame_name(key, leaf_module_id, leaf_function_index);
+                    }
+                }
+# endif
+
+                if(key.empty()) { key.append(::uwvm2::utils::container::u8string_view{u8"[host]"}); }
+                ++stacks[key];
+            }
+
+            auto const& path{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_sample_profile_path};
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                ::fast_io::u8obuf_file file{path, ::fast_io::open_mode::out | ::fast_io::open_mode::creat | ::fast_io::open_mode::trunc};
+                for(auto const& [stack, count]: stacks) { ::fast_io::io::print(file, stack, u8" ", count, u8"\n"); }
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error e)
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                    u8"[error] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Unable to write sample profile \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\": ",
+                                    e,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                    u8" (runtime-sample-profile)\n\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                return;
+            }
+# endif
+
+            if(prof.dropped != 0uz)
+            {
+                sample_profile_warn(u8"The sample buffer filled up; ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    prof.dropped,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8" later samples were dropped. Lower the sampling frequency for long runs.");
+            }
+
+            if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                    u8"[info]  ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Wrote ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    prof.sample_count,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8" samples (",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    stacks.size(),
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8" distinct stacks) to \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\". ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
+                                    u8"[",
+                                    ::uwvm2::uwvm::io::get_local_realtime(),
+                                    u8"] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                    u8"(verbose)\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            }
+        }
+#endif
+
+#if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+        struct function_profile_row_t
+        {
+            ::std::size_t module_id{};
+            ::std::size_t function_index{};
+            function_profile_counters_t const* counters{};
+        };
+
+        inline void append_function_profile_json_string(::uwvm2::utils::container::u8string& out, ::uwvm2::utils::container::u8string_view s) noexcept
+        {
+            constexpr char8_t hex_digits[]{u8"0123456789abcdef"};
+            out.push_back(u8'"');
+            for(auto const c: s)
+            {
+                if(c == u8'"' || c == u8'\\')
+                {
+                    out.push_back(u8'\\');
+                    out.push_back(c);
+                }
+                else if(static_cast<unsigned>(c) < 0x20u)
+                {
+                    out.append(::uwvm2::utils::container::u8string_view{u8"\\u00"});
+                    out.push_back(hex_digits[static_cast<unsigned>(c) >> 4u]);
+                    out.push_back(hex_digits[static_cast<unsigned>(c) & 0xFu]);
+                }
+                else
+                {
+                    out.push_back(c);
+                }
+            }
+            out.push_back(u8'"');
+        }
+
+        // Stop counting and write the report, hottest self time first. Later calls are no-ops.
+        inline void finish_function_profile() noexcept
+        {
+            auto& prof{g_function_profile};
+            if(!prof.started || prof.finished) { return; }
+            prof.finished = true;
+            prof.active = false;
+
+            // Cycle counters tick at a fixed rate unrelated to the clock; derive the rate from the span of the whole profile.
+            auto const elapsed_ticks{function_profile_ticks() - prof.start_ticks};
+            auto const elapsed_ns{function_profile_clock_ns() - prof.start_ns};
+            double const ns_per_tick{elapsed_ticks == 0u ? 0.0 : static_cast<double>(elapsed_ns) / static_cast<double>(elapsed_ticks)};
+            auto const to_ns{[ns_per_tick](::std::uint_least64_t ticks) constexpr noexcept -> ::std::uint_least64_t
+                             { return static_cast<::std::uint_least64_t>(static_cast<double>(ticks) * ns_per_tick); }};
+
+            ::uwvm2::utils::container::vector<function_profile_row_t> rows{};
+            ::std::uint_least64_t self_sum{};
+            for(::std::size_t module_id{}; module_id != prof.modules.size(); ++module_id)
+            {
+                auto const& mod{prof.modules.index_unchecked(module_id)};
+                for(::std::size_t i{}; i != mod.local_count; ++i)
+                {
+                    auto const& c{prof.counters.index_unchecked(mod.counter_base + i)};
+                    if(c.calls == 0u && c.osr_entries == 0u && c.compile_ticks == 0u) { continue; }
+                    rows.push_back(function_profile_row_t{.module_id = module_id, .function_index = mod.import_count + i, .counters = ::std::addressof(c)});
+                    self_sum += c.self_ticks;
+                }
+            }
+            ::std::sort(rows.begin(),
+                        rows.end(),
+                        [](function_profile_row_t const& a, function_profile_row_t const& b) constexpr noexcept
+                        { return a.counters->self_ticks > b.counters->self_ticks; });
+
+            ::uwvm2::utils::container::u8string out{};
+            ::uwvm2::utils::container::u8string_ref_uwvm ref{::std::addressof(out)};
+            ::uwvm2::utils::container::u8string name{};
+
+            if(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_function_profile_format ==
+               ::uwvm2::uwvm::runtime::runtime_mode::runtime_function_profile_format_t::json)
+            {
+                ::fast_io::io::print(ref, u8"{\"elapsed_ns\":", elapsed_ns, u8",\"functions\":[");
+                bool first{true};
+                for(auto const& row: rows)
+                {
+                    auto const& c{*row.counters};
+                    auto const& mod_rec{g_runtime.modules.index_unchecked(row.module_id)};
+                    auto const self_ns{to_ns(c.self_ticks)};
+                    auto const llvm_ns{to_ns(c.llvm_self_ticks)};
+                    ::fast_io::io::print(ref, first ? u8"\n{\"module\":" : u8",\n{\"module\":");
+                    first = false;
+                    append_function_profile_json_string(out, resolve_module_display_name(mod_rec.module_name));
+                    ::fast_io::io::print(ref, u8",\"index\":", row.function_index, u8",\"name\":");
+                    append_function_profile_json_string(out, resolve_func_display_name(mod_rec.module_name, row.function_index));
+                    ::fast_io::io::print(ref,
+                                         u8",\"calls\":",
+                                         c.calls,
+                                         u8",\"llvm_calls\":",
+                                         c.llvm_calls,
+                                         u8",\"osr_entries\":",
+                                         c.osr_entries,
+                                         u8",\"total_ns\":",
+                                         to_ns(c.total_ticks),
+                                         u8",\"self_ns\":",
+                                         self_ns,
+                                         u8",\"interpreter_ns\":",
+                                         self_ns > llvm_ns ? self_ns - llvm_ns : 0u,
+                                         u8",\"llvm_ns\":",
+                                         llvm_ns,
+                                         u8",\"compile_ns\":",
+                                         to_ns(c.compile_ticks),
+                                         u8"}");
+                }
+                ::fast_io::io::print(ref, u8"\n]}\n");
+            }
+            else
+            {
+                // Times are in microseconds; `int` and `llvm` split the self time by where the function body ran.
+                ::fast_io::io::print(ref,
+                                     ::fast_io::mnp::right(u8"self(us)", 14),
+                                     ::fast_io::mnp::right(u8"self%", 7),
+                                     ::fast_io::mnp::right(u8"total(us)", 14),
+                                     ::fast_io::mnp::right(u8"calls", 12),
+                                     ::fast_io::mnp::right(u8"int(us)", 14),
+                                     ::fast_io::mnp::right(u8"llvm(us)", 14),
+                                     ::fast_io::mnp::right(u8"llvm-calls", 12),
+                                     ::fast_io::mnp::right(u8"osr", 8),
+                                     ::fast_io::mnp::right(u8"compile(us)", 13),
+                                     u8"  function\n");
+                for(auto const& row: rows)
+                {
+                    auto const& c{*row.counters};
+                    auto const& mod_rec{g_runtime.modules.index_unchecked(row.module_id)};
+                    auto const self_ns{to_ns(c.self_ticks)};
+                    auto const llvm_ns{to_ns(c.llvm_self_ticks)};
+                    auto const self_permille{self_sum == 0u ? 0u : static_cast<::std::uint_least64_t>(static_cast<double>(c.self_ticks) * 1000.0 /
+                                                                                                         static_cast<double>(self_sum))};
+
+                    name.clear();
+                    ::uwvm2::utils::container::u8string_ref_uwvm name_ref{::std::addressof(name)};
+                    ::fast_io::io::print(name_ref, resolve_module_display_name(mod_rec.module_name), u8"::");
+                    if(auto const fn_name{resolve_func_display_name(mod_rec.module_name, row.function_index)}; fn_name.empty())
+                    {
+                        ::fast_io::io::print(name_ref, u8"func[", row.function_index, u8"]");
+                    }
+                    else
+                    {
+                        ::fast_io::io::print(name_ref, fn_name);
+                    }
+
+                    ::fast_io::io::print(ref,
+                                         ::fast_io::mnp::right(self_ns / 1000u, 14),
+                                         ::fast_io::mnp::right(self_permille / 10u, 5),
+                                         u8".",
+                                         self_permille % 10u,
+                                         ::fast_io::mnp::right(to_ns(c.total_ticks) / 1000u, 14),
+                                         ::fast_io::mnp::right(c.calls, 12),
+                                         ::fast_io::mnp::right((self_ns > llvm_ns ? self_ns - llvm_ns : 0u) / 1000u, 14),
+                                         ::fast_io::mnp::right(llvm_ns / 1000u, 14),
+                                         ::fast_io::mnp::right(c.llvm_calls, 12),
+                                         ::fast_io::mnp::right(c.osr_entries, 8),
+                                         ::fast_io::mnp::right(to_ns(c.compile_ticks) / 1000u, 13),
+                                         u8"  ",
+                                         name,
+                                         u8"\n");
+                }
+            }
+
+            auto const& path{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_function_profile_path};
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                ::fast_io::u8obuf_file file{path, ::fast_io::open_mode::out | ::fast_io::open_mode::creat | ::fast_io::open_mode::trunc};
+                ::fast_io::io::print(file, out);
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error e)
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                    u8"[error] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Unable to write function profile \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\": ",
+                                    e,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                    u8" (runtime-function-profile)\n\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            }
+# endif
+        }
+#endif
+
     }  // namespace
 
 #if defined(UWVM_RUNTIME_LLVM_JIT)
@@ -13710,6 +15351,16 @@ namespace uwvm2::runtime::lib
                 trap_fatal(trap_kind::runtime_invariant_failure);
                 return;
             }
+            case llvm_jit_trap_kind::fuel_exhausted:
+            {
+                trap_fatal(trap_kind::fuel_exhausted);
+                return;
+            }
+            case llvm_jit_trap_kind::epoch_deadline:
+            {
+                trap_fatal(trap_kind::epoch_deadline);
+                return;
+            }
             [[unlikely]] default:
             {
                 trap_fatal(trap_kind::runtime_invariant_failure);
@@ -13834,6 +15485,15 @@ namespace uwvm2::runtime::lib
         auto const main_module{g_runtime.modules.index_unchecked(main_id).runtime_module};
         if(main_module == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
 
+        refill_runtime_fuel();
+        arm_runtime_epoch_deadline();
+# if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+        start_sample_profile_if_requested();
+# endif
+# if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+        start_function_profile_if_requested();
+# endif
+
 # if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
         auto& entry_wasip1_env{resolve_wasip1_env_for_runtime_module_id(main_id)};
         bind_wasip1_memory_for_selected_env(entry_wasip1_env, main_id);
@@ -14132,6 +15792,15 @@ namespace uwvm2::runtime::lib
         auto const main_module{g_runtime.modules.index_unchecked(main_id).runtime_module};
         if(main_module == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
 
+        refill_runtime_fuel();
+        arm_runtime_epoch_deadline();
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+        start_sample_profile_if_requested();
+#endif
+#if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+        start_function_profile_if_requested();
+#endif
+
 #if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
         // Keep the entry module's WASI environment selected across the hot run loop.
         auto& entry_wasip1_env{resolve_wasip1_env_for_runtime_module_id(main_id)};
@@ -14389,6 +16058,13 @@ namespace uwvm2::runtime::lib
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
         g_runtime.tiered_urgent_scheduler.stop();
 # endif
+#endif
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+        // proc_exit never returns to the run loop, so the profile is written here instead.
+        finish_sample_profile();
+#endif
+#if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+        finish_function_profile();
 #endif
     }
 
@@ -14412,6 +16088,10 @@ namespace uwvm2::runtime::lib
         g_runtime.lazy_prefetch_local_function_index = SIZE_MAX;
         g_runtime.lazy_runtime_miss_count.store(0uz, ::std::memory_order_relaxed);
         g_runtime.lazy_runtime_compiled_hit_count.store(0uz, ::std::memory_order_relaxed);
+#  if defined(UWVM_RUNTIME_UWVM_INTERPRETER)
+        g_runtime.call_indirect_inline_cache_hit_count.store(0uz, ::std::memory_order_relaxed);
+        g_runtime.call_indirect_inline_cache_miss_count.store(0uz, ::std::memory_order_relaxed);
+#  endif
         g_runtime.lazy_prefetch_lock.clear(::std::memory_order_release);
 # endif
 
@@ -14596,7 +16276,7 @@ namespace uwvm2::runtime::lib
     //
     // Descriptor coverage:
     // - count/at operate on policy-visible memories, not raw runtime memory indices.
-    // - read/write perform backend-specific range validation before copying bytes.
+    // - read/write perform backend-specific range validation before copying bytes; discard validates the same way before zeroing.
     // - zero-length operations are accepted when the active descriptor resolves.
     // - mmap descriptors expose direct views only when rights and backend state allow it.
     extern "C++" [[nodiscard]] ::std::size_t preload_memory_descriptor_count_host_api() noexcept
@@ -14625,8 +16305,57 @@ namespace uwvm2::runtime::lib
         return preload_memory_write_impl(memory_index, offset, source, size);
     }
 
+    extern "C++" [[nodiscard]] bool preload_memory_discard_host_api(::std::size_t memory_index, ::std::uint_least64_t offset, ::std::size_t size) noexcept
+    {
+        // Zero a selected preload memory range and release its whole pages (memory-discard proposal).
+        return preload_memory_discard_impl(memory_index, offset, size);
+    }
+
+    extern "C++" void epoch_increment_host_api() noexcept
+    {
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) || defined(UWVM_RUNTIME_LLVM_JIT)
+        // Advance the `--wasm-timeout` epoch; an embedder driving its own clock calls this instead of relying on the ticker.
+        increment_runtime_epoch();
+#endif
+    }
+
+    extern "C++" void epoch_set_deadline_host_api(::std::uint_least64_t ticks) noexcept
+    {
+#if defined(UWVM_RUNTIME_UWVM_INTERPRETER) || defined(UWVM_RUNTIME_LLVM_JIT)
+        // Re-arm the interrupt `ticks` epochs from now; guest code traps at its next check once the epoch reaches it.
+        set_runtime_epoch_deadline(ticks);
+#else
+        static_cast<void>(ticks);
+#endif
+    }
+
+    extern "C++" void sample_profile_finish_host_api() noexcept
+    {
+#if UWVM2_RUNTIME_HAS_SAMPLE_PROFILER
+        // Stop `--runtime-sample-profile` and write its folded stacks. Must run before JIT state is reset: leaf PCs are resolved here.
+        finish_sample_profile();
+#endif
+    }
+
+    extern "C++" void function_profile_finish_host_api() noexcept
+    {
+#if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+        // Write the `--runtime-function-profile` report; names come from the module storage, so call it before teardown.
+        finish_function_profile();
+#endif
+    }
+
+    extern "C++" void wasip1_stdio_flush_host_api() noexcept
+    {
+#if !defined(UWVM_DISABLE_LOCAL_IMPORTED_WASIP1) && defined(UWVM_IMPORT_WASI_WASIP1)
+        // Normal exit: the guest has returned, so no WASI call can hold a buffer lock.
+        ::uwvm2::uwvm::imported::wasi::wasip1::storage::flush_all_wasip1_stdio_buffers(true);
+#endif
+    }
+
 }  // namespace uwvm2::runtime::lib
 
+#pragma pop_macro("UWVM2_RUNTIME_HAS_SAMPLE_PROFILER")
 #pragma pop_macro("UWVM2_RUNTIME_INTERPRETER_CALLBACK_FUNC_ATTR")
 #pragma pop_macro("UWVM2_RUNTIME_LLVM_JIT_RAW_ENTRY_FUNC_ATTR")
 #pragma pop_macro("UWVM2_RUNTIME_LLVM_JIT_RAW_ENTRY_PTR_ABI")
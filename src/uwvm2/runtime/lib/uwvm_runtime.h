@@ -104,6 +104,21 @@ UWVM_MODULE_EXPORT namespace uwvm2::runtime::lib
                                                             ::uwvm2::uwvm::wasm::type::uwvm_preload_memory_descriptor_t* out) noexcept;
     extern "C++" bool preload_memory_read_host_api(::std::size_t memory_index, ::std::uint_least64_t offset, void* destination, ::std::size_t size) noexcept;
     extern "C++" bool preload_memory_write_host_api(::std::size_t memory_index, ::std::uint_least64_t offset, void const* source, ::std::size_t size) noexcept;
+    extern "C++" bool preload_memory_discard_host_api(::std::size_t memory_index, ::std::uint_least64_t offset, ::std::size_t size) noexcept;
+
+    extern "C++" void epoch_increment_host_api() noexcept;
+    extern "C++" void epoch_set_deadline_host_api(::std::uint_least64_t ticks) noexcept;
+
+    /// @brief Stop the `--runtime-sample-profile` timer and write the folded-stack file; no-op when profiling is off or already written.
+    /// @note  Call after the last run and before `llvm_jit_reset_runtime_state_host_api()`, which drops the JIT address map used to
+    ///        attribute sampled PCs.
+    extern "C++" void sample_profile_finish_host_api() noexcept;
+
+    /// @brief Write the `--runtime-function-profile` report; no-op when the profiler is compiled out, not requested, or already written.
+    extern "C++" void function_profile_finish_host_api() noexcept;
+
+    /// @brief Write out every WASI environment's buffered guest stdout/stderr; no-op when WASI or stdio buffering is disabled.
+    extern "C++" void wasip1_stdio_flush_host_api() noexcept;
 }  // namespace uwvm2::runtime::lib
 
 #ifndef UWVM_MODULE
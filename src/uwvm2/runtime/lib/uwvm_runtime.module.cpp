@@ -42,6 +42,10 @@
 #elif !UWVM_HAS_BUILTIN(__builtin_alloca)
 # include <alloca.h>
 #endif
+#if defined(__linux__)
+# include <signal.h>
+# include <time.h>
+#endif
 #if defined(UWVM_RUNTIME_LLVM_JIT)
 # include <llvm/Analysis/TargetTransformInfo.h>
 # include <llvm/ADT/StringMap.h>
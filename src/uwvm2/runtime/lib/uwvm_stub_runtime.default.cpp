@@ -67,4 +67,22 @@ namespace uwvm2::runtime::lib
         static_cast<void>(size);
         return false;
     }
+
+    extern "C++" bool preload_memory_discard_host_api(::std::size_t memory_index, ::std::uint_least64_t offset, ::std::size_t size) noexcept
+    {
+        static_cast<void>(memory_index);
+        static_cast<void>(offset);
+        static_cast<void>(size);
+        return false;
+    }
+
+    extern "C++" void epoch_increment_host_api() noexcept {}
+
+    extern "C++" void epoch_set_deadline_host_api(::std::uint_least64_t ticks) noexcept { static_cast<void>(ticks); }
+
+    extern "C++" void sample_profile_finish_host_api() noexcept {}
+
+    extern "C++" void function_profile_finish_host_api() noexcept {}
+
+    extern "C++" void wasip1_stdio_flush_host_api() noexcept {}
 }  // namespace uwvm2::runtime::lib
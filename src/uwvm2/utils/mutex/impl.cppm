@@ -24,6 +24,7 @@ module;
 export module uwvm2.utils.mutex;
 export import :wrapper;
 export import :rw_spin_lock;
+export import :sharded_rw_lock;
 export import :mere_release;
 export import :lock_all;
 
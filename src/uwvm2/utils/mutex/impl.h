@@ -24,6 +24,7 @@
 #ifndef UWVM_MODULE
 # include "wrapper.h"
 # include "rw_spin_lock.h"
+# include "sharded_rw_lock.h"
 # include "mere_release.h"
 # include "lock_all.h"
 #endif
@@ -0,0 +1,179 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstdint>
+# include <cstddef>
+# include <memory>
+# include <atomic>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include "rw_spin_lock.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::utils::mutex
+{
+    /// @brief Number of reader shards in `sharded_rwlock_t`. Threads beyond this count share shards round-robin.
+    inline constexpr ::std::size_t sharded_rwlock_shard_count{16uz};
+
+    /// @brief Distance between two reader counters. Counters exactly this far apart never share a cache line, whatever the base address, so the lock
+    ///        needs no over-alignment and can live in any container.
+    inline constexpr ::std::size_t sharded_rwlock_stride{64uz};
+
+    /// @brief Reader counter of one shard, padded to `sharded_rwlock_stride`.
+    struct sharded_rwlock_shard_t
+    {
+        ::std::atomic_size_t readers{};
+        ::std::byte padding[sharded_rwlock_stride - sizeof(::std::atomic_size_t)]{};
+    };
+
+    /// @brief Reader-sharded RW spin lock ("big reader" lock) for read-mostly tables.
+    /// @details
+    ///   `rwlock_t` keeps all readers in one state word, so every shared acquisition is a CAS on a cache line that all cores write.
+    ///   Here a reader increments the counter of the shard assigned to its thread and then reads `writer`, which stays in the shared
+    ///   cache state while no writer runs. Readers on different shards therefore write no common cache line.
+    ///
+    ///   This is still a lock, not a lock-free read path: a shared acquisition is two atomic read-modify-writes on the shard counter, a
+    ///   reader spins while a writer holds or waits for the lock, and threads beyond `sharded_rwlock_shard_count` share counters and
+    ///   contend on them again. It only guards the caller's data; it does not change how that data is looked up.
+    ///
+    ///   Writers pay for it: they raise `writer` and wait until every shard has drained. Use it where writes are rare (creating and
+    ///   closing fds) and reads are on every call.
+    ///   - Writer-preferred: once `writer` is set, new readers back off until it is released, so writers cannot be starved.
+    ///   - Not recursive: a thread holding a shared guard must not take another one on the same lock, as with `rw_fair_shared_guard_t`.
+    struct sharded_rwlock_t
+    {
+        ::std::atomic_bool writer{};
+        ::std::byte padding[sharded_rwlock_stride - sizeof(::std::atomic_bool)]{};
+        sharded_rwlock_shard_t shards[sharded_rwlock_shard_count]{};
+    };
+
+    namespace details
+    {
+        inline ::std::atomic_size_t sharded_rwlock_next_shard{};  // [global]
+
+        /// @brief Shard of the calling thread, assigned round-robin on first use so that the first `sharded_rwlock_shard_count` threads never share one.
+        inline ::std::size_t sharded_rwlock_thread_shard() noexcept
+        {
+            thread_local ::std::size_t const shard{sharded_rwlock_next_shard.fetch_add(1uz, ::std::memory_order_relaxed) % sharded_rwlock_shard_count};
+            return shard;
+        }
+
+        UWVM_ALWAYS_INLINE inline void sharded_rwlock_backoff(unsigned& spin_count) noexcept
+        {
+            if(++spin_count > 1000u) { ::fast_io::this_thread::yield(); }
+            else
+            {
+                ::uwvm2::utils::mutex::rwlock_pause();
+            }
+        }
+    }  // namespace details
+
+    /// @brief Shared guard of `sharded_rwlock_t`.
+    struct rw_sharded_shared_guard_t
+    {
+        sharded_rwlock_shard_t* shard_ptr{};
+
+        inline explicit rw_sharded_shared_guard_t(sharded_rwlock_t& lock) noexcept :
+            shard_ptr(::std::addressof(lock.shards[details::sharded_rwlock_thread_shard()]))
+        {
+            auto& readers{this->shard_ptr->readers};
+
+            unsigned spin_count{};
+
+            for(;;)
+            {
+                // Announce first, then check: paired with the writer's store-then-scan, one of the two sides always sees the other
+                // (both accesses are seq_cst).
+                readers.fetch_add(1uz, ::std::memory_order_seq_cst);
+                if(!lock.writer.load(::std::memory_order_seq_cst)) [[likely]] { break; }
+
+                // A writer is active or waiting: withdraw so it can drain, and retry once it has finished.
+                readers.fetch_sub(1uz, ::std::memory_order_release);
+                while(lock.writer.load(::std::memory_order_relaxed)) { details::sharded_rwlock_backoff(spin_count); }
+            }
+        }
+
+        inline ~rw_sharded_shared_guard_t()
+        {
+            // no necessary to check shard_ptr, because the guard is always valid
+            this->shard_ptr->readers.fetch_sub(1uz, ::std::memory_order_release);
+        }
+
+        rw_sharded_shared_guard_t() = delete;
+        rw_sharded_shared_guard_t(rw_sharded_shared_guard_t const&) = delete;
+        rw_sharded_shared_guard_t& operator= (rw_sharded_shared_guard_t const&) = delete;
+        rw_sharded_shared_guard_t(rw_sharded_shared_guard_t&&) = delete;
+        rw_sharded_shared_guard_t& operator= (rw_sharded_shared_guard_t&&) = delete;
+    };
+
+    /// @brief Unique guard of `sharded_rwlock_t`.
+    struct rw_sharded_unique_guard_t
+    {
+        sharded_rwlock_t* lock_ptr{};
+
+        inline explicit rw_sharded_unique_guard_t(sharded_rwlock_t& lock) noexcept : lock_ptr(::std::addressof(lock))
+        {
+            unsigned spin_count{};
+
+            // Phase 1: become the only writer. Raising the flag also stops new readers from entering.
+            for(;;)
+            {
+                bool expected{};
+                if(lock.writer.compare_exchange_weak(expected, true, ::std::memory_order_seq_cst, ::std::memory_order_relaxed)) { break; }
+                details::sharded_rwlock_backoff(spin_count);
+            }
+
+            // Phase 2: wait for the readers that entered before the flag was raised.
+            for(auto& shard: lock.shards)
+            {
+                while(shard.readers.load(::std::memory_order_seq_cst) != 0uz) { details::sharded_rwlock_backoff(spin_count); }
+            }
+        }
+
+        inline ~rw_sharded_unique_guard_t()
+        {
+            // no necessary to check lock_ptr, because the guard is always valid
+            this->lock_ptr->writer.store(false, ::std::memory_order_release);
+        }
+
+        rw_sharded_unique_guard_t() = delete;
+        rw_sharded_unique_guard_t(rw_sharded_unique_guard_t const&) = delete;
+        rw_sharded_unique_guard_t& operator= (rw_sharded_unique_guard_t const&) = delete;
+        rw_sharded_unique_guard_t(rw_sharded_unique_guard_t&&) = delete;
+        rw_sharded_unique_guard_t& operator= (rw_sharded_unique_guard_t&&) = delete;
+    };
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
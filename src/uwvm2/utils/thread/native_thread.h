@@ -68,6 +68,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::thread
         return requested_extra_worker_count < max_useful_extra_worker_count ? requested_extra_worker_count : max_useful_extra_worker_count;
     }
 
+    /// @brief Lower `target` to `index` when `index` is smaller.
+    /// @details Batches that must report the lowest failing task (rather than whichever worker failed first) publish
+    ///          failures through this helper. Tasks with a larger index can then skip work whose result is never reported.
+    inline constexpr void atomic_store_min_index(::std::atomic_size_t & target, ::std::size_t index) noexcept
+    {
+        auto curr{target.load(::std::memory_order_acquire)};
+        while(index < curr && !target.compare_exchange_weak(curr, index, ::std::memory_order_acq_rel, ::std::memory_order_acquire)) {}
+    }
+
     template <typename T>
     struct native_global_typed_allocator_buffer
     {
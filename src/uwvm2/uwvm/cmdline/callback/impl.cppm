@@ -40,8 +40,11 @@ export import :wasm_reset_import;
 export import :wasm_set_preload_module_attribute;
 export import :wasm_depend_recursion_limit;
 export import :wasm_set_memory_limit;
+export import :wasm_set_memory_huge_page;
+export import :wasm_set_memory_pool;
 export import :wasm_set_parser_limit;
 export import :wasm_set_initializer_limit;
+export import :wasm_timeout;
 export import :wasm_list_weak_symbol_module;
 export import :wasm_feature;
 
@@ -51,6 +54,11 @@ export import :runtime_custom_compiler;
 export import :runtime_compiler_log;
 export import :runtime_compile_threads;
 export import :runtime_scheduling_policy;
+export import :runtime_snapshot;
+export import :runtime_reset_repeat;
+export import :runtime_fuel;
+export import :runtime_sample_profile;
+export import :runtime_function_profile;
 export import :runtime_llvm_jit_policy;
 export import :runtime_llvm_jit_lazy_policy;
 export import :runtime_llvm_jit_full_policy;
@@ -63,6 +71,7 @@ export import :runtime_aot;
 export import :runtime_tiered;
 export import :runtime_uwvm_int_set_opcode_conbination_level;
 export import :runtime_uwvm_int_loop_unwind_max_size;
+export import :runtime_uwvm_int_call_stack;
 
 // wasi
 export import :wasi_disable_utf8_check;
@@ -70,6 +79,9 @@ export import :wasip1_global_trace;
 export import :wasip1_global_expose_host_api;
 export import :wasip1_global_disable;
 export import :wasip1_global_set_fd_limit;
+export import :wasip1_global_io_uring;
+export import :wasip1_global_path_cache;
+export import :wasip1_global_stdio_buffer;
 export import :wasip1_global_mount_dir;
 export import :wasip1_global_set_argv0;
 export import :wasip1_global_force_args;
@@ -95,6 +107,7 @@ export import :wasip1_single_trace;
 export import :wasip1_single_set_argv0;
 export import :wasip1_single_force_args;
 export import :wasip1_single_set_fd_limit;
+export import :wasip1_single_stdio_buffer;
 export import :wasip1_single_add_or_replace_environment;
 export import :wasip1_single_delete_system_environment;
 export import :wasip1_single_mount_dir;
@@ -116,6 +129,7 @@ export import :wasip1_group_trace;
 export import :wasip1_group_set_argv0;
 export import :wasip1_group_force_args;
 export import :wasip1_group_set_fd_limit;
+export import :wasip1_group_stdio_buffer;
 export import :wasip1_group_add_or_replace_environment;
 export import :wasip1_group_delete_system_environment;
 export import :wasip1_group_mount_dir;
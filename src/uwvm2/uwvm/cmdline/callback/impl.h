@@ -40,8 +40,11 @@
 # include "wasm_set_preload_module_attribute.h"
 # include "wasm_depend_recursion_limit.h"
 # include "wasm_set_memory_limit.h"
+# include "wasm_set_memory_huge_page.h"
+# include "wasm_set_memory_pool.h"
 # include "wasm_set_parser_limit.h"
 # include "wasm_set_initializer_limit.h"
+# include "wasm_timeout.h"
 # include "wasm_list_weak_symbol_module.h"
 # include "wasm_feature.h"
 
@@ -51,6 +54,11 @@
 # include "runtime_compiler_log.h"
 # include "runtime_compile_threads.h"
 # include "runtime_scheduling_policy.h"
+# include "runtime_snapshot.h"
+# include "runtime_reset_repeat.h"
+# include "runtime_fuel.h"
+# include "runtime_sample_profile.h"
+# include "runtime_function_profile.h"
 # include "runtime_llvm_jit_policy.h"
 # include "runtime_llvm_jit_lazy_policy.h"
 # include "runtime_llvm_jit_full_policy.h"
@@ -63,6 +71,7 @@
 # include "runtime_tiered.h"
 # include "runtime_uwvm_int_set_opcode_conbination_level.h"
 # include "runtime_uwvm_int_loop_unwind_max_size.h"
+# include "runtime_uwvm_int_call_stack.h"
 
 // wasi
 # include "wasi_disable_utf8_check.h"
@@ -70,6 +79,9 @@
 # include "wasip1_global_expose_host_api.h"
 # include "wasip1_global_disable.h"
 # include "wasip1_global_set_fd_limit.h"
+# include "wasip1_global_io_uring.h"
+# include "wasip1_global_path_cache.h"
+# include "wasip1_global_stdio_buffer.h"
 # include "wasip1_global_mount_dir.h"
 # include "wasip1_global_set_argv0.h"
 # include "wasip1_global_force_args.h"
@@ -95,6 +107,7 @@
 # include "wasip1_single_set_argv0.h"
 # include "wasip1_single_force_args.h"
 # include "wasip1_single_set_fd_limit.h"
+# include "wasip1_single_stdio_buffer.h"
 # include "wasip1_single_add_or_replace_environment.h"
 # include "wasip1_single_delete_system_environment.h"
 # include "wasip1_single_mount_dir.h"
@@ -116,6 +129,7 @@
 # include "wasip1_group_set_argv0.h"
 # include "wasip1_group_force_args.h"
 # include "wasip1_group_set_fd_limit.h"
+# include "wasip1_group_stdio_buffer.h"
 # include "wasip1_group_add_or_replace_environment.h"
 # include "wasip1_group_delete_system_environment.h"
 # include "wasip1_group_mount_dir.h"
@@ -91,6 +91,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
             set_argv0,
             force_args,
             set_fd_limit,
+            set_stdio_buffer,
             delete_system_environment,
             add_or_replace_environment,
             mount_dir,
@@ -120,6 +121,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
             else if(text == u8"set-argv0") { action = target_action_t::set_argv0; }
             else if(text == u8"force-args") { action = target_action_t::force_args; }
             else if(text == u8"set-fd-limit") { action = target_action_t::set_fd_limit; }
+            else if(text == u8"set-stdio-buffer") { action = target_action_t::set_stdio_buffer; }
             else if(text == u8"delete-system-environment") { action = target_action_t::delete_system_environment; }
             else if(text == u8"add-or-replace-environment") { action = target_action_t::add_or_replace_environment; }
             else if(text == u8"mount-dir") { action = target_action_t::mount_dir; }
@@ -462,6 +464,63 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
             return ::uwvm2::utils::cmdline::parameter_return_type::def;
         }
 
+        // Stdio buffer spec: <off|size|line|time>[:<bytes>[:<ms>]]. It is one
+        // token so the global option, the single/group options and the action
+        // sequence all share this parser without optional trailing arguments.
+        // A zero capacity or interval is rejected rather than reinterpreted.
+        [[nodiscard]] inline constexpr bool
+            parse_stdio_buffer_spec(::uwvm2::utils::container::u8string_view text,
+                                    ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_config_t& config) noexcept
+        {
+            using flush_t = ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_flush_t;
+            using config_t = ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_config_t;
+
+            ::uwvm2::utils::container::u8string_view fields[3]{};
+            ::std::size_t field_count{};
+
+            auto field_begin{text.cbegin()};
+            for(auto curr{text.cbegin()};; ++curr)
+            {
+                if(curr == text.cend() || *curr == u8':')
+                {
+                    if(field_count == 3uz) [[unlikely]] { return false; }
+                    fields[field_count++] = ::uwvm2::utils::container::u8string_view{field_begin, static_cast<::std::size_t>(curr - field_begin)};
+                    if(curr == text.cend()) { break; }
+                    field_begin = curr + 1u;
+                }
+            }
+
+            config_t parsed{};
+
+            auto const policy_text{fields[0]};
+            if(policy_text == u8"off") { parsed.policy = flush_t::off; }
+            else if(policy_text == u8"size") { parsed.policy = flush_t::size; }
+            else if(policy_text == u8"line") { parsed.policy = flush_t::line; }
+            else if(policy_text == u8"time") { parsed.policy = flush_t::time; }
+            else
+            {
+                return false;
+            }
+
+            // `off` takes no size, and only `time` has an interval.
+            if(parsed.policy == flush_t::off && field_count != 1uz) [[unlikely]] { return false; }
+            if(parsed.policy != flush_t::time && field_count == 3uz) [[unlikely]] { return false; }
+
+            if(field_count >= 2uz)
+            {
+                if(!parse_size_t(fields[1], parsed.capacity) || parsed.capacity == 0uz) [[unlikely]] { return false; }
+            }
+
+            if(field_count == 3uz)
+            {
+                auto const [next, err]{::fast_io::parse_by_scan(fields[2].cbegin(), fields[2].cend(), parsed.interval_ms)};
+                if(err != ::fast_io::parse_code::ok || next != fields[2].cend() || parsed.interval_ms == 0u) [[unlikely]] { return false; }
+            }
+
+            config = parsed;
+            return true;
+        }
+
         [[nodiscard]] inline constexpr bool trace_configuration_matches(override_state_t const& target,
                                                                         trace_output_target_t trace_target,
                                                                         ::uwvm2::utils::container::u8string_view file_path) noexcept
@@ -799,6 +858,26 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
                     mark_consumed(extra1);
                     return parameter_return_type::def;
                 }
+                case target_action_t::set_stdio_buffer:
+                {
+                    if(extra1 == para_end || extra1->type != parameter_type::arg) [[unlikely]]
+                    {
+                        return print_usage_error(parameter, u8"Missing stdio buffer policy.");
+                    }
+                    if(target.stdio_buffer_is_set) [[unlikely]]
+                    {
+                        return print_usage_error(
+                            parameter,
+                            u8"Duplicate or conflicting module action. Cannot set the stdio buffer more than once for the same WASI Preview 1 target.");
+                    }
+                    if(!parse_stdio_buffer_spec(::uwvm2::utils::container::u8string_view{extra1->str}, target.stdio_buffer_config)) [[unlikely]]
+                    {
+                        return print_usage_error(parameter, u8"Invalid stdio buffer policy.");
+                    }
+                    target.stdio_buffer_is_set = true;
+                    mark_consumed(extra1);
+                    return parameter_return_type::def;
+                }
                 case target_action_t::delete_system_environment:
                 {
                     // Deleting the same name twice has no runtime side effect, but
@@ -68,6 +68,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_reset_import),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_set_preload_module_attribute),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_set_memory_limit),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_set_memory_huge_page),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_set_memory_pool),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_set_parser_limit),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_set_initializer_limit),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_feature_mvp),
@@ -82,6 +84,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_list_weak_symbol_module),
 #endif
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_memory_grow_strict),
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_timeout),
+#endif
 
         // runtime
 #if defined(UWVM_RUNTIME_HAS_BACKEND) || defined(UWVM_RUNTIME_HAS_DEBUGGER_BACKEND)
@@ -99,6 +104,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_disable_delay_local),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_enable_instruction_reorder),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_loop_unwind_max_size),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_uwvm_int_call_stack),
 # endif
 # if defined(UWVM_RUNTIME_LLVM_JIT)
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_jit),
@@ -112,6 +118,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_compiler_log),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_compile_threads),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_scheduling_policy),
+# if defined(UWVM_RUNTIME_HAS_BACKEND)
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_snapshot),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_reset_repeat),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_fuel),
+#  if defined(__linux__)
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_sample_profile),
+#  endif
+#  if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_function_profile),
+#  endif
+# endif
 # if defined(UWVM_RUNTIME_LLVM_JIT) || defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_policy),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_lazy_policy),
@@ -121,10 +138,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_cache_no_sign),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_cache_no_verify),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_cache_path),
+#  if defined(__linux__)
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_llvm_jit_perf_map),
+#  endif
 # endif
 # if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_tiered_disable_uwvm_int_lazy_interpreter),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_tiered_disable_llvm_full_jit),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_tiered_profile_guided_full_jit),
 # endif
 #endif
 
@@ -139,6 +160,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_expose_host_api),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_disable),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_set_fd_limit),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_io_uring),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_path_cache),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_stdio_buffer),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_global_mount_dir),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_disable_mount_path_normalization),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_allow_overlapping_mount_paths),
@@ -160,6 +184,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_single_set_argv0),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_single_force_args),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_single_set_fd_limit),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_single_stdio_buffer),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_single_add_or_replace_environment),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_single_delete_system_environment),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_single_mount_dir),
@@ -177,6 +202,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_group_set_argv0),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_group_force_args),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_group_set_fd_limit),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_group_stdio_buffer),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_group_add_or_replace_environment),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_group_delete_system_environment),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasip1_group_mount_dir),
@@ -41,8 +41,11 @@ export import :wasm_reset_import;
 export import :wasm_set_preload_module_attribute;
 export import :wasm_depend_recursion_limit;
 export import :wasm_set_memory_limit;
+export import :wasm_set_memory_huge_page;
+export import :wasm_set_memory_pool;
 export import :wasm_set_parser_limit;
 export import :wasm_set_initializer_limit;
+export import :wasm_timeout;
 export import :wasm_list_weak_symbol_module;
 export import :wasm_memory_grow_strict;
 export import :wasm_feature;
@@ -53,6 +56,11 @@ export import :runtime_custom_compiler;
 export import :runtime_compiler_log;
 export import :runtime_compile_threads;
 export import :runtime_scheduling_policy;
+export import :runtime_snapshot;
+export import :runtime_reset_repeat;
+export import :runtime_fuel;
+export import :runtime_sample_profile;
+export import :runtime_function_profile;
 export import :runtime_llvm_jit_policy;
 export import :runtime_llvm_jit_lazy_policy;
 export import :runtime_llvm_jit_full_policy;
@@ -61,6 +69,7 @@ export import :runtime_llvm_jit_disable_ir_verifaction;
 export import :runtime_llvm_jit_cache_no_sign;
 export import :runtime_llvm_jit_cache_no_verify;
 export import :runtime_llvm_jit_cache_path;
+export import :runtime_llvm_jit_perf_map;
 export import :runtime_debug_int;
 export import :runtime_int;
 export import :runtime_jit;
@@ -71,8 +80,10 @@ export import :runtime_uwvm_int_set_opcode_conbination_level;
 export import :runtime_uwvm_int_disable_delay_local;
 export import :runtime_uwvm_int_enable_instruction_reorder;
 export import :runtime_uwvm_int_loop_unwind_max_size;
+export import :runtime_uwvm_int_call_stack;
 export import :runtime_tiered_disable_uwvm_int_lazy_interpreter;
 export import :runtime_tiered_disable_llvm_full_jit;
+export import :runtime_tiered_profile_guided_full_jit;
 
 // wasi
 export import :wasi_disable_utf8_check;
@@ -80,6 +91,9 @@ export import :wasip1_global_trace;
 export import :wasip1_global_expose_host_api;
 export import :wasip1_global_disable;
 export import :wasip1_global_set_fd_limit;
+export import :wasip1_global_io_uring;
+export import :wasip1_global_path_cache;
+export import :wasip1_global_stdio_buffer;
 export import :wasip1_global_mount_dir;
 export import :wasip1_disable_mount_path_normalization;
 export import :wasip1_allow_overlapping_mount_paths;
@@ -105,6 +119,7 @@ export import :wasip1_single_trace;
 export import :wasip1_single_set_argv0;
 export import :wasip1_single_force_args;
 export import :wasip1_single_set_fd_limit;
+export import :wasip1_single_stdio_buffer;
 export import :wasip1_single_add_or_replace_environment;
 export import :wasip1_single_delete_system_environment;
 export import :wasip1_single_mount_dir;
@@ -126,6 +141,7 @@ export import :wasip1_group_trace;
 export import :wasip1_group_set_argv0;
 export import :wasip1_group_force_args;
 export import :wasip1_group_set_fd_limit;
+export import :wasip1_group_stdio_buffer;
 export import :wasip1_group_add_or_replace_environment;
 export import :wasip1_group_delete_system_environment;
 export import :wasip1_group_mount_dir;
@@ -1114,6 +1114,13 @@ namespace uwvm2::uwvm::wasm::type
 
     extern "C" bool uwvm_preload_memory_write(::std::size_t memory_index, ::std::uint_least64_t offset, void const* source, ::std::size_t size) noexcept
     { return ::uwvm2::runtime::lib::preload_memory_write_host_api(memory_index, offset, source, size); }
+
+    extern "C" bool uwvm_preload_memory_discard(::std::size_t memory_index, ::std::uint_least64_t offset, ::std::size_t size) noexcept
+    { return ::uwvm2::runtime::lib::preload_memory_discard_host_api(memory_index, offset, size); }
+
+    extern "C" void uwvm_preload_epoch_increment() noexcept { ::uwvm2::runtime::lib::epoch_increment_host_api(); }
+
+    extern "C" void uwvm_preload_epoch_set_deadline(::std::uint_least64_t ticks) noexcept { ::uwvm2::runtime::lib::epoch_set_deadline_host_api(ticks); }
 #else
     extern "C" ::std::size_t uwvm_preload_memory_descriptor_count() noexcept { return 0uz; }
 
@@ -1132,6 +1139,15 @@ namespace uwvm2::uwvm::wasm::type
                                               [[maybe_unused]] void const* source,
                                               [[maybe_unused]] ::std::size_t size) noexcept
     { return false; }
+
+    extern "C" bool uwvm_preload_memory_discard([[maybe_unused]] ::std::size_t memory_index,
+                                                [[maybe_unused]] ::std::uint_least64_t offset,
+                                                [[maybe_unused]] ::std::size_t size) noexcept
+    { return false; }
+
+    extern "C" void uwvm_preload_epoch_increment() noexcept {}
+
+    extern "C" void uwvm_preload_epoch_set_deadline([[maybe_unused]] ::std::uint_least64_t ticks) noexcept {}
 #endif
 
     extern "C" uwvm_preload_host_api_v1 const* uwvm_get_preload_host_api_v1() noexcept
@@ -1143,6 +1159,9 @@ namespace uwvm2::uwvm::wasm::type
             .memory_descriptor_at = uwvm_preload_memory_descriptor_at,
             .memory_read = uwvm_preload_memory_read,
             .memory_write = uwvm_preload_memory_write,
+            .memory_discard = uwvm_preload_memory_discard,
+            .epoch_increment = uwvm_preload_epoch_increment,
+            .epoch_set_deadline = uwvm_preload_epoch_set_deadline,
         };
 
         return ::std::addressof(preload_host_api_v1);
@@ -128,6 +128,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
             }
         }
 
+        // fast_exit skips static destructors, so every environment's buffered stdout/stderr is written out first.
+        ::uwvm2::uwvm::imported::wasi::wasip1::storage::flush_all_wasip1_stdio_buffers(true);
+
         // The default WASI environment calls this function pointer directly, bypassing host_api.default.cpp wrappers.
         // Join lazy compiler workers before proc_exit enters the host exit path and starts global destruction.
         ::uwvm2::runtime::lib::lazy_compile_stop_before_proc_exit_host_api();
@@ -467,19 +470,53 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
         }
 
+        // Optional host-side buffering of the guest's stdout/stderr (`--wasip1-*-stdio-buffer`). Only pipes and regular files qualify: output to a
+        // terminal stays unbuffered so an interactive user sees it as it is written. The sink is the process's own handle rather than the dup held by
+        // the fd, so exit and trap paths can still flush after the guest has closed the fd.
+        bool const stdio_buffer_enabled{env.stdio_buffer_config.policy != ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_flush_t::off};
+
+        auto const attach_stdio_buffer{
+            [&env](::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_t& new_fd_fd,
+                   ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_t& buf,
+                   ::fast_io::native_io_observer obs) constexpr noexcept
+            {
+                ::fast_io::file_type obs_type;  // no initialize
+#  ifdef UWVM_CPP_EXCEPTIONS
+                try
+#  endif
+                {
+                    obs_type = status(obs).type;
+                }
+#  ifdef UWVM_CPP_EXCEPTIONS
+                catch(::fast_io::error)
+                {
+                    return;
+                }
+#  endif
+
+                if(obs_type != ::fast_io::file_type::fifo && obs_type != ::fast_io::file_type::regular) { return; }
+
+                ::uwvm2::imported::wasi::wasip1::fd_manager::attach_wasi_fd_output_buffer(buf, obs, env.stdio_buffer_config);
+                new_fd_fd.output_buffer = ::std::addressof(buf);
+            }};
+
         {
             ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_unique_ptr_t fd0{};
             if(!init_stdio(*fd0.fd_p, ::fast_io::in())) [[unlikely]] { return false; }
+            // A read from stdin first flushes whatever stdout/stderr buffers end up attached below.
+            fd0.fd_p->flush_output_before_read = stdio_buffer_enabled;
             if(!try_emplace_fd(static_cast<fd_t>(0), ::std::move(fd0))) [[unlikely]] { return false; }
         }
         {
             ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_unique_ptr_t fd1{};
             if(!init_stdio(*fd1.fd_p, ::fast_io::out())) [[unlikely]] { return false; }
+            if(stdio_buffer_enabled) { attach_stdio_buffer(*fd1.fd_p, env.stdout_buffer, ::fast_io::out()); }
             if(!try_emplace_fd(static_cast<fd_t>(1), ::std::move(fd1))) [[unlikely]] { return false; }
         }
         {
             ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_unique_ptr_t fd2{};
             if(!init_stdio(*fd2.fd_p, ::fast_io::err())) [[unlikely]] { return false; }
+            if(stdio_buffer_enabled) { attach_stdio_buffer(*fd2.fd_p, env.stderr_buffer, ::fast_io::err()); }
             if(!try_emplace_fd(static_cast<fd_t>(2), ::std::move(fd2))) [[unlikely]] { return false; }
         }
 
@@ -908,6 +945,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
         state.env.wasip1_proc_raise_func_ptr = default_wasip1_env.wasip1_proc_raise_func_ptr;
         state.env.wasip1_sched_yield_func_ptr = default_wasip1_env.wasip1_sched_yield_func_ptr;
         state.env.fd_storage.fd_limit = state.fd_limit_is_set ? state.fd_limit : default_wasip1_env.fd_storage.fd_limit;
+        state.env.io_uring.mode = default_wasip1_env.io_uring.mode;
+        state.env.path_cache.enabled = default_wasip1_env.path_cache.enabled;
+        state.env.stdio_buffer_config = state.stdio_buffer_is_set ? state.stdio_buffer_config : default_wasip1_env.stdio_buffer_config;
 
         if(state.env.trace_wasip1_call &&
            state.env.trace_wasip1_output_target == ::uwvm2::imported::wasi::wasip1::environment::trace_wasip1_output_target_t::file &&
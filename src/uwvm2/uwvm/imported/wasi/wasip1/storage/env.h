@@ -124,6 +124,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
         bool fd_limit_is_set{};
         ::std::size_t fd_limit{};
 
+        // Target stdio buffering override. The whole configuration replaces the
+        // global one, so `set-stdio-buffer off` can exempt a single target from
+        // a global policy.
+        bool stdio_buffer_is_set{};
+        ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_config_t stdio_buffer_config{};
+
         // Partial argv override. set-argv0 patches argv[0] over the default
         // `--run <wasm> ...` vector and is mutually exclusive with force-args.
         bool argv0_is_set{};
@@ -165,7 +171,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
         [[nodiscard]] inline constexpr bool has_override() const noexcept
         {
             return this->enabled_is_set || this->expose_host_api_is_set || this->noinherit_system_environment_is_set || this->disable_utf8_check_is_set ||
-                   this->fd_limit_is_set || this->argv0_is_set || this->force_args_is_set || this->trace_wasip1_call_is_set ||
+                   this->fd_limit_is_set || this->stdio_buffer_is_set || this->argv0_is_set || this->force_args_is_set || this->trace_wasip1_call_is_set ||
                    !this->delete_system_environment.empty() || !this->add_or_replace_environment.empty() || !this->mount_dir_roots.empty()
 #  if defined(UWVM_IMPORT_WASI_WASIP1_SUPPORT_SOCKET)
                    || !this->preopen_sockets.empty()
@@ -651,6 +657,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::imported::wasi::wasip1::storage
         }
         return false;
     }
+
+    /// @brief Flush the stdout/stderr buffers of the default environment and of every target environment.
+    /// @note  Called from proc_exit, normal process exit and trap reporting; trap paths pass `may_block = false`.
+    inline constexpr void flush_all_wasip1_stdio_buffers(bool may_block) noexcept
+    {
+        ::uwvm2::imported::wasi::wasip1::environment::flush_wasip1_stdio_buffers(default_wasip1_env, may_block);
+        for(auto& state: configured_wasip1_groups) { ::uwvm2::imported::wasi::wasip1::environment::flush_wasip1_stdio_buffers(state.env, may_block); }
+    }
 # endif
 #endif
 }  // namespace uwvm2::uwvm::imported::wasi::wasip1::storage
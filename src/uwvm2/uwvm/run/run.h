@@ -84,6 +84,17 @@
 UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 {
 #if defined(UWVM_RUNTIME_HAS_BACKEND)
+    /// @brief Which default entry `resolve_default_first_entry_function_index()` looks for.
+    enum class default_entry_kind_t : unsigned
+    {
+        // Start section, then `_start`/`main`.
+        program,
+        // `--runtime-snapshot create`: start section, then the reactor `_initialize` export; a module without either has nothing to run.
+        initializer,
+        // `--runtime-snapshot restore`: the initializer already ran in the snapshotting process, so the start section is skipped.
+        restored
+    };
+
     /**
      * @brief   Resolve the default entry function for the main module.
      * @details The returned value is the import-inclusive WebAssembly function index used by the runtime
@@ -101,12 +112,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
      *          only when the import chain ultimately points at a wasm-defined function; host-defined import
      *          leaves are rejected because the default runtime-entry ABI here is wasm-function based.
      *
+     *          `entry_kind` adjusts this order for instance snapshots; see `default_entry_kind_t`.
+     *
      * @param   main_module_name Name key of the executable module in the global wasm/runtime registries.
-     * @return  Import-inclusive wasm function index for the default entry function.
+     * @param   entry_kind       Which entry to resolve.
+     * @return  Import-inclusive wasm function index for the default entry function, or `SIZE_MAX` when resolving an
+     *          initializer for a module that has none.
      * @warning This function does not return on failure.  It emits a fatal diagnostic and terminates when no
      *          valid default entry function can be found.
      */
-    inline constexpr ::std::size_t resolve_default_first_entry_function_index(::uwvm2::utils::container::u8string_view main_module_name) noexcept
+    inline constexpr ::std::size_t resolve_default_first_entry_function_index(::uwvm2::utils::container::u8string_view main_module_name,
+                                                                                 default_entry_kind_t entry_kind = default_entry_kind_t::program) noexcept
     {
         using module_type_t = ::uwvm2::uwvm::wasm::type::module_type_t;
         using start_section_t = ::uwvm2::parser::wasm::standard::wasm1::features::start_section_storage_t;
@@ -201,7 +217,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 
                     // Note: do not subtract pointers here; the default (absent) span is {nullptr, nullptr} and pointer
                     // subtraction would be UB. `sec_begin != nullptr` is the parser's "section present" flag.
-                    if(startsec.sec_span.sec_begin != nullptr)
+                    if(startsec.sec_span.sec_begin != nullptr && entry_kind != default_entry_kind_t::restored)
                     {
                         if(auto const rt_it{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(main_module_name)};
                            rt_it != ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.end())
@@ -247,8 +263,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                                       return true;
                                   }};
 
-            if(try_export(::uwvm2::utils::container::u8string_view{u8"_start"})) { return idx; }
-            if(try_export(::uwvm2::utils::container::u8string_view{u8"main"})) { return idx; }
+            if(entry_kind == default_entry_kind_t::initializer)
+            {
+                if(try_export(::uwvm2::utils::container::u8string_view{u8"_initialize"})) { return idx; }
+            }
+            else
+            {
+                if(try_export(::uwvm2::utils::container::u8string_view{u8"_start"})) { return idx; }
+                if(try_export(::uwvm2::utils::container::u8string_view{u8"main"})) { return idx; }
+            }
         }
 
         // Fallback: if `all_module_export` is missing/stale, resolve from the parsed export section directly.
@@ -289,8 +312,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                                                                return false;
                                                            }};
 
-                        if(try_export_from_section(::uwvm2::utils::container::u8string_view{u8"_start"})) { return idx; }
-                        if(try_export_from_section(::uwvm2::utils::container::u8string_view{u8"main"})) { return idx; }
+                        if(entry_kind == default_entry_kind_t::initializer)
+                        {
+                            if(try_export_from_section(::uwvm2::utils::container::u8string_view{u8"_initialize"})) { return idx; }
+                        }
+                        else
+                        {
+                            if(try_export_from_section(::uwvm2::utils::container::u8string_view{u8"_start"})) { return idx; }
+                            if(try_export_from_section(::uwvm2::utils::container::u8string_view{u8"main"})) { return idx; }
+                        }
                     }
                 }
 
@@ -298,6 +328,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
             }
         }
 
+        // A command module has no separate initializer: its state after instantiation (data/element segments) is the snapshot.
+        if(entry_kind == default_entry_kind_t::initializer) { return ::std::numeric_limits<::std::size_t>::max(); }
+
         ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                             u8"uwvm: ",
@@ -1028,6 +1061,33 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
         cfg.entry_abi_buffers.result_bytes = entry.result_buffer.size();
     }
 
+    /**
+     * @brief   Invoke a runtime-library entry point once per `--runtime-reset-repeat` run.
+     * @details Runs after the first reset every runtime module to the state captured just before the first run.  Linking,
+     *          runtime storage, and compiled code are kept across runs: full compilation is published once, and lazy modes
+     *          keep every function already materialized.
+     * @return  false when a reset failed; the instance is then inconsistent and must not run again.
+     */
+    template <typename RunConfig>
+    inline bool run_main_module_repeated(void (*run_main_module)(::uwvm2::utils::container::u8string_view, RunConfig) noexcept,
+                                         RunConfig const& cfg,
+                                         ::std::size_t run_count) noexcept
+    {
+        if(run_count > 1uz) { ::uwvm2::uwvm::runtime::snapshot::capture_reset_point(::uwvm2::uwvm::runtime::snapshot::global_instance_reset_point); }
+
+        for(::std::size_t run_index{}; run_index != run_count; ++run_index)
+        {
+            if(run_index != 0uz && !::uwvm2::uwvm::runtime::snapshot::reset_to_reset_point(::uwvm2::uwvm::runtime::snapshot::global_instance_reset_point))
+                [[unlikely]]
+            {
+                return false;
+            }
+            run_main_module(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name, cfg);
+        }
+
+        return true;
+    }
+
     /**
      * @brief   Resolve the actual runtime entry invocation for the main module.
      * @details Without `--wasm-set-start-func`, this delegates to the default entry resolver and produces empty ABI
@@ -1036,18 +1096,22 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
      *          computes packed parameter/result storage, converts the local-defined index into the runtime's
      *          import-inclusive function index, and packs every provided argument according to the selected function type.
      *
+     *          Snapshot creation always resolves the module initializer; `--wasm-set-start-func` applies to the run that restores it.
+     *
      * @param   main_module_name Name key of the executable module.
+     * @param   entry_kind       Default-entry variant forwarded to `resolve_default_first_entry_function_index()`.
      * @return  Fully configured entry invocation descriptor.
      * @warning Invalid user input is diagnosed and terminates the process; internal storage inconsistencies terminate
      *          directly because they indicate earlier loader/runtime initialization bugs.
      */
-    inline constexpr runtime_entry_invocation resolve_runtime_entry_invocation(::uwvm2::utils::container::u8string_view main_module_name) noexcept
+    inline constexpr runtime_entry_invocation resolve_runtime_entry_invocation(::uwvm2::utils::container::u8string_view main_module_name,
+                                                                               default_entry_kind_t entry_kind = default_entry_kind_t::program) noexcept
     {
         runtime_entry_invocation entry{};
         auto const& requested{::uwvm2::uwvm::wasm::storage::start_func_call};
-        if(!requested.enabled)
+        if(!requested.enabled || entry_kind == default_entry_kind_t::initializer)
         {
-            entry.function_index = resolve_default_first_entry_function_index(main_module_name);
+            entry.function_index = resolve_default_first_entry_function_index(main_module_name, entry_kind);
             return entry;
         }
 
@@ -1671,6 +1735,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                 // Validate all wasm code with the parser/runtime validator entry point, but do not initialize executable
                 // runtime state.  This path is for validity checks, not compilation, partitioning, or backend execution.
                 // `validate_all_wasm_code` already emits its own verbose progress diagnostics.
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+                // Code bodies are validated on the same worker budget as full translation (`--runtime-compile-threads`).
+                resolve_runtime_compile_threads();
+#endif
                 if(!::uwvm2::uwvm::runtime::validator::validate_all_wasm_code()) [[unlikely]]
                 {
                     return static_cast<int>(::uwvm2::uwvm::run::retval::check_module_error);
@@ -1707,6 +1775,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
         }
 
         // Initialize runtime storage, link metadata, and backend-visible module data after import resolution succeeds.
+        // A snapshot restore overwrites every wasm-defined memory below, so copying active data into them first would be wasted work.
+        ::uwvm2::uwvm::runtime::initializer::skip_defined_memory_active_data =
+            ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_snapshot_mode == ::uwvm2::uwvm::runtime::runtime_mode::runtime_snapshot_mode_t::restore;
         ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
 
 # if defined(UWVM_RUNTIME_DEBUG_INTERPRETER)
@@ -1757,7 +1828,40 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
         // Resolve global execution knobs after runtime storage exists.  Entry resolution needs runtime function type
         // storage, and compile-thread resolution publishes the value consumed by full-translation runtime code.
         resolve_runtime_compile_threads();
-        auto runtime_entry{resolve_runtime_entry_invocation(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name)};
+
+        // Instance snapshots: `restore` replaces the initializer with the saved state before any guest code runs;
+        // `create` runs only the initializer and saves the state after dispatch returns.
+        auto const snapshot_mode{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_snapshot_mode};
+        auto entry_kind{default_entry_kind_t::program};
+        if(snapshot_mode == ::uwvm2::uwvm::runtime::runtime_mode::runtime_snapshot_mode_t::restore)
+        {
+            if(::uwvm2::uwvm::runtime::snapshot::restore_snapshot(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_snapshot_path) !=
+               ::uwvm2::uwvm::runtime::snapshot::snapshot_status::ok) [[unlikely]]
+            {
+                return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+            }
+            entry_kind = default_entry_kind_t::restored;
+        }
+        else if(snapshot_mode == ::uwvm2::uwvm::runtime::runtime_mode::runtime_snapshot_mode_t::create)
+        {
+            entry_kind = default_entry_kind_t::initializer;
+        }
+
+        auto runtime_entry{resolve_runtime_entry_invocation(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name, entry_kind)};
+
+        // `--runtime-reset-repeat`: snapshot creation runs the initializer exactly once.
+        auto const run_count{entry_kind == default_entry_kind_t::initializer ? 1uz : ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_reset_repeat};
+
+        if(entry_kind == default_entry_kind_t::initializer && runtime_entry.function_index == ::std::numeric_limits<::std::size_t>::max())
+        {
+            // Nothing to run: the instantiated state is the snapshot.
+            if(::uwvm2::uwvm::runtime::snapshot::write_snapshot(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_snapshot_path) !=
+               ::uwvm2::uwvm::runtime::snapshot::snapshot_status::ok) [[unlikely]]
+            {
+                return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+            }
+            return static_cast<int>(::uwvm2::uwvm::run::retval::ok);
+        }
 
         // Dispatch matrix:
         //
@@ -1854,7 +1958,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                         ::uwvm2::runtime::lib::lazy_compile_run_config cfg{};
                         configure_runtime_entry_buffers(cfg, runtime_entry);
                         cfg.assume_full_code_verified = false;
-                        ::uwvm2::runtime::lib::lazy_compile_and_run_main_module(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name, cfg);
+                        if(!run_main_module_repeated(::uwvm2::runtime::lib::lazy_compile_and_run_main_module, cfg, run_count)) [[unlikely]]
+                        {
+                            return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+                        }
 # else
                         ::fast_io::io::perr(
                             ::uwvm2::uwvm::io::u8log_output,
@@ -1925,7 +2032,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                         ::uwvm2::runtime::lib::lazy_compile_run_config cfg{};
                         configure_runtime_entry_buffers(cfg, runtime_entry);
                         cfg.assume_full_code_verified = true;
-                        ::uwvm2::runtime::lib::lazy_compile_and_run_main_module(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name, cfg);
+                        if(!run_main_module_repeated(::uwvm2::runtime::lib::lazy_compile_and_run_main_module, cfg, run_count)) [[unlikely]]
+                        {
+                            return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+                        }
 # else
                         ::fast_io::io::perr(
                             ::uwvm2::uwvm::io::u8log_output,
@@ -1955,7 +2065,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                                 // Full compile with the uwvm-int interpreter backend.
                                 ::uwvm2::runtime::lib::full_compile_run_config cfg{};
                                 configure_runtime_entry_buffers(cfg, runtime_entry);
-                                ::uwvm2::runtime::lib::full_compile_and_run_main_module(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name, cfg);
+                                if(!run_main_module_repeated(::uwvm2::runtime::lib::full_compile_and_run_main_module, cfg, run_count)) [[unlikely]]
+                                {
+                                    return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+                                }
 
                                 break;
                             }
@@ -2008,7 +2121,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                                 // runtime library from the globally configured runtime-mode storage.
                                 ::uwvm2::runtime::lib::full_compile_run_config cfg{};
                                 configure_runtime_entry_buffers(cfg, runtime_entry);
-                                ::uwvm2::runtime::lib::full_compile_and_run_main_module(::uwvm2::uwvm::wasm::storage::execute_wasm.module_name, cfg);
+                                if(!run_main_module_repeated(::uwvm2::runtime::lib::full_compile_and_run_main_module, cfg, run_count)) [[unlikely]]
+                                {
+                                    return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+                                }
 
                                 break;
                             }
@@ -2047,6 +2163,22 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
             }
         }
 
+        // Snapshot the state the initializer left behind before the runtime backends are torn down.
+        if(entry_kind == default_entry_kind_t::initializer &&
+           ::uwvm2::uwvm::runtime::snapshot::write_snapshot(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_snapshot_path) !=
+               ::uwvm2::uwvm::runtime::snapshot::snapshot_status::ok) [[unlikely]]
+        {
+            return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+        }
+
+        // Guest output held by `--wasip1-*-stdio-buffer` goes out before any profile report is printed.
+        ::uwvm2::runtime::lib::wasip1_stdio_flush_host_api();
+
+        // `--runtime-sample-profile` resolves sampled JIT addresses while the JIT state below is still alive.
+        ::uwvm2::runtime::lib::sample_profile_finish_host_api();
+        // `--runtime-function-profile` writes its per-function table from the same, still loaded, module storage.
+        ::uwvm2::runtime::lib::function_profile_finish_host_api();
+
 # if defined(UWVM_RUNTIME_LLVM_JIT)
         // Normal executable-mode exit must release LLVM JIT runtime state before
         // process teardown. The runtime library intentionally avoids destroying
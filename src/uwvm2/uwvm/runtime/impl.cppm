@@ -27,6 +27,7 @@ export import uwvm2.uwvm.runtime.storage;
 export import uwvm2.uwvm.runtime.initializer;
 export import uwvm2.uwvm.runtime.runtime_mode;
 export import uwvm2.uwvm.runtime.validator;
+export import uwvm2.uwvm.runtime.snapshot;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -27,4 +27,5 @@
 # include <uwvm2/uwvm/runtime/initializer/impl.h>
 # include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
 # include <uwvm2/uwvm/runtime/validator/impl.h>
+# include <uwvm2/uwvm/runtime/snapshot/impl.h>
 #endif
@@ -65,6 +65,10 @@
 
 UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
 {
+    /// @brief Bounds-check active data segments that target wasm-defined memories without copying their bytes.
+    /// @note  Set for `--runtime-snapshot restore`, which overwrites every wasm-defined memory before any guest code runs.
+    inline bool skip_defined_memory_active_data{};  // [global]
+
     namespace details
     {
         template <typename... Args>
@@ -809,6 +813,107 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
             }
         }
 
+        inline constexpr void fatal_runtime_memory_huge_page_out_of_range(::std::size_t memory_index, ::std::size_t local_defined_memory_count) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                u8"[fatal] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"initializer: In module \"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                current_initializing_module_name,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\", huge page policy targets an out-of-range local-defined memory index (memory_idx=",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                memory_index,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8", local_defined_memory_count=",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                local_defined_memory_count,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8").\n\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            ::fast_io::fast_terminate();
+        }
+
+        inline constexpr void validate_configured_runtime_memory_huge_page_target_modules() noexcept
+        {
+            for(auto const& [module_name, configured_policies]: ::uwvm2::uwvm::wasm::storage::configured_module_memory_huge_page)
+            {
+                auto const module_name_view{
+                    ::uwvm2::utils::container::u8string_view{module_name.data(), module_name.size()}
+                };
+                if(::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(module_name_view) ==
+                   ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.cend()) [[unlikely]]
+                {
+                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                        u8"[fatal] ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"initializer: Huge page policy targets an unknown or non-runtime module \"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                        module_name_view,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"\" (apply_to_all=",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                        configured_policies.apply_to_all_memories,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8", explicit_memory_policies=",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                        configured_policies.local_defined_memory_policies.size(),
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8").\n\n",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+
+        inline constexpr void apply_configured_memory_pool() noexcept
+        {
+            auto const& configured{::uwvm2::uwvm::wasm::storage::configured_memory_pool};
+            if(configured.max_slots == 0uz) [[likely]] { return; }
+
+#if defined(UWVM_SUPPORT_MMAP)
+            // Configure before the runtime storage is cleared, so memories released by a previous initialization are already recycled.
+            if(::uwvm2::object::memory::linear::configure_mmap_memory_pool(configured.max_slots, configured.max_reserved_bytes))
+            {
+                if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+                {
+                    verbose_info(u8"initializer: Enable the mmap memory pool (slots=",
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                 configured.max_slots,
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                 u8", reserved_bytes=",
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                 configured.max_reserved_bytes,
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                 u8"). ");
+                }
+                return;
+            }
+#endif
+
+            if(!::uwvm2::uwvm::io::show_runtime_warning) [[likely]] { return; }
+
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                u8"[warn]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"initializer: The mmap memory pool is not supported on this platform; --wasm-set-memory-pool is ignored. ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8"(runtime)\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+
+            if(::uwvm2::uwvm::io::runtime_warning_fatal) [[unlikely]] { runtime_warning_to_fatal(); }
+        }
+
         inline constexpr void fatal_configured_import_reset_unknown_module(::uwvm2::utils::container::u8string_view module_name,
                                                                            configured_import_reset_vec_t const& rules) noexcept
         {
@@ -3136,6 +3241,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
                 }
             }
 
+            auto const module_memory_huge_page{::uwvm2::uwvm::wasm::storage::find_configured_module_memory_huge_page_const(current_initializing_module_name)};
+            if(module_memory_huge_page != nullptr) [[unlikely]]
+            {
+                for(auto const& [memory_index, configured_policy]: module_memory_huge_page->local_defined_memory_policies)
+                {
+                    static_cast<void>(configured_policy);
+                    if(memory_index >= local_defined_memory_count) [[unlikely]]
+                    {
+                        fatal_runtime_memory_huge_page_out_of_range(memory_index, local_defined_memory_count);
+                    }
+                }
+            }
+
             // imported
             {
                 auto const& imported_funcs{importsec.importdesc.index_unchecked(importdesc_func_index)};
@@ -3592,8 +3710,35 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
                                                                    rec.effective_limits);
                     }
 
+#if defined(UWVM_SUPPORT_MMAP)
+                    if(module_memory_huge_page != nullptr) [[unlikely]]
+                    {
+                        if(auto const policy{::uwvm2::uwvm::wasm::storage::find_configured_local_defined_memory_huge_page(*module_memory_huge_page, memory_idx)};
+                           policy != nullptr && *policy == ::uwvm2::uwvm::wasm::storage::module_memory_huge_page_t::transparent)
+                        {
+                            rec.memory.huge_page_policy = ::uwvm2::object::memory::linear::mmap_memory_huge_page_policy_t::transparent;
+                        }
+                    }
+#endif
+
                     emit_local_memory_init_verbose(u8"init_by_page_count begin", memory_idx, memory_type.limits, rec.effective_limits, runtime_page_size_bytes);
                     rec.memory.init_by_page_count(rec.effective_limits.min);
+
+#if defined(UWVM_SUPPORT_MMAP)
+                    if(module_memory_huge_page != nullptr && ::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+                    {
+                        // `init_by_page_count()` resets the policy when the platform or the page size cannot use huge pages.
+                        verbose_module_info(u8"Init: local-defined memory huge page policy (memory_idx=",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                            memory_idx,
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                            u8", thp=",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                            rec.memory.huge_page_policy == ::uwvm2::object::memory::linear::mmap_memory_huge_page_policy_t::transparent,
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                            u8"). ");
+                    }
+#endif
                     emit_local_memory_init_verbose(u8"init_by_page_count done", memory_idx, memory_type.limits, rec.effective_limits, runtime_page_size_bytes);
 
                     ++memory_idx;
@@ -4238,10 +4383,145 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
             return page_count * page_size_bytes;
         }
 
+        /// @brief Active data segment whose copy into a locally defined memory is deferred to the end of its module.
+        struct wasm1_pending_data_segment_t
+        {
+            ::uwvm2::uwvm::runtime::storage::local_defined_memory_storage_t* memory{};
+            ::std::size_t offset{};
+            ::std::byte const* byte_begin{};
+            ::std::size_t byte_count{};
+        };
+
+        // Below this many bytes of active data per memory, copying is cheaper than creating and mapping a memfd image.
+        inline constexpr ::std::size_t wasm1_data_segment_image_min_bytes{1uz << 20u};
+
+        /// @brief Install `[begin, end)` (all targeting `target`, in segment order) as one copy-on-write memfd image covering their page span.
+        /// @note  Only valid while `target` is still all zeroes: the gaps between segments are mapped from the image, not preserved.
+        /// @return false if the data is too small, the platform lacks support, or the mapping failed; the memory is then still zeroed.
+        inline bool try_map_wasm1_data_segment_image(::uwvm2::uwvm::runtime::storage::local_defined_memory_storage_t& target,
+                                                     wasm1_pending_data_segment_t const* begin,
+                                                     wasm1_pending_data_segment_t const* end,
+                                                     ::std::size_t& mapped_bytes) noexcept
+        {
+#if defined(UWVM_SUPPORT_MMAP)
+            if constexpr(::uwvm2::object::memory::linear::mmap_memory_private_image_supported)
+            {
+                // Bounds were validated when the segments were queued, so `offset + byte_count` cannot overflow.
+                ::std::size_t total_bytes{};
+                ::std::size_t span_begin{::std::numeric_limits<::std::size_t>::max()};
+                ::std::size_t span_end{};
+                for(auto curr{begin}; curr != end; ++curr)
+                {
+                    if(curr->byte_count == 0uz) { continue; }
+                    total_bytes += curr->byte_count;
+                    if(curr->offset < span_begin) { span_begin = curr->offset; }
+                    if(curr->offset + curr->byte_count > span_end) { span_end = curr->offset + curr->byte_count; }
+                }
+
+                if(total_bytes < wasm1_data_segment_image_min_bytes) { return false; }
+
+                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+                if(!success || page_size == 0uz) [[unlikely]] { return false; }
+                auto const page_size_minus_1{page_size - 1uz};
+
+                span_begin &= ~page_size_minus_1;
+                if(span_end > ::std::numeric_limits<::std::size_t>::max() - page_size_minus_1) [[unlikely]] { return false; }
+                span_end = (span_end + page_size_minus_1) & ~page_size_minus_1;
+
+                ::uwvm2::object::memory::linear::mmap_memory_image_t image{};
+                if(!image.create(span_end - span_begin)) { return false; }
+
+                for(auto curr{begin}; curr != end; ++curr)
+                {
+                    if(curr->byte_count == 0uz) { continue; }
+                    ::fast_io::freestanding::my_memcpy(image.data() + (curr->offset - span_begin), curr->byte_begin, curr->byte_count);
+                }
+                image.finish_writing();
+
+                if(!target.memory.try_map_private_image(span_begin, image)) { return false; }
+
+                mapped_bytes = span_end - span_begin;
+                return true;
+            }
+#endif
+            static_cast<void>(target);
+            static_cast<void>(begin);
+            static_cast<void>(end);
+            static_cast<void>(mapped_bytes);
+            return false;
+        }
+
+        /// @brief Apply the data segments deferred for one module. Each memory that has never received data before gets a single image when large
+        ///        enough; every other memory (or a failed mapping) falls back to the plain in-order copy.
+        inline void flush_wasm1_pending_data_segments(
+            ::uwvm2::utils::container::u8string_view module_name,
+            ::uwvm2::utils::container::vector<wasm1_pending_data_segment_t>& pending,
+            ::uwvm2::utils::container::vector<::uwvm2::uwvm::runtime::storage::local_defined_memory_storage_t const*>& initialized_memories) noexcept
+        {
+            // Modules rarely target more than one memory, so the per-memory grouping below stays linear in practice.
+            ::uwvm2::utils::container::vector<::uwvm2::uwvm::runtime::storage::local_defined_memory_storage_t const*> flushed{};
+            ::uwvm2::utils::container::vector<wasm1_pending_data_segment_t> group{};
+
+            for(auto const& seg: pending)
+            {
+                auto const target{seg.memory};
+
+                bool already_flushed{};
+                for(auto const mem: flushed)
+                {
+                    if(mem == target) { already_flushed = true; }
+                }
+                if(already_flushed) { continue; }
+                flushed.push_back(target);
+
+                group.clear();
+                for(auto const& other: pending)
+                {
+                    if(other.memory == target) { group.push_back(other); }
+                }
+
+                bool fresh{true};
+                for(auto const mem: initialized_memories)
+                {
+                    if(mem == target) { fresh = false; }
+                }
+
+                ::std::size_t mapped_bytes{};
+                if(!fresh || !try_map_wasm1_data_segment_image(*target, group.cbegin(), group.cend(), mapped_bytes))
+                {
+                    for(auto const& g: group)
+                    {
+                        if(g.byte_count != 0uz) { ::fast_io::freestanding::my_memcpy(target->memory.memory_begin + g.offset, g.byte_begin, g.byte_count); }
+                    }
+                }
+                else if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+                {
+                    verbose_info(u8"initializer: Mapped active data of module \"",
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                 module_name,
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                 u8"\" as a copy-on-write image (bytes=",
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                 mapped_bytes,
+                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                 u8"). ");
+                }
+
+                if(fresh) { initialized_memories.push_back(target); }
+            }
+
+            pending.clear();
+        }
+
         inline constexpr void apply_wasm1_active_element_and_data_segments_after_linking() noexcept
         {
             using table_elem_type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t;
 
+            // Data for locally defined memories is queued per module so large initial images can be mapped instead of copied.
+            // A memory that already received data (from an earlier module) is always copied into, since mapping would discard its contents.
+            ::uwvm2::utils::container::vector<wasm1_pending_data_segment_t> pending_data{};
+            ::uwvm2::utils::container::vector<::uwvm2::uwvm::runtime::storage::local_defined_memory_storage_t const*> initialized_data_memories{};
+
             for([[maybe_unused]] auto& [curr_module_name, curr_rt]: ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage)
             {
                 if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
@@ -4717,10 +4997,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
                             ::fast_io::fast_terminate();
                         }
 
-                        ::fast_io::freestanding::my_memcpy(memory_begin + offset, byte_begin, byte_count);
+                        if(target_memory)
+                        {
+                            if(!skip_defined_memory_active_data) { pending_data.push_back({target_memory, offset, byte_begin, byte_count}); }
+                        }
+                        else
+                        {
+                            ::fast_io::freestanding::my_memcpy(memory_begin + offset, byte_begin, byte_count);
+                        }
                     }
                 }
 
+                flush_wasm1_pending_data_segments(curr_module_name, pending_data, initialized_data_memories);
+
                 if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
                 {
                     verbose_info(u8"initializer: Apply segments summary for module \"",
@@ -6110,6 +6399,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
 #endif
         }
 
+        details::apply_configured_memory_pool();
+
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]] { details::verbose_info(u8"initializer: Clear runtime storage. "); }
         ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.clear();
         details::import_alias_sanity_checked = false;
@@ -6232,6 +6523,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
 
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]] { details::verbose_info(u8"initializer: Validate configured memory limit override target modules. "); }
         details::validate_configured_runtime_memory_limit_target_modules();
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]] { details::verbose_info(u8"initializer: Validate configured memory huge page target modules. "); }
+        details::validate_configured_runtime_memory_huge_page_target_modules();
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]] { details::verbose_info(u8"initializer: Validate configured import reset target modules. "); }
         details::validate_configured_import_reset_target_modules();
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]] { details::verbose_info(u8"initializer: Validate configured import reset matches. "); }
@@ -25,6 +25,7 @@
 
 // #pragma once
 
+#pragma pop_macro("UWVM_RUNTIME_FUNCTION_PROFILE")
 #pragma pop_macro("UWVM_RUNTIME_HAS_DEBUGGER_BACKEND")
 #pragma pop_macro("UWVM_RUNTIME_HAS_BACKEND")
 #pragma pop_macro("UWVM_RUNTIME_DEBUG_INTERPRETER")
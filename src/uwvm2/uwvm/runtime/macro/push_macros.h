@@ -79,3 +79,10 @@
 #if defined(UWVM_RUNTIME_DEBUG_INTERPRETER)
 # define UWVM_RUNTIME_HAS_DEBUGGER_BACKEND
 #endif
+
+#pragma push_macro("UWVM_RUNTIME_FUNCTION_PROFILE")
+#undef UWVM_RUNTIME_FUNCTION_PROFILE
+// per-function profiling counters are compiled in only on request (`--enable-runtime-function-profile=y`)
+#if defined(UWVM_ENABLE_RUNTIME_FUNCTION_PROFILE) && defined(UWVM_RUNTIME_HAS_BACKEND)
+# define UWVM_RUNTIME_FUNCTION_PROFILE
+#endif
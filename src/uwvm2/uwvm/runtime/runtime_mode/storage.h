@@ -109,6 +109,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
     };
 #endif
 
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+    enum class runtime_snapshot_mode_t : unsigned
+    {
+        none,
+        create,
+        restore
+    };
+#endif
+
     inline bool custom_runtime_mode_existed{};      // [global]
     inline bool custom_runtime_compiler_existed{};  // [global]
 
@@ -196,6 +205,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
 # endif
     };
 
+    enum class runtime_uwvm_int_call_stack_t : unsigned
+    {
+        logical,
+        unwind
+    };
+
     /// @brief Whether uwvm-int loop unwind is disabled at runtime.
     inline bool runtime_uwvm_int_disable_loop_unwind{};  // [global]
 
@@ -218,6 +233,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
 
     /// @brief Maximum Wasm body bytes considered for one loop-unwind decision.
     inline ::std::size_t global_runtime_uwvm_int_loop_unwind_max_size{default_runtime_uwvm_int_loop_unwind_max_size};  // [global]
+
+    /// @brief Whether the uwvm-int call-stack tracking mode was explicitly configured.
+    inline bool runtime_uwvm_int_call_stack_existed{};  // [global]
+
+    /// @brief Runtime uwvm-int call-stack tracking mode.
+    /// @details `logical` pushes one frame per interpreter call; `unwind` rebuilds interpreter frames only when a trap is reported.
+    inline runtime_uwvm_int_call_stack_t global_runtime_uwvm_int_call_stack{runtime_uwvm_int_call_stack_t::logical};  // [global]
 #endif
 
 #if defined(UWVM_RUNTIME_LLVM_JIT) || defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -262,6 +284,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
 
     /// @brief Runtime LLVM JIT custom cache directory path.
     inline ::uwvm2::utils::container::u8string global_runtime_llvm_jit_cache_path{};  // [global]
+
+# if defined(__linux__)
+    /// @brief Whether every loaded LLVM JIT function is written to `/tmp/perf-<pid>.map` for `perf report`.
+    inline bool runtime_llvm_jit_perf_map{};  // [global]
+# endif
 #endif
 
 #if defined(UWVM_RUNTIME_UWVM_INTERPRETER_LLVM_JIT_TIERED)
@@ -270,6 +297,66 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
 
     /// @brief Whether Tier 2 background full-module LLVM JIT is disabled in tiered mode.
     inline bool runtime_tiered_disable_llvm_full_jit{};  // [global]
+
+    /// @brief Whether Tier 1 branch/entry counts are collected and applied to the Tier 2 full-module LLVM JIT.
+    inline bool runtime_tiered_profile_guided_full_jit{};  // [global]
+#endif
+
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+    /// @brief Whether an instance snapshot mode was explicitly configured.
+    inline bool runtime_snapshot_existed{};  // [global]
+
+    /// @brief Instance snapshot mode: run only the initializer and write a snapshot, or restore one instead of running the initializer.
+    inline runtime_snapshot_mode_t global_runtime_snapshot_mode{runtime_snapshot_mode_t::none};  // [global]
+
+    /// @brief Instance snapshot file path.
+    inline ::uwvm2::utils::container::u8string global_runtime_snapshot_path{};  // [global]
+
+    /// @brief Whether a repeated-run count was explicitly configured.
+    inline bool runtime_reset_repeat_existed{};  // [global]
+
+    /// @brief Number of times the entry is run; the instance is reset to its post-initialization state between runs.
+    inline ::std::size_t global_runtime_reset_repeat{1uz};  // [global]
+
+    /// @brief Whether fuel metering was explicitly configured.
+    inline bool runtime_fuel_existed{};  // [global]
+
+    /// @brief Fuel units each run starts with; one unit is charged per function entry and per loop-header pass.
+    inline ::std::uint_least64_t global_runtime_fuel{};  // [global]
+
+    /// @brief Whether epoch interruption was explicitly configured (`--wasm-timeout`); checks are only emitted then.
+    inline bool wasm_timeout_existed{};  // [global]
+
+    /// @brief Per-run wall-clock limit in milliseconds; 0 emits the epoch checks but leaves the deadline to the embedding API.
+    inline ::std::uint_least64_t global_wasm_timeout_ms{};  // [global]
+#endif
+
+#if defined(UWVM_RUNTIME_HAS_BACKEND) && defined(__linux__)
+    /// @brief Whether the sampling profiler was explicitly configured (`--runtime-sample-profile`).
+    inline bool runtime_sample_profile_existed{};  // [global]
+
+    /// @brief Sampling frequency in samples per second of guest-thread CPU time.
+    inline ::std::uint_least32_t global_runtime_sample_profile_hz{};  // [global]
+
+    /// @brief Folded-stack output file written when the run finishes.
+    inline ::uwvm2::utils::container::u8string global_runtime_sample_profile_path{};  // [global]
+#endif
+
+#if defined(UWVM_RUNTIME_FUNCTION_PROFILE)
+    enum class runtime_function_profile_format_t : unsigned
+    {
+        table,
+        json
+    };
+
+    /// @brief Whether per-function profiling was explicitly configured (`--runtime-function-profile`).
+    inline bool runtime_function_profile_existed{};  // [global]
+
+    /// @brief Layout of the report written at exit.
+    inline runtime_function_profile_format_t global_runtime_function_profile_format{};  // [global]
+
+    /// @brief Report file written when the run finishes.
+    inline ::uwvm2::utils::container::u8string global_runtime_function_profile_path{};  // [global]
 #endif
 
     /// @brief   The global runtime mode.
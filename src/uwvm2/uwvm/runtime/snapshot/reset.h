@@ -0,0 +1,255 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @file        reset.h
+ * @brief       In-process instance reset points.
+ * @details     A reset point records the mutable state of every wasm module once the initializer has run: defined globals, table elements and
+ *              sizes, element/data segment state, and linear memories. `reset_to_reset_point()` puts that state back so the same linked and
+ *              compiled instance can serve another run, without re-running `initialize_runtime()` or any backend translation.
+ *
+ *              On Linux, each mmap memory is backed by a memfd image of its contents at the reset point and mapped copy-on-write. A reset
+ *              re-maps the image and drops the grown tail, so its cost follows the pages the previous run touched; other targets fall back to
+ *              copying the saved contents back.
+ *
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/runtime/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+# include "snapshot.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::snapshot
+{
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+    struct instance_reset_point_t
+    {
+        struct memory_state_t
+        {
+            ::std::size_t page_count{};
+            ::std::size_t length{};
+            // Contents at the reset point; left empty when `image` backs the memory instead.
+            ::uwvm2::utils::container::vector<::std::byte> contents{};
+# if defined(UWVM_SUPPORT_MMAP)
+            ::uwvm2::object::memory::linear::mmap_memory_image_t image{};
+# endif
+        };
+
+        struct module_state_t
+        {
+            ::uwvm2::utils::container::u8string_view name{};
+            ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t* runtime_module{};
+            ::uwvm2::utils::container::vector<::uwvm2::object::global::wasm_global_storage_t> globals{};
+            ::uwvm2::utils::container::vector<::uwvm2::utils::container::vector<::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_t>> tables{};
+            ::uwvm2::utils::container::vector<::uwvm2::uwvm::runtime::storage::wasm_element_storage_t> elements{};
+            ::uwvm2::utils::container::vector<::uwvm2::uwvm::runtime::storage::wasm_data_storage_t> datas{};
+            ::uwvm2::utils::container::vector<memory_state_t> memories{};
+        };
+
+        ::uwvm2::utils::container::vector<module_state_t> modules{};
+        bool captured{};
+    };
+
+    /// @brief The reset point used by `--runtime-reset-repeat`.
+    inline instance_reset_point_t global_instance_reset_point{};  // [global]
+
+    namespace details
+    {
+        template <typename... Args>
+        inline constexpr void reset_error(Args&&... args) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                ::std::forward<Args>(args)...,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8" (reset)\n\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        template <typename NativeMemory>
+        inline constexpr void capture_memory_state(NativeMemory& memory, instance_reset_point_t::memory_state_t& state) noexcept
+        {
+            state.page_count = memory.get_page_size();
+            state.length = memory_byte_length(memory);
+            if(state.length == 0uz) { return; }
+
+# if defined(UWVM_SUPPORT_MMAP)
+            if constexpr(::uwvm2::object::memory::linear::mmap_memory_private_image_supported)
+            {
+                // Move the contents into a memfd and map it back copy-on-write; later resets only re-map the image.
+                if(state.image.create(state.length))
+                {
+                    ::fast_io::freestanding::my_memcpy(state.image.data(), memory.memory_begin, state.length);
+                    state.image.finish_writing();
+                    if(memory.try_map_private_image(0uz, state.image)) { return; }
+                    state.image.clear();
+                }
+            }
+# endif
+
+            state.contents.resize(state.length);
+            ::fast_io::freestanding::my_memcpy(state.contents.data(), memory.memory_begin, state.length);
+        }
+
+        template <typename NativeMemory>
+        [[nodiscard]] inline constexpr bool restore_memory_state(NativeMemory& memory, instance_reset_point_t::memory_state_t const& state) noexcept
+        {
+# if defined(UWVM_SUPPORT_MMAP)
+            if(state.image.fd != -1)
+            {
+                if(memory.try_reset_to_private_image(state.image)) [[likely]] { return true; }
+                // A failed re-map leaves the window zeroed at the reset-point length; nothing is left to copy from.
+                return false;
+            }
+# endif
+
+            // Memory cannot shrink on the copy path; a run that grew it cannot be undone here.
+            if(memory.get_page_size() != state.page_count) { return false; }
+            if(state.length != 0uz) { ::fast_io::freestanding::my_memcpy(memory.memory_begin, state.contents.data(), state.length); }
+            return true;
+        }
+    }  // namespace details
+
+    /// @brief  Record the current state of every runtime module as the point `reset_to_reset_point()` returns to.
+    /// @note   Call after the initializer has returned and before the first run. Memories imported from the host are not owned by any module
+    ///         and are left untouched by resets.
+    inline void capture_reset_point(instance_reset_point_t& point) noexcept
+    {
+        point.modules.clear();
+        point.modules.reserve(::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.size());
+
+        for(auto& entry: ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage)
+        {
+            auto& rt{entry.second};
+            instance_reset_point_t::module_state_t state{};
+            state.name = entry.first;
+            state.runtime_module = ::std::addressof(rt);
+
+            state.globals.reserve(rt.local_defined_global_vec_storage.size());
+            for(auto const& g: rt.local_defined_global_vec_storage) { state.globals.push_back_unchecked(g.global); }
+
+            state.tables.reserve(rt.local_defined_table_vec_storage.size());
+            for(auto const& table: rt.local_defined_table_vec_storage) { state.tables.push_back_unchecked(table.elems); }
+
+            state.elements.reserve(rt.local_defined_element_vec_storage.size());
+            for(auto const& e: rt.local_defined_element_vec_storage) { state.elements.push_back_unchecked(e.element); }
+
+            state.datas.reserve(rt.local_defined_data_vec_storage.size());
+            for(auto const& d: rt.local_defined_data_vec_storage) { state.datas.push_back_unchecked(d.data); }
+
+            state.memories.resize(rt.local_defined_memory_vec_storage.size());
+            for(::std::size_t i{}; i != rt.local_defined_memory_vec_storage.size(); ++i)
+            {
+                details::capture_memory_state(rt.local_defined_memory_vec_storage.index_unchecked(i).memory, state.memories.index_unchecked(i));
+            }
+
+            point.modules.push_back(::std::move(state));
+        }
+
+        point.captured = true;
+    }
+
+    /// @brief  Put every runtime module back into the state recorded by `capture_reset_point()`.
+    /// @return false if a memory could not be restored (copy path after growth, or a failed re-map). The instance must not run again then.
+    /// @note   Only valid between runs, while no guest code executes. Host-side state such as WASI file descriptors is not reset.
+    [[nodiscard]] inline bool reset_to_reset_point(instance_reset_point_t const& point) noexcept
+    {
+        if(!point.captured) [[unlikely]] { return false; }
+
+        for(auto const& state: point.modules)
+        {
+            auto& rt{*state.runtime_module};
+
+            for(::std::size_t i{}; i != state.globals.size(); ++i)
+            {
+                rt.local_defined_global_vec_storage.index_unchecked(i).global = state.globals.index_unchecked(i);
+            }
+
+            // Tables are restored in place: `table.grow` resizes the same element vector, and compiled code reaches it through the table record.
+            for(::std::size_t i{}; i != state.tables.size(); ++i)
+            {
+                auto& elems{rt.local_defined_table_vec_storage.index_unchecked(i).elems};
+                auto const& saved{state.tables.index_unchecked(i)};
+                elems.resize(saved.size());
+                for(::std::size_t j{}; j != saved.size(); ++j) { elems.index_unchecked(j) = saved.index_unchecked(j); }
+            }
+
+            // Segment records carry their own dropped flag and byte/function range, so copying them back also undoes `data.drop`/`elem.drop`.
+            for(::std::size_t i{}; i != state.elements.size(); ++i)
+            {
+                rt.local_defined_element_vec_storage.index_unchecked(i).element = state.elements.index_unchecked(i);
+            }
+            for(::std::size_t i{}; i != state.datas.size(); ++i) { rt.local_defined_data_vec_storage.index_unchecked(i).data = state.datas.index_unchecked(i); }
+
+            for(::std::size_t i{}; i != state.memories.size(); ++i)
+            {
+                if(!details::restore_memory_state(rt.local_defined_memory_vec_storage.index_unchecked(i).memory, state.memories.index_unchecked(i)))
+                    [[unlikely]]
+                {
+                    details::reset_error(u8"Unable to reset memory ",
+                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                         i,
+                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                         u8" of module \"",
+                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                         state.name,
+                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                         u8"\": either the previous run grew it and this target cannot shrink memory, or re-mapping its image failed.");
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+#endif
+}  // namespace uwvm2::uwvm::runtime::snapshot
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
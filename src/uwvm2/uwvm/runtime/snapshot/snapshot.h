@@ -0,0 +1,1034 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @file        snapshot.h
+ * @brief       Pre-initialized instance snapshots.
+ * @details     A snapshot captures the runtime state of every wasm module after its initializer has run: linear-memory contents, global
+ *              values, table elements, and the dropped state of passive element/data segments. Restoring a snapshot replaces the initializer
+ *              run of a later process with a file read (or, on Linux, a copy-on-write mapping of the memory images).
+ *
+ *              Snapshots are keyed by a SHA-256 over the bytes of every loaded module plus the WASI Preview 1 argv, environment, and mount
+ *              roots, so a snapshot is only accepted by the exact module set and guest configuration that produced it. State that cannot be
+ *              reproduced from the file (host-provided memories and globals, host references) makes `write_snapshot()` refuse instead of
+ *              producing a snapshot that would silently diverge on restore.
+ *
+ *              File layout (all integers little-endian):
+ *              - header: magic (8), format version (u32), module count (u32), key (32), memory data offset (u64);
+ *              - per module, in name order: name, globals (kind u8 + 16 payload bytes), tables (element count, then tag u8 + module u32 +
+ *                function index u64 per element), element-segment dropped flags, data-segment dropped flags, memories (page count, byte
+ *                length, data-area offset);
+ *              - memory images, each starting on a `snapshot_memory_alignment` boundary so they can be mapped directly.
+ *
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <algorithm>
+# include <bit>
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <limits>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/runtime/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_push_macro.h>  // wasip1
+# endif
+// import
+# include <fast_io.h>
+# include <fast_io_device.h>
+# include <fast_io_crypto.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/imported/wasi/wasip1/storage/impl.h>
+# include <uwvm2/uwvm/wasm/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::snapshot
+{
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+    enum class snapshot_status : unsigned
+    {
+        ok,
+        io_error,
+        bad_format,
+        key_mismatch,
+        module_mismatch,
+        not_reproducible,
+        memory_error
+    };
+
+    inline constexpr ::uwvm2::utils::container::u8string_view get_snapshot_status_name(snapshot_status status) noexcept
+    {
+        switch(status)
+        {
+            case snapshot_status::ok:
+            {
+                return u8"ok";
+            }
+            case snapshot_status::io_error:
+            {
+                return u8"io_error";
+            }
+            case snapshot_status::bad_format:
+            {
+                return u8"bad_format";
+            }
+            case snapshot_status::key_mismatch:
+            {
+                return u8"key_mismatch";
+            }
+            case snapshot_status::module_mismatch:
+            {
+                return u8"module_mismatch";
+            }
+            case snapshot_status::not_reproducible:
+            {
+                return u8"not_reproducible";
+            }
+            case snapshot_status::memory_error:
+            {
+                return u8"memory_error";
+            }
+            [[unlikely]] default:
+            {
+                return u8"unknown";
+            }
+        }
+    }
+
+    namespace details
+    {
+        inline constexpr ::std::size_t snapshot_key_size{32uz};
+        using snapshot_key_t = ::uwvm2::utils::container::array<::std::byte, snapshot_key_size>;
+
+        inline constexpr char8_t snapshot_magic[8]{u8'U', u8'W', u8'V', u8'M', u8'S', u8'N', u8'P', u8'\x01'};
+        inline constexpr ::std::uint_least32_t snapshot_format_version{1u};
+
+        // magic + version + module count + key + memory data offset
+        inline constexpr ::std::size_t snapshot_header_size{sizeof(snapshot_magic) + 4uz + 4uz + snapshot_key_size + 8uz};
+
+        // Memory images start on a 64 KiB boundary: a multiple of every supported platform page size, so each image can be mapped in place.
+        inline constexpr ::std::size_t snapshot_memory_alignment{65536uz};
+
+        // Every global payload is stored in a fixed 16-byte slot (the size of v128).
+        inline constexpr ::std::size_t snapshot_global_payload_size{16uz};
+
+        enum class snapshot_func_ref_tag : ::std::uint_least8_t
+        {
+            null_ref,
+            imported,
+            defined
+        };
+
+        using module_name_vec = ::uwvm2::utils::container::vector<::uwvm2::utils::container::u8string_view>;
+        using byte_vec = ::uwvm2::utils::container::vector<::std::byte>;
+
+        template <typename... Args>
+        inline constexpr void snapshot_error(Args&&... args) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                ::std::forward<Args>(args)...,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8" (snapshot)\n\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        template <typename... Args>
+        inline constexpr void snapshot_verbose_info(Args&&... args) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                ::std::forward<Args>(args)...,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
+                                u8"[",
+                                ::uwvm2::uwvm::io::get_local_realtime(),
+                                u8"] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8"(verbose)\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        inline constexpr void append_bytes(byte_vec& out, void const* first, ::std::size_t size) noexcept
+        {
+            auto curr{reinterpret_cast<::std::byte const*>(first)};
+            for(auto const last{curr + size}; curr != last; ++curr) { out.push_back(*curr); }
+        }
+
+        inline constexpr void append_u8(byte_vec& out, ::std::uint_least8_t v) noexcept { out.push_back(static_cast<::std::byte>(v)); }
+
+        inline constexpr void append_u32_le(byte_vec& out, ::std::uint_least32_t v) noexcept
+        {
+            for(unsigned i{}; i != 4u; ++i) { out.push_back(static_cast<::std::byte>((v >> (i * 8u)) & 0xFFu)); }
+        }
+
+        inline constexpr void append_u64_le(byte_vec& out, ::std::uint_least64_t v) noexcept
+        {
+            for(unsigned i{}; i != 8u; ++i) { out.push_back(static_cast<::std::byte>((v >> (i * 8u)) & 0xFFu)); }
+        }
+
+        inline constexpr void append_name(byte_vec& out, ::uwvm2::utils::container::u8string_view name) noexcept
+        {
+            append_u64_le(out, static_cast<::std::uint_least64_t>(name.size()));
+            append_bytes(out, name.data(), name.size());
+        }
+
+        inline constexpr void patch_u64_le(byte_vec& out, ::std::size_t pos, ::std::uint_least64_t v) noexcept
+        {
+            for(unsigned i{}; i != 8u; ++i) { out.index_unchecked(pos + i) = static_cast<::std::byte>((v >> (i * 8u)) & 0xFFu); }
+        }
+
+        /// @brief Bounds-checked cursor over the loaded snapshot file. Every read fails (instead of trapping) on a truncated file.
+        struct snapshot_reader
+        {
+            ::std::byte const* curr{};
+            ::std::byte const* end{};
+
+            [[nodiscard]] inline constexpr bool read_bytes(void* out, ::std::size_t size) noexcept
+            {
+                if(static_cast<::std::size_t>(this->end - this->curr) < size) [[unlikely]] { return false; }
+                if(size != 0uz) { ::std::memcpy(out, this->curr, size); }
+                this->curr += size;
+                return true;
+            }
+
+            [[nodiscard]] inline constexpr bool read_u8(::std::uint_least8_t& out) noexcept
+            {
+                if(this->curr == this->end) [[unlikely]] { return false; }
+                out = static_cast<::std::uint_least8_t>(*this->curr++);
+                return true;
+            }
+
+            [[nodiscard]] inline constexpr bool read_u32_le(::std::uint_least32_t& out) noexcept
+            {
+                if(static_cast<::std::size_t>(this->end - this->curr) < 4uz) [[unlikely]] { return false; }
+                out = {};
+                for(unsigned i{}; i != 4u; ++i) { out |= static_cast<::std::uint_least32_t>(static_cast<::std::uint_least8_t>(*this->curr++)) << (i * 8u); }
+                return true;
+            }
+
+            [[nodiscard]] inline constexpr bool read_u64_le(::std::uint_least64_t& out) noexcept
+            {
+                if(static_cast<::std::size_t>(this->end - this->curr) < 8uz) [[unlikely]] { return false; }
+                out = {};
+                for(unsigned i{}; i != 8u; ++i) { out |= static_cast<::std::uint_least64_t>(static_cast<::std::uint_least8_t>(*this->curr++)) << (i * 8u); }
+                return true;
+            }
+
+            [[nodiscard]] inline constexpr bool read_size(::std::size_t& out) noexcept
+            {
+                ::std::uint_least64_t v{};
+                if(!this->read_u64_le(v) || v > ::std::numeric_limits<::std::size_t>::max()) [[unlikely]] { return false; }
+                out = static_cast<::std::size_t>(v);
+                return true;
+            }
+
+            [[nodiscard]] inline constexpr bool read_name(::uwvm2::utils::container::u8string_view& out) noexcept
+            {
+                ::std::size_t size{};
+                if(!this->read_size(size) || static_cast<::std::size_t>(this->end - this->curr) < size) [[unlikely]] { return false; }
+                out = ::uwvm2::utils::container::u8string_view{reinterpret_cast<char8_t const*>(this->curr), size};
+                this->curr += size;
+                return true;
+            }
+        };
+
+        /// @brief Runtime module names in byte order, so the file layout and the key do not depend on hash-map iteration order.
+        [[nodiscard]] inline constexpr module_name_vec sorted_runtime_module_names() noexcept
+        {
+            module_name_vec names{};
+            names.reserve(::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.size());
+            for(auto const& entry: ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage) { names.push_back(entry.first); }
+            ::std::sort(names.begin(), names.end());
+            return names;
+        }
+
+        inline constexpr void sha256_update(::fast_io::sha256_context& sha, void const* first, ::std::size_t size) noexcept
+        {
+            if(size != 0uz)
+            {
+                auto const begin{reinterpret_cast<::std::byte const*>(first)};
+                sha.update(begin, begin + size);
+            }
+        }
+
+        inline constexpr void sha256_update_name(::fast_io::sha256_context& sha, ::uwvm2::utils::container::u8string_view name) noexcept
+        {
+            byte_vec size_bytes{};
+            append_u64_le(size_bytes, static_cast<::std::uint_least64_t>(name.size()));
+            sha256_update(sha, size_bytes.data(), size_bytes.size());
+            sha256_update(sha, name.data(), name.size());
+        }
+
+        /// @brief Key that binds a snapshot to the exact loaded modules and WASI guest configuration.
+        /// @note  Host byte order is part of the key because global payloads are stored in native representation.
+        [[nodiscard]] inline constexpr snapshot_key_t make_snapshot_key() noexcept
+        {
+            ::fast_io::sha256_context sha{};
+            sha256_update_name(sha, u8"uwvm2-instance-snapshot");
+            sha256_update_name(sha, ::std::endian::native == ::std::endian::little ? u8"le" : u8"be");
+
+            ::uwvm2::utils::container::vector<::uwvm2::utils::container::u8string_view> all_names{};
+            all_names.reserve(::uwvm2::uwvm::wasm::storage::all_module.size());
+            for(auto const& entry: ::uwvm2::uwvm::wasm::storage::all_module) { all_names.push_back(entry.first); }
+            ::std::sort(all_names.begin(), all_names.end());
+
+            for(auto const name: all_names)
+            {
+                auto const& am{::uwvm2::uwvm::wasm::storage::all_module.find(name)->second};
+                sha256_update_name(sha, name);
+
+                byte_vec type_bytes{};
+                append_u32_le(type_bytes, static_cast<::std::uint_least32_t>(am.type));
+                sha256_update(sha, type_bytes.data(), type_bytes.size());
+
+                if(am.type == ::uwvm2::uwvm::wasm::type::module_type_t::exec_wasm || am.type == ::uwvm2::uwvm::wasm::type::module_type_t::preloaded_wasm)
+                {
+                    auto const wf{am.module_storage_ptr.wf};
+                    if(wf != nullptr && wf->binfmt_ver == 1u)
+                    {
+                        auto const& span{wf->wasm_module_storage.wasm_binfmt_ver1_storage.module_span};
+                        sha256_update(sha, span.module_begin, static_cast<::std::size_t>(span.module_end - span.module_begin));
+                    }
+
+                    static_assert(::uwvm2::uwvm::wasm::feature::max_binfmt_version == 1u, "missing implementation of other binfmt version");
+                }
+            }
+
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  if defined(UWVM_IMPORT_WASI_WASIP1)
+            auto const& env{::uwvm2::uwvm::imported::wasi::wasip1::storage::default_wasip1_env};
+            sha256_update_name(sha, u8"wasip1-argv");
+            for(auto const arg: env.argv) { sha256_update_name(sha, arg); }
+            sha256_update_name(sha, u8"wasip1-envs");
+            for(auto const e: env.envs) { sha256_update_name(sha, e); }
+            sha256_update_name(sha, u8"wasip1-mounts");
+            for(auto const& mr: env.mount_dir_roots) { sha256_update_name(sha, mr.preload_dir); }
+#  endif
+# endif
+
+            sha.do_final();
+            snapshot_key_t key{};
+            sha.digest_to_byte_ptr(key.data());
+            return key;
+        }
+
+        /// @brief Index of `ptr` inside `vec`, or false when it points elsewhere. Compares addresses as integers, since the candidate vector
+        ///        is usually not the one the pointer came from.
+        template <typename T>
+        [[nodiscard]] inline constexpr bool index_in_vector(::uwvm2::utils::container::vector<T> const& vec, T const* ptr, ::std::size_t& index) noexcept
+        {
+            if(vec.empty()) { return false; }
+            auto const base{reinterpret_cast<::std::uintptr_t>(vec.data())};
+            auto const addr{reinterpret_cast<::std::uintptr_t>(ptr)};
+            if(addr < base) { return false; }
+            auto const diff{static_cast<::std::size_t>(addr - base)};
+            if(diff % sizeof(T) != 0uz || diff / sizeof(T) >= vec.size()) { return false; }
+            index = diff / sizeof(T);
+            return true;
+        }
+
+        /// @brief Encode a table element as (tag, module ordinal, vector index). Function storage may belong to any module.
+        [[nodiscard]] inline constexpr bool encode_table_elem(module_name_vec const& names,
+                                                              ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_t const& elem,
+                                                              byte_vec& out) noexcept
+        {
+            using elem_type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t;
+
+            bool const is_imported{elem.type == elem_type::func_ref_imported};
+            bool const is_null{is_imported ? elem.storage.imported_ptr == nullptr : elem.storage.defined_ptr == nullptr};
+            if(is_null)
+            {
+                append_u8(out, static_cast<::std::uint_least8_t>(snapshot_func_ref_tag::null_ref));
+                append_u32_le(out, 0u);
+                append_u64_le(out, 0u);
+                return true;
+            }
+
+            for(::std::size_t ordinal{}; ordinal != names.size(); ++ordinal)
+            {
+                auto const& rt{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(names.index_unchecked(ordinal))->second};
+                ::std::size_t index{};
+                bool const found{is_imported ? index_in_vector(rt.imported_function_vec_storage, elem.storage.imported_ptr, index)
+                                             : index_in_vector(rt.local_defined_function_vec_storage, elem.storage.defined_ptr, index)};
+                if(!found) { continue; }
+
+                append_u8(out, static_cast<::std::uint_least8_t>(is_imported ? snapshot_func_ref_tag::imported : snapshot_func_ref_tag::defined));
+                append_u32_le(out, static_cast<::std::uint_least32_t>(ordinal));
+                append_u64_le(out, static_cast<::std::uint_least64_t>(index));
+                return true;
+            }
+
+            return false;
+        }
+
+        [[nodiscard]] inline constexpr bool decode_table_elem(module_name_vec const& names,
+                                                              ::std::uint_least8_t tag,
+                                                              ::std::uint_least32_t ordinal,
+                                                              ::std::uint_least64_t index,
+                                                              ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_t& elem) noexcept
+        {
+            using elem_type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t;
+
+            switch(static_cast<snapshot_func_ref_tag>(tag))
+            {
+                case snapshot_func_ref_tag::null_ref:
+                {
+                    elem = {};
+                    return true;
+                }
+                case snapshot_func_ref_tag::imported: [[fallthrough]];
+                case snapshot_func_ref_tag::defined:
+                {
+                    if(ordinal >= names.size()) [[unlikely]] { return false; }
+                    auto const& rt{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(names.index_unchecked(ordinal))->second};
+                    if(static_cast<snapshot_func_ref_tag>(tag) == snapshot_func_ref_tag::imported)
+                    {
+                        if(index >= rt.imported_function_vec_storage.size()) [[unlikely]] { return false; }
+                        elem.storage.imported_ptr = ::std::addressof(rt.imported_function_vec_storage.index_unchecked(static_cast<::std::size_t>(index)));
+                        elem.type = elem_type::func_ref_imported;
+                    }
+                    else
+                    {
+                        if(index >= rt.local_defined_function_vec_storage.size()) [[unlikely]] { return false; }
+                        elem.storage.defined_ptr = ::std::addressof(rt.local_defined_function_vec_storage.index_unchecked(static_cast<::std::size_t>(index)));
+                        elem.type = elem_type::func_ref_defined;
+                    }
+                    return true;
+                }
+                [[unlikely]] default:
+                {
+                    return false;
+                }
+            }
+        }
+
+        /// @brief Encode a global as kind + a 16-byte payload. Only null and index-based function references are reproducible.
+        [[nodiscard]] inline constexpr bool encode_global(::uwvm2::object::global::wasm_global_storage_t const& g, byte_vec& out) noexcept
+        {
+            using global_type = ::uwvm2::object::global::global_type;
+
+            ::std::byte payload[snapshot_global_payload_size]{};
+            switch(g.kind)
+            {
+                case global_type::wasm_i32:
+                {
+                    ::std::memcpy(payload, ::std::addressof(g.storage.i32), sizeof(g.storage.i32));
+                    break;
+                }
+                case global_type::wasm_i64:
+                {
+                    ::std::memcpy(payload, ::std::addressof(g.storage.i64), sizeof(g.storage.i64));
+                    break;
+                }
+                case global_type::wasm_f32:
+                {
+                    ::std::memcpy(payload, ::std::addressof(g.storage.f32), sizeof(g.storage.f32));
+                    break;
+                }
+                case global_type::wasm_f64:
+                {
+                    ::std::memcpy(payload, ::std::addressof(g.storage.f64), sizeof(g.storage.f64));
+                    break;
+                }
+                case global_type::wasm_v128:
+                {
+                    static_assert(sizeof(g.storage.v128) <= snapshot_global_payload_size);
+                    ::std::memcpy(payload, ::std::addressof(g.storage.v128), sizeof(g.storage.v128));
+                    break;
+                }
+                case global_type::wasm_ref:
+                {
+                    using ref_kind = ::uwvm2::object::global::wasm_ref_kind;
+                    auto const kind{g.storage.ref.kind};
+                    if(kind != ref_kind::wasm_null && kind != ref_kind::wasm_func) { return false; }
+
+                    ::std::uint_least32_t const kind_u32{static_cast<::std::uint_least32_t>(kind)};
+                    ::std::uint_least32_t const func_idx{kind == ref_kind::wasm_func ? static_cast<::std::uint_least32_t>(g.storage.ref.storage.func_idx) : 0u};
+                    ::std::memcpy(payload, ::std::addressof(kind_u32), sizeof(kind_u32));
+                    ::std::memcpy(payload + sizeof(kind_u32), ::std::addressof(func_idx), sizeof(func_idx));
+                    break;
+                }
+                [[unlikely]] default:
+                {
+                    return false;
+                }
+            }
+
+            append_u8(out, static_cast<::std::uint_least8_t>(g.kind));
+            append_bytes(out, payload, sizeof(payload));
+            return true;
+        }
+
+        inline constexpr void decode_global_payload(::uwvm2::object::global::wasm_global_storage_t& g, ::std::byte const* payload) noexcept
+        {
+            using global_type = ::uwvm2::object::global::global_type;
+
+            switch(g.kind)
+            {
+                case global_type::wasm_i32:
+                {
+                    ::std::memcpy(::std::addressof(g.storage.i32), payload, sizeof(g.storage.i32));
+                    break;
+                }
+                case global_type::wasm_i64:
+                {
+                    ::std::memcpy(::std::addressof(g.storage.i64), payload, sizeof(g.storage.i64));
+                    break;
+                }
+                case global_type::wasm_f32:
+                {
+                    ::std::memcpy(::std::addressof(g.storage.f32), payload, sizeof(g.storage.f32));
+                    break;
+                }
+                case global_type::wasm_f64:
+                {
+                    ::std::memcpy(::std::addressof(g.storage.f64), payload, sizeof(g.storage.f64));
+                    break;
+                }
+                case global_type::wasm_v128:
+                {
+                    ::std::memcpy(::std::addressof(g.storage.v128), payload, sizeof(g.storage.v128));
+                    break;
+                }
+                case global_type::wasm_ref:
+                {
+                    ::std::uint_least32_t kind_u32{};
+                    ::std::uint_least32_t func_idx{};
+                    ::std::memcpy(::std::addressof(kind_u32), payload, sizeof(kind_u32));
+                    ::std::memcpy(::std::addressof(func_idx), payload + sizeof(kind_u32), sizeof(func_idx));
+                    g.storage.ref = {};
+                    g.storage.ref.kind = static_cast<::uwvm2::object::global::wasm_ref_kind>(kind_u32);
+                    if(g.storage.ref.kind == ::uwvm2::object::global::wasm_ref_kind::wasm_func) { g.storage.ref.storage.func_idx = func_idx; }
+                    break;
+                }
+                [[unlikely]] default:
+                {
+                    break;
+                }
+            }
+        }
+
+        template <typename NativeMemory>
+        [[nodiscard]] inline constexpr ::std::size_t memory_byte_length(NativeMemory const& memory) noexcept
+        {
+            // All supported backends expose `get_page_size()` and `custom_page_size_log2`; the initializer already proved the product fits.
+            return memory.get_page_size() << static_cast<::std::size_t>(memory.custom_page_size_log2);
+        }
+
+        [[nodiscard]] inline constexpr ::std::size_t align_up_memory(::std::size_t v) noexcept
+        { return (v + (snapshot_memory_alignment - 1uz)) & ~(snapshot_memory_alignment - 1uz); }
+
+        /// @brief Reject module state that a later process cannot recreate from the snapshot file alone.
+        [[nodiscard]] inline constexpr bool check_snapshot_reproducible(module_name_vec const& names) noexcept
+        {
+            using memory_link_kind = ::uwvm2::uwvm::runtime::storage::imported_memory_storage_t::imported_memory_link_kind;
+            using global_link_kind = ::uwvm2::uwvm::runtime::storage::imported_global_storage_t::imported_global_link_kind;
+
+            for(auto const name: names)
+            {
+                auto const& rt{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(name)->second};
+
+                // Imports that resolve to another wasm module are restored through that module's own record; host-provided ones are not.
+                for(auto const& imp: rt.imported_memory_vec_storage)
+                {
+                    if(imp.link_kind == memory_link_kind::local_imported)
+                    {
+                        snapshot_error(u8"Module \"",
+                                       ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                       name,
+                                       ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                       u8"\" imports a host-provided memory, whose contents cannot be reproduced from a snapshot.");
+                        return false;
+                    }
+                }
+
+                for(auto const& imp: rt.imported_global_vec_storage)
+                {
+                    if(imp.link_kind == global_link_kind::local_imported)
+                    {
+                        snapshot_error(u8"Module \"",
+                                       ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                       name,
+                                       ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                       u8"\" imports a host-provided global, whose value cannot be reproduced from a snapshot.");
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }  // namespace details
+
+    /// @brief  Serialize the current state of every runtime module to `path`.
+    /// @note   Call after the initializer has returned and before any other guest code runs. The file is written to a temporary name and then
+    ///         renamed, so an interrupted write never leaves a truncated snapshot behind.
+    [[nodiscard]] inline snapshot_status write_snapshot(::uwvm2::utils::container::u8string_view path) noexcept
+    {
+        auto const names{details::sorted_runtime_module_names()};
+        if(!details::check_snapshot_reproducible(names)) { return snapshot_status::not_reproducible; }
+
+        if(names.size() > ::std::numeric_limits<::std::uint_least32_t>::max()) [[unlikely]] { return snapshot_status::not_reproducible; }
+
+        details::byte_vec meta{};
+        details::append_bytes(meta, details::snapshot_magic, sizeof(details::snapshot_magic));
+        details::append_u32_le(meta, details::snapshot_format_version);
+        details::append_u32_le(meta, static_cast<::std::uint_least32_t>(names.size()));
+        auto const key{details::make_snapshot_key()};
+        details::append_bytes(meta, key.data(), key.size());
+        auto const data_offset_pos{meta.size()};
+        details::append_u64_le(meta, 0u);
+
+        // Memories are written in metadata order; `data_size` tracks the running offset inside the data area.
+        struct pending_memory_t
+        {
+            ::std::byte const* begin{};
+            ::std::size_t length{};
+        };
+
+        ::uwvm2::utils::container::vector<pending_memory_t> memories{};
+        ::std::size_t data_size{};
+
+        for(auto const name: names)
+        {
+            auto const& rt{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(name)->second};
+            details::append_name(meta, name);
+
+            details::append_u64_le(meta, static_cast<::std::uint_least64_t>(rt.local_defined_global_vec_storage.size()));
+            for(auto const& g: rt.local_defined_global_vec_storage)
+            {
+                if(!details::encode_global(g.global, meta))
+                {
+                    details::snapshot_error(u8"Module \"",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                            name,
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                            u8"\" holds a global reference to host state, which cannot be stored in a snapshot.");
+                    return snapshot_status::not_reproducible;
+                }
+            }
+
+            details::append_u64_le(meta, static_cast<::std::uint_least64_t>(rt.local_defined_table_vec_storage.size()));
+            for(auto const& table: rt.local_defined_table_vec_storage)
+            {
+                details::append_u64_le(meta, static_cast<::std::uint_least64_t>(table.elems.size()));
+                for(auto const& elem: table.elems)
+                {
+                    if(!details::encode_table_elem(names, elem, meta)) [[unlikely]]
+                    {
+                        details::snapshot_error(u8"Module \"",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                name,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"\" has a table element that does not point into runtime function storage.");
+                        return snapshot_status::not_reproducible;
+                    }
+                }
+            }
+
+            details::append_u64_le(meta, static_cast<::std::uint_least64_t>(rt.local_defined_element_vec_storage.size()));
+            for(auto const& e: rt.local_defined_element_vec_storage) { details::append_u8(meta, e.element.dropped ? 1u : 0u); }
+
+            details::append_u64_le(meta, static_cast<::std::uint_least64_t>(rt.local_defined_data_vec_storage.size()));
+            for(auto const& d: rt.local_defined_data_vec_storage) { details::append_u8(meta, d.data.dropped ? 1u : 0u); }
+
+            details::append_u64_le(meta, static_cast<::std::uint_least64_t>(rt.local_defined_memory_vec_storage.size()));
+            for(auto const& mem: rt.local_defined_memory_vec_storage)
+            {
+                auto const length{details::memory_byte_length(mem.memory)};
+                details::append_u64_le(meta, static_cast<::std::uint_least64_t>(mem.memory.get_page_size()));
+                details::append_u64_le(meta, static_cast<::std::uint_least64_t>(length));
+                details::append_u64_le(meta, static_cast<::std::uint_least64_t>(data_size));
+
+                memories.push_back({mem.memory.memory_begin, length});
+                data_size += details::align_up_memory(length);
+            }
+        }
+
+        auto const data_offset{details::align_up_memory(meta.size())};
+        details::patch_u64_le(meta, data_offset_pos, static_cast<::std::uint_least64_t>(data_offset));
+
+        ::uwvm2::utils::container::u8string temp_path{};
+        {
+            ::uwvm2::utils::container::u8string_ref_uwvm ref{::std::addressof(temp_path)};
+            ::fast_io::io::print(ref, path, u8".wip");
+        }
+
+# ifdef UWVM_CPP_EXCEPTIONS
+        try
+# endif
+        {
+            {
+                ::fast_io::u8obuf_file file{temp_path, ::fast_io::open_mode::out | ::fast_io::open_mode::creat | ::fast_io::open_mode::trunc};
+
+                static constexpr ::std::byte zero_page[details::snapshot_memory_alignment]{};
+                auto const write_padding{[&file](::std::size_t size) constexpr
+                                         {
+                                             if(size != 0uz) { ::fast_io::operations::write_all_bytes(file, zero_page, zero_page + size); }
+                                         }};
+
+                ::fast_io::operations::write_all_bytes(file, meta.cbegin(), meta.cend());
+                write_padding(data_offset - meta.size());
+
+                for(auto const& m: memories)
+                {
+                    if(m.length != 0uz) { ::fast_io::operations::write_all_bytes(file, m.begin, m.begin + m.length); }
+                    write_padding(details::align_up_memory(m.length) - m.length);
+                }
+            }
+
+            ::fast_io::native_renameat(::fast_io::at_fdcwd(), temp_path, ::fast_io::at_fdcwd(), path);
+        }
+# ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error e)
+        {
+            details::snapshot_error(u8"Unable to write snapshot \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\": ",
+                                    e);
+            return snapshot_status::io_error;
+        }
+# endif
+
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        {
+            details::snapshot_verbose_info(u8"Wrote instance snapshot \"",
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                           path,
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                           u8"\" (modules=",
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                           names.size(),
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                           u8", memory_bytes=",
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                           data_size,
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                           u8"). ");
+        }
+
+        return snapshot_status::ok;
+    }
+
+    /// @brief  Replace the freshly instantiated state of every runtime module with the contents of the snapshot at `path`.
+    /// @note   Call after runtime initialization and before any guest code runs. The snapshot is validated completely before the first module is
+    ///         modified, except for memory growth and image installation, which happen per memory; a failure there is reported as
+    ///         `memory_error` and the process must not continue running guest code.
+    [[nodiscard]] inline snapshot_status restore_snapshot(::uwvm2::utils::container::u8string_view path) noexcept
+    {
+        auto const names{details::sorted_runtime_module_names()};
+
+        ::fast_io::native_file_loader file{};
+# ifdef UWVM_CPP_EXCEPTIONS
+        try
+# endif
+        {
+            file = ::fast_io::native_file_loader{path, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+        }
+# ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error e)
+        {
+            details::snapshot_error(u8"Unable to open snapshot \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\": ",
+                                    e);
+            return snapshot_status::io_error;
+        }
+# endif
+
+        auto const file_begin{reinterpret_cast<::std::byte const*>(file.cbegin())};
+        auto const file_end{reinterpret_cast<::std::byte const*>(file.cend())};
+        auto const file_size{static_cast<::std::size_t>(file_end - file_begin)};
+        details::snapshot_reader reader{file_begin, file_end};
+
+        auto const bad_format{[&path]() constexpr noexcept -> snapshot_status
+                              {
+                                  details::snapshot_error(u8"Snapshot \"",
+                                                          ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                                          path,
+                                                          ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                          u8"\" is truncated or malformed.");
+                                  return snapshot_status::bad_format;
+                              }};
+
+        // header
+        char8_t magic[sizeof(details::snapshot_magic)]{};
+        ::std::uint_least32_t version{};
+        ::std::uint_least32_t module_count{};
+        details::snapshot_key_t file_key{};
+        ::std::size_t data_offset{};
+        if(!reader.read_bytes(magic, sizeof(magic)) || ::std::memcmp(magic, details::snapshot_magic, sizeof(magic)) != 0 || !reader.read_u32_le(version) ||
+           version != details::snapshot_format_version || !reader.read_u32_le(module_count) || !reader.read_bytes(file_key.data(), file_key.size()) ||
+           !reader.read_size(data_offset) || data_offset > file_size || (data_offset % details::snapshot_memory_alignment) != 0uz) [[unlikely]]
+        {
+            return bad_format();
+        }
+
+        if(auto const key{details::make_snapshot_key()}; ::std::memcmp(key.data(), file_key.data(), key.size()) != 0)
+        {
+            details::snapshot_error(u8"Snapshot \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\" was created for different modules or a different WASI configuration.");
+            return snapshot_status::key_mismatch;
+        }
+
+        if(module_count != names.size()) [[unlikely]] { return bad_format(); }
+
+        // Pass 1 validates every record against the live runtime storage; pass 2 applies. Reusing the same reader keeps both passes in sync.
+        auto const meta_begin{reader.curr};
+        for(unsigned pass{}; pass != 2u; ++pass)
+        {
+            bool const apply{pass == 1u};
+            reader.curr = meta_begin;
+
+            for(auto const expected_name: names)
+            {
+                ::uwvm2::utils::container::u8string_view name{};
+                if(!reader.read_name(name)) [[unlikely]] { return bad_format(); }
+                if(name != expected_name) [[unlikely]]
+                {
+                    details::snapshot_error(u8"Snapshot module \"",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                            name,
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                            u8"\" does not match runtime module \"",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                            expected_name,
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                            u8"\".");
+                    return snapshot_status::module_mismatch;
+                }
+
+                auto& rt{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(expected_name)->second};
+
+                // globals
+                ::std::size_t global_count{};
+                if(!reader.read_size(global_count)) [[unlikely]] { return bad_format(); }
+                if(global_count != rt.local_defined_global_vec_storage.size()) [[unlikely]] { return snapshot_status::module_mismatch; }
+                for(auto& g: rt.local_defined_global_vec_storage)
+                {
+                    ::std::uint_least8_t kind{};
+                    ::std::byte payload[details::snapshot_global_payload_size]{};
+                    if(!reader.read_u8(kind) || !reader.read_bytes(payload, sizeof(payload))) [[unlikely]] { return bad_format(); }
+                    if(kind != static_cast<::std::uint_least8_t>(g.global.kind)) [[unlikely]] { return snapshot_status::module_mismatch; }
+                    if(apply) { details::decode_global_payload(g.global, payload); }
+                }
+
+                // tables
+                ::std::size_t table_count{};
+                if(!reader.read_size(table_count)) [[unlikely]] { return bad_format(); }
+                if(table_count != rt.local_defined_table_vec_storage.size()) [[unlikely]] { return snapshot_status::module_mismatch; }
+                for(auto& table: rt.local_defined_table_vec_storage)
+                {
+                    ::std::size_t elem_count{};
+                    if(!reader.read_size(elem_count)) [[unlikely]] { return bad_format(); }
+
+                    // Tables are restored in place; compiled call_indirect views keep pointing at the same element storage.
+                    if(elem_count != table.elems.size())
+                    {
+                        details::snapshot_error(u8"Snapshot table size of module \"",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                expected_name,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"\" differs from the instantiated table; tables grown by the initializer are not supported.");
+                        return snapshot_status::module_mismatch;
+                    }
+
+                    for(auto& elem: table.elems)
+                    {
+                        ::std::uint_least8_t tag{};
+                        ::std::uint_least32_t ordinal{};
+                        ::std::uint_least64_t index{};
+                        if(!reader.read_u8(tag) || !reader.read_u32_le(ordinal) || !reader.read_u64_le(index)) [[unlikely]] { return bad_format(); }
+
+                        ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_t decoded{};
+                        if(!details::decode_table_elem(names, tag, ordinal, index, decoded)) [[unlikely]] { return bad_format(); }
+                        if(apply) { elem = decoded; }
+                    }
+                }
+
+                // element segments
+                ::std::size_t element_count{};
+                if(!reader.read_size(element_count)) [[unlikely]] { return bad_format(); }
+                if(element_count != rt.local_defined_element_vec_storage.size()) [[unlikely]] { return snapshot_status::module_mismatch; }
+                for(auto& e: rt.local_defined_element_vec_storage)
+                {
+                    ::std::uint_least8_t dropped{};
+                    if(!reader.read_u8(dropped)) [[unlikely]] { return bad_format(); }
+                    if(apply && dropped != 0u)
+                    {
+                        // Same state `elem.drop` leaves behind.
+                        e.element.dropped = true;
+                        e.element.funcidx_begin = nullptr;
+                        e.element.funcidx_end = nullptr;
+                    }
+                }
+
+                // data segments
+                ::std::size_t data_count{};
+                if(!reader.read_size(data_count)) [[unlikely]] { return bad_format(); }
+                if(data_count != rt.local_defined_data_vec_storage.size()) [[unlikely]] { return snapshot_status::module_mismatch; }
+                for(auto& d: rt.local_defined_data_vec_storage)
+                {
+                    ::std::uint_least8_t dropped{};
+                    if(!reader.read_u8(dropped)) [[unlikely]] { return bad_format(); }
+                    if(apply && dropped != 0u)
+                    {
+                        // Same state `data.drop` leaves behind.
+                        d.data.dropped = true;
+                        d.data.byte_begin = nullptr;
+                        d.data.byte_end = nullptr;
+                    }
+                }
+
+                // memories
+                ::std::size_t memory_count{};
+                if(!reader.read_size(memory_count)) [[unlikely]] { return bad_format(); }
+                if(memory_count != rt.local_defined_memory_vec_storage.size()) [[unlikely]] { return snapshot_status::module_mismatch; }
+                for(auto& mem: rt.local_defined_memory_vec_storage)
+                {
+                    ::std::size_t page_count{};
+                    ::std::size_t length{};
+                    ::std::size_t rel_offset{};
+                    if(!reader.read_size(page_count) || !reader.read_size(length) || !reader.read_size(rel_offset)) [[unlikely]] { return bad_format(); }
+
+                    auto const log2{static_cast<::std::size_t>(mem.memory.custom_page_size_log2)};
+                    if(page_count > (::std::numeric_limits<::std::size_t>::max() >> log2) || (page_count << log2) != length) [[unlikely]]
+                    {
+                        return bad_format();
+                    }
+                    if(rel_offset > file_size - data_offset || length > file_size - data_offset - rel_offset ||
+                       (rel_offset % details::snapshot_memory_alignment) != 0uz) [[unlikely]]
+                    {
+                        return bad_format();
+                    }
+
+                    // Memory cannot shrink, so a snapshot smaller than the fresh instance cannot come from this module set.
+                    auto const current_pages{mem.memory.get_page_size()};
+                    if(page_count < current_pages) [[unlikely]] { return snapshot_status::module_mismatch; }
+
+                    if(!apply) { continue; }
+
+                    if(page_count != current_pages && !mem.memory.try_grow_silently(page_count - current_pages)) [[unlikely]]
+                    {
+                        details::snapshot_error(u8"Unable to grow a memory of module \"",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                expected_name,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"\" to the snapshot size (pages=",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                                page_count,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8").");
+                        return snapshot_status::memory_error;
+                    }
+
+                    if(length == 0uz) { continue; }
+
+                    auto const image_offset{data_offset + rel_offset};
+                    bool mapped{};
+
+# if defined(UWVM_SUPPORT_MMAP)
+                    if constexpr(::uwvm2::object::memory::linear::mmap_memory_private_image_supported)
+                    {
+                        // Map the image copy-on-write straight from the snapshot file: untouched pages stay shared with the page cache.
+                        // The initializer skipped active data for restored memories, so the image replaces an untouched zero mapping.
+#  ifdef UWVM_CPP_EXCEPTIONS
+                        try
+#  endif
+                        {
+                            ::fast_io::native_file image_file{path, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+                            ::uwvm2::object::memory::linear::mmap_memory_image_t image{};
+                            if(image.adopt_file_region(image_file.native_handle(), image_offset, length))
+                            {
+                                static_cast<void>(image_file.release());
+                                mapped = mem.memory.try_map_private_image(0uz, image);
+                            }
+                        }
+#  ifdef UWVM_CPP_EXCEPTIONS
+                        catch(::fast_io::error)
+                        {
+                            mapped = false;
+                        }
+#  endif
+                    }
+# endif
+
+                    if(!mapped) { ::fast_io::freestanding::my_memcpy(mem.memory.memory_begin, file_begin + image_offset, length); }
+                }
+            }
+        }
+
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        {
+            details::snapshot_verbose_info(u8"Restored instance snapshot \"",
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                           path,
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                           u8"\" (modules=",
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                           names.size(),
+                                           ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                           u8"). ");
+        }
+
+        return snapshot_status::ok;
+    }
+#endif
+}  // namespace uwvm2::uwvm::runtime::snapshot
+
+#ifndef UWVM_MODULE
+// macro
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_pop_macro.h>  // wasip1
+# endif
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -24,6 +24,7 @@ module;
 // std
 #include <cstddef>
 #include <cstdint>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -36,6 +37,7 @@ export module uwvm2.uwvm.runtime.validator:validate;
 import fast_io;
 import uwvm2.utils.container;
 import uwvm2.utils.debug;
+import uwvm2.utils.thread;
 import uwvm2.parser.wasm.concepts;
 import uwvm2.parser.wasm.standard.wasm1.type;
 import uwvm2.parser.wasm.standard.wasm1.const_expr;
@@ -52,6 +54,7 @@ import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
 import uwvm2.uwvm.utils.memory;
 import uwvm2.uwvm.wasm;
+import uwvm2.uwvm.runtime.runtime_mode;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
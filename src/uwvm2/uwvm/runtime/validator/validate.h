@@ -25,6 +25,7 @@
 // std
 # include <cstddef>
 # include <cstdint>
+# include <atomic>
 # include <limits>
 # include <memory>
 # include <utility>
@@ -35,6 +36,7 @@
 # include <fast_io.h>
 # include <uwvm2/utils/container/impl.h>
 # include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/utils/thread/impl.h>
 # include <uwvm2/parser/wasm/concepts/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/const_expr/impl.h>
@@ -51,6 +53,7 @@
 # include <uwvm2/uwvm/utils/ansies/impl.h>
 # include <uwvm2/uwvm/utils/memory/impl.h>
 # include <uwvm2/uwvm/wasm/impl.h>
+# include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -59,90 +62,278 @@
 
 UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::validator
 {
-    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
-    inline constexpr bool validate_all_wasm_code_for_module(
-        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
-        ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para,
-        [[maybe_unused]] ::uwvm2::utils::container::u8cstring_view file_name,
-        [[maybe_unused]] ::uwvm2::utils::container::u8string_view module_name) noexcept
+    namespace details
     {
-        auto const& importsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
-            ::uwvm2::parser::wasm::standard::wasm1::features::import_section_storage_t<Fs...>>(module_storage.sections)};
-        auto const import_func_count{importsec.importdesc.index_unchecked(0u).size()};
+        /// @brief One contiguous slice of a module's code section, validated by one scheduled task.
+        /// @details Each group owns its own diagnostic slot, so workers never race on a shared error object. A group stops at
+        ///          its first failing body; since groups are contiguous, the first failed group (in module, then index order)
+        ///          always holds the lowest failing function index, independent of thread timing.
+        struct code_validation_task_group
+        {
+            ::std::size_t job_index{};
+            ::std::size_t begin_index{};
+            ::std::size_t end_index{};
+            ::std::size_t failed_local_idx{::std::numeric_limits<::std::size_t>::max()};
+            ::uwvm2::validation::error::code_validation_error_impl err{};
+        };
 
-        auto const& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
-            ::uwvm2::parser::wasm::standard::wasm1::features::code_section_storage_t<Fs...>>(module_storage.sections)};
+        /// @brief Per-module inputs shared (read-only) by every task group of that module.
+        template <typename ModuleStorage, typename FeatureParameter>
+        struct module_code_validation_job
+        {
+            ModuleStorage const* module_storage_ptr{};
+            FeatureParameter const* fs_para_ptr{};
+            ::uwvm2::utils::container::u8cstring_view file_name{};
+            ::uwvm2::utils::container::u8string_view module_name{};
+        };
 
-        for(::std::size_t local_idx{}; local_idx < codesec.codes.size(); ++local_idx)
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr void print_code_validation_error(
+            ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+            ::uwvm2::validation::error::code_validation_error_impl const& v_err,
+            ::uwvm2::utils::container::u8cstring_view file_name,
+            ::uwvm2::utils::container::u8string_view module_name) noexcept
         {
-            auto const& code{codesec.codes.index_unchecked(local_idx)};
-            auto const code_begin_ptr{reinterpret_cast<::std::byte const*>(code.body.expr_begin)};
-            auto const code_end_ptr{reinterpret_cast<::std::byte const*>(code.body.code_end)};
+            ::uwvm2::uwvm::utils::memory::print_memory const memory_printer{module_storage.module_span.module_begin,
+                                                                            v_err.err_curr,
+                                                                            module_storage.module_span.module_end};
 
-            ::uwvm2::validation::error::code_validation_error_impl v_err{};
-#ifdef UWVM_CPP_EXCEPTIONS
-            try
+            ::uwvm2::validation::error::error_output_t errout{};
+            errout.module_begin = module_storage.module_span.module_begin;
+            errout.err = v_err;
+            errout.flag.enable_ansi = static_cast<::std::uint_least8_t>(::uwvm2::uwvm::utils::ansies::put_color);
+#if defined(_WIN32) && (_WIN32_WINNT < 0x0A00 || defined(_WIN32_WINDOWS))
+            errout.flag.win32_use_text_attr = static_cast<::std::uint_least8_t>(!::uwvm2::uwvm::utils::ansies::log_win32_use_ansi_b);
 #endif
+
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                // 1
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Validation error in WebAssembly Code (module=\"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                module_name,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\", file=\"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                file_name,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\").\n",
+                                // 2
+                                errout,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\n"
+                                // 3
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Validator Memory Indication: ",
+                                memory_printer,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                u8"\n\n");
+        }
+
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr void append_code_validation_task_groups(
+            ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+            ::std::size_t job_index,
+            ::uwvm2::utils::container::vector<code_validation_task_group>& task_groups)
+        {
+            // Split with the same `--runtime-scheduling-policy` granularity used by full translation so one knob controls
+            // both the validation and the compilation fan-out.
+            auto const& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                ::uwvm2::parser::wasm::standard::wasm1::features::code_section_storage_t<Fs...>>(module_storage.sections)};
+            auto const code_count{codesec.codes.size()};
+            if(code_count == 0uz) { return; }
+
+            auto const split_policy{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_scheduling_policy};
+            auto const split_size_raw{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_scheduling_size};
+            auto const split_size{split_size_raw == 0uz ? 1uz : split_size_raw};
+
+            ::std::size_t group_begin_index{};
+            ::std::size_t current_group_weight{};
+
+            for(::std::size_t local_idx{}; local_idx != code_count; ++local_idx)
             {
-                ::uwvm2::validation::standard::wasm1p1::validate_code(::uwvm2::validation::standard::wasm1p1::wasm1p1_code_version{},
-                                                                      module_storage,
-                                                                      import_func_count + local_idx,
-                                                                      code_begin_ptr,
-                                                                      code_end_ptr,
-                                                                      v_err,
-                                                                      fs_para);
+                ::std::size_t task_unit{1uz};
+                if(split_policy == ::uwvm2::uwvm::runtime::runtime_mode::runtime_scheduling_policy_t::code_size)
+                {
+                    auto const& body{codesec.codes.index_unchecked(local_idx).body};
+                    task_unit = static_cast<::std::size_t>(reinterpret_cast<::std::byte const*>(body.code_end) -
+                                                           reinterpret_cast<::std::byte const*>(body.code_begin));
+                }
+
+                if(task_unit > (::std::numeric_limits<::std::size_t>::max() - current_group_weight)) [[unlikely]]
+                {
+                    current_group_weight = ::std::numeric_limits<::std::size_t>::max();
+                }
+                else
+                {
+                    current_group_weight += task_unit;
+                }
+
+                if(current_group_weight >= split_size)
+                {
+                    task_groups.push_back({.job_index = job_index, .begin_index = group_begin_index, .end_index = local_idx + 1uz});
+                    group_begin_index = local_idx + 1uz;
+                    current_group_weight = 0uz;
+                }
             }
+
+            if(group_begin_index != code_count) { task_groups.push_back({.job_index = job_index, .begin_index = group_begin_index, .end_index = code_count}); }
+        }
+
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr void validate_code_task_group(
+            ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+            ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para,
+            code_validation_task_group& task_group) noexcept
+        {
+            auto const& importsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                ::uwvm2::parser::wasm::standard::wasm1::features::import_section_storage_t<Fs...>>(module_storage.sections)};
+            auto const import_func_count{importsec.importdesc.index_unchecked(0u).size()};
+
+            auto const& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                ::uwvm2::parser::wasm::standard::wasm1::features::code_section_storage_t<Fs...>>(module_storage.sections)};
+
+            for(::std::size_t local_idx{task_group.begin_index}; local_idx != task_group.end_index; ++local_idx)
+            {
+                auto const& code{codesec.codes.index_unchecked(local_idx)};
+                auto const code_begin_ptr{reinterpret_cast<::std::byte const*>(code.body.expr_begin)};
+                auto const code_end_ptr{reinterpret_cast<::std::byte const*>(code.body.code_end)};
+
 #ifdef UWVM_CPP_EXCEPTIONS
-            catch(::fast_io::error)
+                try
+#endif
+                {
+                    ::uwvm2::validation::standard::wasm1p1::validate_code(::uwvm2::validation::standard::wasm1p1::wasm1p1_code_version{},
+                                                                          module_storage,
+                                                                          import_func_count + local_idx,
+                                                                          code_begin_ptr,
+                                                                          code_end_ptr,
+                                                                          task_group.err,
+                                                                          fs_para);
+                }
+#ifdef UWVM_CPP_EXCEPTIONS
+                catch(::fast_io::error)
+                {
+                    task_group.failed_local_idx = local_idx;
+                    return;
+                }
+#endif
+            }
+        }
+
+        template <typename ModuleStorage, typename FeatureParameter>
+        inline ::uwvm2::utils::thread::scheduled_task
+            make_code_validation_task(::uwvm2::utils::container::vector<module_code_validation_job<ModuleStorage, FeatureParameter>> const& jobs,
+                                      code_validation_task_group& task_group,
+                                      ::std::size_t task_group_index,
+                                      ::std::atomic_size_t& first_failed_task_group_index) noexcept
+        {
+            // A group ordered after an already failed group can never produce the reported diagnostic.
+            if(first_failed_task_group_index.load(::std::memory_order_acquire) < task_group_index) { co_return; }
+
+            auto const& job{jobs.index_unchecked(task_group.job_index)};
+            validate_code_task_group(*job.module_storage_ptr, *job.fs_para_ptr, task_group);
+
+            if(task_group.failed_local_idx != ::std::numeric_limits<::std::size_t>::max())
             {
-                ::uwvm2::uwvm::utils::memory::print_memory const memory_printer{module_storage.module_span.module_begin,
-                                                                                v_err.err_curr,
-                                                                                module_storage.module_span.module_end};
-
-                ::uwvm2::validation::error::error_output_t errout{};
-                errout.module_begin = module_storage.module_span.module_begin;
-                errout.err = v_err;
-                errout.flag.enable_ansi = static_cast<::std::uint_least8_t>(::uwvm2::uwvm::utils::ansies::put_color);
-# if defined(_WIN32) && (_WIN32_WINNT < 0x0A00 || defined(_WIN32_WINDOWS))
-                errout.flag.win32_use_text_attr = static_cast<::std::uint_least8_t>(!::uwvm2::uwvm::utils::ansies::log_win32_use_ansi_b);
-# endif
-
-                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                    // 1
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                    u8"uwvm: ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
-                                    u8"[error] ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"Validation error in WebAssembly Code (module=\"",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                    module_name,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"\", file=\"",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                    file_name,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"\").\n",
-                                    // 2
-                                    errout,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"\n"
-                                    // 3
-                                    u8"uwvm: ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
-                                    u8"[info]  ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"Validator Memory Indication: ",
-                                    memory_printer,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
-                                    u8"\n\n");
-
-                return false;
+                ::uwvm2::utils::thread::atomic_store_min_index(first_failed_task_group_index, task_group_index);
             }
-#endif
+
+            co_return;
         }
 
-        return true;
+        /// @brief Validate every task group and return the index of the first failed group in task-group order.
+        /// @return `::std::numeric_limits<::std::size_t>::max()` when every body is valid.
+        template <typename ModuleStorage, typename FeatureParameter>
+        inline constexpr ::std::size_t
+            run_code_validation_task_groups(::uwvm2::utils::container::vector<module_code_validation_job<ModuleStorage, FeatureParameter>> const& jobs,
+                                            ::uwvm2::utils::container::vector<code_validation_task_group>& task_groups) noexcept
+        {
+            if(task_groups.empty()) { return ::std::numeric_limits<::std::size_t>::max(); }
+
+            ::std::atomic_size_t first_failed_task_group_index{::std::numeric_limits<::std::size_t>::max()};
+
+            auto const extra_worker_count{::uwvm2::utils::thread::clamp_extra_worker_count(
+                task_groups.size(),
+                ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compile_threads_resolved)};
+
+            if(extra_worker_count == 0uz)
+            {
+                // Serial path: avoid coroutine frames entirely and stop at the first failure like the historical loop.
+                for(::std::size_t task_group_index{}; task_group_index != task_groups.size(); ++task_group_index)
+                {
+                    auto& task_group{task_groups.index_unchecked(task_group_index)};
+                    auto const& job{jobs.index_unchecked(task_group.job_index)};
+                    validate_code_task_group(*job.module_storage_ptr, *job.fs_para_ptr, task_group);
+                    if(task_group.failed_local_idx != ::std::numeric_limits<::std::size_t>::max())
+                    {
+                        first_failed_task_group_index.store(task_group_index, ::std::memory_order_relaxed);
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                ::uwvm2::utils::thread::scheduled_task_batch task_batch{task_groups.size()};
+                for(::std::size_t task_group_index{}; task_group_index != task_groups.size(); ++task_group_index)
+                {
+                    auto task{make_code_validation_task(jobs, task_groups.index_unchecked(task_group_index), task_group_index, first_failed_task_group_index)};
+                    ::std::construct_at(task_batch.handles.buffer + task_batch.handle_count, task.release());
+                    ++task_batch.handle_count;
+                }
+
+                ::uwvm2::utils::thread::native_thread_pool thread_pool{};
+                thread_pool.run(task_batch, extra_worker_count);
+            }
+
+            return first_failed_task_group_index.load(::std::memory_order_acquire);
+        }
+
+        template <typename ModuleStorage, typename FeatureParameter>
+        inline constexpr bool
+            run_code_validation_jobs(::uwvm2::utils::container::vector<module_code_validation_job<ModuleStorage, FeatureParameter>> const& jobs) noexcept
+        {
+            // All modules share one batch: independent modules are validated concurrently, and the task-group order
+            // (module order first, then function index) defines which failure is reported.
+            ::uwvm2::utils::container::vector<code_validation_task_group> task_groups{};
+            for(::std::size_t job_index{}; job_index != jobs.size(); ++job_index)
+            {
+                append_code_validation_task_groups(*jobs.index_unchecked(job_index).module_storage_ptr, job_index, task_groups);
+            }
+
+            auto const failed_task_group_index{run_code_validation_task_groups(jobs, task_groups)};
+            if(failed_task_group_index == ::std::numeric_limits<::std::size_t>::max()) { return true; }
+
+            auto const& failed_task_group{task_groups.index_unchecked(failed_task_group_index)};
+            auto const& failed_job{jobs.index_unchecked(failed_task_group.job_index)};
+            print_code_validation_error(*failed_job.module_storage_ptr, failed_task_group.err, failed_job.file_name, failed_job.module_name);
+            return false;
+        }
+    }  // namespace details
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr bool validate_all_wasm_code_for_module(
+        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para,
+        ::uwvm2::utils::container::u8cstring_view file_name,
+        ::uwvm2::utils::container::u8string_view module_name) noexcept
+    {
+        using module_storage_t = ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>;
+        using feature_parameter_t = ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...>;
+
+        ::uwvm2::utils::container::vector<details::module_code_validation_job<module_storage_t, feature_parameter_t>> jobs{};
+        jobs.push_back({.module_storage_ptr = ::std::addressof(module_storage),
+                        .fs_para_ptr = ::std::addressof(fs_para),
+                        .file_name = file_name,
+                        .module_name = module_name});
+        return details::run_code_validation_jobs(jobs);
     }
 
     inline constexpr bool validate_all_wasm_code() noexcept
@@ -179,6 +370,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::validator
 #endif
         }
 
+        // Collect every wasm module first so all code bodies (across modules) are validated by one parallel batch.
+        using validation_job_t = details::module_code_validation_job<::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_module_storage_t,
+                                                                     ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t>;
+        ::uwvm2::utils::container::vector<validation_job_t> binfmt_ver1_jobs{};
+
         // validate all wasm code (full verification before execution)
         for(auto const& [module_name, mod]: ::uwvm2::uwvm::wasm::storage::all_module)
         {
@@ -196,13 +392,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::validator
                     {
                         case 1u:
                         {
-                            if(!validate_all_wasm_code_for_module(wf->wasm_module_storage.wasm_binfmt_ver1_storage,
-                                                                  wf->wasm_parameter.binfmt1_para,
-                                                                  wf->file_name,
-                                                                  module_name))
-                            {
-                                return false;
-                            }
+                            binfmt_ver1_jobs.push_back({.module_storage_ptr = ::std::addressof(wf->wasm_module_storage.wasm_binfmt_ver1_storage),
+                                                        .fs_para_ptr = ::std::addressof(wf->wasm_parameter.binfmt1_para),
+                                                        .file_name = wf->file_name,
+                                                        .module_name = module_name});
                             break;
                         }
                         [[unlikely]] default:
@@ -240,6 +433,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::validator
             }
         }
 
+        if(!details::run_code_validation_jobs(binfmt_ver1_jobs)) { return false; }
+
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
         {
             ::fast_io::unix_timestamp end_time{};
@@ -32,6 +32,8 @@ export import :preloaded_dl;
 export import :weak_symbol;
 export import :preload_module_attribute;
 export import :memory_limit;
+export import :memory_huge_page;
+export import :memory_pool;
 export import :import_reset;
 export import :start_func;
 export import :all_module;
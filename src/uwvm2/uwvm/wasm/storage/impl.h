@@ -32,6 +32,8 @@
 # include "weak_symbol.h"
 # include "preload_module_attribute.h"
 # include "memory_limit.h"
+# include "memory_huge_page.h"
+# include "memory_pool.h"
 # include "import_reset.h"
 # include "start_func.h"
 # include "all_module.h"
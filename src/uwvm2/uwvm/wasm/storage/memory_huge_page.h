@@ -0,0 +1,97 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::storage
+{
+    enum class module_memory_huge_page_t : unsigned
+    {
+        none,
+        transparent
+    };
+
+    struct configured_module_memory_huge_page_t
+    {
+        ::uwvm2::utils::container::unordered_flat_map<::std::size_t, module_memory_huge_page_t> local_defined_memory_policies{};
+        module_memory_huge_page_t all_policy{};
+        bool apply_to_all_memories{};
+    };
+
+    using configured_module_memory_huge_page_map_t = ::uwvm2::utils::container::unordered_flat_map<::uwvm2::utils::container::u8string,
+                                                                                                   configured_module_memory_huge_page_t,
+                                                                                                   ::uwvm2::utils::container::pred::u8string_view_hash,
+                                                                                                   ::uwvm2::utils::container::pred::u8string_view_equal>;
+
+    inline configured_module_memory_huge_page_map_t configured_module_memory_huge_page{};  // [global]
+
+    [[nodiscard]] inline constexpr configured_module_memory_huge_page_t const* find_configured_module_memory_huge_page_const(
+        ::uwvm2::utils::container::u8string_view module_name) noexcept
+    {
+        if(auto const it{configured_module_memory_huge_page.find(module_name)}; it != configured_module_memory_huge_page.cend()) [[likely]]
+        {
+            return ::std::addressof(it->second);
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] inline constexpr configured_module_memory_huge_page_t& upsert_configured_module_memory_huge_page(
+        ::uwvm2::utils::container::u8string_view module_name) noexcept
+    {
+        auto const [it, inserted]{configured_module_memory_huge_page.try_emplace(::uwvm2::utils::container::u8string{module_name})};
+        static_cast<void>(inserted);
+        return it->second;
+    }
+
+    [[nodiscard]] inline constexpr module_memory_huge_page_t const* find_configured_local_defined_memory_huge_page(
+        configured_module_memory_huge_page_t const& config,
+        ::std::size_t local_memory_index) noexcept
+    {
+        if(auto const it{config.local_defined_memory_policies.find(local_memory_index)}; it != config.local_defined_memory_policies.cend()) [[likely]]
+        {
+            return ::std::addressof(it->second);
+        }
+
+        if(config.apply_to_all_memories) [[likely]] { return ::std::addressof(config.all_policy); }
+
+        return nullptr;
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
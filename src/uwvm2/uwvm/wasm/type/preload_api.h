@@ -92,6 +92,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::type
         using uwvm_preload_memory_descriptor_at_t = bool (*)(::std::size_t, uwvm_preload_memory_descriptor_t*);
         using uwvm_preload_memory_read_t = bool (*)(::std::size_t, ::std::uint_least64_t, void*, ::std::size_t);
         using uwvm_preload_memory_write_t = bool (*)(::std::size_t, ::std::uint_least64_t, void const*, ::std::size_t);
+        using uwvm_preload_memory_discard_t = bool (*)(::std::size_t, ::std::uint_least64_t, ::std::size_t);
+        using uwvm_preload_epoch_increment_t = void (*)();
+        using uwvm_preload_epoch_set_deadline_t = void (*)(::std::uint_least64_t);
 
         struct uwvm_preload_host_api_v1
         {
@@ -101,6 +104,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::type
             uwvm_preload_memory_descriptor_at_t memory_descriptor_at;
             uwvm_preload_memory_read_t memory_read;
             uwvm_preload_memory_write_t memory_write;
+            // Appended member: check `struct_size` covers it before calling. Zeroes the range and returns whole pages to the OS (`memory.discard`).
+            uwvm_preload_memory_discard_t memory_discard;
+            // Appended members: check `struct_size` covers them before calling. Drive `--wasm-timeout` epoch interruption from the host.
+            uwvm_preload_epoch_increment_t epoch_increment;
+            uwvm_preload_epoch_set_deadline_t epoch_set_deadline;
         };
 
         using uwvm_set_preload_host_api_v1_t = void (*)(uwvm_preload_host_api_v1 const*);
@@ -233,6 +241,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::type
             - Key logic off `delivery_state`, not `backend_kind`; future backends may reuse the same delivery contract.
             - Keep copy-mode helpers even if you expect mmap on your main platform.
             - Preload modules run in-process; this API is for stability and compatibility, not process isolation.
+            - `memory_discard()` is the host side of the memory-discard proposal: the range reads back as zero afterwards and
+              the runtime releases the whole pages inside it. A plugin can re-export it as a Wasm import so guest allocators
+              can hand freed spans back, e.g. `if(api->struct_size > offsetof(uwvm_preload_host_api_v1, memory_discard)) ...`.
+            - `epoch_increment()` / `epoch_set_deadline(ticks)` only have an effect when the run was started with `--wasm-timeout`.
+              With `--wasm-timeout 0` no ticker runs, so the plugin owns the clock: arm a deadline, then advance the epoch from
+              its own timer. Guest code traps at its next function entry or loop header once the epoch reaches the deadline.
         */
 
         uwvm_preload_host_api_v1 const* uwvm_get_preload_host_api_v1() noexcept;
@@ -240,6 +254,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::type
         bool uwvm_preload_memory_descriptor_at(::std::size_t, uwvm_preload_memory_descriptor_t*) noexcept;
         bool uwvm_preload_memory_read(::std::size_t, ::std::uint_least64_t, void*, ::std::size_t) noexcept;
         bool uwvm_preload_memory_write(::std::size_t, ::std::uint_least64_t, void const*, ::std::size_t) noexcept;
+        bool uwvm_preload_memory_discard(::std::size_t, ::std::uint_least64_t, ::std::size_t) noexcept;
+        void uwvm_preload_epoch_increment() noexcept;
+        void uwvm_preload_epoch_set_deadline(::std::uint_least64_t) noexcept;
     }
 }
 
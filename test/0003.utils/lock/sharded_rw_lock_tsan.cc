@@ -0,0 +1,107 @@
+﻿/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdlib>
+
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <uwvm2/utils/mutex/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+namespace
+{
+    // Two plain (non-atomic) words that writers always change together: a reader that ever sees them differ, or a race reported by TSan,
+    // means a reader overlapped a writer.
+    struct protected_pair_t
+    {
+        std::uint64_t a{};
+        std::uint64_t b{};
+    };
+
+    void run_sharded_rw_lock_scenario(std::size_t thread_count, unsigned write_period)
+    {
+        ::uwvm2::utils::mutex::sharded_rwlock_t lock{};
+        protected_pair_t pair{};
+        std::atomic_bool torn{};
+
+        constexpr std::size_t iters_per_thread{2000};
+
+        auto worker = [&](unsigned tid)
+        {
+            for(std::size_t i{}; i < iters_per_thread; ++i)
+            {
+                if(((i + tid) % write_period) == 0u)
+                {
+                    ::uwvm2::utils::mutex::rw_sharded_unique_guard_t g{lock};
+                    ++pair.a;
+                    ++pair.b;
+                }
+                else
+                {
+                    ::uwvm2::utils::mutex::rw_sharded_shared_guard_t g{lock};
+                    if(pair.a != pair.b) { torn.store(true, std::memory_order_relaxed); }
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        for(std::size_t i{}; i < thread_count; ++i) { threads.emplace_back(worker, static_cast<unsigned>(i)); }
+        for(auto& t: threads) { t.join(); }
+
+        if(torn.load(std::memory_order_relaxed)) { std::abort(); }
+
+        // Every writer iteration must have been applied exactly once.
+        std::uint64_t expected_writes{};
+        for(std::size_t tid{}; tid < thread_count; ++tid)
+        {
+            for(std::size_t i{}; i < iters_per_thread; ++i)
+            {
+                if(((i + tid) % write_period) == 0u) { ++expected_writes; }
+            }
+        }
+        if(pair.a != expected_writes || pair.b != expected_writes) { std::abort(); }
+    }
+
+}  // namespace
+
+int main()
+{
+    // 50/50 mix, as in rw_spin_lock_tsan.cc.
+    run_sharded_rw_lock_scenario(4uz, 2u);
+
+    // Read-mostly, the intended workload, with more threads than shards so that shards are shared.
+    run_sharded_rw_lock_scenario(::uwvm2::utils::mutex::sharded_rwlock_shard_count + 4uz, 64u);
+
+    return 0;
+}
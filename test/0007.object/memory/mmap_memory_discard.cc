@@ -0,0 +1,70 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <uwvm2/object/memory/linear/mmap.h>
+# include <uwvm2/object/memory/linear/access.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+int main()
+{
+#if !defined(UWVM_SUPPORT_MMAP)
+    // mmap backend is not available on this build target
+#else
+    namespace linear = ::uwvm2::object::memory::linear;
+
+    constexpr ::std::size_t wasm_page{65536uz};
+    linear::mmap_memory_t mem{};
+    mem.init_by_page_count(4u);
+    auto const length{4uz * wasm_page};
+    for(::std::size_t i{}; i != length; ++i) { mem.memory_begin[i] = ::std::byte{0xff}; }
+
+    // Unaligned on both ends: the partial head/tail pages are cleared by hand, the whole pages in between are released.
+    constexpr ::std::size_t first{100uz};
+    constexpr ::std::size_t size{3uz * wasm_page - 200uz};
+    if(!linear::discard_memory_range(mem, first, size)) { ::fast_io::fast_terminate(); }
+    for(::std::size_t i{}; i != length; ++i)
+    {
+        auto const inside{i >= first && i < first + size};
+        if(mem.memory_begin[i] != (inside ? ::std::byte{} : ::std::byte{0xff})) { ::fast_io::fast_terminate(); }
+    }
+
+    // Discarded pages are still committed and writable.
+    mem.memory_begin[wasm_page] = ::std::byte{0x42};
+    if(mem.memory_begin[wasm_page] != ::std::byte{0x42}) { ::fast_io::fast_terminate(); }
+
+    // Out-of-range requests are rejected without touching memory; an empty range at the end is valid.
+    if(linear::discard_memory_range(mem, length - 1uz, 2uz)) { ::fast_io::fast_terminate(); }
+    if(linear::discard_memory_range(mem, length + 1uz, 0uz)) { ::fast_io::fast_terminate(); }
+    if(!linear::discard_memory_range(mem, length, 0uz)) { ::fast_io::fast_terminate(); }
+    if(mem.memory_begin[length - 1uz] != ::std::byte{0xff}) { ::fast_io::fast_terminate(); }
+#endif
+}
@@ -0,0 +1,75 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <uwvm2/object/memory/linear/mmap.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+int main()
+{
+#if !defined(UWVM_SUPPORT_MMAP)
+    // mmap backend is not available on this build target
+#else
+    namespace linear = ::uwvm2::object::memory::linear;
+
+    {
+        linear::mmap_memory_t mem{};
+        mem.huge_page_policy = linear::mmap_memory_huge_page_policy_t::transparent;
+        mem.init_by_page_count(40u);
+        if(mem.memory_begin == nullptr) { ::fast_io::fast_terminate(); }
+
+        if constexpr(linear::mmap_memory_huge_page_supported)
+        {
+            // The usable window starts on a huge-page boundary so whole 2 MiB extents can be backed by one PMD.
+            if(mem.huge_page_policy != linear::mmap_memory_huge_page_policy_t::transparent) { ::fast_io::fast_terminate(); }
+            if(reinterpret_cast<::std::uintptr_t>(mem.memory_begin) % linear::mmap_memory_huge_page_size != 0uz) { ::fast_io::fast_terminate(); }
+        }
+        else
+        {
+            if(mem.huge_page_policy != linear::mmap_memory_huge_page_policy_t::none) { ::fast_io::fast_terminate(); }
+        }
+
+        mem.memory_begin[0] = ::std::byte{0x5a};
+        mem.grow_silently(8uz);
+        mem.memory_begin[48uz * 65536uz - 1uz] = ::std::byte{0xa5};
+        if(mem.memory_begin[0] != ::std::byte{0x5a}) { ::fast_io::fast_terminate(); }
+    }
+
+    {
+        // Custom page sizes cannot use huge pages and fall back to the default policy.
+        linear::mmap_memory_t mem{1uz, linear::mmap_memory_status_t::wasm32};
+        mem.huge_page_policy = linear::mmap_memory_huge_page_policy_t::transparent;
+        mem.init_by_page_count(4096u);
+        if(mem.huge_page_policy != linear::mmap_memory_huge_page_policy_t::none) { ::fast_io::fast_terminate(); }
+        mem.memory_begin[4095uz] = ::std::byte{0x11};
+    }
+#endif
+}
@@ -0,0 +1,105 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <uwvm2/object/memory/linear/mmap.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+int main()
+{
+#if !defined(UWVM_SUPPORT_MMAP)
+    // mmap backend is not available on this build target
+#else
+    namespace linear = ::uwvm2::object::memory::linear;
+
+    if constexpr(!linear::mmap_memory_pool_supported)
+    {
+        // Recycling is Linux-only; the pool must refuse to enable elsewhere.
+        if(linear::configure_mmap_memory_pool(4uz, ::std::numeric_limits<::std::size_t>::max())) { ::fast_io::fast_terminate(); }
+        return 0;
+    }
+    else
+    {
+        if(!linear::configure_mmap_memory_pool(2uz, ::std::numeric_limits<::std::size_t>::max())) { ::fast_io::fast_terminate(); }
+
+        ::std::byte* first_reservation{};
+        {
+            linear::mmap_memory_t mem{};
+            mem.init_by_page_count(2u);
+            if(mem.memory_begin == nullptr) { ::fast_io::fast_terminate(); }
+            first_reservation = mem.reserved_begin;
+
+            // Dirty both committed pages, then grow and dirty the new page too.
+            mem.memory_begin[0] = ::std::byte{0x5a};
+            mem.memory_begin[65536uz + 17uz] = ::std::byte{0xa5};
+            mem.grow_silently(1uz);
+            mem.memory_begin[2uz * 65536uz - 1uz + 65536uz] = ::std::byte{0x11};
+        }
+
+        auto stats{linear::get_mmap_memory_pool_stats()};
+        if(stats.fresh != 1uz || stats.reused != 0uz || stats.recycled != 1uz || stats.pooled_slots != 1uz) { ::fast_io::fast_terminate(); }
+
+        {
+            // Same reserved size: the slot is reused, and every page the previous instance touched reads back as zero.
+            linear::mmap_memory_t mem{};
+            mem.init_by_page_count(3u);
+            if(mem.reserved_begin != first_reservation) { ::fast_io::fast_terminate(); }
+            for(::std::size_t i{}; i != 3uz * 65536uz; ++i)
+            {
+                if(mem.memory_begin[i] != ::std::byte{}) { ::fast_io::fast_terminate(); }
+            }
+            mem.memory_begin[0] = ::std::byte{0x01};
+        }
+
+        stats = linear::get_mmap_memory_pool_stats();
+        if(stats.reused != 1uz || stats.recycled != 2uz || stats.pooled_slots != 1uz) { ::fast_io::fast_terminate(); }
+
+        {
+            // Three live memories with two slots: one reuse, two fresh reservations; on release only two fit.
+            linear::mmap_memory_t a{};
+            linear::mmap_memory_t b{};
+            linear::mmap_memory_t c{};
+            a.init_by_page_count(1u);
+            b.init_by_page_count(1u);
+            c.init_by_page_count(1u);
+        }
+
+        stats = linear::get_mmap_memory_pool_stats();
+        if(stats.reused != 2uz || stats.fresh != 3uz || stats.pooled_slots != 2uz || stats.unmapped != 1uz) { ::fast_io::fast_terminate(); }
+
+        // Disabling the pool unmaps every idle slot.
+        if(!linear::configure_mmap_memory_pool(0uz, 0uz)) { ::fast_io::fast_terminate(); }
+        stats = linear::get_mmap_memory_pool_stats();
+        if(stats.pooled_slots != 0uz || stats.pooled_bytes != 0uz) { ::fast_io::fast_terminate(); }
+    }
+#endif
+}
@@ -0,0 +1,90 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <uwvm2/object/memory/linear/mmap.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+int main()
+{
+#if !defined(UWVM_SUPPORT_MMAP)
+    // mmap backend is not available on this build target
+#else
+    namespace linear = ::uwvm2::object::memory::linear;
+
+    constexpr ::std::size_t wasm_page{65536uz};
+    linear::mmap_memory_t mem{};
+    mem.init_by_page_count(2u);
+    auto const length{2uz * wasm_page};
+
+    linear::mmap_memory_image_t image{};
+    if constexpr(!linear::mmap_memory_private_image_supported)
+    {
+        // Without memfd images there is nothing to reset to; the memory must be left alone.
+        if(image.create(length) || mem.try_reset_to_private_image(image)) { ::fast_io::fast_terminate(); }
+        return 0;
+    }
+    else
+    {
+        // Reset point: a recognizable pattern in both pages.
+        if(!image.create(length)) { ::fast_io::fast_terminate(); }
+        for(::std::size_t i{}; i != length; ++i) { image.data()[i] = static_cast<::std::byte>(i % 251uz); }
+        image.finish_writing();
+        if(!mem.try_map_private_image(0uz, image)) { ::fast_io::fast_terminate(); }
+
+        for(unsigned run{}; run != 3u; ++run)
+        {
+            // A "run" dirties one page, grows by a page, and writes into the grown page.
+            mem.memory_begin[wasm_page + 7uz] = ::std::byte{0xee};
+            mem.grow_silently(1uz);
+            mem.memory_begin[length + 3uz] = ::std::byte{0xdd};
+
+            if(!mem.try_reset_to_private_image(image)) { ::fast_io::fast_terminate(); }
+
+            if(mem.get_page_size() != 2uz) { ::fast_io::fast_terminate(); }
+            for(::std::size_t i{}; i != length; ++i)
+            {
+                if(mem.memory_begin[i] != static_cast<::std::byte>(i % 251uz)) { ::fast_io::fast_terminate(); }
+            }
+        }
+
+        // Pages grown after a reset read back as zero again.
+        mem.grow_silently(1uz);
+        if(mem.memory_begin[length + 3uz] != ::std::byte{}) { ::fast_io::fast_terminate(); }
+
+        // A memory already smaller than the image is rejected without changes.
+        linear::mmap_memory_t small{};
+        small.init_by_page_count(1u);
+        small.memory_begin[0] = ::std::byte{0x11};
+        if(small.try_reset_to_private_image(image) || small.memory_begin[0] != ::std::byte{0x11}) { ::fast_io::fast_terminate(); }
+    }
+#endif
+}
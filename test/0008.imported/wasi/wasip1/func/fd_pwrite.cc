@@ -329,6 +329,64 @@ int main()
     }
 #endif
 
+#if defined(__linux__)
+    // Linux-only: the same pwrite/pread round trip through the environment's io_uring (falls back to plain syscalls if the kernel has none)
+    {
+        env.io_uring.mode = ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_mode_t::on;
+
+        constexpr char const ring[] = "Ring";  // 4
+        constexpr wasi_void_ptr_t buf{7000u};
+        ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32(memory,
+                                                                            buf,
+                                                                            reinterpret_cast<::std::byte const*>(ring),
+                                                                            reinterpret_cast<::std::byte const*>(ring) + 4);
+
+        constexpr wasi_void_ptr_t iovs_ptr{7200u};
+        constexpr wasi_void_ptr_t nwritten_ptr{7300u};
+        ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory, iovs_ptr, buf);
+        ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory,
+                                                                                        static_cast<wasi_void_ptr_t>(iovs_ptr + 4u),
+                                                                                        static_cast<wasi_size_t>(4u));
+
+        // fd 4 still holds "HelloWorld" from case 1
+        auto const ret = ::uwvm2::imported::wasi::wasip1::func::fd_pwrite(env,
+                                                                          static_cast<wasi_posix_fd_t>(4),
+                                                                          iovs_ptr,
+                                                                          static_cast<wasi_size_t>(1u),
+                                                                          static_cast<filesize_t>(10u),
+                                                                          nwritten_ptr);
+        auto const nwritten = ::uwvm2::imported::wasi::wasip1::memory::get_basic_wasm_type_from_memory_wasm32<wasi_size_t>(memory, nwritten_ptr);
+        if(ret != errno_t::esuccess || nwritten != static_cast<wasi_size_t>(4u))
+        {
+            ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_pwrite (io_uring): expected esuccess with nwritten 4");
+            ::fast_io::fast_terminate();
+        }
+
+        constexpr wasi_void_ptr_t out{7500u};
+        constexpr wasi_void_ptr_t read_iovs_ptr{7600u};
+        constexpr wasi_void_ptr_t nread_ptr{7700u};
+        ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory, read_iovs_ptr, out);
+        ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory,
+                                                                                        static_cast<wasi_void_ptr_t>(read_iovs_ptr + 4u),
+                                                                                        static_cast<wasi_size_t>(14u));
+
+        auto const rret = ::uwvm2::imported::wasi::wasip1::func::fd_pread(env,
+                                                                          static_cast<wasi_posix_fd_t>(4),
+                                                                          read_iovs_ptr,
+                                                                          static_cast<wasi_size_t>(1u),
+                                                                          static_cast<filesize_t>(0u),
+                                                                          nread_ptr);
+        auto const nread = ::uwvm2::imported::wasi::wasip1::memory::get_basic_wasm_type_from_memory_wasm32<wasi_size_t>(memory, nread_ptr);
+        if(rret != errno_t::esuccess || nread != static_cast<wasi_size_t>(14u) || std::memcmp(memory.memory_begin + out, "HelloWorldRing", 14uz) != 0)
+        {
+            ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_pread (io_uring): expected \"HelloWorldRing\"");
+            ::fast_io::fast_terminate();
+        }
+
+        env.io_uring.mode = ::uwvm2::imported::wasi::wasip1::environment::wasip1_io_uring_mode_t::off;
+    }
+#endif
+
     return 0;
 }
 
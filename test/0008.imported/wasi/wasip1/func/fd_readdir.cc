@@ -314,6 +314,167 @@ int main()
         }
     }
 
+    // Case 4: page through a large directory with a small buffer, following d_next cookies; every name must appear exactly once. Then remove a
+    // file, report the change the way a path_* call does, and page again: the removed name must be gone.
+    {
+        constexpr ::std::size_t file_count{3000uz};
+        constexpr char8_t many_dir_name[]{u8"fd_readdir_many"};
+
+        auto const make_name{[](char8_t (&name)[6], ::std::size_t i) constexpr noexcept
+                             {
+                                 name[0] = u8'f';
+                                 for(::std::size_t d{}; d != 4uz; ++d)
+                                 {
+                                     name[4uz - d] = static_cast<char8_t>(u8'0' + i % 10uz);
+                                     i /= 10uz;
+                                 }
+                                 name[5] = u8'\0';
+                             }};
+
+        try
+        {
+            ::fast_io::native_mkdirat(::fast_io::at_fdcwd(), many_dir_name);
+        }
+        catch(...)
+        {
+        }
+
+        ::fast_io::dir_file many_dir{many_dir_name};
+        for(::std::size_t i{}; i != file_count; ++i)
+        {
+            char8_t name[6];
+            make_name(name, i);
+            ::fast_io::native_file{::fast_io::at(many_dir), ::fast_io::mnp::os_c_str(name), ::fast_io::open_mode::out};
+        }
+
+        auto& fde = *env.fd_storage.opens.index_unchecked(7uz).fd_p;
+        fde.rights_base = static_cast<rights_t>(-1);
+        fde.rights_inherit = static_cast<rights_t>(-1);
+        fde.wasi_fd.ptr->wasi_fd_storage.reset_type(::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::dir);
+        {
+            ::uwvm2::imported::wasi::wasip1::fd_manager::dir_stack_entry_ref_t entry{};
+            entry.ptr->dir_stack.storage.file = ::fast_io::dir_file{many_dir_name};
+            fde.wasi_fd.ptr->wasi_fd_storage.storage.dir_stack.dir_stack.push_back(::std::move(entry));
+        }
+
+        constexpr wasi_void_ptr_t buf_ptr{16384u};
+        constexpr wasi_void_ptr_t used_ptr{15360u};
+        constexpr wasi_size_t buf_len{200u};
+        constexpr ::std::size_t header_size{::uwvm2::imported::wasi::wasip1::func::size_of_wasi_dirent_t};
+
+        auto const list_all{[&](::std::vector<unsigned>& seen)
+                            {
+                                ::std::uint_least64_t cookie{};
+                                for(;;)
+                                {
+                                    auto const ret = ::uwvm2::imported::wasi::wasip1::func::fd_readdir(
+                                        env,
+                                        static_cast<wasi_posix_fd_t>(7),
+                                        buf_ptr,
+                                        buf_len,
+                                        static_cast<::uwvm2::imported::wasi::wasip1::abi::dircookie_t>(cookie),
+                                        used_ptr);
+                                    if(ret != errno_t::esuccess)
+                                    {
+                                        ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_readdir: case4 expected esuccess: ", static_cast<unsigned>(ret));
+                                        ::fast_io::fast_terminate();
+                                    }
+
+                                    auto const used = static_cast<::std::size_t>(
+                                        ::uwvm2::imported::wasi::wasip1::memory::get_basic_wasm_type_from_memory_wasm32<wasi_size_t>(memory, used_ptr));
+
+                                    ::std::size_t off{};
+                                    while(off + header_size <= used)
+                                    {
+                                        auto const ent_ptr{static_cast<wasi_void_ptr_t>(buf_ptr + off)};
+                                        auto const d_next = ::uwvm2::imported::wasi::wasip1::memory::get_basic_wasm_type_from_memory_wasm32<
+                                            ::std::uint_least64_t>(memory, ent_ptr);
+                                        auto const d_namlen = static_cast<::std::size_t>(
+                                            ::uwvm2::imported::wasi::wasip1::memory::get_basic_wasm_type_from_memory_wasm32<::std::uint_least32_t>(
+                                                memory,
+                                                static_cast<wasi_void_ptr_t>(ent_ptr + 16u)));
+
+                                        // The last entry may be cut short; it is listed again from the previous cookie.
+                                        if(off + header_size + d_namlen > used) { break; }
+
+                                        char8_t name[16]{};
+                                        if(d_namlen < sizeof(name))
+                                        {
+                                            ::uwvm2::imported::wasi::wasip1::memory::read_all_from_memory_wasm32(
+                                                memory,
+                                                static_cast<wasi_void_ptr_t>(ent_ptr + header_size),
+                                                reinterpret_cast<::std::byte*>(name),
+                                                reinterpret_cast<::std::byte*>(name) + d_namlen);
+                                        }
+
+                                        if(d_namlen == 5uz && name[0] == u8'f')
+                                        {
+                                            ::std::size_t idx{};
+                                            for(::std::size_t d{1uz}; d != 5uz; ++d) { idx = idx * 10uz + static_cast<::std::size_t>(name[d] - u8'0'); }
+                                            if(idx < seen.size()) { ++seen[idx]; }
+                                        }
+
+                                        cookie = d_next;
+                                        off += header_size + d_namlen;
+                                    }
+
+                                    if(used < static_cast<::std::size_t>(buf_len)) { break; }
+                                }
+                            }};
+
+        {
+            ::std::vector<unsigned> seen(file_count);
+            list_all(seen);
+            for(::std::size_t i{}; i != file_count; ++i)
+            {
+                if(seen[i] != 1u)
+                {
+                    ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_readdir: case4 file ", i, u8" listed ", seen[i], u8" times");
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+
+        {
+            char8_t removed_name[6];
+            make_name(removed_name, 1234uz);
+            ::fast_io::native_unlinkat(::fast_io::at(many_dir), ::fast_io::mnp::os_c_str(removed_name), {});
+            env.path_cache.generation.fetch_add(1uz, ::std::memory_order_release);
+
+            ::std::vector<unsigned> seen(file_count);
+            list_all(seen);
+            for(::std::size_t i{}; i != file_count; ++i)
+            {
+                if(seen[i] != (i == 1234uz ? 0u : 1u))
+                {
+                    ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_readdir: case4 after unlink, file ", i, u8" listed ", seen[i], u8" times");
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+
+        // cleanup
+        for(::std::size_t i{}; i != file_count; ++i)
+        {
+            char8_t name[6];
+            make_name(name, i);
+            try
+            {
+                ::fast_io::native_unlinkat(::fast_io::at(many_dir), ::fast_io::mnp::os_c_str(name), {});
+            }
+            catch(...)
+            {
+            }
+        }
+        try
+        {
+            ::fast_io::native_unlinkat(::fast_io::at_fdcwd(), many_dir_name, ::fast_io::native_at_flags::removedir);
+        }
+        catch(...)
+        {
+        }
+    }
+
     return 0;
 }
 
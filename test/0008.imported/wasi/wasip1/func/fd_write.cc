@@ -27,6 +27,7 @@
 
 #include <uwvm2/imported/wasi/wasip1/func/fd_write.h>
 #include <uwvm2/imported/wasi/wasip1/func/fd_pread.h>
+#include <uwvm2/imported/wasi/wasip1/func/fd_sync.h>
 #ifdef UWVM_DLLIMPORT
 # error "UWVM_DLLIMPORT existed"
 #endif
@@ -291,6 +292,69 @@ int main()
     }
 #endif
 
+#if !defined(_WIN32)
+    // POSIX-only: host-side output buffer (size policy) holds the data until fd_sync flushes it to the sink
+    {
+        auto& fde = *env.fd_storage.opens.index_unchecked(3uz).fd_p;
+        fde.rights_base = static_cast<rights_t>(-1);
+        fde.rights_inherit = static_cast<rights_t>(-1);
+        fde.wasi_fd.ptr->wasi_fd_storage.reset_type(::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::file);
+        fde.wasi_fd.ptr->wasi_fd_storage.storage.file_fd =
+            ::fast_io::native_file{u8"test_fd_write_buffered.tmp",
+                                   ::fast_io::open_mode::out | ::fast_io::open_mode::in | ::fast_io::open_mode::trunc | ::fast_io::open_mode::creat};
+        auto& file_fd = fde.wasi_fd.ptr->wasi_fd_storage.storage.file_fd;
+
+        ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_buffer_t out_buf{};
+        ::uwvm2::imported::wasi::wasip1::fd_manager::attach_wasi_fd_output_buffer(
+            out_buf,
+            ::fast_io::native_io_observer{file_fd.native_handle()},
+            {.policy = ::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_output_flush_t::size, .capacity = 64uz, .interval_ms = 0u});
+        fde.wasi_fd.ptr->output_buffer = ::std::addressof(out_buf);
+
+        constexpr char const data[] = "Buffered";  // 8
+        constexpr wasi_void_ptr_t buf{8000u};
+        ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32(memory,
+                                                                            buf,
+                                                                            reinterpret_cast<::std::byte const*>(data),
+                                                                            reinterpret_cast<::std::byte const*>(data) + 8);
+
+        constexpr wasi_void_ptr_t iovs_ptr{8200u};
+        constexpr wasi_void_ptr_t nwritten_ptr{8300u};
+        ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory, iovs_ptr, buf);
+        ::uwvm2::imported::wasi::wasip1::memory::store_basic_wasm_type_to_memory_wasm32(memory,
+                                                                                        static_cast<wasi_void_ptr_t>(iovs_ptr + 4u),
+                                                                                        static_cast<wasi_size_t>(8u));
+
+        auto const ret =
+            ::uwvm2::imported::wasi::wasip1::func::fd_write(env, static_cast<wasi_posix_fd_t>(3), iovs_ptr, static_cast<wasi_size_t>(1u), nwritten_ptr);
+        auto const nwritten = ::uwvm2::imported::wasi::wasip1::memory::get_basic_wasm_type_from_memory_wasm32<wasi_size_t>(memory, nwritten_ptr);
+        if(ret != errno_t::esuccess || nwritten != static_cast<wasi_size_t>(8u))
+        {
+            ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_write (buffered): expected esuccess with nwritten 8");
+            ::fast_io::fast_terminate();
+        }
+
+        if(::fast_io::status(file_fd).size != 0u)
+        {
+            ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_write (buffered): data should still be in the host buffer");
+            ::fast_io::fast_terminate();
+        }
+
+        if(::uwvm2::imported::wasi::wasip1::func::fd_sync(env, static_cast<wasi_posix_fd_t>(3)) != errno_t::esuccess)
+        {
+            ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_write (buffered): fd_sync expected esuccess");
+            ::fast_io::fast_terminate();
+        }
+
+        if(::fast_io::status(file_fd).size != 8u)
+        {
+            ::fast_io::io::perrln(::fast_io::u8err(), u8"fd_write (buffered): fd_sync should flush 8 bytes");
+            ::fast_io::fast_terminate();
+        }
+
+        fde.wasi_fd.ptr->output_buffer = nullptr;
+    }
+#endif
+
     return 0;
 }
-
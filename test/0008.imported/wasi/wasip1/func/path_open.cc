@@ -1178,6 +1178,204 @@ int main()
         try_unlink(u8"po32_fdlim_fail.txt");
     }
 
+    // ===== Case 27: path cache - negative entry dropped by O_CREAT, directory chain reused =====
+    {
+        env.path_cache.enabled = true;
+
+        try_unlink(u8"po32_pc_new.txt");
+        write_cu8str32(memory, P0, u8"po32_pc_new.txt");
+        auto const r_missing = ::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                                static_cast<wasi_posix_fd_t>(3),
+                                                                                static_cast<lookupflags_t>(0),
+                                                                                P0,
+                                                                                static_cast<wasi_size_t>(sizeof(u8"po32_pc_new.txt") - 1u),
+                                                                                static_cast<oflags_t>(0),
+                                                                                rights_t::right_fd_read,
+                                                                                static_cast<rights_t>(0),
+                                                                                static_cast<fdflags_t>(0),
+                                                                                PFD);
+        if(r_missing != ::uwvm2::imported::wasi::wasip1::abi::errno_t::enoent)
+        {
+            ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(r_missing));
+            ::fast_io::fast_terminate();
+        }
+
+        auto const r_creat = ::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                              static_cast<wasi_posix_fd_t>(3),
+                                                                              static_cast<lookupflags_t>(0),
+                                                                              P0,
+                                                                              static_cast<wasi_size_t>(sizeof(u8"po32_pc_new.txt") - 1u),
+                                                                              oflags_t::o_creat,
+                                                                              rights_t::right_fd_write,
+                                                                              static_cast<rights_t>(0),
+                                                                              static_cast<fdflags_t>(0),
+                                                                              PFD);
+        if(r_creat != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+        {
+            ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(r_creat));
+            ::fast_io::fast_terminate();
+        }
+        if(::uwvm2::imported::wasi::wasip1::func::fd_close(env, static_cast<wasi_posix_fd_t>(read_u32(memory, PFD))) !=
+           ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // O_CREAT dropped the negative entry, so the file is visible now.
+        auto const r_reopen = ::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                               static_cast<wasi_posix_fd_t>(3),
+                                                                               static_cast<lookupflags_t>(0),
+                                                                               P0,
+                                                                               static_cast<wasi_size_t>(sizeof(u8"po32_pc_new.txt") - 1u),
+                                                                               static_cast<oflags_t>(0),
+                                                                               rights_t::right_fd_read,
+                                                                               static_cast<rights_t>(0),
+                                                                               static_cast<fdflags_t>(0),
+                                                                               PFD);
+        if(r_reopen != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+        {
+            ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(r_reopen));
+            ::fast_io::fast_terminate();
+        }
+        if(::uwvm2::imported::wasi::wasip1::func::fd_close(env, static_cast<wasi_posix_fd_t>(read_u32(memory, PFD))) !=
+           ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // The second directory open replays the chain recorded by the first one.
+        write_cu8str32(memory, P0, u8"po32_dir");
+        wasi_posix_fd_t dir_fds[2]{};
+        for(auto& dir_fd: dir_fds)
+        {
+            auto const r_dir = ::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                                static_cast<wasi_posix_fd_t>(3),
+                                                                                lookupflags_t::lookup_symlink_follow,
+                                                                                P0,
+                                                                                static_cast<wasi_size_t>(sizeof(u8"po32_dir") - 1u),
+                                                                                oflags_t::o_directory,
+                                                                                static_cast<rights_t>(0),
+                                                                                static_cast<rights_t>(0),
+                                                                                static_cast<fdflags_t>(0),
+                                                                                PFD);
+            if(r_dir != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(r_dir));
+                ::fast_io::fast_terminate();
+            }
+            dir_fd = static_cast<wasi_posix_fd_t>(read_u32(memory, PFD));
+        }
+
+        auto const& ds0 = env.fd_storage.opens.index_unchecked(static_cast<::std::size_t>(dir_fds[0])).fd_p->wasi_fd.ptr->wasi_fd_storage.storage.dir_stack;
+        auto const& ds1 = env.fd_storage.opens.index_unchecked(static_cast<::std::size_t>(dir_fds[1])).fd_p->wasi_fd.ptr->wasi_fd_storage.storage.dir_stack;
+        if(ds0.dir_stack.size() != 2uz || ds1.dir_stack.size() != 2uz || ds0.dir_stack.back_unchecked().ptr != ds1.dir_stack.back_unchecked().ptr)
+        {
+            ::fast_io::perrln(static_cast<unsigned>(__LINE__));
+            ::fast_io::fast_terminate();
+        }
+
+        for(auto const dir_fd: dir_fds)
+        {
+            if(::uwvm2::imported::wasi::wasip1::func::fd_close(env, dir_fd) != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+
+        env.path_cache.enabled = false;
+        env.path_cache.bases.clear();
+        try_unlink(u8"po32_pc_new.txt");
+    }
+
+    // ===== Case 28: path cache - write-only and append opens create without O_CREAT, so they ignore and drop negative entries =====
+    {
+        env.path_cache.enabled = true;
+
+        struct implicit_creat_case
+        {
+            char8_t const* name;
+            fdflags_t fdflags;
+        };
+
+        constexpr implicit_creat_case implicit_creat_cases[]{
+            {u8"po32_pc_wronly.txt", static_cast<fdflags_t>(0)},
+            {u8"po32_pc_append.txt", fdflags_t::fdflag_append },
+        };
+
+        for(auto const& c: implicit_creat_cases)
+        {
+            auto const name_len{static_cast<wasi_size_t>(::std::char_traits<char8_t>::length(c.name))};
+            try_unlink(c.name);
+            write_cu8str32(memory, P0, c.name);
+
+            // Record a negative entry for the missing name.
+            auto const r_missing = ::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                                    static_cast<wasi_posix_fd_t>(3),
+                                                                                    static_cast<lookupflags_t>(0),
+                                                                                    P0,
+                                                                                    name_len,
+                                                                                    static_cast<oflags_t>(0),
+                                                                                    rights_t::right_fd_read,
+                                                                                    static_cast<rights_t>(0),
+                                                                                    static_cast<fdflags_t>(0),
+                                                                                    PFD);
+            if(r_missing != ::uwvm2::imported::wasi::wasip1::abi::errno_t::enoent)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(r_missing));
+                ::fast_io::fast_terminate();
+            }
+
+            // Write-only and append opens create the file like the uncached walk does, even though the guest did not ask for o_creat.
+            auto const r_implicit = ::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                                     static_cast<wasi_posix_fd_t>(3),
+                                                                                     static_cast<lookupflags_t>(0),
+                                                                                     P0,
+                                                                                     name_len,
+                                                                                     static_cast<oflags_t>(0),
+                                                                                     rights_t::right_fd_write,
+                                                                                     static_cast<rights_t>(0),
+                                                                                     c.fdflags,
+                                                                                     PFD);
+            if(r_implicit != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(r_implicit));
+                ::fast_io::fast_terminate();
+            }
+            if(::uwvm2::imported::wasi::wasip1::func::fd_close(env, static_cast<wasi_posix_fd_t>(read_u32(memory, PFD))) !=
+               ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::fast_terminate();
+            }
+
+            // The creating open dropped the negative entry, so a plain read open finds the new file.
+            auto const r_reopen = ::uwvm2::imported::wasi::wasip1::func::path_open(env,
+                                                                                   static_cast<wasi_posix_fd_t>(3),
+                                                                                   static_cast<lookupflags_t>(0),
+                                                                                   P0,
+                                                                                   name_len,
+                                                                                   static_cast<oflags_t>(0),
+                                                                                   rights_t::right_fd_read,
+                                                                                   static_cast<rights_t>(0),
+                                                                                   static_cast<fdflags_t>(0),
+                                                                                   PFD);
+            if(r_reopen != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(r_reopen));
+                ::fast_io::fast_terminate();
+            }
+            if(::uwvm2::imported::wasi::wasip1::func::fd_close(env, static_cast<wasi_posix_fd_t>(read_u32(memory, PFD))) !=
+               ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::fast_terminate();
+            }
+
+            try_unlink(c.name);
+        }
+
+        env.path_cache.enabled = false;
+        env.path_cache.bases.clear();
+    }
+
     // Final cleanup
     try_unlink(u8"uwvm_ut_po32_src.txt");
     try_unlink(u8"po32_dir/f.txt");
@@ -6,6 +6,7 @@
 #include <fast_io.h>
 
 #include <uwvm2/imported/wasi/wasip1/func/poll_oneoff.h>
+#include <uwvm2/imported/wasi/wasip1/func/fd_close.h>
 #ifdef UWVM_DLLIMPORT
 # error "UWVM_DLLIMPORT existed"
 #endif
@@ -343,6 +344,116 @@ int main()
             ::fast_io::fast_terminate();
         }
     }
+
+#if defined(__linux__)
+    // Case 6: repeated polls on a pipe reuse the environment's registrations; closing the fd drops its registration
+    {
+        env.fd_storage.opens.resize(8uz);
+
+        ::fast_io::posix_pipe pipe{};
+
+        auto& fd4 = *env.fd_storage.opens.index_unchecked(4uz).fd_p;
+        fd4.rights_base = static_cast<rights_t>(-1);
+        fd4.rights_inherit = static_cast<rights_t>(-1);
+        fd4.wasi_fd.ptr->wasi_fd_storage.reset_type(::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::file);
+        fd4.wasi_fd.ptr->wasi_fd_storage.storage.file_fd = ::std::move(pipe.pipes[0]);
+
+        auto& fd5 = *env.fd_storage.opens.index_unchecked(5uz).fd_p;
+        fd5.rights_base = static_cast<rights_t>(-1);
+        fd5.rights_inherit = static_cast<rights_t>(-1);
+        fd5.wasi_fd.ptr->wasi_fd_storage.reset_type(::uwvm2::imported::wasi::wasip1::fd_manager::wasi_fd_type_e::file);
+        fd5.wasi_fd.ptr->wasi_fd_storage.storage.file_fd = ::std::move(pipe.pipes[1]);
+
+        wasi_subscription_t subs[3]{};
+
+        subs[0].userdata = static_cast<userdata_t>(static_cast<::std::uint64_t>(0xE1u));
+        subs[0].u.tag = eventtype_t::eventtype_fd_read;
+        subs[0].u.u.fd_readwrite.file_descriptor = static_cast<fd_t>(4);
+
+        subs[1].userdata = static_cast<userdata_t>(static_cast<::std::uint64_t>(0xE2u));
+        subs[1].u.tag = eventtype_t::eventtype_fd_write;
+        subs[1].u.u.fd_readwrite.file_descriptor = static_cast<fd_t>(5);
+
+        subs[2].userdata = static_cast<userdata_t>(static_cast<::std::uint64_t>(0xE3u));
+        subs[2].u.tag = eventtype_t::eventtype_clock;
+        subs[2].u.u.clock.id = ::uwvm2::imported::wasi::wasip1::abi::clockid_t::clock_monotonic;
+        subs[2].u.u.clock.timeout = static_cast<timestamp_t>(static_cast<::std::uint64_t>(1'000'000ull));
+        subs[2].u.u.clock.precision = static_cast<timestamp_t>(static_cast<::std::uint64_t>(0u));
+        subs[2].u.u.clock.flags = static_cast<subclockflags_t>(0u);
+
+        auto const poll_once = [&](wasi_size_t nsubs, wasi_event_t& first_evt) noexcept -> wasi_size_t
+        {
+            ::uwvm2::imported::wasi::wasip1::memory::write_all_to_memory_wasm32(memory,
+                                                                                P_SUBS,
+                                                                                reinterpret_cast<::std::byte const*>(subs),
+                                                                                reinterpret_cast<::std::byte const*>(subs) + sizeof(subs));
+
+            auto const ret = ::uwvm2::imported::wasi::wasip1::func::poll_oneoff(env, P_SUBS, P_EVENTS, nsubs, P_NEVENTS);
+            if(ret != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(ret));
+                ::fast_io::fast_terminate();
+            }
+
+            ::uwvm2::imported::wasi::wasip1::memory::read_all_from_memory_wasm32(memory,
+                                                                                 P_EVENTS,
+                                                                                 reinterpret_cast<::std::byte*>(::std::addressof(first_evt)),
+                                                                                 reinterpret_cast<::std::byte*>(::std::addressof(first_evt)) + sizeof(first_evt));
+
+            return ::uwvm2::imported::wasi::wasip1::memory::get_basic_wasm_type_from_memory_wasm32<wasi_size_t>(memory, P_NEVENTS);
+        };
+
+        // The pipe is empty and writable: only the write subscription is ready, on every round.
+        for(unsigned round{}; round != 3u; ++round)
+        {
+            wasi_event_t evt{};
+            auto const nevents{poll_once(static_cast<wasi_size_t>(3u), evt)};
+            if(nevents != static_cast<wasi_size_t>(1u) || evt.userdata != subs[1].userdata || evt.type != eventtype_t::eventtype_fd_write ||
+               evt.error != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " round=", round, " nevents=", static_cast<unsigned>(nevents));
+                ::fast_io::fast_terminate();
+            }
+        }
+
+        // Once data is in the pipe, polling only the read end must not report the write end registered by the previous rounds.
+        ::fast_io::io::print(fd5.wasi_fd.ptr->wasi_fd_storage.storage.file_fd, "x");
+        {
+            wasi_event_t evt{};
+            auto const nevents{poll_once(static_cast<wasi_size_t>(1u), evt)};
+            if(nevents != static_cast<wasi_size_t>(1u) || evt.userdata != subs[0].userdata || evt.type != eventtype_t::eventtype_fd_read)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " nevents=", static_cast<unsigned>(nevents));
+                ::fast_io::fast_terminate();
+            }
+        }
+
+        // After fd_close the read end reports ebadf, and the clock still fires.
+        if(auto const ret{::uwvm2::imported::wasi::wasip1::func::fd_close(env, static_cast<::uwvm2::imported::wasi::wasip1::abi::wasi_posix_fd_t>(4))};
+           ret != ::uwvm2::imported::wasi::wasip1::abi::errno_t::esuccess)
+        {
+            ::fast_io::perrln(static_cast<unsigned>(__LINE__), " ", static_cast<unsigned>(ret));
+            ::fast_io::fast_terminate();
+        }
+
+        subs[1] = subs[2];
+        {
+            wasi_event_t evts[2]{};
+            auto const nevents{poll_once(static_cast<wasi_size_t>(2u), evts[0])};
+            ::uwvm2::imported::wasi::wasip1::memory::read_all_from_memory_wasm32(memory,
+                                                                                 P_EVENTS,
+                                                                                 reinterpret_cast<::std::byte*>(evts),
+                                                                                 reinterpret_cast<::std::byte*>(evts) + sizeof(evts));
+            if(nevents != static_cast<wasi_size_t>(2u) || evts[0].userdata != subs[0].userdata ||
+               evts[0].error != ::uwvm2::imported::wasi::wasip1::abi::errno_t::ebadf || evts[1].userdata != subs[2].userdata ||
+               evts[1].type != eventtype_t::eventtype_clock)
+            {
+                ::fast_io::perrln(static_cast<unsigned>(__LINE__), " nevents=", static_cast<unsigned>(nevents));
+                ::fast_io::fast_terminate();
+            }
+        }
+    }
+#endif
 }
 
 #else
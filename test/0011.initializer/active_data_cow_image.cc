@@ -0,0 +1,252 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/uwvm/cmdline/callback/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/runtime/initializer/init.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+# include <uwvm2/uwvm/wasm/feature/impl.h>
+# include <uwvm2/uwvm/wasm/loader/load_and_check_modules.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+namespace
+{
+    constexpr ::std::size_t wasm_page{65536uz};
+    constexpr ::std::size_t memory_pages{32uz};
+    constexpr ::std::size_t memory_length{memory_pages * wasm_page};
+
+    // Two segments, 1.25 MiB in total, with unaligned edges and a gap between them: well above the 1 MiB image threshold.
+    struct segment_t
+    {
+        ::std::size_t offset;
+        ::std::size_t size;
+    };
+
+    constexpr segment_t segments[]{
+        {100uz,      1048576uz},
+        {1572881uz, 300000uz },
+    };
+
+    // Addresses written after initialization: inside each segment, in the gap between them, and past the image span.
+    constexpr ::std::size_t written_addresses[]{100uz, 70000uz, 1200000uz, 1700000uz, 2000000uz};
+    constexpr ::std::byte written_value{0xa5};
+
+    [[nodiscard]] inline constexpr ::std::byte pattern_at(::std::size_t address) noexcept
+    {
+        return static_cast<::std::byte>((address * 131uz + 7uz) % 253uz);
+    }
+
+    [[nodiscard]] inline constexpr ::std::byte initial_byte_at(::std::size_t address) noexcept
+    {
+        for(auto const& seg: segments)
+        {
+            if(address >= seg.offset && address - seg.offset < seg.size) { return pattern_at(address); }
+        }
+        return ::std::byte{};
+    }
+
+    inline void append_u32_leb(::std::vector<::std::uint8_t>& out, ::std::uint_least32_t value)
+    {
+        do {
+            auto byte{static_cast<::std::uint8_t>(value & 0x7fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(byte);
+        }
+        while(value != 0u);
+    }
+
+    inline void append_i32_leb(::std::vector<::std::uint8_t>& out, ::std::int_least32_t value)
+    {
+        for(;;)
+        {
+            auto byte{static_cast<::std::uint8_t>(value & 0x7f)};
+            value >>= 7;
+            if((value == 0 && (byte & 0x40u) == 0u) || (value == -1 && (byte & 0x40u) != 0u))
+            {
+                out.push_back(byte);
+                return;
+            }
+            out.push_back(static_cast<::std::uint8_t>(byte | 0x80u));
+        }
+    }
+
+    inline void append_section(::std::vector<::std::uint8_t>& out, ::std::uint8_t id, ::std::vector<::std::uint8_t> const& payload)
+    {
+        out.push_back(id);
+        append_u32_leb(out, static_cast<::std::uint_least32_t>(payload.size()));
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    /// @brief `(memory 32)` plus one active data segment per entry of `segments`.
+    [[nodiscard]] inline ::std::vector<::std::uint8_t> make_module()
+    {
+        ::std::vector<::std::uint8_t> bytes{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+
+        ::std::vector<::std::uint8_t> memsec{0x01u, 0x00u};
+        append_u32_leb(memsec, static_cast<::std::uint_least32_t>(memory_pages));
+        append_section(bytes, 0x05u, memsec);
+
+        ::std::vector<::std::uint8_t> datasec{};
+        append_u32_leb(datasec, static_cast<::std::uint_least32_t>(::std::size(segments)));
+        for(auto const& seg: segments)
+        {
+            datasec.push_back(0x00u);
+            datasec.push_back(0x41u);
+            append_i32_leb(datasec, static_cast<::std::int_least32_t>(seg.offset));
+            datasec.push_back(0x0bu);
+            append_u32_leb(datasec, static_cast<::std::uint_least32_t>(seg.size));
+            for(::std::size_t i{}; i != seg.size; ++i) { datasec.push_back(static_cast<::std::uint8_t>(pattern_at(seg.offset + i))); }
+        }
+        append_section(bytes, 0x0bu, datasec);
+
+        return bytes;
+    }
+
+    [[nodiscard]] inline bool install_module(::uwvm2::uwvm::wasm::type::wasm_file_t& wf,
+                                             ::uwvm2::utils::container::u8string_view module_name,
+                                             ::std::vector<::std::uint8_t> const& bytes)
+    {
+        auto const* begin{reinterpret_cast<::std::byte const*>(bytes.data())};
+        auto const* end{begin + bytes.size()};
+
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t fs_para{};
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_module_storage_t module_storage{};
+        try
+        {
+            module_storage = ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(begin, end, err, fs_para);
+        }
+        catch(::fast_io::error const&)
+        {
+            return false;
+        }
+        if(err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::ok) { return false; }
+
+        wf = ::uwvm2::uwvm::wasm::type::wasm_file_t{1u};
+        wf.module_name = module_name;
+        wf.binfmt_ver = 1u;
+        wf.wasm_parameter.binfmt1_para = fs_para;
+        wf.wasm_module_storage.wasm_binfmt_ver1_storage = ::std::move(module_storage);
+        return true;
+    }
+
+    [[nodiscard]] inline ::std::byte* memory_of(::uwvm2::utils::container::u8string_view module_name) noexcept
+    {
+        auto it{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(module_name)};
+        if(it == ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.end()) { return nullptr; }
+        auto& memories{it->second.local_defined_memory_vec_storage};
+        if(memories.size() != 1uz) { return nullptr; }
+        return memories.index_unchecked(0uz).memory.memory_begin;
+    }
+
+    [[nodiscard]] inline ::std::size_t count_memory_image_mappings()
+    {
+        ::std::ifstream maps{"/proc/self/maps"};
+        ::std::size_t count{};
+        for(::std::string line{}; ::std::getline(maps, line);)
+        {
+            if(line.find("memfd:uwvm-memory-image") != ::std::string::npos) { ++count; }
+        }
+        return count;
+    }
+}  // namespace
+
+int main()
+{
+    ::uwvm2::uwvm::io::show_verbose = false;
+    ::uwvm2::uwvm::io::show_depend_warning = false;
+
+    // Both instances parse the same bytes and keep pointing into them, so the buffer outlives initialization.
+    auto const bytes{make_module()};
+
+    if(!install_module(::uwvm2::uwvm::wasm::storage::execute_wasm, u8"cow_main", bytes)) { ::fast_io::fast_terminate(); }
+    ::uwvm2::uwvm::wasm::storage::execute_wasm.file_name = u8"cow_main.wasm";
+    auto& preloaded{::uwvm2::uwvm::wasm::storage::preloaded_wasm.emplace_back()};
+    if(!install_module(preloaded, u8"cow_peer", bytes)) { ::fast_io::fast_terminate(); }
+    preloaded.file_name = u8"cow_peer.wasm";
+
+    if(::uwvm2::uwvm::wasm::loader::construct_all_module_and_check_duplicate_module() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok)
+    {
+        ::fast_io::fast_terminate();
+    }
+    if(::uwvm2::uwvm::wasm::loader::check_import_exist_and_detect_cycles() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok)
+    {
+        ::fast_io::fast_terminate();
+    }
+
+    ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+
+    auto const main_memory{memory_of(u8"cow_main")};
+    auto const peer_memory{memory_of(u8"cow_peer")};
+    if(main_memory == nullptr || peer_memory == nullptr || main_memory == peer_memory) { ::fast_io::fast_terminate(); }
+
+#if defined(UWVM_SUPPORT_MMAP)
+    // Where memfd images are available, both memories must have taken the image path rather than the copy fallback.
+    if constexpr(::uwvm2::object::memory::linear::mmap_memory_private_image_supported)
+    {
+        if(count_memory_image_mappings() < 2uz) { ::fast_io::fast_terminate(); }
+    }
+#endif
+
+    // Initial contents: segment bytes where data was placed, zero everywhere else, including the gap inside the mapped span.
+    for(::std::size_t address{}; address != memory_length; ++address)
+    {
+        auto const expected{initial_byte_at(address)};
+        if(main_memory[address] != expected || peer_memory[address] != expected) { ::fast_io::fast_terminate(); }
+    }
+
+    // Guest writes land in private copies: the writing memory sees them, the peer mapped from its own image does not, and
+    // every other byte on the touched pages keeps its initial value.
+    for(auto const address: written_addresses) { main_memory[address] = written_value; }
+
+    for(::std::size_t address{}; address != memory_length; ++address)
+    {
+        bool written{};
+        for(auto const w: written_addresses) { written = written || w == address; }
+
+        auto const expected{initial_byte_at(address)};
+        if(main_memory[address] != (written ? written_value : expected)) { ::fast_io::fast_terminate(); }
+        if(peer_memory[address] != expected) { ::fast_io::fast_terminate(); }
+    }
+
+    return 0;
+}
+
+#include <uwvm2/utils/macro/pop_macros.h>
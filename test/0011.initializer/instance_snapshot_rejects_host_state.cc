@@ -0,0 +1,179 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+#include <uwvm2/uwvm/runtime/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/uwvm/cmdline/callback/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/runtime/initializer/init.h>
+# include <uwvm2/uwvm/runtime/snapshot/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+# include <uwvm2/uwvm/wasm/feature/impl.h>
+# include <uwvm2/uwvm/wasm/loader/load_and_check_modules.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+namespace
+{
+    inline constexpr ::uwvm2::utils::container::u8string_view snapshot_path{u8"instance_snapshot_rejects_host_state.snap"};
+
+    struct host_memory
+    {
+        inline static constexpr ::uwvm2::utils::container::u8string_view memory_name{u8"mem"};
+        inline static constexpr ::std::uint_least64_t page_size{64u * 1024u};
+
+        ::std::byte buf[64u * 1024u]{};
+        ::std::uint_least64_t pages{1u};
+
+        friend bool memory_grow(host_memory&, ::std::uint_least64_t grow_page_size) noexcept { return grow_page_size == 0u; }
+
+        friend ::std::byte* memory_begin(host_memory& mem) noexcept { return mem.buf; }
+
+        friend ::std::uint_least64_t memory_size(host_memory& mem) noexcept { return mem.pages; }
+    };
+
+    struct host_global
+    {
+        inline static constexpr ::uwvm2::utils::container::u8string_view global_name{u8"g"};
+        using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+
+        value_type value{42};
+
+        friend value_type global_get(host_global& g) noexcept { return g.value; }
+    };
+
+    /// @brief Host module whose memory and global live outside any wasm runtime record.
+    struct host_module
+    {
+        ::uwvm2::utils::container::u8string_view module_name{u8"host"};
+
+        using local_memory_tuple = ::uwvm2::utils::container::tuple<host_memory>;
+        using local_global_tuple = ::uwvm2::utils::container::tuple<host_global>;
+
+        local_memory_tuple local_memory{};
+        local_global_tuple local_global{};
+    };
+
+    // (import "host" "mem" (memory 1))
+    inline constexpr ::std::uint8_t imports_host_memory[]{
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x01, 0x04, 'h', 'o', 's', 't', 0x03, 'm', 'e', 'm', 0x02, 0x00, 0x01,
+    };
+
+    // (import "host" "g" (global i32))
+    inline constexpr ::std::uint8_t imports_host_global[]{
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x04, 'h', 'o', 's', 't', 0x01, 'g', 0x03, 0x7f, 0x00,
+    };
+
+    // (memory 1): everything it owns is wasm-defined, so the snapshot is accepted.
+    inline constexpr ::std::uint8_t owns_its_memory[]{
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x05, 0x03, 0x01, 0x00, 0x01,
+    };
+
+    /// @brief Reset the loader registries, register the host module and `bytes` as the exec module, then instantiate them.
+    [[nodiscard]] inline bool instantiate(::std::uint8_t const* bytes, ::std::size_t size)
+    {
+        ::uwvm2::uwvm::wasm::storage::all_module.clear();
+        ::uwvm2::uwvm::wasm::storage::all_module_export.clear();
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm.clear();
+        ::uwvm2::uwvm::wasm::storage::preload_local_imported.clear();
+        ::uwvm2::uwvm::wasm::storage::preload_local_imported.emplace_back(host_module{});
+
+        auto const* begin{reinterpret_cast<::std::byte const*>(bytes)};
+        auto const* end{begin + size};
+
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t fs_para{};
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_module_storage_t module_storage{};
+        try
+        {
+            module_storage = ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(begin, end, err, fs_para);
+        }
+        catch(::fast_io::error const&)
+        {
+            return false;
+        }
+        if(err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::ok) { return false; }
+
+        auto& wf{::uwvm2::uwvm::wasm::storage::execute_wasm};
+        wf = ::uwvm2::uwvm::wasm::type::wasm_file_t{1u};
+        wf.file_name = u8"guest.wasm";
+        wf.module_name = u8"guest";
+        wf.binfmt_ver = 1u;
+        wf.wasm_parameter.binfmt1_para = fs_para;
+        wf.wasm_module_storage.wasm_binfmt_ver1_storage = ::std::move(module_storage);
+
+        if(::uwvm2::uwvm::wasm::loader::construct_all_module_and_check_duplicate_module() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok)
+        {
+            return false;
+        }
+        if(::uwvm2::uwvm::wasm::loader::check_import_exist_and_detect_cycles() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok)
+        {
+            return false;
+        }
+
+        ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+        return true;
+    }
+}  // namespace
+
+int main()
+{
+    ::uwvm2::uwvm::io::show_verbose = false;
+    ::uwvm2::uwvm::io::show_depend_warning = false;
+
+    namespace snapshot = ::uwvm2::uwvm::runtime::snapshot;
+
+    // Host-provided memory contents and global values are not part of the file, so creation must refuse rather than write a snapshot that
+    // silently diverges on restore.
+    if(!instantiate(imports_host_memory, sizeof(imports_host_memory))) { ::fast_io::fast_terminate(); }
+    if(snapshot::write_snapshot(snapshot_path) != snapshot::snapshot_status::not_reproducible) { ::fast_io::fast_terminate(); }
+
+    if(!instantiate(imports_host_global, sizeof(imports_host_global))) { ::fast_io::fast_terminate(); }
+    if(snapshot::write_snapshot(snapshot_path) != snapshot::snapshot_status::not_reproducible) { ::fast_io::fast_terminate(); }
+
+    // Control: the same host module merely being loaded does not block a module that imports nothing from it.
+    if(!instantiate(owns_its_memory, sizeof(owns_its_memory))) { ::fast_io::fast_terminate(); }
+    if(snapshot::write_snapshot(snapshot_path) != snapshot::snapshot_status::ok) { ::fast_io::fast_terminate(); }
+
+    static_cast<void>(::std::remove(reinterpret_cast<char const*>(snapshot_path.data())));
+    return 0;
+}
+#else
+int main() { return 0; }
+#endif
+
+#include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,249 @@
+/*************************************************************
+ * UlteSoft WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <utility>
+#include <vector>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+#include <uwvm2/uwvm/runtime/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/uwvm/cmdline/callback/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/runtime/initializer/init.h>
+# include <uwvm2/uwvm/runtime/snapshot/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+# include <uwvm2/uwvm/wasm/feature/impl.h>
+# include <uwvm2/uwvm/wasm/loader/load_and_check_modules.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+#if defined(UWVM_RUNTIME_HAS_BACKEND)
+namespace
+{
+    inline constexpr ::uwvm2::utils::container::u8string_view snapshot_path{u8"instance_snapshot_round_trip.snap"};
+
+    // (type (func (result i32)))
+    // (func $f0 (result i32) i32.const 1)  (func $f1 (result i32) i32.const 2)
+    // (table 2 funcref)  (memory 1)
+    // (global (mut i32) (i32.const 7))  (global (mut i64) (i64.const 9))
+    // (elem (i32.const 0) func $f0)  (elem func $f1)
+    // (data (i32.const 16) "active")  (data "pass")
+    inline constexpr ::std::uint8_t snapshot_module[]{
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+        // type
+        0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,
+        // function
+        0x03, 0x03, 0x02, 0x00, 0x00,
+        // table
+        0x04, 0x04, 0x01, 0x70, 0x00, 0x02,
+        // memory
+        0x05, 0x03, 0x01, 0x00, 0x01,
+        // global
+        0x06, 0x0b, 0x02, 0x7f, 0x01, 0x41, 0x07, 0x0b, 0x7e, 0x01, 0x42, 0x09, 0x0b,
+        // element: one active, one passive
+        0x09, 0x0b, 0x02, 0x00, 0x41, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
+        // data count
+        0x0c, 0x01, 0x02,
+        // code
+        0x0a, 0x0b, 0x02, 0x04, 0x00, 0x41, 0x01, 0x0b, 0x04, 0x00, 0x41, 0x02, 0x0b,
+        // data: one active, one passive
+        0x0b, 0x12, 0x02, 0x00, 0x41, 0x10, 0x0b, 0x06, 'a', 'c', 't', 'i', 'v', 'e', 0x01, 0x04, 'p', 'a', 's', 's',
+    };
+
+    inline constexpr ::std::size_t active_data_offset{16uz};
+    inline constexpr ::std::size_t wasm_page{65536uz};
+
+    [[nodiscard]] inline bool install_exec_module()
+    {
+        auto const* begin{reinterpret_cast<::std::byte const*>(snapshot_module)};
+        auto const* end{begin + sizeof(snapshot_module)};
+
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t fs_para{};
+        auto& para{::uwvm2::parser::wasm::standard::wasm1p1::features::get_wasm1p1_parameter(fs_para)};
+        para.disable_reference_types = false;
+        para.disable_bulk_memory = false;
+
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_module_storage_t module_storage{};
+        try
+        {
+            module_storage = ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(begin, end, err, fs_para);
+        }
+        catch(::fast_io::error const&)
+        {
+            return false;
+        }
+        if(err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::ok) { return false; }
+
+        auto& wf{::uwvm2::uwvm::wasm::storage::execute_wasm};
+        wf = ::uwvm2::uwvm::wasm::type::wasm_file_t{1u};
+        wf.file_name = u8"snap.wasm";
+        wf.module_name = u8"snap";
+        wf.binfmt_ver = 1u;
+        wf.wasm_parameter.binfmt1_para = fs_para;
+        wf.wasm_module_storage.wasm_binfmt_ver1_storage = ::std::move(module_storage);
+
+        return ::uwvm2::uwvm::wasm::loader::construct_all_module_and_check_duplicate_module() ==
+                   ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok &&
+               ::uwvm2::uwvm::wasm::loader::check_import_exist_and_detect_cycles() == ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok;
+    }
+
+    [[nodiscard]] inline ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t& runtime_record() noexcept
+    {
+        auto it{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(u8"snap")};
+        if(it == ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.end()) { ::fast_io::fast_terminate(); }
+        return it->second;
+    }
+
+    [[nodiscard]] inline bool table_slot_is(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& rt, ::std::size_t slot, ::std::size_t func) noexcept
+    {
+        using elem_type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t;
+        auto const& elem{rt.local_defined_table_vec_storage.index_unchecked(0uz).elems.index_unchecked(slot)};
+        return elem.type == elem_type::func_ref_defined &&
+               elem.storage.defined_ptr == ::std::addressof(rt.local_defined_function_vec_storage.index_unchecked(func));
+    }
+
+    /// @brief Every kind of state a snapshot carries is moved away from what instantiation produces.
+    inline void mutate_state(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t& rt) noexcept
+    {
+        using elem_type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t;
+
+        auto& memory{rt.local_defined_memory_vec_storage.index_unchecked(0uz).memory};
+        if(!memory.try_grow_silently(1uz)) { ::fast_io::fast_terminate(); }
+        memory.memory_begin[active_data_offset] = ::std::byte{'A'};
+        memory.memory_begin[0x100uz] = ::std::byte{0x5a};
+        memory.memory_begin[wasm_page + 3uz] = ::std::byte{0x77};
+
+        rt.local_defined_global_vec_storage.index_unchecked(0uz).global.storage.i32 = 123456;
+        rt.local_defined_global_vec_storage.index_unchecked(1uz).global.storage.i64 = -7;
+
+        auto& elems{rt.local_defined_table_vec_storage.index_unchecked(0uz).elems};
+        elems.index_unchecked(0uz).storage.defined_ptr = ::std::addressof(rt.local_defined_function_vec_storage.index_unchecked(1uz));
+        elems.index_unchecked(0uz).type = elem_type::func_ref_defined;
+        elems.index_unchecked(1uz).storage.defined_ptr = ::std::addressof(rt.local_defined_function_vec_storage.index_unchecked(0uz));
+        elems.index_unchecked(1uz).type = elem_type::func_ref_defined;
+
+        // What `elem.drop 1` and `data.drop 1` leave behind.
+        auto& passive_elem{rt.local_defined_element_vec_storage.index_unchecked(1uz).element};
+        passive_elem.dropped = true;
+        passive_elem.funcidx_begin = nullptr;
+        passive_elem.funcidx_end = nullptr;
+
+        auto& passive_data{rt.local_defined_data_vec_storage.index_unchecked(1uz).data};
+        passive_data.dropped = true;
+        passive_data.byte_begin = nullptr;
+        passive_data.byte_end = nullptr;
+    }
+
+    [[nodiscard]] inline bool has_mutated_state(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& rt) noexcept
+    {
+        auto const& memory{rt.local_defined_memory_vec_storage.index_unchecked(0uz).memory};
+        if(memory.get_page_size() != 2uz) { return false; }
+
+        constexpr char8_t expected_active[]{u8'A', u8'c', u8't', u8'i', u8'v', u8'e'};
+        for(::std::size_t i{}; i != sizeof(expected_active); ++i)
+        {
+            if(memory.memory_begin[active_data_offset + i] != static_cast<::std::byte>(expected_active[i])) { return false; }
+        }
+        if(memory.memory_begin[0x100uz] != ::std::byte{0x5a} || memory.memory_begin[wasm_page + 3uz] != ::std::byte{0x77}) { return false; }
+        if(memory.memory_begin[0uz] != ::std::byte{} || memory.memory_begin[2uz * wasm_page - 1uz] != ::std::byte{}) { return false; }
+
+        if(rt.local_defined_global_vec_storage.index_unchecked(0uz).global.storage.i32 != 123456) { return false; }
+        if(rt.local_defined_global_vec_storage.index_unchecked(1uz).global.storage.i64 != -7) { return false; }
+
+        if(!table_slot_is(rt, 0uz, 1uz) || !table_slot_is(rt, 1uz, 0uz)) { return false; }
+
+        auto const& passive_elem{rt.local_defined_element_vec_storage.index_unchecked(1uz).element};
+        if(!passive_elem.dropped || passive_elem.funcidx_begin != nullptr) { return false; }
+        auto const& passive_data{rt.local_defined_data_vec_storage.index_unchecked(1uz).data};
+        if(!passive_data.dropped || passive_data.byte_begin != nullptr) { return false; }
+
+        // Segments the snapshot recorded as live stay live.
+        if(rt.local_defined_element_vec_storage.index_unchecked(0uz).element.dropped) { return false; }
+        if(rt.local_defined_data_vec_storage.index_unchecked(0uz).data.dropped) { return false; }
+
+        return true;
+    }
+}  // namespace
+
+int main()
+{
+    ::uwvm2::uwvm::io::show_verbose = false;
+    ::uwvm2::uwvm::io::show_depend_warning = false;
+
+    namespace snapshot = ::uwvm2::uwvm::runtime::snapshot;
+
+    if(!install_exec_module()) { ::fast_io::fast_terminate(); }
+
+    ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+    {
+        auto& rt{runtime_record()};
+        if(!table_slot_is(rt, 0uz, 0uz)) { ::fast_io::fast_terminate(); }
+        if(rt.local_defined_global_vec_storage.index_unchecked(0uz).global.storage.i32 != 7) { ::fast_io::fast_terminate(); }
+        auto const memory_begin{rt.local_defined_memory_vec_storage.index_unchecked(0uz).memory.memory_begin};
+        if(memory_begin[active_data_offset] != ::std::byte{'a'}) { ::fast_io::fast_terminate(); }
+
+        mutate_state(rt);
+        if(!has_mutated_state(rt)) { ::fast_io::fast_terminate(); }
+    }
+
+    if(snapshot::write_snapshot(snapshot_path) != snapshot::snapshot_status::ok) { ::fast_io::fast_terminate(); }
+
+    // Instantiate again the way `--runtime-snapshot restore` does: active data is bounds-checked but not copied into defined memories.
+    ::uwvm2::uwvm::runtime::initializer::skip_defined_memory_active_data = true;
+    ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+    {
+        auto const& rt{runtime_record()};
+        auto const& memory{rt.local_defined_memory_vec_storage.index_unchecked(0uz).memory};
+        if(memory.get_page_size() != 1uz || memory.memory_begin[active_data_offset] != ::std::byte{}) { ::fast_io::fast_terminate(); }
+        if(!table_slot_is(rt, 0uz, 0uz) || rt.local_defined_data_vec_storage.index_unchecked(1uz).data.dropped) { ::fast_io::fast_terminate(); }
+    }
+
+    if(snapshot::restore_snapshot(snapshot_path) != snapshot::snapshot_status::ok) { ::fast_io::fast_terminate(); }
+
+    if(!has_mutated_state(runtime_record())) { ::fast_io::fast_terminate(); }
+
+    // Restored memory pages are private: writes after the restore must not reach the snapshot file.
+    runtime_record().local_defined_memory_vec_storage.index_unchecked(0uz).memory.memory_begin[0x100uz] = ::std::byte{0x11};
+    ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+    if(snapshot::restore_snapshot(snapshot_path) != snapshot::snapshot_status::ok || !has_mutated_state(runtime_record())) { ::fast_io::fast_terminate(); }
+
+    static_cast<void>(::std::remove(reinterpret_cast<char const*>(snapshot_path.data())));
+    return 0;
+}
+#else
+int main() { return 0; }
+#endif
+
+#include <uwvm2/uwvm/runtime/macro/pop_macros.h>
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,205 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#ifndef UWVM_MODULE
+# include <fast_io.h>
+# include <uwvm2/validation/standard/wasm1p1/impl.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/binfmt.h>
+# include <uwvm2/parser/wasm/standard/wasm1p1/features/impl.h>
+# include <uwvm2/uwvm/runtime/validator/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+namespace
+{
+    using wasm1_feature = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+    using wasm1p1_feature = ::uwvm2::parser::wasm::standard::wasm1p1::features::wasm1p1;
+    using fs_para_t = ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1_feature, wasm1p1_feature>;
+    using module_storage_t = ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<wasm1_feature, wasm1p1_feature>;
+
+    namespace validator_details = ::uwvm2::uwvm::runtime::validator::details;
+    using job_t = validator_details::module_code_validation_job<module_storage_t, fs_para_t>;
+
+    inline constexpr ::std::size_t no_failure{::std::numeric_limits<::std::size_t>::max()};
+
+    inline void append_u32_leb(::std::vector<::std::uint8_t>& out, ::std::uint_least32_t value)
+    {
+        do {
+            auto byte{static_cast<::std::uint8_t>(value & 0x7fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(byte);
+        }
+        while(value != 0u);
+    }
+
+    inline void append_section(::std::vector<::std::uint8_t>& out, ::std::uint8_t id, ::std::vector<::std::uint8_t> const& payload)
+    {
+        out.push_back(id);
+        append_u32_leb(out, static_cast<::std::uint_least32_t>(payload.size()));
+        out.insert(out.end(), payload.begin(), payload.end());
+    }
+
+    /// @brief Build `func_count` functions of type `[] -> []`; bodies listed in `invalid` underflow the operand stack.
+    [[nodiscard]] inline ::std::vector<::std::uint8_t> make_module(::std::size_t func_count, ::std::vector<::std::size_t> const& invalid)
+    {
+        ::std::vector<::std::uint8_t> bytes{0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u};
+
+        append_section(bytes, 0x01u, {0x01u, 0x60u, 0x00u, 0x00u});
+
+        ::std::vector<::std::uint8_t> funcsec{};
+        append_u32_leb(funcsec, static_cast<::std::uint_least32_t>(func_count));
+        for(::std::size_t i{}; i != func_count; ++i) { funcsec.push_back(0x00u); }
+        append_section(bytes, 0x03u, funcsec);
+
+        ::std::vector<::std::uint8_t> codesec{};
+        append_u32_leb(codesec, static_cast<::std::uint_least32_t>(func_count));
+        for(::std::size_t i{}; i != func_count; ++i)
+        {
+            bool is_invalid{};
+            for(auto const idx: invalid) { is_invalid = is_invalid || idx == i; }
+
+            if(is_invalid)
+            {
+                // i32.add with an empty operand stack
+                codesec.insert(codesec.end(), {0x03u, 0x00u, 0x6au, 0x0bu});
+            }
+            else
+            {
+                codesec.insert(codesec.end(), {0x02u, 0x00u, 0x0bu});
+            }
+        }
+        append_section(bytes, 0x0au, codesec);
+
+        return bytes;
+    }
+
+    inline constexpr void configure_features(fs_para_t& fs_para) noexcept
+    {
+        auto& para{::uwvm2::parser::wasm::standard::wasm1p1::features::get_wasm1p1_parameter(fs_para)};
+        para.disable_multi_value = false;
+        para.disable_reference_types = true;
+        para.disable_bulk_memory = false;
+        para.disable_sign_extension = false;
+        para.controllable_allow_multi_result_vector = false;
+        para.controllable_allow_multi_table = false;
+    }
+
+    [[nodiscard]] inline bool parse_module(::std::vector<::std::uint8_t> const& bytes, fs_para_t const& fs_para, module_storage_t& module_storage) noexcept
+    {
+        auto const* begin{reinterpret_cast<::std::byte const*>(bytes.data())};
+        auto const* end{begin + bytes.size()};
+
+        ::uwvm2::parser::wasm::base::error_impl parse_err{};
+        try
+        {
+            module_storage =
+                ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<wasm1_feature, wasm1p1_feature>(begin, end, parse_err, fs_para);
+        }
+        catch(::fast_io::error const&)
+        {
+            return false;
+        }
+
+        return parse_err.err_code == ::uwvm2::parser::wasm::base::wasm_parse_error_code::ok;
+    }
+
+    struct reported_failure_t
+    {
+        ::std::size_t job_index{no_failure};
+        ::std::size_t local_idx{no_failure};
+    };
+
+    [[nodiscard]] inline reported_failure_t run_jobs(::uwvm2::utils::container::vector<job_t> const& jobs) noexcept
+    {
+        ::uwvm2::utils::container::vector<validator_details::code_validation_task_group> task_groups{};
+        for(::std::size_t job_index{}; job_index != jobs.size(); ++job_index)
+        {
+            validator_details::append_code_validation_task_groups(*jobs.index_unchecked(job_index).module_storage_ptr, job_index, task_groups);
+        }
+
+        auto const failed{validator_details::run_code_validation_task_groups(jobs, task_groups)};
+        if(failed == no_failure) { return {}; }
+
+        auto const& group{task_groups.index_unchecked(failed)};
+        return {.job_index = group.job_index, .local_idx = group.failed_local_idx};
+    }
+
+    struct scenario_t
+    {
+        char const* name;
+        ::std::vector<::std::size_t> invalid_a;
+        ::std::vector<::std::size_t> invalid_b;
+        reported_failure_t expected;
+    };
+}  // namespace
+
+int main()
+{
+    namespace runtime_mode = ::uwvm2::uwvm::runtime::runtime_mode;
+
+    // Two bodies per task group and three extra workers: failures live in different groups and are
+    // raced by different workers, yet the report must always name the lowest failing index.
+    runtime_mode::global_runtime_scheduling_policy = runtime_mode::runtime_scheduling_policy_t::function_count;
+    runtime_mode::global_runtime_scheduling_size = 2uz;
+    runtime_mode::global_runtime_compile_threads_resolved = 3uz;
+
+    constexpr ::std::size_t func_count{32uz};
+    constexpr ::std::size_t iterations{64uz};
+
+    ::std::vector<scenario_t> const scenarios{
+        {"first module, lowest of several groups", {7uz, 13uz, 29uz}, {2uz}, {.job_index = 0uz, .local_idx = 7uz}},
+        {"same group, earlier body wins", {31uz, 30uz, 18uz, 19uz}, {}, {.job_index = 0uz, .local_idx = 18uz}},
+        {"second module only", {}, {27uz, 3uz, 11uz}, {.job_index = 1uz, .local_idx = 3uz}},
+        {"all valid", {}, {}, {}},
+    };
+
+    fs_para_t fs_para{};
+    configure_features(fs_para);
+
+    for(auto const& scenario: scenarios)
+    {
+        auto const bytes_a{make_module(func_count, scenario.invalid_a)};
+        auto const bytes_b{make_module(func_count, scenario.invalid_b)};
+
+        module_storage_t module_a{};
+        module_storage_t module_b{};
+        if(!parse_module(bytes_a, fs_para, module_a) || !parse_module(bytes_b, fs_para, module_b))
+        {
+            ::fast_io::io::perrln("parse failed: ", ::fast_io::mnp::os_c_str(scenario.name));
+            return 1;
+        }
+
+        ::uwvm2::utils::container::vector<job_t> jobs{};
+        jobs.push_back({.module_storage_ptr = ::std::addressof(module_a), .fs_para_ptr = ::std::addressof(fs_para)});
+        jobs.push_back({.module_storage_ptr = ::std::addressof(module_b), .fs_para_ptr = ::std::addressof(fs_para)});
+
+        for(::std::size_t i{}; i != iterations; ++i)
+        {
+            auto const reported{run_jobs(jobs)};
+            if(reported.job_index != scenario.expected.job_index || reported.local_idx != scenario.expected.local_idx)
+            {
+                ::fast_io::io::perrln("unexpected failure report for \"",
+                                      ::fast_io::mnp::os_c_str(scenario.name),
+                                      "\" (iteration ",
+                                      i,
+                                      "): job=",
+                                      reported.job_index,
+                                      " idx=",
+                                      reported.local_idx,
+                                      ", expected job=",
+                                      scenario.expected.job_index,
+                                      " idx=",
+                                      scenario.expected.local_idx);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,340 @@
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    // Exported through `--wasm-preload-library ... ic_lib` so the main module's table can hold an imported element.
+    inline constexpr ::std::string_view library_wat{R"((module
+  (func (export "lib_seven") (result i32)
+    i32.const 7))
+)"};
+
+    // Every indirect call goes through the single call_indirect in `$dispatch`, so all probes hit the same two-way site slot.  Each block
+    // repoints or adds an element, calls it once (miss + refill) and once more (hit), and traps if the result is not the new target's.
+    inline constexpr ::std::string_view inline_cache_wat{R"((module
+  (import "ic_lib" "lib_seven" (func $lib_seven (result i32)))
+  (type $r (func (result i32)))
+  (table $t 2 funcref)
+  (elem (i32.const 0) func $one $lib_seven)
+  (elem $later func $three)
+  (elem declare func $two $four)
+
+  (func $one (type $r) i32.const 1)
+  (func $two (type $r) i32.const 2)
+  (func $three (type $r) i32.const 3)
+  (func $four (type $r) i32.const 4)
+
+  (func $dispatch (param $slot i32) (result i32)
+    local.get $slot
+    call_indirect $t (type $r))
+
+  (func $expect (param $slot i32) (param $want i32)
+    local.get $slot
+    call $dispatch
+    local.get $want
+    i32.ne
+    if
+      unreachable
+    end)
+
+  (func $_start (export "_start")
+    ;; empty slot: miss, then hit on the same target
+    i32.const 0
+    i32.const 1
+    call $expect
+    i32.const 0
+    i32.const 1
+    call $expect
+
+    ;; table.set: the cached way no longer matches the element
+    i32.const 0
+    ref.func $two
+    table.set $t
+    i32.const 0
+    i32.const 2
+    call $expect
+    i32.const 0
+    i32.const 2
+    call $expect
+
+    ;; imported element: cached as a tagged import-target way
+    i32.const 1
+    i32.const 7
+    call $expect
+    i32.const 1
+    i32.const 7
+    call $expect
+
+    ;; table.grow: the new element is reached through the same site
+    ref.func $four
+    i32.const 1
+    table.grow $t
+    i32.const 2
+    i32.ne
+    if
+      unreachable
+    end
+    i32.const 2
+    i32.const 4
+    call $expect
+    i32.const 2
+    i32.const 4
+    call $expect
+
+    ;; table.init: overwrite element 0 from the passive segment
+    i32.const 0
+    i32.const 0
+    i32.const 1
+    table.init $t $later
+    i32.const 0
+    i32.const 3
+    call $expect
+    i32.const 0
+    i32.const 3
+    call $expect
+
+    ;; both ways stay live: element 2 was shifted into the second way by the table.init refill
+    i32.const 2
+    i32.const 4
+    call $expect))
+)"};
+
+    // One miss per repointed element (set, import, grow, init and the first call); one hit per repeat plus the final second-way probe.
+    inline constexpr long long expected_ic_hits{6};
+    inline constexpr long long expected_ic_misses{5};
+
+    /// @brief Decimal value following `key` in the runtime log, or -1 when the key is missing.
+    [[nodiscard]] long long counter_for(::std::string const& log, ::std::string_view key)
+    {
+        auto const field{log.find(key)};
+        if(field == ::std::string::npos) { return -1; }
+
+        long long value{};
+        bool any_digit{};
+        for(auto pos{field + key.size()}; pos != log.size() && log[pos] >= '0' && log[pos] <= '9'; ++pos)
+        {
+            value = value * 10 + (log[pos] - '0');
+            any_digit = true;
+        }
+        return any_digit ? value : -1;
+    }
+
+    [[nodiscard]] bool compile_wat(::std::filesystem::path const& wat2wasm_path,
+                                   ::std::filesystem::path const& wat_path,
+                                   ::std::filesystem::path const& wasm_path,
+                                   ::std::string_view wat)
+    {
+        if(!write_text_file(wat_path, wat)) { return false; }
+
+        auto const compile_command{quote_argument(wat2wasm_path) + " " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+        ::std::cout << "[call-indirect-inline-cache] " << compile_command << '\n';
+        if(!command_succeeds(compile_command))
+        {
+            ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[call-indirect-inline-cache] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0013.uwvm_int" / "uwvm_int_call_indirect_inline_cache_wat"};
+    auto const library_wasm_path{artifact_dir / "ic_lib.wasm"};
+    auto const wasm_path{artifact_dir / "inline_cache.wasm"};
+    if(!compile_wat(wat2wasm_path, artifact_dir / "ic_lib.wat", library_wasm_path, library_wat)) { return 1; }
+    if(!compile_wat(wat2wasm_path, artifact_dir / "inline_cache.wat", wasm_path, inline_cache_wat)) { return 1; }
+
+    // The counters are only maintained while runtime logging is on and are reported in the lazy summary line.
+    auto const output_path{artifact_dir / "u2_lazy.out"};
+    auto const log_path{artifact_dir / "u2_lazy.log"};
+    auto const command{quote_argument(uwvm_path) + " --wasm-feature-wasm1.1 -Rcc int -Rcm lazy -Rclog file " + quote_argument(log_path) +
+                       " --wasm-preload-library " + quote_argument(library_wasm_path) + " ic_lib --run " + quote_argument(wasm_path) + " > " +
+                       quote_argument(output_path) + " 2>&1"};
+    ::std::cout << "[call-indirect-inline-cache] " << command << '\n';
+
+    if(run_system_command(command) != 0)
+    {
+        ::std::cerr << "a call_indirect dispatched to a stale target; output=" << output_path << '\n';
+        return 1;
+    }
+
+    ::std::string log{};
+    if(!read_text_file(log_path, log)) { return 1; }
+
+    auto const hits{counter_for(log, "call_indirect_ic_hits=")};
+    auto const misses{counter_for(log, "call_indirect_ic_misses=")};
+    if(hits != expected_ic_hits || misses != expected_ic_misses)
+    {
+        ::std::cerr << "expected call_indirect_ic_hits=" << expected_ic_hits << " call_indirect_ic_misses=" << expected_ic_misses << ", log reports hits="
+                    << hits << " misses=" << misses << "; log=" << log_path << '\n';
+        return 1;
+    }
+
+    ::std::cout << "[call-indirect-inline-cache] every table.set/grow/init repoint missed once and then hit\n";
+    return 0;
+}
@@ -0,0 +1,317 @@
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct profile_mode_t
+    {
+        char const* name;
+        char const* args;
+    };
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    // `$work` is a same-module callee that u2 full mode would otherwise enter through a frameless call.  Its body has a branch, so the
+    // trivial-call fast path does not apply and the only thing under test is whether the call reaches the profiled bridge.
+    inline constexpr ::std::string_view function_profile_wat{R"((module
+  (func $work (param $x i32) (result i32)
+    local.get $x
+    i32.const 1
+    i32.and
+    if (result i32)
+      local.get $x
+      i32.const 3
+      i32.mul
+    else
+      local.get $x
+      i32.const 1
+      i32.shr_u
+    end)
+
+  (func $_start (export "_start")
+    (local $i i32)
+    (local $acc i32)
+    loop $calls
+      local.get $acc
+      local.get $i
+      i32.add
+      call $work
+      local.set $acc
+      local.get $i
+      i32.const 1
+      i32.add
+      local.tee $i
+      i32.const 1000
+      i32.lt_u
+      br_if $calls
+    end))
+)"};
+
+    inline constexpr unsigned expected_work_calls{1000u};
+
+    /// @brief `calls` of the JSON row whose `"name"` is `name`, or -1 when the row or the field is missing.
+    [[nodiscard]] long long calls_for(::std::string const& json, ::std::string_view name)
+    {
+        auto const key{::std::string{"\"name\":\""} + ::std::string{name} + "\""};
+        auto const row{json.find(key)};
+        if(row == ::std::string::npos) { return -1; }
+
+        constexpr ::std::string_view calls_key{"\"calls\":"};
+        auto const field{json.find(calls_key, row)};
+        auto const row_end{json.find('}', row)};
+        if(field == ::std::string::npos || field > row_end) { return -1; }
+
+        long long value{};
+        bool any_digit{};
+        for(auto pos{field + calls_key.size()}; pos != json.size() && json[pos] >= '0' && json[pos] <= '9'; ++pos)
+        {
+            value = value * 10 + (json[pos] - '0');
+            any_digit = true;
+        }
+        return any_digit ? value : -1;
+    }
+
+    [[nodiscard]] bool run_case(::std::filesystem::path const& uwvm_path,
+                                ::std::filesystem::path const& wasm_path,
+                                ::std::filesystem::path const& artifact_dir,
+                                profile_mode_t const& mode)
+    {
+        auto const output_path{artifact_dir / (::std::string{mode.name} + ".out")};
+        auto const profile_path{artifact_dir / (::std::string{mode.name} + ".json")};
+        auto const command{quote_argument(uwvm_path) + " " + mode.args + " --runtime-function-profile json " + quote_argument(profile_path) + " --run " +
+                           quote_argument(wasm_path) + " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[function-profile-frameless] " << command << '\n';
+
+        if(run_system_command(command) != 0)
+        {
+            ::std::cerr << "profiled run failed for " << mode.name << "; output=" << output_path << '\n';
+            return false;
+        }
+
+        ::std::string profile{};
+        if(!read_text_file(profile_path, profile)) { return false; }
+
+        auto const calls{calls_for(profile, "work")};
+        if(calls != static_cast<long long>(expected_work_calls))
+        {
+            ::std::cerr << mode.name << ": expected " << expected_work_calls << " calls to work, profile reports " << calls << "; profile=" << profile_path
+                        << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0013.uwvm_int" / "uwvm_int_function_profile_frameless_wat"};
+
+    // The option only exists in builds configured with `--enable-runtime-function-profile=y`.
+    auto const help_path{artifact_dir / "help.out"};
+    ::std::error_code ec{};
+    ::std::filesystem::create_directories(artifact_dir, ec);
+    static_cast<void>(run_system_command(quote_argument(uwvm_path) + " --help runtime > " + quote_argument(help_path) + " 2>&1"));
+    ::std::string help{};
+    if(!read_text_file(help_path, help)) { return 1; }
+    if(help.find("--runtime-function-profile") == ::std::string::npos)
+    {
+        ::std::cout << "[function-profile-frameless] skip: uwvm was built without --enable-runtime-function-profile\n";
+        return 0;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[function-profile-frameless] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const wat_path{artifact_dir / "function_profile.wat"};
+    auto const wasm_path{artifact_dir / "function_profile.wasm"};
+    if(!write_text_file(wat_path, function_profile_wat)) { return 1; }
+
+    // Keep the name section so the profile row is `"name":"work"`.
+    auto const compile_command{quote_argument(wat2wasm_path) + " --debug-names " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+    ::std::cout << "[function-profile-frameless] " << compile_command << '\n';
+    if(!command_succeeds(compile_command))
+    {
+        ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+        return 1;
+    }
+
+    // Full mode is where frameless local calls are emitted; lazy mode always goes through the bridge and serves as the reference.
+    ::std::vector<profile_mode_t> const modes{
+        {"u2_full", "-Rcc int -Rcm full"},
+        {"u2_lazy", "-Rcc int -Rcm lazy"},
+    };
+
+    bool ok{true};
+    for(auto const& mode: modes)
+    {
+        if(!run_case(uwvm_path, wasm_path, artifact_dir, mode)) { ok = false; }
+    }
+
+    if(ok)
+    {
+        ::std::cout << "[function-profile-frameless] every same-module call is counted in full and lazy mode\n";
+        return 0;
+    }
+
+    return 1;
+}
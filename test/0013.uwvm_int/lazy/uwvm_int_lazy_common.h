@@ -78,7 +78,7 @@ namespace uwvm2test::uwvm_int_lazy
     }
 
     inline void UWVM2TEST_INTERPRETER_ABI
-        terminate_call_indirect_callback(::std::size_t, ::std::size_t, ::std::size_t, ::std::byte**) noexcept
+        terminate_call_indirect_callback(::std::size_t, ::std::size_t, ::std::size_t, optable::call_indirect_inline_cache_t*, ::std::byte**) noexcept
     {
         ::fast_io::fast_terminate();
     }
@@ -241,6 +241,7 @@ namespace uwvm2test::uwvm_int_lazy
     inline void runner_call_indirect_bridge(::std::size_t wasm_module_id,
                                             ::std::size_t type_index,
                                             ::std::size_t table_index,
+                                            optable::call_indirect_inline_cache_t*,
                                             ::std::byte** stack_top_ptr) UWVM_THROWS
     {
         if(g_call_indirect_runtime_module == nullptr || g_call_indirect_lazy_module == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
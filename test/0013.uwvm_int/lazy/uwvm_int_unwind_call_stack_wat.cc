@@ -0,0 +1,420 @@
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct stack_case_t
+    {
+        char const* name;
+        // Innermost frame first.  Empty means only the logical/unwind comparison is checked.
+        ::std::vector<::std::size_t> expected_funcs;
+        ::std::string_view wat;
+    };
+
+    struct mode_t
+    {
+        char const* name;
+        char const* args;
+    };
+
+    struct run_result_t
+    {
+        bool valid{};
+        ::std::vector<::std::size_t> func_indices{};
+        ::std::filesystem::path output_path{};
+    };
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    [[nodiscard]] ::std::string strip_ansi_codes(::std::string_view text)
+    {
+        ::std::string out{};
+        out.reserve(text.size());
+
+        for(::std::size_t i{}; i != text.size();)
+        {
+            if(text[i] == '\x1b' && i + 1uz < text.size() && text[i + 1uz] == '[')
+            {
+                i += 2uz;
+                while(i != text.size())
+                {
+                    auto const ch{text[i++]};
+                    if(ch >= '@' && ch <= '~') { break; }
+                }
+                continue;
+            }
+
+            out.push_back(text[i++]);
+        }
+
+        return out;
+    }
+
+    [[nodiscard]] ::std::vector<::std::size_t> parse_func_indices(::std::string_view plain_output)
+    {
+        ::std::vector<::std::size_t> result{};
+        constexpr ::std::string_view prefix{" func_idx="};
+        ::std::size_t pos{};
+
+        for(;;)
+        {
+            pos = plain_output.find(prefix, pos);
+            if(pos == ::std::string_view::npos) { return result; }
+            pos += prefix.size();
+
+            while(pos != plain_output.size() && (plain_output[pos] < '0' || plain_output[pos] > '9')) { ++pos; }
+
+            ::std::size_t value{};
+            auto const value_begin{pos};
+            while(pos != plain_output.size())
+            {
+                auto const ch{plain_output[pos]};
+                if(ch < '0' || ch > '9') { break; }
+                value = value * 10uz + static_cast<::std::size_t>(ch - '0');
+                ++pos;
+            }
+
+            if(pos != value_begin) { result.push_back(value); }
+        }
+    }
+
+    inline constexpr ::std::string_view direct_chain_wat{R"((module
+  (type $v (func))
+  (func $leaf (type $v) unreachable)
+  (func $mid (type $v) call $leaf)
+  (func $top (type $v) call $mid)
+  (func $_start (export "_start") (type $v) call $top))
+)"};
+
+    inline constexpr ::std::string_view indirect_chain_wat{R"((module
+  (type $v (func))
+  (table 1 funcref)
+  (elem (i32.const 0) $leaf)
+  (func $leaf (type $v) unreachable)
+  (func $mid (type $v) i32.const 0 call_indirect (type $v))
+  (func $top (type $v) call $mid)
+  (func $_start (export "_start") (type $v) call $top))
+)"};
+
+    // Calls that returned normally must leave no record behind, or they would show up in the later trap.
+    inline constexpr ::std::string_view after_returns_wat{R"((module
+  (type $v (func))
+  (type $i (func (param i32) (result i32)))
+  (func $leaf (type $v) unreachable)
+  (func $mid (type $v) call $leaf)
+  (func $top (type $v) call $mid)
+  (func $ok_leaf (type $i) (param i32) (result i32) local.get 0 i32.const 1 i32.add)
+  (func $ok (type $i) (param i32) (result i32) local.get 0 call $ok_leaf call $ok_leaf)
+  (func $_start (export "_start") (type $v)
+    (local $i i32)
+    block $exit
+      loop $calls
+        local.get $i
+        i32.const 64
+        i32.ge_u
+        br_if $exit
+        local.get $i
+        call $ok
+        local.set $i
+        br $calls
+      end
+    end
+    call $top))
+)"};
+
+    // Deeper than the per-thread record stack, so unwind mode runs out of records and falls back to logical frames mid-stack.
+    inline constexpr ::std::string_view deep_recursion_wat{R"((module
+  (type $v (func))
+  (type $i (func (param i32)))
+  (func $rec (type $i) (param $n i32)
+    local.get $n
+    i32.eqz
+    if
+      unreachable
+    end
+    local.get $n
+    i32.const 1
+    i32.sub
+    call $rec)
+  (func $_start (export "_start") (type $v)
+    i32.const 9000
+    call $rec))
+)"};
+
+    [[nodiscard]] ::std::vector<stack_case_t> make_cases()
+    {
+        return {
+            {"direct_chain",   {0uz, 1uz, 2uz, 3uz}, direct_chain_wat  },
+            {"indirect_chain", {0uz, 1uz, 2uz, 3uz}, indirect_chain_wat},
+            {"after_returns",  {0uz, 1uz, 2uz, 5uz}, after_returns_wat },
+            {"deep_recursion", {},                   deep_recursion_wat},
+        };
+    }
+
+    inline constexpr ::std::array modes{
+        mode_t{"lazy", "-Rcc int -Rcm lazy"},
+        mode_t{"full", "-Rcc int -Rcm full"},
+    };
+
+    [[nodiscard]] run_result_t run_case(::std::filesystem::path const& uwvm_path,
+                                        ::std::filesystem::path const& wasm_path,
+                                        ::std::filesystem::path const& artifact_dir,
+                                        char const* stem,
+                                        mode_t const& mode,
+                                        char const* call_stack)
+    {
+        auto const output_path{artifact_dir / (::std::string{stem} + "." + mode.name + "." + call_stack + ".out")};
+        auto const command{quote_argument(uwvm_path) + " " + mode.args + " -Rint-call-stack " + call_stack + " --run " + quote_argument(wasm_path) +
+                           " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[uwvm-int-unwind-stack] " << command << '\n';
+
+        if(run_system_command(command) == 0)
+        {
+            ::std::cerr << "trap command unexpectedly succeeded: " << stem << '/' << mode.name << '/' << call_stack << '\n';
+            return {.output_path = output_path};
+        }
+
+        ::std::string output{};
+        if(!read_text_file(output_path, output)) { return {.output_path = output_path}; }
+
+        auto const plain_output{strip_ansi_codes(output)};
+        auto funcs{parse_func_indices(plain_output)};
+        auto const valid{plain_output.find("Runtime crash (") != ::std::string::npos && !funcs.empty()};
+        if(!valid)
+        {
+            ::std::cerr << "failed to parse trap output for " << stem << '/' << mode.name << '/' << call_stack << ":\n" << output << '\n';
+        }
+
+        return {.valid = valid, .func_indices = ::std::move(funcs), .output_path = output_path};
+    }
+
+    void print_funcs(::std::ostream& out, ::std::vector<::std::size_t> const& funcs)
+    {
+        out << '[';
+        for(::std::size_t i{}; i != funcs.size(); ++i)
+        {
+            if(i != 0uz) { out << ','; }
+            out << funcs[i];
+        }
+        out << ']';
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[uwvm-int-unwind-stack] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0013.uwvm_int" / "unwind_call_stack_wat"};
+
+    bool ok{true};
+    for(auto const& test_case: make_cases())
+    {
+        auto const wat_path{artifact_dir / (::std::string{test_case.name} + ".wat")};
+        auto const wasm_path{artifact_dir / (::std::string{test_case.name} + ".wasm")};
+        if(!write_text_file(wat_path, test_case.wat)) { return 1; }
+
+        auto const compile_command{quote_argument(wat2wasm_path) + " " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+        ::std::cout << "[uwvm-int-unwind-stack] " << compile_command << '\n';
+        if(!command_succeeds(compile_command))
+        {
+            ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+            return 1;
+        }
+
+        for(auto const& mode: modes)
+        {
+            auto const logical{run_case(uwvm_path, wasm_path, artifact_dir, test_case.name, mode, "logical")};
+            auto const unwind{run_case(uwvm_path, wasm_path, artifact_dir, test_case.name, mode, "unwind")};
+
+            if(!test_case.expected_funcs.empty() && logical.valid && logical.func_indices != test_case.expected_funcs)
+            {
+                ok = false;
+                ::std::cerr << "[uwvm-int-unwind-stack] logical baseline mismatch for " << test_case.name << '/' << mode.name << " expected=";
+                print_funcs(::std::cerr, test_case.expected_funcs);
+                ::std::cerr << " actual=";
+                print_funcs(::std::cerr, logical.func_indices);
+                ::std::cerr << " output=" << logical.output_path << '\n';
+            }
+
+            if(!logical.valid || !unwind.valid || unwind.func_indices != logical.func_indices)
+            {
+                ok = false;
+                ::std::cerr << "[uwvm-int-unwind-stack] unwind backtrace differs from logical for " << test_case.name << '/' << mode.name << '\n';
+                ::std::cerr << "  logical=";
+                print_funcs(::std::cerr, logical.func_indices);
+                ::std::cerr << " output=" << logical.output_path << '\n';
+                ::std::cerr << "  unwind=";
+                print_funcs(::std::cerr, unwind.func_indices);
+                ::std::cerr << " output=" << unwind.output_path << '\n';
+            }
+        }
+    }
+
+    if(ok)
+    {
+        ::std::cout << "[uwvm-int-unwind-stack] unwind-mode trap backtraces matched logical mode\n";
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,207 @@
+#include "../uwvm_int_translate_strict_common.h"
+
+namespace
+{
+    using namespace ::uwvm2test::uwvm_int_strict;
+
+    [[nodiscard]] byte_vec build_frameless_call_module()
+    {
+        module_builder mb{};
+
+        auto op = [&](byte_vec& c, wasm_op o) { append_u8(c, u8(o)); };
+        auto u32 = [&](byte_vec& c, ::std::uint32_t v) { append_u32_leb(c, v); };
+        auto i32 = [&](byte_vec& c, ::std::int32_t v) { append_i32_leb(c, v); };
+
+        // 0: mix(a, b) => t = a*b; t + a - b  (uses a declared local, so the trivial matcher does not claim it)
+        {
+            func_type ty{{k_val_i32, k_val_i32}, {k_val_i32}};
+            func_body fb{};
+            fb.locals.push_back({1u, k_val_i32});
+            auto& c = fb.code;
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::local_get);
+            u32(c, 1u);
+            op(c, wasm_op::i32_mul);
+            op(c, wasm_op::local_set);
+            u32(c, 2u);
+            op(c, wasm_op::local_get);
+            u32(c, 2u);
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i32_add);
+            op(c, wasm_op::local_get);
+            u32(c, 1u);
+            op(c, wasm_op::i32_sub);
+            op(c, wasm_op::end);
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        // 1: nest(x) => mix(x, mix(x, 3))
+        {
+            func_type ty{{k_val_i32}, {k_val_i32}};
+            func_body fb{};
+            auto& c = fb.code;
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::local_get);
+            u32(c, 0u);
+            op(c, wasm_op::i32_const);
+            i32(c, 3);
+            op(c, wasm_op::call);
+            u32(c, 0u);
+            op(c, wasm_op::call);
+            u32(c, 0u);
+            op(c, wasm_op::end);
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        // 2: entry() => nest(5) + 1 == 74
+        {
+            func_type ty{{}, {k_val_i32}};
+            func_body fb{};
+            auto& c = fb.code;
+            op(c, wasm_op::i32_const);
+            i32(c, 5);
+            op(c, wasm_op::call);
+            u32(c, 1u);
+            op(c, wasm_op::i32_const);
+            i32(c, 1);
+            op(c, wasm_op::i32_add);
+            op(c, wasm_op::end);
+            (void)mb.add_func(::std::move(ty), ::std::move(fb));
+        }
+
+        return mb.build();
+    }
+
+    constexpr optable::uwvm_interpreter_translate_option_t k_frameless_opt{.is_tail_call = true};
+
+    inline ::std::size_t g_bridge_calls{};
+
+    // Fallback bridge: runs the callee through a fresh native dispatch, as the runtime bridge does when a frameless frame cannot be built.
+    static void UWVM2TEST_WASM_ABI frameless_fallback_call_bridge(::std::size_t wasm_module_id, ::std::size_t call_function, ::std::byte** stack_top_ptr)
+        UWVM_THROWS
+    {
+        if(wasm_module_id != SIZE_MAX || stack_top_ptr == nullptr || *stack_top_ptr == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        auto const* const info{reinterpret_cast<optable::compiled_defined_call_info const*>(call_function)};
+        if(info == nullptr || info->compiled_func == nullptr || info->runtime_func == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+        ++g_bridge_calls;
+
+        auto const args_begin{*stack_top_ptr - info->param_bytes};
+        byte_vec params(info->param_bytes);
+        if(info->param_bytes != 0uz) { ::std::memcpy(params.data(), args_begin, info->param_bytes); }
+
+        auto rr = interpreter_runner<k_frameless_opt>::run(*info->compiled_func,
+                                                           *static_cast<runtime_local_func_t const*>(info->runtime_func),
+                                                           params,
+                                                           nullptr,
+                                                           nullptr);
+        if(rr.results.size() != info->result_bytes) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(info->result_bytes != 0uz) { ::std::memcpy(args_begin, rr.results.data(), info->result_bytes); }
+        *stack_top_ptr = args_begin + info->result_bytes;
+    }
+
+    [[nodiscard]] int test_translate_call_frameless() noexcept
+    {
+        install_unexpected_traps();
+
+        optable::call_func = frameless_fallback_call_bridge;
+        optable::call_indirect_func = strict_terminate_call_indirect;
+
+        auto wasm = build_frameless_call_module();
+        auto prep = prepare_runtime_from_wasm(wasm, u8"uwvm2test_call_frameless");
+        UWVM2TEST_REQUIRE(prep.mod != nullptr);
+        runtime_module_t const& rt = *prep.mod;
+
+        ::uwvm2::validation::error::code_validation_error_impl err{};
+        optable::compile_option cop{};
+        cop.frameless_local_calls = true;
+        auto cm = compiler::compile_all_from_uwvm_single_func<k_frameless_opt>(rt, cop, err);
+        UWVM2TEST_REQUIRE(err.err_code == ::uwvm2::validation::error::code_validation_error_code::ok);
+        UWVM2TEST_REQUIRE(cm.local_defined_call_info.index_unchecked(0).trivial_kind == optable::trivial_defined_call_kind::none);
+
+        constexpr optable::uwvm_interpreter_stacktop_currpos_t curr{};
+        constexpr auto tuple = compiler::details::make_interpreter_tuple<k_frameless_opt>(
+            ::std::make_index_sequence<compiler::details::interpreter_tuple_size<k_frameless_opt>()>{});
+        constexpr auto exp_frameless = optable::translate::get_uwvmint_call_frameless_fptr_from_tuple<k_frameless_opt>(curr, tuple);
+        constexpr auto exp_bridge_call = optable::translate::get_uwvmint_call_fptr_from_tuple<k_frameless_opt>(curr, tuple);
+
+        // Local calls use the frameless opfunc; the bridge `call` is not emitted for them.
+        UWVM2TEST_REQUIRE(bytecode_contains_fptr(cm.local_funcs.index_unchecked(1).op.operands, exp_frameless));
+        UWVM2TEST_REQUIRE(!bytecode_contains_fptr(cm.local_funcs.index_unchecked(1).op.operands, exp_bridge_call));
+        UWVM2TEST_REQUIRE(bytecode_contains_fptr(cm.local_funcs.index_unchecked(2).op.operands, exp_frameless));
+
+        // Without the compile option the translator keeps the bridge call.
+        {
+            ::uwvm2::validation::error::code_validation_error_impl err2{};
+            optable::compile_option cop2{};
+            auto cm2 = compiler::compile_all_from_uwvm_single_func<k_frameless_opt>(rt, cop2, err2);
+            UWVM2TEST_REQUIRE(err2.err_code == ::uwvm2::validation::error::code_validation_error_code::ok);
+            UWVM2TEST_REQUIRE(!bytecode_contains_fptr(cm2.local_funcs.index_unchecked(1).op.operands, exp_frameless));
+        }
+
+        using Runner = interpreter_runner<k_frameless_opt>;
+
+#if defined(UWVM_USE_THREAD_LOCAL) && !defined(UWVM2TEST_RUNNER_USE_LLVM_JIT)
+        alignas(16) static ::std::byte region[4096]{};
+        static optable::frameless_call_record_t records[8]{};
+        auto& fs{optable::frameless_call_stack};
+
+        // Provisioned stack: both nested calls stay inside the dispatch chain and never reach the bridge.
+        fs = {.region_begin = region,
+              .region_curr = region,
+              .region_end = region + sizeof(region),
+              .records_begin = records,
+              .records_curr = records,
+              .records_end = records + 8};
+        g_bridge_calls = 0uz;
+        {
+            auto rr = Runner::run(cm.local_funcs.index_unchecked(2),
+                                  rt.local_defined_function_vec_storage.index_unchecked(2),
+                                  pack_no_params(),
+                                  nullptr,
+                                  nullptr);
+            UWVM2TEST_REQUIRE(load_i32(rr.results) == 74);
+        }
+        UWVM2TEST_REQUIRE(g_bridge_calls == 0uz);
+        UWVM2TEST_REQUIRE(fs.records_curr == fs.records_begin);
+        UWVM2TEST_REQUIRE(fs.region_curr == fs.region_begin);
+
+        // One record only: the inner call inside `nest` declines and goes through the bridge; the outer frame still resumes correctly.
+        fs.records_end = records + 1;
+        g_bridge_calls = 0uz;
+        {
+            auto rr = Runner::run(cm.local_funcs.index_unchecked(2),
+                                  rt.local_defined_function_vec_storage.index_unchecked(2),
+                                  pack_no_params(),
+                                  nullptr,
+                                  nullptr);
+            UWVM2TEST_REQUIRE(load_i32(rr.results) == 74);
+        }
+        UWVM2TEST_REQUIRE(g_bridge_calls == 2uz);
+        UWVM2TEST_REQUIRE(fs.records_curr == fs.records_begin);
+        UWVM2TEST_REQUIRE(fs.region_curr == fs.region_begin);
+
+        fs = {};
+#endif
+
+        // Unprovisioned stack: every frameless call falls back to the bridge.
+        {
+            auto rr = Runner::run(cm.local_funcs.index_unchecked(2),
+                                  rt.local_defined_function_vec_storage.index_unchecked(2),
+                                  pack_no_params(),
+                                  nullptr,
+                                  nullptr);
+            UWVM2TEST_REQUIRE(load_i32(rr.results) == 74);
+        }
+
+        return 0;
+    }
+}  // namespace
+
+int main()
+{
+    return test_translate_call_frameless();
+}
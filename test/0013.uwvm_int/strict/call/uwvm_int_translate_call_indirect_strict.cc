@@ -90,6 +90,7 @@ namespace
     static void UWVM2TEST_WASM_ABI call_indirect_bridge(::std::size_t /*wasm_module_id*/,
                                                         ::std::size_t type_index,
                                                         ::std::size_t table_index,
+                                                        optable::call_indirect_inline_cache_t* inline_cache,
                                                         ::std::byte** stack_top_ptr) UWVM_THROWS
     {
         auto die = [&](char const* msg) noexcept
@@ -100,6 +101,15 @@ namespace
 
         if(g_rt == nullptr || g_cm == nullptr) [[unlikely]] { die("g_rt/g_cm is null"); }
         if(stack_top_ptr == nullptr || *stack_top_ptr == nullptr) [[unlikely]] { die("stack_top_ptr is null"); }
+        // Every call_indirect variant must hand the bridge its own aligned, still-empty per-site slot (this bridge never fills it).
+        if(inline_cache == nullptr || reinterpret_cast<::std::uintptr_t>(inline_cache) % alignof(optable::call_indirect_inline_cache_t) != 0u) [[unlikely]]
+        {
+            die("inline_cache slot is null or misaligned");
+        }
+        for(auto const way: inline_cache->ways)
+        {
+            if(way != 0u) [[unlikely]] { die("inline_cache slot is not zero-initialized"); }
+        }
 
         // Pop selector index (i32) - Wasm stack layout: [args..., idx]
         wasm_i32 selector_i32{};  // init
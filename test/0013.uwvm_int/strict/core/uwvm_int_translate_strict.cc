@@ -136,6 +136,7 @@ namespace
     inline void UWVM2TEST_WASM_ABI unexpected_call_indirect(::std::size_t wasm_module_id,
                                                                             ::std::size_t type_index,
                                                                             ::std::size_t table_index,
+                                                                            optable::call_indirect_inline_cache_t*,
                                                                             ::std::byte**) UWVM_THROWS
     {
         ::std::fprintf(stderr,
@@ -159,6 +159,7 @@ namespace
     static void UWVM2TEST_WASM_ABI call_indirect_bridge(::std::size_t /*wasm_module_id*/,
                                                         ::std::size_t type_index,
                                                         ::std::size_t table_index,
+                                                        optable::call_indirect_inline_cache_t*,
                                                         ::std::byte** stack_top_ptr) UWVM_THROWS
     {
         if(g_rt == nullptr || g_cm == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
@@ -89,7 +89,8 @@ namespace uwvm2test::uwvm_int_strict
         ::fast_io::fast_terminate();
     }
 
-    inline void UWVM2TEST_WASM_ABI strict_terminate_call_indirect(::std::size_t, ::std::size_t, ::std::size_t, ::std::byte**) UWVM_THROWS
+    inline void UWVM2TEST_WASM_ABI
+        strict_terminate_call_indirect(::std::size_t, ::std::size_t, ::std::size_t, optable::call_indirect_inline_cache_t*, ::std::byte**) UWVM_THROWS
     {
         ::fast_io::fast_terminate();
     }
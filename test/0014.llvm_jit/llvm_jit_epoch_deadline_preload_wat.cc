@@ -0,0 +1,385 @@
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct epoch_mode_t
+    {
+        char const* name;
+        char const* args;
+    };
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    [[nodiscard]] ::std::string find_c_compiler()
+    {
+        if(auto const env{::std::getenv("CC")}; env != nullptr && *env != '\0') { return env; }
+        if(command_succeeds("cc --version > /dev/null 2>&1")) { return "cc"; }
+        return {};
+    }
+
+    // The plugin owns the epoch clock: with `--wasm-timeout 0` nothing else advances it.  `arm_expired` puts the deadline one tick
+    // ahead and takes that tick, so the next check in the guest must trap; `arm_pending` leaves the deadline one tick away.
+    inline constexpr ::std::string_view epoch_plugin_c{R"plugin(#include "interface.h"
+
+static uwvm_preload_host_api_v1 const* g_preload_host_api;
+
+static char const module_name_str[] = "epoch.test";
+static char const func_arm_expired_name[] = "arm_expired";
+static char const func_arm_pending_name[] = "arm_pending";
+
+static int epoch_api_available(void)
+{
+    return g_preload_host_api != 0 && g_preload_host_api->abi_version == UWVM_EXAMPLE_PRELOAD_HOST_API_V1_ABI_VERSION &&
+           g_preload_host_api->struct_size >= sizeof(*g_preload_host_api);
+}
+
+static void arm_expired_impl(unsigned char* res_bytes, unsigned char* para_bytes)
+{
+    (void)res_bytes;
+    (void)para_bytes;
+    if(!epoch_api_available()) { return; }
+    g_preload_host_api->epoch_set_deadline(1u);
+    g_preload_host_api->epoch_increment();
+}
+
+static void arm_pending_impl(unsigned char* res_bytes, unsigned char* para_bytes)
+{
+    (void)res_bytes;
+    (void)para_bytes;
+    if(!epoch_api_available()) { return; }
+    g_preload_host_api->epoch_set_deadline(2u);
+    g_preload_host_api->epoch_increment();
+}
+
+void uwvm_set_preload_host_api_v1(uwvm_preload_host_api_v1 const* api) { g_preload_host_api = api; }
+
+capi_module_name_t uwvm_get_module_name(void)
+{
+    capi_module_name_t ret;
+    ret.name = module_name_str;
+    ret.name_length = sizeof(module_name_str) - 1u;
+    return ret;
+}
+
+capi_function_vec_t uwvm_function(void)
+{
+    static capi_function_t const functions[] = {
+        {func_arm_expired_name, sizeof(func_arm_expired_name) - 1u, 0, 0u, 0, 0u, &arm_expired_impl},
+        {func_arm_pending_name, sizeof(func_arm_pending_name) - 1u, 0, 0u, 0, 0u, &arm_pending_impl},
+    };
+    capi_function_vec_t ret;
+    ret.function_begin = functions;
+    ret.function_size = sizeof(functions) / sizeof(functions[0]);
+    return ret;
+}
+)plugin"};
+
+    // After `arm_expired` the only check left on the path is the loop header, so this never returns unless loop headers poll the epoch.
+    inline constexpr ::std::string_view expired_wat{R"((module
+  (import "epoch.test" "arm_expired" (func $arm_expired))
+  (func $_start (export "_start")
+    call $arm_expired
+    loop $spin
+      br $spin
+    end))
+)"};
+
+    // Control: the deadline is still one tick away, so the same kind of loop, bounded this time, must run to completion.
+    inline constexpr ::std::string_view pending_wat{R"((module
+  (import "epoch.test" "arm_pending" (func $arm_pending))
+  (func $_start (export "_start")
+    (local $i i32)
+    call $arm_pending
+    loop $spin
+      local.get $i
+      i32.const 1
+      i32.add
+      local.tee $i
+      i32.const 100000
+      i32.lt_u
+      br_if $spin
+    end))
+)"};
+
+    inline constexpr ::std::string_view epoch_trap_pattern{"epoch deadline reached"};
+
+    [[nodiscard]] bool compile_wat(::std::filesystem::path const& wat2wasm_path,
+                                   ::std::filesystem::path const& wat_path,
+                                   ::std::filesystem::path const& wasm_path,
+                                   ::std::string_view wat)
+    {
+        if(!write_text_file(wat_path, wat)) { return false; }
+
+        auto const compile_command{quote_argument(wat2wasm_path) + " " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+        ::std::cout << "[epoch-deadline] " << compile_command << '\n';
+        if(!command_succeeds(compile_command))
+        {
+            ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool run_case(::std::filesystem::path const& uwvm_path,
+                                ::std::filesystem::path const& plugin_path,
+                                ::std::filesystem::path const& wasm_path,
+                                ::std::filesystem::path const& artifact_dir,
+                                epoch_mode_t const& mode,
+                                char const* case_name,
+                                bool expect_trap)
+    {
+        auto const output_path{artifact_dir / (::std::string{mode.name} + "." + case_name + ".out")};
+        auto const command{quote_argument(uwvm_path) + " " + mode.args + " -Rllvm-cache-path disable --wasm-timeout 0 --wasm-register-dl " +
+                           quote_argument(plugin_path) + " epoch.test --run " + quote_argument(wasm_path) + " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[epoch-deadline] " << command << '\n';
+
+        auto const status{run_system_command(command)};
+
+        ::std::string output{};
+        if(!read_text_file(output_path, output)) { return false; }
+        bool const trapped{output.find(epoch_trap_pattern) != ::std::string::npos};
+
+        if(expect_trap)
+        {
+            if(status == 0 || !trapped)
+            {
+                ::std::cerr << "expected an epoch deadline trap for " << mode.name << "." << case_name << "; output=" << output_path << '\n';
+                return false;
+            }
+        }
+        else if(status != 0 || trapped)
+        {
+            ::std::cerr << "unexpected failure for " << mode.name << "." << case_name << "; output=" << output_path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+#ifdef _WIN32
+    ::std::cout << "[epoch-deadline] skip: the preload plugin is only built with a POSIX C compiler\n";
+    return 0;
+#else
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[epoch-deadline] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const c_compiler{find_c_compiler()};
+    if(c_compiler.empty())
+    {
+        ::std::cout << "[epoch-deadline] skip: no C compiler found; set CC or put cc in PATH\n";
+        return 0;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.llvm_jit" / "llvm_jit_epoch_deadline_preload_wat"};
+    auto const plugin_source_path{artifact_dir / "epoch_plugin.c"};
+# ifdef __APPLE__
+    auto const plugin_path{artifact_dir / "libepoch_plugin.dylib"};
+    constexpr char const* shared_flags{"-dynamiclib"};
+# else
+    auto const plugin_path{artifact_dir / "libepoch_plugin.so"};
+    constexpr char const* shared_flags{"-shared -fPIC"};
+# endif
+    if(!write_text_file(plugin_source_path, epoch_plugin_c)) { return 1; }
+
+    // The plugin reuses the example ABI header rather than restating the host API layout.
+    auto const plugin_command{c_compiler + " -std=c17 " + shared_flags + " -I" + quote_argument(project_root / "examples" / "0002.dl") + " " +
+                              quote_argument(plugin_source_path) + " -o " + quote_argument(plugin_path)};
+    ::std::cout << "[epoch-deadline] " << plugin_command << '\n';
+    if(!command_succeeds(plugin_command))
+    {
+        ::std::cerr << "failed to build the epoch preload plugin from " << plugin_source_path << '\n';
+        return 1;
+    }
+
+    auto const expired_wasm_path{artifact_dir / "expired.wasm"};
+    auto const pending_wasm_path{artifact_dir / "pending.wasm"};
+    if(!compile_wat(wat2wasm_path, artifact_dir / "expired.wat", expired_wasm_path, expired_wat)) { return 1; }
+    if(!compile_wat(wat2wasm_path, artifact_dir / "pending.wat", pending_wasm_path, pending_wat)) { return 1; }
+
+    ::std::vector<epoch_mode_t> const modes{
+        {"u2_full",   "-Rcc int -Rcm full"},
+        {"u2_lazy",   "-Rcc int -Rcm lazy"},
+        {"llvm_full", "-Rcm full -Rcc jit"},
+        {"llvm_lazy", "-Rjit"             },
+    };
+
+    bool ok{true};
+    for(auto const& mode: modes)
+    {
+        if(!run_case(uwvm_path, plugin_path, expired_wasm_path, artifact_dir, mode, "expired", true)) { ok = false; }
+        if(!run_case(uwvm_path, plugin_path, pending_wasm_path, artifact_dir, mode, "pending", false)) { ok = false; }
+    }
+
+    if(ok)
+    {
+        ::std::cout << "[epoch-deadline] u2 and llvm trap at the loop header once the plugin-armed deadline is reached\n";
+        return 0;
+    }
+
+    return 1;
+#endif
+}
@@ -0,0 +1,326 @@
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct fuel_mode_t
+    {
+        char const* name;
+        char const* args;
+    };
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+
+    inline constexpr unsigned call_count{1000u};
+
+    // `$inc` matches the interpreter's trivial-call shape (`local.get 0; i32.const 1; i32.add`), so an unmetered u2 call bridge would run
+    // it without entering the body.  Metered runs must still charge its entry: `_start` costs 1, and each iteration costs 1 for the loop
+    // header plus 1 for `$inc`.
+    inline constexpr ::std::string_view fuel_parity_wat{R"((module
+  (func $inc (param i32) (result i32)
+    local.get 0
+    i32.const 1
+    i32.add)
+
+  (func $_start (export "_start")
+    (local $i i32)
+    (local $acc i32)
+    loop $calls
+      local.get $acc
+      call $inc
+      local.set $acc
+      local.get $i
+      i32.const 1
+      i32.add
+      local.tee $i
+      i32.const 1000
+      i32.lt_u
+      br_if $calls
+    end
+    local.get $acc
+    i32.const 1000
+    i32.ne
+    if
+      unreachable
+    end))
+)"};
+
+    inline constexpr ::std::string_view fuel_trap_pattern{"fuel exhausted"};
+
+    enum class fuel_outcome_t : unsigned
+    {
+        completed,
+        fuel_exhausted,
+        failed
+    };
+
+    [[nodiscard]] fuel_outcome_t run_with_fuel(::std::filesystem::path const& uwvm_path,
+                                               ::std::filesystem::path const& wasm_path,
+                                               ::std::filesystem::path const& artifact_dir,
+                                               fuel_mode_t const& mode,
+                                               unsigned fuel)
+    {
+        auto const stem{::std::string{mode.name} + ".fuel" + ::std::to_string(fuel)};
+        auto const output_path{artifact_dir / (stem + ".out")};
+        auto const command{quote_argument(uwvm_path) + " " + mode.args + " -Rllvm-cache-path disable -Rfuel " + ::std::to_string(fuel) + " --run " +
+                           quote_argument(wasm_path) + " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[fuel-parity] " << command << '\n';
+
+        auto const status{run_system_command(command)};
+        if(status == 0) { return fuel_outcome_t::completed; }
+
+        ::std::string output{};
+        if(!read_text_file(output_path, output)) { return fuel_outcome_t::failed; }
+        if(output.find(fuel_trap_pattern) != ::std::string::npos) { return fuel_outcome_t::fuel_exhausted; }
+
+        ::std::cerr << "run neither completed nor ran out of fuel: " << stem << "; output=" << output_path << '\n';
+        return fuel_outcome_t::failed;
+    }
+
+    /// @brief Smallest budget in `[low, high]` that lets the module complete, or 0 when none does or a run failed otherwise.
+    [[nodiscard]] unsigned find_fuel_threshold(::std::filesystem::path const& uwvm_path,
+                                               ::std::filesystem::path const& wasm_path,
+                                               ::std::filesystem::path const& artifact_dir,
+                                               fuel_mode_t const& mode,
+                                               unsigned low,
+                                               unsigned high)
+    {
+        for(auto fuel{low}; fuel <= high; ++fuel)
+        {
+            switch(run_with_fuel(uwvm_path, wasm_path, artifact_dir, mode, fuel))
+            {
+                case fuel_outcome_t::completed: return fuel;
+                case fuel_outcome_t::fuel_exhausted: break;
+                case fuel_outcome_t::failed: return 0u;
+            }
+        }
+
+        ::std::cerr << "no budget in [" << low << ", " << high << "] completed for " << mode.name << '\n';
+        return 0u;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[fuel-parity] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.llvm_jit" / "llvm_jit_fuel_parity_wat"};
+    auto const wat_path{artifact_dir / "fuel_parity.wat"};
+    auto const wasm_path{artifact_dir / "fuel_parity.wasm"};
+    if(!write_text_file(wat_path, fuel_parity_wat)) { return 1; }
+
+    auto const compile_command{quote_argument(wat2wasm_path) + " " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+    ::std::cout << "[fuel-parity] " << compile_command << '\n';
+    if(!command_succeeds(compile_command))
+    {
+        ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+        return 1;
+    }
+
+    ::std::vector<fuel_mode_t> const modes{
+        {"u2_full",   "-Rcc int -Rcm full"},
+        {"u2_lazy",   "-Rcc int -Rcm lazy"},
+        {"llvm_full", "-Rcm full -Rcc jit"},
+    };
+
+    // Search a window around the documented cost so an off-by-one in either backend shows up as a mismatch rather than a miss.
+    constexpr unsigned expected_fuel{2u * call_count + 1u};
+    constexpr unsigned search_low{expected_fuel - 4u};
+    constexpr unsigned search_high{expected_fuel + 4u};
+
+    bool ok{true};
+    unsigned reference_threshold{};
+    for(auto const& mode: modes)
+    {
+        auto const threshold{find_fuel_threshold(uwvm_path, wasm_path, artifact_dir, mode, search_low, search_high)};
+        if(threshold == 0u)
+        {
+            ok = false;
+            continue;
+        }
+
+        ::std::cout << "[fuel-parity] " << mode.name << " completes with " << threshold << " units\n";
+        if(reference_threshold == 0u) { reference_threshold = threshold; }
+        else if(threshold != reference_threshold)
+        {
+            ::std::cerr << "fuel threshold mismatch: " << mode.name << " needs " << threshold << ", " << modes.front().name << " needs "
+                        << reference_threshold << '\n';
+            ok = false;
+        }
+    }
+
+    if(ok && reference_threshold != expected_fuel)
+    {
+        ::std::cerr << "fuel threshold " << reference_threshold << " differs from the documented cost " << expected_fuel << '\n';
+        ok = false;
+    }
+
+    if(ok)
+    {
+        ::std::cout << "[fuel-parity] u2 and llvm exhaust fuel at the same call\n";
+        return 0;
+    }
+
+    return 1;
+}
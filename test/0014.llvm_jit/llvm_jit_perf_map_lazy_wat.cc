@@ -0,0 +1,285 @@
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    // Under `--runtime-jit` nothing is compiled up front: `$lazy_leaf` only exists as machine code once `_start` first calls it, so its
+    // perf-map line has to come from the object loaded on that lazy path.
+    inline constexpr ::std::string_view perf_map_wat{R"((module $perfmod
+  (func $lazy_leaf (param $x i32) (result i32)
+    local.get $x
+    i32.const 3
+    i32.mul
+    i32.const 1
+    i32.add)
+
+  (func $_start (export "_start")
+    (local $i i32)
+    (local $acc i32)
+    loop $calls
+      local.get $acc
+      call $lazy_leaf
+      local.set $acc
+      local.get $i
+      i32.const 1
+      i32.add
+      local.tee $i
+      i32.const 1000
+      i32.lt_u
+      br_if $calls
+    end))
+)"};
+
+    inline constexpr ::std::string_view lazy_leaf_name{"perfmod::lazy_leaf"};
+
+    [[nodiscard]] bool is_hex(::std::string_view s) noexcept
+    {
+        return !s.empty() && s.find_first_not_of("0123456789abcdefABCDEF") == ::std::string_view::npos;
+    }
+
+    /// @brief True when some line of `map` is exactly `START SIZE perfmod::lazy_leaf` with hex START and a non-zero hex SIZE.
+    [[nodiscard]] bool has_lazy_leaf_line(::std::string const& map)
+    {
+        ::std::istringstream lines{map};
+        for(::std::string line{}; ::std::getline(lines, line);)
+        {
+            ::std::string_view const view{line};
+            auto const first_space{view.find(' ')};
+            if(first_space == ::std::string_view::npos) { continue; }
+            auto const second_space{view.find(' ', first_space + 1uz)};
+            if(second_space == ::std::string_view::npos) { continue; }
+
+            auto const start{view.substr(0uz, first_space)};
+            auto const size{view.substr(first_space + 1uz, second_space - first_space - 1uz)};
+            auto const name{view.substr(second_space + 1uz)};
+            if(name != lazy_leaf_name || !is_hex(start) || !is_hex(size)) { continue; }
+            if(size.find_first_not_of('0') == ::std::string_view::npos) { continue; }
+            return true;
+        }
+
+        return false;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+#ifndef __linux__
+    ::std::cout << "[perf-map-lazy] skip: --runtime-llvm-jit-perf-map is Linux only\n";
+    return 0;
+#else
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[perf-map-lazy] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.llvm_jit" / "llvm_jit_perf_map_lazy_wat"};
+    auto const wat_path{artifact_dir / "perf_map.wat"};
+    auto const wasm_path{artifact_dir / "perf_map.wasm"};
+    if(!write_text_file(wat_path, perf_map_wat)) { return 1; }
+
+    // Keep the name section so the map line reads `perfmod::lazy_leaf` instead of `perf_map::func[0]`.
+    auto const compile_command{quote_argument(wat2wasm_path) + " --debug-names " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+    ::std::cout << "[perf-map-lazy] " << compile_command << '\n';
+    if(!command_succeeds(compile_command))
+    {
+        ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+        return 1;
+    }
+
+    // The map is named after the uwvm process id, so the wrapper script records `$$` and then execs uwvm under that same pid.
+    auto const pid_path{artifact_dir / "uwvm.pid"};
+    auto const output_path{artifact_dir / "run.out"};
+    auto const script_path{artifact_dir / "run.sh"};
+    auto const script{"echo $$ > " + quote_argument(pid_path) + "\nexec " + quote_argument(uwvm_path) +
+                      " -Rjit -Rllvm-cache-path disable -Rllvm-perf-map --run " + quote_argument(wasm_path) + " > " + quote_argument(output_path) +
+                      " 2>&1\n"};
+    if(!write_text_file(script_path, script)) { return 1; }
+
+    auto const command{"sh " + quote_argument(script_path)};
+    ::std::cout << "[perf-map-lazy] " << command << '\n';
+    if(run_system_command(command) != 0)
+    {
+        ::std::cerr << "lazy JIT run failed; output=" << output_path << '\n';
+        return 1;
+    }
+
+    ::std::string pid_text{};
+    if(!read_text_file(pid_path, pid_text)) { return 1; }
+    while(!pid_text.empty() && (pid_text.back() == '\n' || pid_text.back() == '\r')) { pid_text.pop_back(); }
+    ::std::filesystem::path const map_path{"/tmp/perf-" + pid_text + ".map"};
+
+    ::std::string map{};
+    if(!read_text_file(map_path, map)) { return 1; }
+    ::std::error_code ec{};
+    ::std::filesystem::remove(map_path, ec);
+
+    if(!has_lazy_leaf_line(map))
+    {
+        ::std::cerr << "no `START SIZE " << lazy_leaf_name << "` line in the perf map written by pid " << pid_text << "; output=" << output_path
+                    << '\n';
+        return 1;
+    }
+
+    ::std::cout << "[perf-map-lazy] lazily materialized function is named in the perf map\n";
+    return 0;
+#endif
+}
@@ -0,0 +1,338 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct profile_mode_t
+    {
+        char const* name;
+        char const* args;
+    };
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    // `$deep` recurses past the 4096 frames the logical call stack reserves, so the stack vector grows while SIGPROF is armed.  `$burn`
+    // at the bottom is where the CPU time goes, so it is the frame every sampled stack must end in.
+    inline constexpr ::std::string_view sample_profile_wat{R"((module
+  (func $burn (param $n i32) (result i32)
+    (local $acc i32)
+    loop $spin
+      local.get $acc
+      local.get $n
+      i32.xor
+      i32.const 1
+      i32.add
+      local.set $acc
+      local.get $n
+      i32.const 1
+      i32.sub
+      local.tee $n
+      br_if $spin
+    end
+    local.get $acc)
+
+  (func $deep (param $d i32) (result i32)
+    local.get $d
+    i32.eqz
+    if (result i32)
+      i32.const 20000000
+      call $burn
+    else
+      local.get $d
+      i32.const 1
+      i32.sub
+      call $deep
+    end)
+
+  (func $_start (export "_start")
+    (local $round i32)
+    loop $rounds
+      i32.const 5000
+      call $deep
+      drop
+      local.get $round
+      i32.const 1
+      i32.add
+      local.tee $round
+      i32.const 10
+      i32.lt_u
+      br_if $rounds
+    end))
+)"};
+
+    inline constexpr ::std::string_view hot_frame{"::burn"};
+
+    /// @brief Check the folded-stack format: every line is `frame(;frame)* count` with a positive count, and some stack ends in `$burn`.
+    [[nodiscard]] bool check_folded_profile(::std::string const& text, ::std::filesystem::path const& profile_path)
+    {
+        ::std::istringstream lines{text};
+        ::std::size_t stacks{};
+        bool saw_hot_frame{};
+        for(::std::string line{}; ::std::getline(lines, line);)
+        {
+            if(line.empty()) { continue; }
+
+            auto const space{line.rfind(' ')};
+            if(space == ::std::string::npos || space == 0uz || space + 1uz == line.size())
+            {
+                ::std::cerr << "malformed folded line in " << profile_path << ": " << line << '\n';
+                return false;
+            }
+
+            auto const count{::std::string_view{line}.substr(space + 1uz)};
+            if(count.find_first_not_of("0123456789") != ::std::string_view::npos || count == "0")
+            {
+                ::std::cerr << "bad sample count in " << profile_path << ": " << line << '\n';
+                return false;
+            }
+
+            auto const stack{::std::string_view{line}.substr(0uz, space)};
+            if(stack.size() >= hot_frame.size() && stack.substr(stack.size() - hot_frame.size()) == hot_frame) { saw_hot_frame = true; }
+            ++stacks;
+        }
+
+        if(stacks == 0uz)
+        {
+            ::std::cerr << "empty sample profile: " << profile_path << '\n';
+            return false;
+        }
+        if(!saw_hot_frame)
+        {
+            ::std::cerr << "no sampled stack ends in " << hot_frame << ": " << profile_path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool run_case(::std::filesystem::path const& uwvm_path,
+                                ::std::filesystem::path const& wasm_path,
+                                ::std::filesystem::path const& artifact_dir,
+                                profile_mode_t const& mode)
+    {
+        auto const output_path{artifact_dir / (::std::string{mode.name} + ".out")};
+        auto const profile_path{artifact_dir / (::std::string{mode.name} + ".folded")};
+        ::std::error_code ec{};
+        ::std::filesystem::remove(profile_path, ec);
+
+        auto const command{quote_argument(uwvm_path) + " " + mode.args + " -Rllvm-cache-path disable --runtime-sample-profile 997 " +
+                           quote_argument(profile_path) + " --run " + quote_argument(wasm_path) + " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[sample-profile] " << command << '\n';
+
+        if(run_system_command(command) != 0)
+        {
+            ::std::cerr << "sampled run failed for " << mode.name << "; output=" << output_path << '\n';
+            return false;
+        }
+
+        ::std::string profile{};
+        if(!read_text_file(profile_path, profile)) { return false; }
+        return check_folded_profile(profile, profile_path);
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+#ifndef __linux__
+    ::std::cout << "[sample-profile] skip: --runtime-sample-profile is Linux only\n";
+    return 0;
+#else
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[sample-profile] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.llvm_jit" / "llvm_jit_sample_profile_folded_wat"};
+    auto const wat_path{artifact_dir / "sample_profile.wat"};
+    auto const wasm_path{artifact_dir / "sample_profile.wasm"};
+    if(!write_text_file(wat_path, sample_profile_wat)) { return 1; }
+
+    // Keep the name section so folded frames read `module::burn` instead of `module::func[0]`.
+    auto const compile_command{quote_argument(wat2wasm_path) + " --debug-names " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+    ::std::cout << "[sample-profile] " << compile_command << '\n';
+    if(!command_succeeds(compile_command))
+    {
+        ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+        return 1;
+    }
+
+    ::std::vector<profile_mode_t> const modes{
+        {"u2_full",   "-Rcc int -Rcm full"},
+        {"u2_lazy",   "-Rcc int -Rcm lazy"},
+        {"llvm_full", "-Rcm full -Rcc jit"},
+    };
+
+    bool ok{true};
+    for(auto const& mode: modes)
+    {
+        if(!run_case(uwvm_path, wasm_path, artifact_dir, mode)) { ok = false; }
+    }
+
+    if(ok)
+    {
+        ::std::cout << "[sample-profile] folded stacks are well formed and attribute time to the hot frame\n";
+        return 0;
+    }
+
+    return 1;
+#endif
+}
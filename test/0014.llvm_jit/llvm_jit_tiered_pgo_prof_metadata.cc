@@ -0,0 +1,285 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#ifndef UWVM_MODULE
+# include <fast_io.h>
+
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/binfmt.h>
+# include <uwvm2/validation/error/error.h>
+
+# include <uwvm2/runtime/compiler/llvm_jit/compile_all_from_uwvm/impl.h>
+
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/runtime/initializer/init.h>
+# include <uwvm2/uwvm/wasm/feature/impl.h>
+# include <uwvm2/uwvm/wasm/loader/load_and_check_modules.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+
+// callback
+# include <uwvm2/uwvm/cmdline/callback/impl.h>
+
+# include <llvm/IR/Module.h>
+# include <llvm/Passes/PassBuilder.h>
+# include <llvm/Support/raw_ostream.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+namespace
+{
+    namespace llvm_jit = ::uwvm2::runtime::compiler::llvm_jit::compile_all_from_uwvm;
+
+    // (module
+    //   (memory 1)
+    //   (func $hot (param i32) (result i32)
+    //     local.get 0
+    //     if (result i32) i32.const 1 else i32.const 2 end
+    //     drop
+    //     block
+    //       loop
+    //         local.get 0 local.get 0 local.get 0 i32.mul i32.store
+    //         local.get 0 i32.const 4 i32.sub local.tee 0 i32.const 0 i32.le_s
+    //         br_if 1
+    //         br 0
+    //       end
+    //     end
+    //     block block local.get 0 br_table 0 1 0 end end
+    //     local.get 0)
+    //   (func (export "_start") i32.const 64 call $hot drop))
+    //
+    // `$hot` has one site of each profiled shape: `if`, `br_if` and `br_table`.
+    inline constexpr ::std::array<unsigned char, 112uz> profiled_branches_wasm{
+        0x00u, 0x61u, 0x73u, 0x6du, 0x01u, 0x00u, 0x00u, 0x00u, 0x01u, 0x09u, 0x02u, 0x60u, 0x01u, 0x7fu, 0x01u, 0x7fu, 0x60u, 0x00u, 0x00u,
+        0x03u, 0x03u, 0x02u, 0x00u, 0x01u, 0x05u, 0x03u, 0x01u, 0x00u, 0x01u, 0x07u, 0x0au, 0x01u, 0x06u, 0x5fu, 0x73u, 0x74u, 0x61u, 0x72u,
+        0x74u, 0x00u, 0x01u, 0x0au, 0x45u, 0x02u, 0x3au, 0x00u, 0x20u, 0x00u, 0x04u, 0x7fu, 0x41u, 0x01u, 0x05u, 0x41u, 0x02u, 0x0bu, 0x1au,
+        0x02u, 0x40u, 0x03u, 0x40u, 0x20u, 0x00u, 0x20u, 0x00u, 0x20u, 0x00u, 0x6cu, 0x36u, 0x02u, 0x00u, 0x20u, 0x00u, 0x41u, 0x04u, 0x6bu,
+        0x22u, 0x00u, 0x41u, 0x00u, 0x4cu, 0x0du, 0x01u, 0x0cu, 0x00u, 0x0bu, 0x0bu, 0x02u, 0x40u, 0x02u, 0x40u, 0x20u, 0x00u, 0x0eu, 0x02u,
+        0x00u, 0x01u, 0x00u, 0x0bu, 0x0bu, 0x20u, 0x00u, 0x0bu, 0x08u, 0x00u, 0x41u, 0xc0u, 0x00u, 0x10u, 0x00u, 0x1au, 0x0bu};
+
+    [[nodiscard]] ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const*
+        build_runtime_module(::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t const& feature_parameter)
+    {
+        auto const* begin{reinterpret_cast<::std::byte const*>(profiled_branches_wasm.data())};
+        auto const* end{begin + profiled_branches_wasm.size()};
+
+        ::uwvm2::parser::wasm::base::error_impl parse_err{};
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_module_storage_t parsed_module_storage{};
+        try
+        {
+            parsed_module_storage = ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(begin, end, parse_err, feature_parameter);
+        }
+        catch(::fast_io::error const&)
+        {
+            return nullptr;
+        }
+
+        ::uwvm2::uwvm::io::show_verbose = false;
+        ::uwvm2::uwvm::io::show_depend_warning = false;
+
+        ::uwvm2::uwvm::wasm::storage::execute_wasm = ::uwvm2::uwvm::wasm::type::wasm_file_t{1u};
+        ::uwvm2::uwvm::wasm::storage::execute_wasm.file_name = u8"pgo.wasm";
+        ::uwvm2::uwvm::wasm::storage::execute_wasm.module_name = u8"pgo";
+        ::uwvm2::uwvm::wasm::storage::execute_wasm.binfmt_ver = 1u;
+        ::uwvm2::uwvm::wasm::storage::execute_wasm.wasm_parameter.binfmt1_para = feature_parameter;
+        ::uwvm2::uwvm::wasm::storage::execute_wasm.wasm_module_storage.wasm_binfmt_ver1_storage = ::std::move(parsed_module_storage);
+
+        if(::uwvm2::uwvm::wasm::loader::construct_all_module_and_check_duplicate_module() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok)
+        {
+            return nullptr;
+        }
+        if(::uwvm2::uwvm::wasm::loader::check_import_exist_and_detect_cycles() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok)
+        {
+            return nullptr;
+        }
+
+        // Only the per-module runtime record is needed to emit IR; nothing here is executed.
+        ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.clear();
+        ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.reserve(1uz);
+
+        ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t rt{};
+        ::uwvm2::uwvm::runtime::initializer::details::current_initializing_module_name = u8"pgo";
+        ::uwvm2::uwvm::runtime::initializer::details::initialize_from_wasm_file(::uwvm2::uwvm::wasm::storage::execute_wasm, rt);
+        ::uwvm2::uwvm::runtime::initializer::details::current_initializing_module_name = {};
+        ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.try_emplace(u8"pgo", ::std::move(rt));
+
+        auto it{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(u8"pgo")};
+        if(it == ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.end()) { return nullptr; }
+        return ::std::addressof(it->second);
+    }
+
+    [[nodiscard]] llvm_jit::full_function_symbol_t
+        compile_with_profile(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
+                             ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t const& feature_parameter,
+                             ::uwvm2::utils::container::vector<llvm_jit::llvm_jit_function_profile_t>& profiles,
+                             llvm_jit::llvm_jit_profile_mode_t profile_mode)
+    {
+        ::uwvm2::validation::error::code_validation_error_impl err{};
+        llvm_jit::compile_option opt{};
+        opt.validator_feature_parameter = ::std::addressof(feature_parameter);
+        opt.function_profiles = profiles.data();
+        opt.function_profile_count = profiles.size();
+        opt.profile_mode = profile_mode;
+
+        auto compiled{llvm_jit::compile_all_from_uwvm(runtime_module, opt, err, 0uz)};
+        if(profile_mode == llvm_jit::llvm_jit_profile_mode_t::apply && compiled.llvm_jit_module.llvm_module != nullptr)
+        {
+            // Same as the tier-2 full compile: the summary is attached after emission, before the pipeline runs.
+            llvm_jit::details::attach_runtime_llvm_jit_profile_summary(*compiled.llvm_jit_module.llvm_module, profiles.data(), profiles.size());
+        }
+        return compiled;
+    }
+
+    [[nodiscard]] ::std::string print_module(::llvm::Module const& module)
+    {
+        ::std::string text{};
+        ::llvm::raw_string_ostream stream{text};
+        module.print(stream, nullptr);
+        stream.flush();
+        return text;
+    }
+
+    [[nodiscard]] bool has_entry_count(::llvm::Module const& module)
+    {
+        for(auto const& function: module)
+        {
+            if(function.isDeclaration()) { continue; }
+            auto const entry_count{function.getEntryCount()};
+            if(entry_count.has_value() && entry_count->getCount() != 0u) { return true; }
+        }
+        return false;
+    }
+
+    void run_pass_builder_pipeline(::llvm::Module& module, ::llvm::OptimizationLevel opt_level)
+    {
+        ::llvm::LoopAnalysisManager loop_analysis_manager{};
+        ::llvm::FunctionAnalysisManager function_analysis_manager{};
+        ::llvm::CGSCCAnalysisManager cgscc_analysis_manager{};
+        ::llvm::ModuleAnalysisManager module_analysis_manager{};
+        ::llvm::PassBuilder pass_builder{};
+
+        pass_builder.registerModuleAnalyses(module_analysis_manager);
+        pass_builder.registerCGSCCAnalyses(cgscc_analysis_manager);
+        pass_builder.registerFunctionAnalyses(function_analysis_manager);
+        pass_builder.registerLoopAnalyses(loop_analysis_manager);
+        pass_builder.crossRegisterProxies(loop_analysis_manager, function_analysis_manager, cgscc_analysis_manager, module_analysis_manager);
+
+        auto module_pass_manager{pass_builder.buildPerModuleDefaultPipeline(opt_level)};
+        module_pass_manager.run(module, module_analysis_manager);
+    }
+
+    [[nodiscard]] int check_profile_metadata(::llvm::Module const& module, ::std::string_view stage)
+    {
+        auto const ir{print_module(module)};
+        int failures{};
+        if(ir.find("!prof") == ::std::string::npos || ir.find("\"branch_weights\"") == ::std::string::npos)
+        {
+            ::std::cerr << stage << ": no !prof branch weights in tier-2 IR\n";
+            ++failures;
+        }
+        if(!has_entry_count(module) || ir.find("\"function_entry_count\"") == ::std::string::npos)
+        {
+            ::std::cerr << stage << ": no function entry count in tier-2 IR\n";
+            ++failures;
+        }
+        if(module.getProfileSummary(false) == nullptr)
+        {
+            ::std::cerr << stage << ": no instrumentation ProfileSummary in tier-2 IR\n";
+            ++failures;
+        }
+        if(failures != 0) { ::std::cerr << ir << '\n'; }
+        return failures;
+    }
+}  // namespace
+
+int main()
+{
+    ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t feature_parameter{};
+    auto const* runtime_module{build_runtime_module(feature_parameter)};
+    if(runtime_module == nullptr)
+    {
+        ::std::cerr << "failed to build the runtime module\n";
+        return 1;
+    }
+
+    auto const local_func_count{runtime_module->local_defined_function_vec_storage.size()};
+    ::uwvm2::utils::container::vector<llvm_jit::llvm_jit_function_profile_t> profiles{};
+    profiles.resize(local_func_count);
+
+    // Tier 1 sizes the counter arrays the first time it emits a function in collection mode.
+    {
+        auto const collected{compile_with_profile(*runtime_module, feature_parameter, profiles, llvm_jit::llvm_jit_profile_mode_t::collect)};
+        if(collected.local_funcs.size() != local_func_count)
+        {
+            ::std::cerr << "collection-mode compile failed\n";
+            return 1;
+        }
+    }
+
+    // Stand in for tier-1 execution: every edge gets a distinct, skewed count, the function entry slot included.
+    for(auto& profile: profiles)
+    {
+        if(profile.counters.empty())
+        {
+            ::std::cerr << "collection-mode compile did not size the counters\n";
+            return 1;
+        }
+        for(::std::size_t slot{}; slot != profile.counters.size(); ++slot)
+        {
+            profile.counters.index_unchecked(slot) = (slot % 2uz == 0uz) ? 1000uz + slot : 1uz;
+        }
+    }
+
+    struct pipeline_case_t
+    {
+        char const* name;
+        ::llvm::OptimizationLevel opt_level;
+    };
+
+    pipeline_case_t const pipelines[]{
+        {"pb-o2", ::llvm::OptimizationLevel::O2},
+        {"pb-o3", ::llvm::OptimizationLevel::O3},
+    };
+
+    int failures{};
+    for(auto const& pipeline: pipelines)
+    {
+        auto applied{compile_with_profile(*runtime_module, feature_parameter, profiles, llvm_jit::llvm_jit_profile_mode_t::apply)};
+        if(applied.local_funcs.size() != local_func_count || applied.llvm_jit_module.llvm_module == nullptr)
+        {
+            ::std::cerr << pipeline.name << ": application-mode compile failed\n";
+            return 1;
+        }
+
+        auto& module{*applied.llvm_jit_module.llvm_module};
+        failures += check_profile_metadata(module, ::std::string{pipeline.name} + " (emitted)");
+
+        // The profile has to reach the passes that consume it, not just the emitted IR.
+        run_pass_builder_pipeline(module, pipeline.opt_level);
+        failures += check_profile_metadata(module, ::std::string{pipeline.name} + " (optimized)");
+    }
+
+    // Without a profile the same module carries none of this metadata.
+    {
+        ::uwvm2::utils::container::vector<llvm_jit::llvm_jit_function_profile_t> no_profiles{};
+        auto plain{compile_with_profile(*runtime_module, feature_parameter, no_profiles, llvm_jit::llvm_jit_profile_mode_t::none)};
+        if(plain.llvm_jit_module.llvm_module == nullptr)
+        {
+            ::std::cerr << "unprofiled compile failed\n";
+            return 1;
+        }
+        auto const ir{print_module(*plain.llvm_jit_module.llvm_module)};
+        if(ir.find("\"branch_weights\"") != ::std::string::npos || ir.find("\"function_entry_count\"") != ::std::string::npos)
+        {
+            ::std::cerr << "unprofiled compile emitted profile metadata\n";
+            ++failures;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -14,6 +14,8 @@ namespace
     {
         char const* name;
         char const* wat_name;
+        // When set, every mode must also report this trap kind.  Self-checking fixtures trap with a different kind on a wrong result.
+        char const* expected_trap;
     };
 
     struct mode_t
@@ -31,25 +33,29 @@ namespace
     };
 
     inline constexpr ::std::array fixtures{
-        fixture_t{"oob_load",                        "oob_load.wat"                       },
-        fixture_t{"oob_store",                       "oob_store.wat"                      },
-        fixture_t{"oob_load8_s",                     "oob_load8_s.wat"                    },
-        fixture_t{"oob_store64",                     "oob_store64.wat"                    },
-        fixture_t{"divide_zero",                     "divide_zero.wat"                    },
-        fixture_t{"i32_divide_zero_u",               "i32_divide_zero_u.wat"              },
-        fixture_t{"i64_divide_zero",                 "i64_divide_zero.wat"                },
-        fixture_t{"integer_overflow",                "integer_overflow.wat"               },
-        fixture_t{"i64_integer_overflow",            "i64_integer_overflow.wat"           },
-        fixture_t{"invalid_conversion",              "invalid_conversion.wat"             },
-        fixture_t{"invalid_conversion_u32_nan",      "invalid_conversion_u32_nan.wat"     },
-        fixture_t{"invalid_conversion_f64_i64",      "invalid_conversion_f64_i64.wat"     },
-        fixture_t{"invalid_conversion_f32_overflow", "invalid_conversion_f32_overflow.wat"},
-        fixture_t{"invalid_conversion_f64_overflow", "invalid_conversion_f64_overflow.wat"},
-        fixture_t{"invalid_conversion_u64_overflow", "invalid_conversion_u64_overflow.wat"},
-        fixture_t{"unreachable",                     "unreachable.wat"                    },
-        fixture_t{"call_indirect_null",              "call_indirect_null.wat"             },
-        fixture_t{"call_indirect_oob",               "call_indirect_oob.wat"              },
-        fixture_t{"call_indirect_type",              "call_indirect_type.wat"             },
+        fixture_t{"oob_load",                        "oob_load.wat",                        nullptr            },
+        fixture_t{"oob_store",                       "oob_store.wat",                       nullptr            },
+        fixture_t{"oob_load8_s",                     "oob_load8_s.wat",                     nullptr            },
+        fixture_t{"oob_store64",                     "oob_store64.wat",                     nullptr            },
+        fixture_t{"divide_zero",                     "divide_zero.wat",                     nullptr            },
+        fixture_t{"i32_divide_zero_u",               "i32_divide_zero_u.wat",               nullptr            },
+        fixture_t{"i64_divide_zero",                 "i64_divide_zero.wat",                 nullptr            },
+        fixture_t{"integer_overflow",                "integer_overflow.wat",                nullptr            },
+        fixture_t{"i64_integer_overflow",            "i64_integer_overflow.wat",            nullptr            },
+        fixture_t{"invalid_conversion",              "invalid_conversion.wat",              nullptr            },
+        fixture_t{"invalid_conversion_u32_nan",      "invalid_conversion_u32_nan.wat",      nullptr            },
+        fixture_t{"invalid_conversion_f64_i64",      "invalid_conversion_f64_i64.wat",      nullptr            },
+        fixture_t{"invalid_conversion_f32_overflow", "invalid_conversion_f32_overflow.wat", nullptr            },
+        fixture_t{"invalid_conversion_f64_overflow", "invalid_conversion_f64_overflow.wat", nullptr            },
+        fixture_t{"invalid_conversion_u64_overflow", "invalid_conversion_u64_overflow.wat", nullptr            },
+        fixture_t{"unreachable",                     "unreachable.wat",                     nullptr            },
+        fixture_t{"call_indirect_null",              "call_indirect_null.wat",              nullptr            },
+        fixture_t{"call_indirect_oob",               "call_indirect_oob.wat",               nullptr            },
+        fixture_t{"call_indirect_type",              "call_indirect_type.wat",              nullptr            },
+        fixture_t{"simd_oob_load",                   "simd_oob_load.wat",                   nullptr            },
+        fixture_t{"simd_oob_store",                  "simd_oob_store.wat",                  nullptr            },
+        fixture_t{"simd_oob_load_lane",              "simd_oob_load_lane.wat",              nullptr            },
+        fixture_t{"simd_lane_semantics",             "simd_lane_semantics.wat",             "catch unreachable"},
     };
 
     inline constexpr ::std::array modes{
@@ -369,6 +375,16 @@ int main(int argc, char** argv)
                 continue;
             }
 
+            if(fixture.expected_trap != nullptr && instruction.trap_kind != fixture.expected_trap)
+            {
+                ++mismatch_count;
+                ok = false;
+                ::std::cerr << "[trap-matrix] unexpected trap fixture=" << fixture.name << " mode=" << mode.name << " expected=\"" << fixture.expected_trap
+                            << "\" ";
+                print_result(::std::cerr, instruction);
+                ::std::cerr << '\n';
+            }
+
             for(auto const* policy: compare_policies)
             {
                 auto const compared{run_case(uwvm_path, wasm_path, artifact_dir, fixture, mode, policy)};
@@ -0,0 +1,307 @@
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct devirtualize_case_t
+    {
+        char const* name;
+        char const* args;
+    };
+
+    [[nodiscard]] ::std::string quote_argument(::std::filesystem::path const& path)
+    {
+        return ::std::string{"\""} + path.string() + "\"";
+    }
+
+    [[nodiscard]] int run_system_command(::std::string const& command)
+    {
+#ifdef _WIN32
+        auto const wrapped{::std::string{"cmd.exe /S /C \""} + command + "\""};
+        return ::std::system(wrapped.c_str());
+#else
+        return ::std::system(command.c_str());
+#endif
+    }
+
+    [[nodiscard]] bool command_succeeds(::std::string const& command)
+    {
+        return run_system_command(command) == 0;
+    }
+
+    [[nodiscard]] bool read_text_file(::std::filesystem::path const& path, ::std::string& text)
+    {
+        ::std::ifstream input(path);
+        if(!input)
+        {
+            ::std::cerr << "failed to open text file: " << path << '\n';
+            return false;
+        }
+
+        text.assign(::std::istreambuf_iterator<char>{input}, ::std::istreambuf_iterator<char>{});
+        if(input.bad())
+        {
+            ::std::cerr << "failed to read text file: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool write_text_file(::std::filesystem::path const& path, ::std::string_view text)
+    {
+        ::std::error_code ec{};
+        ::std::filesystem::create_directories(path.parent_path(), ec);
+        if(ec)
+        {
+            ::std::cerr << "failed to create output directory: " << path.parent_path() << '\n';
+            return false;
+        }
+
+        ::std::ofstream output(path, ::std::ios::binary | ::std::ios::trunc);
+        if(!output)
+        {
+            ::std::cerr << "failed to open text output: " << path << '\n';
+            return false;
+        }
+
+        output.write(text.data(), static_cast<::std::streamsize>(text.size()));
+        if(!output)
+        {
+            ::std::cerr << "failed to write text output: " << path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_parent_with(::std::filesystem::path dir, ::std::filesystem::path const& child)
+    {
+        for(;;)
+        {
+            if(::std::filesystem::exists(dir / child)) { return dir; }
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_uwvm_binary(::std::filesystem::path dir)
+    {
+        for(;;)
+        {
+            auto const candidate{dir / "uwvm"};
+            if(::std::filesystem::exists(candidate)) { return candidate; }
+#ifdef _WIN32
+            auto const windows_candidate{dir / "uwvm.exe"};
+            if(::std::filesystem::exists(windows_candidate)) { return windows_candidate; }
+#endif
+            if(dir == dir.root_path()) { return {}; }
+            dir = dir.parent_path();
+        }
+    }
+
+    [[nodiscard]] ::std::filesystem::path find_wat2wasm(::std::filesystem::path const& project_root)
+    {
+        if(auto const env{::std::getenv("WAT2WASM")}; env != nullptr && *env != '\0')
+        {
+            ::std::filesystem::path const p{env};
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        constexpr char const* name{"wat2wasm.exe"};
+#else
+        constexpr char const* name{"wat2wasm"};
+#endif
+        ::std::array candidates{
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "bin" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build" / "Release" / name,
+            project_root / "build" / "test" / "third-parties" / "wabt" / "build-ninja" / name,
+            project_root / "wabt" / "build" / name,
+            project_root / "wabt" / "build" / "bin" / name,
+            project_root / "wabt" / "build" / "Release" / name,
+            project_root / "wabt" / "build-ninja" / name,
+        };
+
+        for(auto const& p: candidates)
+        {
+            if(::std::filesystem::exists(p)) { return p; }
+        }
+
+#ifdef _WIN32
+        if(command_succeeds("wat2wasm --version > NUL 2>&1")) { return "wat2wasm"; }
+#else
+        if(command_succeeds("wat2wasm --version > /dev/null 2>&1")) { return "wat2wasm"; }
+#endif
+        return {};
+    }
+
+    // `$dispatch` holds the only `call_indirect`.  Each round first makes `$one` the overwhelming majority target of that
+    // site, then swaps table slot 0 to `$two` for a few calls.  Once Tier 2 has speculated on `$one`, every swap has to
+    // miss the guard and still reach `$two`; a wrong result traps.
+    inline constexpr ::std::string_view devirtualize_wat{R"((module
+  (type $v (func))
+  (type $r (func (result i32)))
+  (type $d (func (param i32) (result i32)))
+  (table 2 funcref)
+  (elem (i32.const 0) func $one $two)
+
+  (func $one (type $r) i32.const 1)
+  (func $two (type $r) i32.const 2)
+
+  (func $dispatch (type $d) (param $slot i32) (result i32)
+    local.get $slot
+    call_indirect (type $r))
+
+  (func $run (param $calls i32) (param $expected i32)
+    block $exit
+      loop $call_loop
+        local.get $calls
+        i32.eqz
+        br_if $exit
+        i32.const 0
+        call $dispatch
+        local.get $expected
+        i32.ne
+        if
+          unreachable
+        end
+        local.get $calls
+        i32.const 1
+        i32.sub
+        local.set $calls
+        br $call_loop
+      end
+    end)
+
+  (func $_start (export "_start") (type $v)
+    (local $round i32)
+    loop $rounds
+      i32.const 200000
+      i32.const 1
+      call $run
+
+      i32.const 0
+      ref.func $two
+      table.set 0
+      i32.const 16
+      i32.const 2
+      call $run
+
+      i32.const 0
+      ref.func $one
+      table.set 0
+
+      local.get $round
+      i32.const 1
+      i32.add
+      local.tee $round
+      i32.const 20
+      i32.lt_u
+      br_if $rounds
+    end))
+)"};
+
+    // The miss path is only exercised once Tier 2 published the speculated code, so the run must report it.
+    inline constexpr ::std::string_view required_log_pattern{"[llvm-jit-lazy] tiered-full-ready"};
+
+    [[nodiscard]] bool run_case(::std::filesystem::path const& uwvm_path,
+                                ::std::filesystem::path const& wasm_path,
+                                ::std::filesystem::path const& artifact_dir,
+                                devirtualize_case_t const& test_case)
+    {
+        auto const output_path{artifact_dir / (::std::string{test_case.name} + ".out")};
+        auto const log_path{artifact_dir / (::std::string{test_case.name} + ".log")};
+        auto const command{quote_argument(uwvm_path) + " " + test_case.args + " -Rclog file " + quote_argument(log_path) + " --run " +
+                           quote_argument(wasm_path) + " > " + quote_argument(output_path) + " 2>&1"};
+        ::std::cout << "[tiered-pgo-devirtualize] " << command << '\n';
+
+        if(run_system_command(command) != 0)
+        {
+            ::std::cerr << "dispatch after table.set went wrong for " << test_case.name << "; output=" << output_path << '\n';
+            return false;
+        }
+
+        ::std::string log{};
+        if(!read_text_file(log_path, log)) { return false; }
+        if(log.find(required_log_pattern) == ::std::string::npos)
+        {
+            ::std::cerr << "missing required log pattern for " << test_case.name << ": " << required_log_pattern << "\n  log=" << log_path << '\n';
+            return false;
+        }
+
+        return true;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc <= 0 || argv == nullptr || argv[0] == nullptr)
+    {
+        ::std::cerr << "missing argv[0]\n";
+        return 1;
+    }
+
+    auto const executable{::std::filesystem::absolute(argv[0])};
+    auto const executable_dir{executable.parent_path()};
+    auto const project_root{find_parent_with(executable_dir, "xmake.lua")};
+    if(project_root.empty())
+    {
+        ::std::cerr << "failed to locate project root from " << executable << '\n';
+        return 1;
+    }
+
+    auto const uwvm_path{find_uwvm_binary(executable_dir)};
+    if(uwvm_path.empty())
+    {
+        ::std::cerr << "failed to locate uwvm next to test executable: " << executable << '\n';
+        return 1;
+    }
+
+    auto const wat2wasm_path{find_wat2wasm(project_root)};
+    if(wat2wasm_path.empty())
+    {
+        ::std::cout << "[tiered-pgo-devirtualize] skip: wat2wasm not found; set WAT2WASM or put wat2wasm in PATH\n";
+        return 0;
+    }
+
+    auto const artifact_dir{executable_dir / "test-artifacts" / "0014.llvm_jit" / "tiered_pgo_devirtualize_wat"};
+    auto const wat_path{artifact_dir / "devirtualize.wat"};
+    auto const wasm_path{artifact_dir / "devirtualize.wasm"};
+    if(!write_text_file(wat_path, devirtualize_wat)) { return 1; }
+
+    auto const compile_command{quote_argument(wat2wasm_path) + " " + quote_argument(wat_path) + " -o " + quote_argument(wasm_path)};
+    ::std::cout << "[tiered-pgo-devirtualize] " << compile_command << '\n';
+    if(!command_succeeds(compile_command))
+    {
+        ::std::cerr << "wat2wasm failed for " << wat_path << '\n';
+        return 1;
+    }
+
+    ::std::vector<devirtualize_case_t> const cases{
+        {"pb_o2", "--wasm-feature-wasm1.1 -Rllvm-cache-path disable -Rtiered -Rct 2 -Rllvm-full-policy pb-o2 -Rtiered-pgo"},
+        {"pb_o3", "--wasm-feature-wasm1.1 -Rllvm-cache-path disable -Rtiered -Rct 2 -Rllvm-full-policy pb-o3 -Rtiered-pgo"},
+    };
+
+    bool ok{true};
+    for(auto const& test_case: cases)
+    {
+        if(!run_case(uwvm_path, wasm_path, artifact_dir, test_case)) { ok = false; }
+    }
+
+    if(ok)
+    {
+        ::std::cout << "[tiered-pgo-devirtualize] guard misses dispatched to the replaced table element\n";
+        return 0;
+    }
+
+    return 1;
+}
@@ -0,0 +1,188 @@
+(module
+  (type $v (func))
+  (memory 1)
+  (global $g (mut v128) (v128.const i64x2 7 9))
+
+  ;; A lane result that disagrees with the scalar expectation traps with a different kind and stack.
+  (func $mismatch (type $v)
+    i32.const 1
+    i32.const 0
+    i32.div_u
+    drop)
+
+  (func $done (type $v) unreachable)
+
+  (func $check (type $v)
+    (local $a v128)
+    (local $b v128)
+    v128.const i32x4 1 2 3 4
+    local.set $a
+    v128.const i32x4 10 20 30 40
+    local.set $b
+
+    ;; integer lane arithmetic
+    local.get $a
+    local.get $b
+    i32x4.add
+    i32x4.extract_lane 3
+    i32.const 44
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    ;; byte shuffle: reversing the bytes of $a puts 0x04 in the top byte of lane 0
+    local.get $a
+    local.get $b
+    i8x16.shuffle 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1 0
+    i32x4.extract_lane 0
+    i32.const 0x04000000
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    ;; float lane arithmetic
+    v128.const f32x4 1.5 2 3 4
+    f32.const 2
+    f32x4.splat
+    f32x4.mul
+    f32x4.extract_lane 0
+    f32.const 3
+    f32.ne
+    if
+      call $mismatch
+    end
+
+    ;; saturating narrow-lane arithmetic and sign-extending extraction
+    i32.const 100
+    i8x16.splat
+    i32.const 100
+    i8x16.splat
+    i8x16.add_sat_s
+    i8x16.extract_lane_s 5
+    i32.const 127
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    ;; bitmask keeps lane 0 in bit 0
+    v128.const i32x4 -1 0 -1 0
+    i32x4.bitmask
+    i32.const 5
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    local.get $a
+    i32x4.all_true
+    i32.eqz
+    if
+      call $mismatch
+    end
+
+    ;; shift counts are taken modulo the lane width
+    local.get $a
+    i32.const 33
+    i32x4.shl
+    i32x4.extract_lane 2
+    i32.const 6
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    ;; lane-wise compare produces masks
+    local.get $a
+    local.get $b
+    i32x4.gt_s
+    v128.any_true
+    if
+      call $mismatch
+    end
+
+    ;; saturating narrow
+    v128.const i32x4 70000 -70000 1 2
+    v128.const i32x4 0 0 0 0
+    i16x8.narrow_i32x4_s
+    i16x8.extract_lane_s 1
+    i32.const -32768
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    ;; conversions, including the saturating NaN/overflow lanes
+    local.get $a
+    f32x4.convert_i32x4_s
+    f32x4.extract_lane 3
+    f32.const 4
+    f32.ne
+    if
+      call $mismatch
+    end
+
+    v128.const f32x4 nan 3e9 -3e9 1.9
+    i32x4.trunc_sat_f32x4_s
+    local.tee $b
+    i32x4.extract_lane 0
+    if
+      call $mismatch
+    end
+
+    local.get $b
+    i32x4.extract_lane 1
+    i32.const 2147483647
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    ;; memory forms
+    i32.const 16
+    v128.const i32x4 10 20 30 40
+    v128.store
+    i32.const 28
+    i32.load
+    i32.const 40
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    i32.const 16
+    v128.load32_splat
+    i32x4.extract_lane 2
+    i32.const 10
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    ;; v128 block results, select and globals
+    block (result v128)
+      local.get $a
+    end
+    v128.const i32x4 10 20 30 40
+    i32.const 0
+    select
+    i32x4.extract_lane 0
+    i32.const 10
+    i32.ne
+    if
+      call $mismatch
+    end
+
+    global.get $g
+    i64x2.extract_lane 1
+    i64.const 9
+    i64.ne
+    if
+      call $mismatch
+    end
+
+    call $done)
+
+  (func $_start (export "_start") (type $v) call $check))
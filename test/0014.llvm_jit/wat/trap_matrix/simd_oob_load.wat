@@ -0,0 +1,12 @@
+(module
+  (type $v (func))
+  (memory 1)
+
+  (func $leaf (type $v)
+    i32.const 65530
+    v128.load
+    drop)
+
+  (func $mid (type $v) call $leaf)
+  (func $top (type $v) call $mid)
+  (func $_start (export "_start") (type $v) call $top))
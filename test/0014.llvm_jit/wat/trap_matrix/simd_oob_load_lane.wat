@@ -0,0 +1,13 @@
+(module
+  (type $v (func))
+  (memory 1)
+
+  (func $leaf (type $v)
+    i32.const 65536
+    v128.const i64x2 0 0
+    v128.load8_lane 15
+    drop)
+
+  (func $mid (type $v) call $leaf)
+  (func $top (type $v) call $mid)
+  (func $_start (export "_start") (type $v) call $top))
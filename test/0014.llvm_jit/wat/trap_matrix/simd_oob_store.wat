@@ -0,0 +1,12 @@
+(module
+  (type $v (func))
+  (memory 1)
+
+  (func $leaf (type $v)
+    i32.const -1
+    v128.const i32x4 1 2 3 4
+    v128.store)
+
+  (func $mid (type $v) call $leaf)
+  (func $top (type $v) call $mid)
+  (func $_start (export "_start") (type $v) call $top))
@@ -202,6 +202,11 @@ function def_build(opt)
 		add_defines("UWVM_ENABLE_UWVM_INT_LOOP_UNWIND")
 	end
 
+	local enable_runtime_function_profile = get_config("enable-runtime-function-profile")
+	if enable_runtime_function_profile then
+		add_defines("UWVM_ENABLE_RUNTIME_FUNCTION_PROFILE")
+	end
+
 	local use_thread_local = get_config("use-thread-local")
 	if use_thread_local then
 		add_defines("UWVM_USE_THREAD_LOCAL")
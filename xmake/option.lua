@@ -313,6 +313,17 @@ option("enable-uwvm-int-loop-unwind", function()
     set_default(true)
 end)
 
+option("enable-runtime-function-profile", function()
+    set_description
+    (
+        "Compile in per-function execution profiling (--runtime-function-profile).",
+        "default = false",
+        "    false: compile out the profiling hooks at call boundaries.",
+        "    true: make --runtime-function-profile available; hooks cost one branch per call when the option is not given."
+    )
+    set_default(false)
+end)
+
 option("detailed-debug-check", function()
     set_description
     (